@@ -54,7 +54,10 @@ const int undefined = -2;
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method */
+    defaultDense = 0, /*!< Default: performance-oriented method */
+    kdTreeDense  = 1  /*!< Method that finds the neighborhoods with the kd-tree built for the input data,
+                           suitable for the data of low dimensionality. Finds the same neighborhoods
+                           as defaultDense in the memory saving mode */
 };
 
 /**
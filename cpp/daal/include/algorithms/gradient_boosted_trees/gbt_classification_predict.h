@@ -93,11 +93,12 @@ public:
  *                                                          for the gradient boosted trees prediction algorithm
  *      - \ref classifier::prediction::ModelInputId         Identifiers of input Model objects of the algorithm
  *      - \ref classifier::prediction::ResultId             Identifiers of prediction results
+ *      - \ref ResultId                                     Identifiers of SHAP values
  *
  * \par References
  *      - \ref interface1::Model "Model" class
  *      - \ref classifier::prediction::interface1::Input "classifier::prediction::Input" class
- *      - \ref classifier::prediction::interface1::Result "classifier::prediction::Result" class
+ *      - \ref interface1::Result "Result" class
  */
 template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
 class DAAL_EXPORT Batch : public classifier::prediction::Batch
@@ -107,7 +108,7 @@ public:
 
     typedef algorithms::gbt::classification::prediction::Input InputType;
     typedef algorithms::gbt::classification::prediction::Parameter ParameterType;
-    typedef typename super::ResultType ResultType;
+    typedef algorithms::gbt::classification::prediction::Result ResultType;
 
     InputType input; /*!< %Input objects of the algorithm */
 
@@ -159,12 +160,32 @@ public:
      */
     services::SharedPtr<Batch<algorithmFPType, method> > clone() const { return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl()); }
 
+    /**
+     * Returns the structure that contains computed prediction results
+     * \return Structure that contains computed prediction results
+     */
+    ResultPtr getResult() { return ResultType::cast(_result); }
+
+    /**
+     * Registers user-allocated memory for storing the prediction results
+     * \param[in] result Structure for storing the prediction results
+     *
+     * \return Status of computation
+     */
+    services::Status setResult(const ResultPtr & result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res    = _result.get();
+        return services::Status();
+    }
+
 protected:
     virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Batch<algorithmFPType, method>(*this); }
 
     services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _result->allocate<algorithmFPType>(&input, _par, 0);
+        services::Status s = static_cast<ResultType *>(_result.get())->allocate<algorithmFPType>(&input, _par, 0);
         _res               = _result.get();
         return s;
     }
@@ -173,6 +194,7 @@ protected:
     {
         _in = &input;
         _ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _result.reset(new ResultType());
     }
 
 private:
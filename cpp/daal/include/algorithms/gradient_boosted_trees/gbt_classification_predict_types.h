@@ -56,6 +56,34 @@ enum Method
     defaultDense = 0 /*!< Default method */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__PREDICTION__RESULTTOCOMPUTEID"></a>
+ * \brief Available identifiers to specify the SHAP values to compute in addition to the results
+ *        specified by resultsToEvaluate
+ */
+enum ResultToComputeId
+{
+    computeShapContributions = 0x00000001ULL, /*!< Compute the SHAP feature contributions */
+    computeShapInteractions  = 0x00000002ULL  /*!< Compute the SHAP feature interactions */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__PREDICTION__RESULTID"></a>
+ * \brief Available identifiers of the result of gradient boosted trees model-based prediction.
+ *        SHAP values explain the raw boosted values (log-odds) of the model. They are computed for one output
+ *        in the binary case and for each of nClasses outputs in the multiclass case, the values of the outputs
+ *        are stored one after another in each row of the table
+ */
+enum ResultId
+{
+    prediction        = classifier::prediction::prediction,       /*!< Prediction results */
+    shapContributions = classifier::prediction::lastResultId + 1, /*!< Numeric table of size n x (c * (p + 1)) with the SHAP feature
+                                                                       contributions, the last column of each output is the bias */
+    shapInteractions  = classifier::prediction::lastResultId + 2, /*!< Numeric table of size n x (c * (p + 1)^2) with the SHAP feature
+                                                                       interactions */
+    lastResultId      = shapInteractions
+};
+
 /**
  * \brief Contains version 2.0 of the Intel(R) oneAPI Data Analytics Library interface.
  */
@@ -70,9 +98,10 @@ namespace interface2
 /* [Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
 {
-    Parameter(size_t nClasses = 2) : daal::algorithms::classifier::Parameter(nClasses), nIterations(0) {}
-    Parameter(const Parameter & o) : daal::algorithms::classifier::Parameter(o), nIterations(o.nIterations) {}
-    size_t nIterations; /*!< Number of iterations of the trained model to be used for prediction */
+    Parameter(size_t nClasses = 2) : daal::algorithms::classifier::Parameter(nClasses), nIterations(0), resultsToCompute(0) {}
+    Parameter(const Parameter & o) : daal::algorithms::classifier::Parameter(o), nIterations(o.nIterations), resultsToCompute(o.resultsToCompute) {}
+    size_t nIterations;           /*!< Number of iterations of the trained model to be used for prediction */
+    DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the SHAP values to compute, see ResultToComputeId */
 };
 /* [Parameter source code] */
 } // namespace interface2
@@ -135,9 +164,74 @@ public:
     services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__PREDICTION__RESULT"></a>
+ * \brief Provides interface for the result of gradient boosted trees model-based prediction
+ */
+class DAAL_EXPORT Result : public classifier::prediction::Result
+{
+    typedef classifier::prediction::Result super;
+
+public:
+    DECLARE_SERIALIZABLE_CAST(Result)
+    Result();
+
+    using super::get;
+    using super::set;
+
+    /**
+     * Returns the result of gradient boosted trees model-based prediction
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of gradient boosted trees model-based prediction
+     * \param[in] id      Identifier of the result
+     * \param[in] value   Pointer to the result
+     */
+    void set(ResultId id, const data_management::NumericTablePtr & value);
+
+    /**
+     * Allocates memory for storing prediction results of gradient boosted trees algorithm
+     * \tparam  algorithmFPType     Data type for storing prediction results
+     * \param[in] input     Pointer to the input objects of the classification algorithm
+     * \param[in] parameter Pointer to the parameters of the classification algorithm
+     * \param[in] method    Computation method
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method);
+
+    /**
+     * Checks the correctness of prediction results of gradient boosted trees algorithm
+     * \param[in] input     Pointer to the the input object
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    using super::check;
+
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return super::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+typedef services::SharedPtr<const Result> ResultConstPtr;
+
 } // namespace interface1
 using interface2::Parameter;
 using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+using interface1::ResultConstPtr;
 } // namespace prediction
 /** @} */
 } // namespace classification
@@ -86,8 +86,22 @@ enum ModelInputId
  */
 enum ResultId
 {
-    prediction   = algorithms::regression::prediction::prediction, /*!< Result of gradient boosted trees model-based prediction */
-    lastResultId = prediction
+    prediction        = algorithms::regression::prediction::prediction,       /*!< Result of gradient boosted trees model-based prediction */
+    shapContributions = algorithms::regression::prediction::lastResultId + 1, /*!< Numeric table of size n x (p + 1) with the SHAP feature
+                                                                                   contributions, the last column is the bias */
+    shapInteractions  = algorithms::regression::prediction::lastResultId + 2, /*!< Numeric table of size n x (p + 1)^2 with the SHAP feature
+                                                                                   interactions */
+    lastResultId      = shapInteractions
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSSION__PREDICTION__RESULTTOCOMPUTEID"></a>
+ * \brief Available identifiers to specify the optional results to compute, the prediction is always computed
+ */
+enum ResultToComputeId
+{
+    computeShapContributions = 0x00000001ULL, /*!< Compute the SHAP feature contributions */
+    computeShapInteractions  = 0x00000002ULL  /*!< Compute the SHAP feature interactions */
 };
 
 /**
@@ -104,9 +118,10 @@ namespace interface1
 /* [Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
-    Parameter() : daal::algorithms::Parameter(), nIterations(0) {}
-    Parameter(const Parameter & o) : daal::algorithms::Parameter(o), nIterations(o.nIterations) {}
-    size_t nIterations; /*!< Number of iterations of the trained model to be uses for prediction*/
+    Parameter() : daal::algorithms::Parameter(), nIterations(0), resultsToCompute(0) {}
+    Parameter(const Parameter & o) : daal::algorithms::Parameter(o), nIterations(o.nIterations), resultsToCompute(o.resultsToCompute) {}
+    size_t nIterations;           /*!< Number of iterations of the trained model to be uses for prediction*/
+    DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the optional results to compute, see ResultToComputeId */
 };
 /* [Parameter source code] */
 
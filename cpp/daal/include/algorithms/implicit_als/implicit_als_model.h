@@ -65,7 +65,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      * \param[in] preferenceThreshold Threshold used to define preference values
      */
     Parameter(size_t nFactors = 10, size_t maxIterations = 5, double alpha = 40.0, double lambda = 0.01, double preferenceThreshold = 0.0)
-        : nFactors(nFactors), maxIterations(maxIterations), alpha(alpha), lambda(lambda), preferenceThreshold(preferenceThreshold)
+        : nFactors(nFactors), maxIterations(maxIterations), alpha(alpha), lambda(lambda), preferenceThreshold(preferenceThreshold), nCGIterations(0)
     {}
 
     size_t nFactors;            /*!< Number of factors */
@@ -73,6 +73,10 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     double alpha;               /*!< Confidence parameter of the implicit ALS training algorithm */
     double lambda;              /*!< Regularization parameter */
     double preferenceThreshold; /*!< Threshold used to define preference values */
+    size_t nCGIterations;       /*!< Number of conjugate gradient iterations used to solve the system of normal equations
+                                     for each user and item. In the batch processing mode, the iterations start from the factors
+                                     computed at the previous iteration of the training algorithm. In the distributed processing
+                                     mode, the iterations start from zero factors. If 0, the systems are solved directly */
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
@@ -50,7 +50,11 @@ enum Method
 {
     lloydDense   = 0, /*!< Default: performance-oriented method, synonym of defaultDense */
     defaultDense = 0, /*!< Default: performance-oriented method, synonym of lloydDense */
-    lloydCSR     = 1  /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydCSR     = 1, /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    hamerlyDense = 2  /*!< Lloyd algorithm that skips the distance computations by the triangle inequality bounds of the Hamerly
+                           algorithm. Gives the same assignments and centroids as lloydDense, faster when the clustering is close
+                           to convergence. Available in the batch processing mode only. With the positive accuracy threshold no
+                           distance is skipped, so that the objective function and the number of iterations are also the same */
 };
 
 /**
@@ -58,7 +58,9 @@ enum InputId
     argument = (int)sum_of_functions::argument, /*!< Numeric table of size 1 x p with input argument of the objective function */
     data,                                       /*!< Numeric table of size n x p with data */
     dependentVariables,                         /*!< Numeric table of size n x 1 with dependent variables */
-    lastInputId = dependentVariables
+    hessianVector,                              /*!< Numeric table of size 1 x p with the vector the hessian is multiplied by,
+                                                     required if hessianVectorProduct is computed */
+    lastInputId = hessianVector
 };
 
 /**
@@ -78,7 +78,9 @@ enum ResultToComputeId
     componentOfHessianDiagonal =
         0x00000080ULL, /*!< Numeric table of size 1 x nDependentVariable with the dioganal element of hession matrix over certain feature of the objective function in the given argument */
     componentOfProximalProjection =
-        0x00000100ULL /*!< Numeric table of size p x nDependentVariable with proximal projection of certain of the objective function in the given argument */
+        0x00000100ULL, /*!< Numeric table of size p x nDependentVariable with proximal projection of certain of the objective function in the given argument */
+    hessianVectorProduct =
+        0x00000200ULL /*!< Numeric table of size 1 x p with the product of the hessian of the objective function in the given argument and the input vector */
 };
 
 /**
@@ -96,7 +98,8 @@ enum ResultId
     componentOfGradientIdx,           /*!< Index of the componentOfGradient numeric table in the result collection */
     componentOfHessianDiagonalIdx,    /*!< Index of the componentOfHessianDiagonal numeric table in the result collection */
     componentOfProximalProjectionIdx, /*!< Index of the componentOfProximalProjection numeric table in the result collection */
-    lastResultId = componentOfProximalProjectionIdx
+    hessianVectorProductIdx,          /*!< Index of the hessianVectorProduct numeric table in the result collection */
+    lastResultId = hessianVectorProductIdx
 };
 
 /**
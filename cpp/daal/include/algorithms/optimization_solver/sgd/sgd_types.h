@@ -160,6 +160,15 @@ struct DAAL_EXPORT Parameter<defaultDense> : public BaseParameter
     virtual services::Status check() const;
 
     virtual ~Parameter() {}
+
+    /* asynchronous and nStreams were appended in this release and change the size of the structure,
+       so the binaries that create it must be rebuilt with these headers */
+    bool asynchronous; /*!< If true, the terms are processed by all threads available to the library concurrently,
+                            and the threads update the argument without locks */
+    size_t nStreams;   /*!< Number of independent streams of term indices in the asynchronous mode.
+                            If 0, the chunks of a single sequence of indices are distributed among the threads dynamically.
+                            Otherwise, each stream is generated by its own engine derived from the engine of the parameter
+                            and processed by one thread, so the order of the terms in a stream does not depend on the number of threads */
 };
 /* [ParameterDefaultDense source code] */
 
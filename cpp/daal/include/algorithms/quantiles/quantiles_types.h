@@ -47,7 +47,8 @@ namespace quantiles
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method. Works with all types of input numeric tables */
+    defaultDense = 0 /*!< Default: performance-oriented method. Works with all types of input numeric tables.
+                          In the online and distributed processing modes it maintains a mergeable quantile sketch */
 };
 
 /**
@@ -70,6 +71,27 @@ enum ResultId
     lastResultId = quantiles
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the quantiles algorithm
+ */
+enum PartialResultId
+{
+    sketchLevels, /*!< Sizes of the levels of the sketch and the offsets of their next compactions, shared by all features */
+    sketchItems,  /*!< Values retained by the sketch for each feature */
+    lastPartialResultId = sketchItems
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__MASTERINPUTID"></a>
+ * \brief Available identifiers of input objects for the quantiles algorithm on the master node
+ */
+enum MasterInputId
+{
+    partialResults, /*!< Collection of partial results computed on local nodes */
+    lastMasterInputId = partialResults
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) oneAPI Data Analytics Library interface.
  */
@@ -83,13 +105,32 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
     Parameter(const data_management::NumericTablePtr quantileOrders = data_management::NumericTablePtr());
     data_management::NumericTablePtr quantileOrders; /*!< Numeric table with quantile orders. Default value is 0.5 (median) */
+    double accuracy;                                 /*!< Target rank error of the quantiles computed in the online and distributed
+                                                          processing modes, in the (0, 1) range. Default value is 0.01.
+                                                          The sketch keeps at most about 10 / accuracy values per feature.
+                                                          Not used in the batch processing mode */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__INPUTIFACE"></a>
+ * \brief Abstract class that specifies interface of the input objects for the quantiles algorithm
+ */
+class InputIface : public daal::algorithms::Input
+{
+public:
+    InputIface(size_t nElements) : daal::algorithms::Input(nElements) {}
+    InputIface(const InputIface & other) : daal::algorithms::Input(other) {}
+    virtual services::Status getNumberOfColumns(size_t & nCols) const = 0;
+    virtual ~InputIface() {}
 };
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__INPUT"></a>
  * \brief %Input objects for the quantiles algorithm
  */
-class DAAL_EXPORT Input : public daal::algorithms::Input
+class DAAL_EXPORT Input : public InputIface
 {
 public:
     Input();
@@ -97,6 +138,13 @@ public:
 
     virtual ~Input() {}
 
+    /**
+     * Get number of columns in the input data set
+     * \param[out] nCols Number of columns in the input data set
+     * \return Status of the call
+     */
+    services::Status getNumberOfColumns(size_t & nCols) const DAAL_C11_OVERRIDE;
+
     /**
      * Returns an input object for the quantiles algorithm
      * \param[in] id    Identifier of the %input object
@@ -119,10 +167,93 @@ public:
     virtual services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method
+ *        of the quantiles algorithm in the online or distributed processing mode.
+ *        The partial result is a mergeable sketch of the data processed so far
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult)
+    PartialResult();
+
+    virtual ~PartialResult() {}
+
+    /**
+     * Allocates memory to store partial results of the quantiles algorithm
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Initializes partial results of the quantiles algorithm with an empty sketch
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     * \return Status of initialization
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Get number of columns in the data set summarized by the partial result
+     * \param[out] nCols Number of columns
+     * \return Status of the call
+     */
+    services::Status getNumberOfColumns(size_t & nCols) const;
+
+    /**
+     * Returns the partial result of the quantiles algorithm
+     * \param[in] id   Identifier of the partial result, \ref PartialResultId
+     * \return Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets the partial result of the quantiles algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr & ptr);
+
+    /**
+     * Checks correctness of the partial result
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of partial result
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    services::Status checkImpl(size_t nFeatures, const daal::algorithms::Parameter * parameter) const;
+};
+
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__RESULT"></a>
  * \brief Provides methods to access final results obtained with the compute() method of the
- *        quantiles algorithm in the batch processing mode
+ *        quantiles algorithm in the batch processing mode or finalizeCompute() method
+ *        of the algorithm in the online or distributed processing mode
  */
 class DAAL_EXPORT Result : public daal::algorithms::Result
 {
@@ -141,6 +272,16 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
 
+    /**
+     * Allocates memory to store final results of the quantile algorithms
+     * \param[in] partialResult Partial results of the quantiles algorithm
+     * \param[in] parameter     Parameters of the quantiles algorithm
+     * \param[in] method        Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * parameter,
+                                          const int method);
+
     /**
      * Returns the final result of the quantiles algorithm
      * \param[in] id   Identifier of the final result, \ref ResultId
@@ -163,24 +304,88 @@ public:
      */
     virtual services::Status check(const daal::algorithms::Input * in, const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
 
-protected:
-    using daal::algorithms::interface1::Result::check;
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] partialResult Pointer to the partial results
+     * \param[in] par           Pointer to the parameters structure
+     * \param[in] method        Algorithm computation method
+     */
+    virtual services::Status check(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * par,
+                                   int method) const DAAL_C11_OVERRIDE;
 
+protected:
     /** \private */
     template <typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive * arch)
     {
         return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
     }
+
+    services::Status checkImpl(size_t nFeatures, const daal::algorithms::Parameter * par) const;
 };
 typedef services::SharedPtr<Result> ResultPtr;
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT"></a>
+ * \brief Input objects for the quantiles algorithm in the distributed processing mode on master node.
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ */
+template <ComputeStep step>
+class DAAL_EXPORT DistributedInput : public InputIface
+{
+public:
+    DistributedInput();
+    DistributedInput(const DistributedInput & other);
+
+    virtual ~DistributedInput() {}
+
+    /**
+     * Get number of columns in the input data set
+     * \param[out] nCols Number of columns in the input data set
+     * \return Status of the call
+     */
+    services::Status getNumberOfColumns(size_t & nCols) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Adds partial result to the collection of input objects for the quantiles algorithm in the distributed processing mode.
+     * \param[in] id            Identifier of the input object
+     * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+     */
+    void add(MasterInputId id, const PartialResultPtr & partialResult);
+
+    /**
+     * Sets input object for the quantiles algorithm in the distributed processing mode.
+     * \param[in] id  Identifier of the input object
+     * \param[in] ptr Pointer to the input object
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr & ptr);
+
+    /**
+     * Returns the collection of input objects
+     * \param[in] id   Identifier of the input object, \ref MasterInputId
+     * \return Collection of distributed input objects
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Checks the partial results collected on the master node
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
 /** @} */
 } // namespace interface1
 using interface1::Parameter;
+using interface1::InputIface;
 using interface1::Input;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
 using interface1::Result;
 using interface1::ResultPtr;
+using interface1::DistributedInput;
 
 } // namespace quantiles
 } // namespace algorithms
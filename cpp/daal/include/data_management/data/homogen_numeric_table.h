@@ -397,7 +397,7 @@ public:
         df.setType<DataType>();
         this->_status |= _ddict->setAllFeatures(df);
 
-        if (memoryAllocationFlag == doAllocate) this->_status |= allocateDataMemoryImpl();
+        this->_status |= allocateDataMemoryByFlag(memoryAllocationFlag);
     }
 
     /**
@@ -431,7 +431,7 @@ public:
         df.setType<DataType>();
         this->_status |= _ddict->setAllFeatures(df);
 
-        if (memoryAllocationFlag == doAllocate) this->_status |= allocateDataMemoryImpl();
+        this->_status |= allocateDataMemoryByFlag(memoryAllocationFlag);
     }
 
     /**
@@ -467,7 +467,7 @@ public:
 
         this->_status |= _ddict->setAllFeatures(df);
 
-        if (memoryAllocationFlag == doAllocate) this->_status |= allocateDataMemoryImpl();
+        this->_status |= allocateDataMemoryByFlag(memoryAllocationFlag);
 
         this->_status |= assign<DataType>(constValue);
     }
@@ -507,10 +507,7 @@ public:
 
         this->_status |= _ddict->setAllFeatures(df);
 
-        if (memoryAllocationFlag == doAllocate)
-        {
-            this->_status |= allocateDataMemoryImpl();
-        }
+        this->_status |= allocateDataMemoryByFlag(memoryAllocationFlag);
 
         this->_status |= assign<DataType>(constValue);
     }
@@ -764,13 +761,13 @@ protected:
         df.setType<DataType>();
         st |= _ddict->setAllFeatures(df);
 
-        if (memoryAllocationFlag == doAllocate) st |= allocateDataMemoryImpl();
+        st |= allocateDataMemoryByFlag(memoryAllocationFlag);
     }
 
     HomogenNumericTable(DictionaryIface::FeaturesEqual featuresEqual, size_t nColumns, size_t nRows,
                         NumericTable::AllocationFlag memoryAllocationFlag, const DataType & constValue, services::Status & st);
 
-    services::Status allocateDataMemoryImpl(daal::MemType /*type*/ = daal::dram) DAAL_C11_OVERRIDE
+    services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
     {
         freeDataMemoryImpl();
 
@@ -791,7 +788,15 @@ protected:
                                                                 services::ErrorIncorrectNumberOfObservations);
         }
 
-        _ptr = services::SharedPtr<byte>((byte *)daal::services::daal_malloc(size * sizeof(DataType)), services::ServiceDeleter());
+        if (type == daal::dram_numa_local)
+        {
+            _ptr = services::SharedPtr<byte>((byte *)daal::services::internal::daal_numa_malloc(size * sizeof(DataType)),
+                                             services::NumaServiceDeleter());
+        }
+        else
+        {
+            _ptr = services::SharedPtr<byte>((byte *)daal::services::daal_malloc(size * sizeof(DataType)), services::ServiceDeleter());
+        }
 
         if (!_ptr) return services::Status(services::ErrorMemoryAllocationFailed);
 
@@ -799,6 +804,13 @@ protected:
         return services::Status();
     }
 
+    services::Status allocateDataMemoryByFlag(AllocationFlag memoryAllocationFlag)
+    {
+        if (memoryAllocationFlag == doAllocate) return allocateDataMemoryImpl();
+        if (memoryAllocationFlag == doAllocateNumaLocal) return allocateDataMemoryImpl(daal::dram_numa_local);
+        return services::Status();
+    }
+
     void freeDataMemoryImpl() DAAL_C11_OVERRIDE
     {
         _ptr       = services::SharedPtr<byte>();
@@ -405,7 +405,8 @@ public:
         doNotAllocate = 0, /*!< Memory will not be allocated by NumericTable */
         notAllocate =
             0, /*!< Memory will not be allocated by NumericTable \DAAL_DEPRECATED_USE{ \ref daal::data_management::interface1::NumericTableIface::doNotAllocate "doNotAllocate" }*/
-        doAllocate = 1 /*!< Memory will be allocated by NumericTable when needed */
+        doAllocate          = 1, /*!< Memory will be allocated by NumericTable when needed */
+        doAllocateNumaLocal = 2  /*!< Memory will be allocated by HomogenNumericTable with row blocks on the NUMA nodes that process them */
     };
 
     /**
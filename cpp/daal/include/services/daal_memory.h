@@ -81,6 +81,59 @@ namespace internal
 * \return Status of memory copy, memory copy is successful if zero is returned
 */
 DAAL_EXPORT int daal_memcpy_s(void * dest, size_t destSize, const void * src, size_t srcSize);
+
+/**
+* Allocates an aligned block of scratch memory from the arena of the calling thread.
+* Blocks of the same size class freed by the thread are reused instead of being returned to the system
+* \param[in] size      Size of the block of memory in bytes
+* \param[in] alignment Alignment constraint. Must be a power of two
+* \return Pointer to the beginning of a block of memory
+*/
+DAAL_EXPORT void * daal_arena_malloc(size_t size, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT);
+
+/**
+* Deallocates the space previously allocated by daal_arena_malloc. The block is kept in the arena
+* of the calling thread until the arena is released. Each arena caches at most a few megabytes
+* \param[in] ptr   Pointer to the beginning of a block of memory to deallocate
+*/
+DAAL_EXPORT void daal_arena_free(void * ptr);
+
+/**
+* Enters the scope of the scratch arena of the calling thread
+*/
+DAAL_EXPORT void daal_arena_enter_scope();
+
+/**
+* Leaves the scope of the scratch arena of the calling thread.
+* The memory cached by the arena is returned to the system when the outermost scope is left.
+* The arenas of the other threads that are out of any scope return their memory on their next
+* allocation or deallocation
+*/
+DAAL_EXPORT void daal_arena_leave_scope();
+
+/**
+* Allocates an aligned block of memory whose pages are first touched by the threads of the NUMA nodes.
+* Each NUMA node touches the same part of the block as the part of iterations it gets in threader_for_numa,
+* so the rows of a table stored in the block are local to the threads that process them
+* \param[in] size      Size of the block of memory in bytes
+* \param[in] alignment Alignment constraint. Must be a power of two
+* \return Pointer to the beginning of a newly allocated block of memory, deallocated with daal_numa_free
+*/
+DAAL_EXPORT void * daal_numa_malloc(size_t size, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT);
+
+/**
+* Deallocates the block of memory allocated with daal_numa_malloc
+* \param[in] ptr Pointer to the beginning of the block of memory
+*/
+DAAL_EXPORT void daal_numa_free(void * ptr);
+
+/**
+* Checks whether the memory is a part of a block allocated by daal_numa_malloc and placed on several NUMA nodes.
+* Only the loops over such memory are split between the NUMA nodes
+* \param[in] ptr Pointer to the memory
+* \return True if the memory is placed on the NUMA nodes as threader_for_numa splits the iterations
+*/
+DAAL_EXPORT bool daal_is_numa_local(const void * ptr);
 } // namespace internal
 
 /**
@@ -34,6 +34,7 @@
 #include "src/externals/service_math.h"
 #include "src/algorithms/service_kernel_math.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_sort.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -50,6 +51,8 @@ namespace internal
 #define __DBSCAN_DEFAULT_QUEUE_SIZE        32
 #define __DBSCAN_DEFAULT_VECTOR_SIZE       32
 #define __DBSCAN_DEFAULT_NEIGHBORHOOD_SIZE 64
+#define __DBSCAN_KDTREE_LEAF_SIZE          32
+#define __DBSCAN_KDTREE_MAX_DEPTH          128
 
 template <typename T, CpuType cpu>
 class Queue
@@ -634,6 +637,394 @@ private:
     FPType _p;
 };
 
+/* Neighborhood engine that builds a kd-tree over the observations of the output table
+   and answers each query by the traversal that skips the nodes whose bounding box is farther
+   than epsilon from the query. The tree is built on the first query. Neighbors are reported
+   in ascending order of their indices, the same order as in queryFull of the brute-force engine */
+template <typename FPType, CpuType cpu>
+class NeighborhoodEngine<kdTreeDense, FPType, cpu>
+{
+    DAAL_NEW_DELETE();
+
+    static const size_t leafSize = __DBSCAN_KDTREE_LEAF_SIZE;
+    static const size_t maxDepth = __DBSCAN_KDTREE_MAX_DEPTH;
+
+    struct KdTreeNode
+    {
+        size_t begin; /* Range of the node observations in the tree order */
+        size_t end;
+        size_t left; /* Children of the node, zero for the leaf as the root is never a child */
+        size_t right;
+    };
+
+public:
+    NeighborhoodEngine(const NumericTable * inTable, const NumericTable * outTable, const NumericTable * weights, FPType eps, FPType p)
+        : _inTable(inTable), _outTable(outTable), _weights(weights), _eps(eps), _p(p), _dim(0), _nNodes(0), _isBuilt(false)
+    {}
+
+    ~NeighborhoodEngine() {}
+
+    NeighborhoodEngine(const NeighborhoodEngine &) = delete;
+    NeighborhoodEngine & operator=(const NeighborhoodEngine &) = delete;
+
+    services::Status queryFull(Neighborhood<FPType, cpu> * neighs, bool doReset = false)
+    {
+        const size_t inRows  = _inTable->getNumberOfRows();
+        const size_t outRows = _outTable->getNumberOfRows();
+
+        if (outRows == 0)
+        {
+            return services::Status();
+        }
+
+        DAAL_CHECK_STATUS_VAR(build());
+
+        const size_t inDim = _inTable->getNumberOfColumns();
+
+        const size_t inBlockSize = 128;
+        const size_t nInBlocks   = inRows / inBlockSize + (inRows % inBlockSize > 0);
+
+        daal::tls<Vector<size_t, cpu> *> tlsIdx([=]() { return new Vector<size_t, cpu>(); });
+
+        SafeStatus safeStat;
+        daal::threader_for(nInBlocks, nInBlocks, [&](size_t inBlock) {
+            const size_t i1    = inBlock * inBlockSize;
+            const size_t i2    = (inBlock + 1 == nInBlocks ? inRows : i1 + inBlockSize);
+            const size_t iSize = i2 - i1;
+
+            ReadRows<FPType, cpu> inDataRows(const_cast<NumericTable *>(_inTable), i1, iSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(inDataRows);
+            const FPType * const inData = inDataRows.get();
+
+            Vector<size_t, cpu> * idx = tlsIdx.local();
+            DAAL_CHECK_MALLOC_THR(idx);
+
+            for (size_t i = 0; i < iSize; i++)
+            {
+                if (doReset)
+                {
+                    neighs[i + i1].reset();
+                }
+                DAAL_CHECK_STATUS_THR(queryPoint(inData + i * inDim, *idx, neighs[i + i1]));
+            }
+        });
+
+        tlsIdx.reduce([](Vector<size_t, cpu> * idx) { delete idx; });
+
+        return safeStat.detach();
+    }
+
+    services::Status query(size_t * indices, size_t n, Neighborhood<FPType, cpu> * neighs, bool doReset = false)
+    {
+        const size_t outRows = _outTable->getNumberOfRows();
+
+        if (outRows == 0)
+        {
+            return services::Status();
+        }
+
+        DAAL_CHECK_STATUS_VAR(build());
+
+        daal::tls<Vector<size_t, cpu> *> tlsIdx([=]() { return new Vector<size_t, cpu>(); });
+
+        SafeStatus safeStat;
+        daal::threader_for(n, n, [&](size_t i) {
+            ReadRows<FPType, cpu> queryRows(const_cast<NumericTable *>(_inTable), indices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(queryRows);
+
+            Vector<size_t, cpu> * idx = tlsIdx.local();
+            DAAL_CHECK_MALLOC_THR(idx);
+
+            if (doReset)
+            {
+                neighs[i].reset();
+            }
+            DAAL_CHECK_STATUS_THR(queryPoint(queryRows.get(), *idx, neighs[i]));
+        });
+
+        tlsIdx.reduce([](Vector<size_t, cpu> * idx) { delete idx; });
+
+        return safeStat.detach();
+    }
+
+private:
+    services::Status build()
+    {
+        if (_isBuilt)
+        {
+            return services::Status();
+        }
+
+        const size_t nRows  = _outTable->getNumberOfRows();
+        const size_t outDim = _outTable->getNumberOfColumns();
+        _dim                = _inTable->getNumberOfColumns();
+        DAAL_ASSERT(outDim >= _dim);
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, _dim);
+
+        /* Each split keeps at least half of the leaf size observations in both children */
+        const size_t maxNodes = 2 * (nRows / (leafSize / 2) + 1);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, maxNodes, _dim);
+
+        FPType * const points       = _points.reset(nRows * _dim);
+        size_t * const pointIndices = _pointIndices.reset(nRows);
+        KdTreeNode * const nodes    = _nodes.reset(maxNodes);
+        FPType * const lower        = _lower.reset(maxNodes * _dim);
+        FPType * const upper        = _upper.reset(maxNodes * _dim);
+        DAAL_CHECK_MALLOC(points && pointIndices && nodes && lower && upper);
+
+        const size_t blockSize = 512;
+        const size_t nBlocks   = nRows / blockSize + (nRows % blockSize > 0);
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t i1 = iBlock * blockSize;
+            const size_t i2 = (iBlock + 1 == nBlocks ? nRows : i1 + blockSize);
+
+            ReadRows<FPType, cpu> dataRows(const_cast<NumericTable *>(_outTable), i1, i2 - i1);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+            const FPType * const data = dataRows.get();
+
+            for (size_t i = i1; i < i2; i++)
+            {
+                pointIndices[i] = i;
+                for (size_t d = 0; d < _dim; d++)
+                {
+                    points[i * _dim + d] = data[(i - i1) * outDim + d];
+                }
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        if (_weights)
+        {
+            FPType * const weightValues = _weightValues.reset(nRows);
+            DAAL_CHECK_MALLOC(weightValues);
+
+            ReadRows<FPType, cpu> weightsRows(const_cast<NumericTable *>(_weights), 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS(weightsRows);
+            DAAL_CHECK(!services::internal::daal_memcpy_s(weightValues, nRows * sizeof(FPType), weightsRows.get(), nRows * sizeof(FPType)),
+                       services::ErrorMemoryCopyFailedInternal);
+        }
+
+        size_t stack[maxDepth];
+        size_t stackSize = 0;
+
+        nodes[0] = { 0, nRows, 0, 0 };
+        _nNodes  = 1;
+
+        stack[stackSize++] = 0;
+        while (stackSize > 0)
+        {
+            const size_t node = stack[--stackSize];
+            const size_t b    = nodes[node].begin;
+            const size_t e    = nodes[node].end;
+
+            FPType * const nodeLower = lower + node * _dim;
+            FPType * const nodeUpper = upper + node * _dim;
+            for (size_t d = 0; d < _dim; d++)
+            {
+                nodeLower[d] = nodeUpper[d] = points[b * _dim + d];
+            }
+            for (size_t i = b + 1; i < e; i++)
+            {
+                for (size_t d = 0; d < _dim; d++)
+                {
+                    const FPType value = points[i * _dim + d];
+                    nodeLower[d]       = (value < nodeLower[d]) ? value : nodeLower[d];
+                    nodeUpper[d]       = (nodeUpper[d] < value) ? value : nodeUpper[d];
+                }
+            }
+
+            if (e - b <= leafSize)
+            {
+                continue;
+            }
+
+            size_t splitDim    = 0;
+            FPType splitExtent = 0;
+            for (size_t d = 0; d < _dim; d++)
+            {
+                if (splitExtent < nodeUpper[d] - nodeLower[d])
+                {
+                    splitExtent = nodeUpper[d] - nodeLower[d];
+                    splitDim    = d;
+                }
+            }
+
+            /* All observations of the node coincide */
+            if (!(splitExtent > 0))
+            {
+                continue;
+            }
+
+            const size_t mid = b + (e - b) / 2;
+            selectRows(b, e, mid, splitDim);
+
+            DAAL_ASSERT(_nNodes + 2 <= maxNodes);
+            nodes[node].left   = _nNodes;
+            nodes[node].right  = _nNodes + 1;
+            nodes[_nNodes]     = { b, mid, 0, 0 };
+            nodes[_nNodes + 1] = { mid, e, 0, 0 };
+
+            DAAL_ASSERT(stackSize + 2 <= maxDepth);
+            stack[stackSize++] = _nNodes + 1;
+            stack[stackSize++] = _nNodes;
+            _nNodes += 2;
+        }
+
+        _isBuilt = true;
+        return services::Status();
+    }
+
+    /* Reorders the observations in [begin, end) so that the k-th one is in its sorted position by the splitDim coordinate
+       and the observations before and after it are not greater and not less than it respectively */
+    void selectRows(size_t begin, size_t end, size_t k, size_t splitDim)
+    {
+        const FPType * const points = _points.get();
+
+        const DAAL_INT64 kth = k;
+        DAAL_INT64 l         = begin;
+        DAAL_INT64 r         = end - 1;
+        while (l < r)
+        {
+            const FPType med = points[k * _dim + splitDim];
+            DAAL_INT64 i     = l;
+            DAAL_INT64 j     = r;
+            while (i <= j)
+            {
+                while (points[i * _dim + splitDim] < med)
+                {
+                    i++;
+                }
+                while (med < points[j * _dim + splitDim])
+                {
+                    j--;
+                }
+                if (i <= j)
+                {
+                    swapRows(i, j);
+                    i++;
+                    j--;
+                }
+            }
+            if (j < kth)
+            {
+                l = i;
+            }
+            if (kth < i)
+            {
+                r = j;
+            }
+        }
+    }
+
+    void swapRows(size_t i, size_t j)
+    {
+        FPType * const points = _points.get();
+        for (size_t d = 0; d < _dim; d++)
+        {
+            swap<cpu, FPType>(points[i * _dim + d], points[j * _dim + d]);
+        }
+        swap<cpu, size_t>(_pointIndices[i], _pointIndices[j]);
+    }
+
+    /* The distances are compared with epsilon in the same way as the brute-force engine does:
+       squared Euclidean distances are compared with the p-th power of epsilon */
+    FPType boxDistance(size_t node, const FPType * query) const
+    {
+        const FPType * const nodeLower = _lower.get() + node * _dim;
+        const FPType * const nodeUpper = _upper.get() + node * _dim;
+
+        FPType sum = 0;
+        for (size_t d = 0; d < _dim; d++)
+        {
+            FPType diff = 0;
+            if (query[d] < nodeLower[d])
+            {
+                diff = nodeLower[d] - query[d];
+            }
+            else if (nodeUpper[d] < query[d])
+            {
+                diff = query[d] - nodeUpper[d];
+            }
+            sum += diff * diff;
+        }
+        return sum;
+    }
+
+    /* Rounding is monotonic, so the computed distance to any observation in the box is not less than the one to the box */
+    FPType pointDistance(const FPType * query, const FPType * point) const { return distancePow2<FPType, cpu>(query, point, _dim); }
+
+    services::Status queryPoint(const FPType * query, Vector<size_t, cpu> & idx, Neighborhood<FPType, cpu> & neigh) const
+    {
+        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+
+        const KdTreeNode * const nodes = _nodes.get();
+        const FPType * const points    = _points.get();
+
+        idx.reset();
+
+        size_t stack[maxDepth];
+        size_t stackSize   = 0;
+        stack[stackSize++] = 0;
+        while (stackSize > 0)
+        {
+            const size_t node = stack[--stackSize];
+            if (boxDistance(node, query) > epsP)
+            {
+                continue;
+            }
+
+            if (nodes[node].left == 0)
+            {
+                for (size_t i = nodes[node].begin; i < nodes[node].end; i++)
+                {
+                    if (pointDistance(query, points + i * _dim) <= epsP)
+                    {
+                        DAAL_CHECK_STATUS_VAR(idx.push_back(_pointIndices[i]));
+                    }
+                }
+            }
+            else
+            {
+                stack[stackSize++] = nodes[node].right;
+                stack[stackSize++] = nodes[node].left;
+            }
+        }
+
+        const size_t count = idx.size();
+        qSort<size_t, cpu>(count, idx.ptr());
+
+        DAAL_CHECK_MALLOC(!neigh.allocateNewEntries(count));
+        const FPType * const weightValues = _weightValues.get();
+        for (size_t j = 0; j < count; j++)
+        {
+            neigh.fastAdd(idx[j], weightValues ? weightValues[idx[j]] : FPType(1));
+        }
+
+        return services::Status();
+    }
+
+    const NumericTable * _inTable;
+    const NumericTable * _outTable;
+    const NumericTable * _weights;
+
+    FPType _eps;
+    FPType _p;
+
+    size_t _dim;
+    size_t _nNodes;
+    bool _isBuilt;
+
+    TArray<FPType, cpu> _points;       /* Observations in the tree order */
+    TArray<size_t, cpu> _pointIndices; /* Indices of the observations in the tree order */
+    TArray<FPType, cpu> _weightValues;
+    TArray<KdTreeNode, cpu> _nodes;
+    TArray<FPType, cpu> _lower; /* Bounding boxes of the nodes */
+    TArray<FPType, cpu> _upper;
+};
+
 template <typename FPType, CpuType cpu>
 FPType findKthStatistic(FPType * values, size_t nElements, size_t k)
 {
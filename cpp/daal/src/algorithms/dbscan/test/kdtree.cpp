@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "daal/include/algorithms/dbscan/dbscan_batch.h"
+#include "daal/include/data_management/data/homogen_numeric_table.h"
+#include "daal/src/algorithms/dbscan/dbscan_utils.h"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal::algorithms::dbscan::test {
+
+namespace dm = daal::data_management;
+
+template <typename Float>
+static std::vector<Float> generate_uniform(std::size_t row_count, std::size_t column_count) {
+    std::mt19937 rng(7777);
+    std::uniform_real_distribution<Float> distr(Float(0), Float(1));
+    std::vector<Float> data(row_count * column_count);
+    for (auto& value : data) {
+        value = distr(rng);
+    }
+    return data;
+}
+
+template <typename Float>
+static std::vector<int> get_column(const dm::NumericTablePtr& table) {
+    const std::size_t row_count = table->getNumberOfRows();
+    std::vector<int> column(row_count);
+    if (row_count == 0) {
+        return column;
+    }
+    dm::BlockDescriptor<int> block;
+    table->getBlockOfRows(0, row_count, dm::readOnly, block);
+    std::copy(block.getBlockPtr(), block.getBlockPtr() + row_count, column.begin());
+    table->releaseBlockOfRows(block);
+    return column;
+}
+
+template <typename Float, typename Neighborhood>
+static std::vector<std::size_t> get_sorted(const Neighborhood& neigh) {
+    std::vector<std::size_t> indices(neigh.size());
+    for (std::size_t j = 0; j < neigh.size(); j++) {
+        indices[j] = neigh.get(j);
+    }
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+// The brute-force engine computes the distances directly in the query, so the
+// neighborhoods found by the kd-tree one must coincide with them exactly for
+// any power of the distance
+TEMPLATE_TEST("kd-tree engine finds the same neighborhoods as the brute-force one",
+              "[dbscan][kdtree]",
+              float,
+              double) {
+    using Float = TestType;
+    using neighborhood_t = internal::Neighborhood<Float, daal::sse2>;
+
+    const Float p = GENERATE(Float(2), Float(3));
+    const std::size_t column_count = GENERATE(2, 5);
+    CAPTURE(p, column_count);
+
+    const std::size_t row_count = 500;
+    const Float eps = Float(0.2);
+    auto data = generate_uniform<Float>(row_count, column_count);
+    const auto table = dm::HomogenNumericTable<Float>::create(data.data(), column_count, row_count);
+
+    std::vector<std::size_t> indices(row_count);
+    for (std::size_t i = 0; i < row_count; i++) {
+        indices[i] = i;
+    }
+
+    std::vector<neighborhood_t> ref_neighs(row_count);
+    internal::NeighborhoodEngine<defaultDense, Float, daal::sse2>
+        ref_engine(table.get(), table.get(), nullptr, eps, p);
+    REQUIRE(ref_engine.query(indices.data(), row_count, ref_neighs.data()).ok());
+
+    std::vector<neighborhood_t> full_neighs(row_count);
+    std::vector<neighborhood_t> query_neighs(row_count);
+    internal::NeighborhoodEngine<kdTreeDense, Float, daal::sse2>
+        engine(table.get(), table.get(), nullptr, eps, p);
+    REQUIRE(engine.queryFull(full_neighs.data()).ok());
+    REQUIRE(engine.query(indices.data(), row_count, query_neighs.data()).ok());
+
+    for (std::size_t i = 0; i < row_count; i++) {
+        CAPTURE(i);
+        const auto ref = get_sorted<Float>(ref_neighs[i]);
+        REQUIRE(get_sorted<Float>(full_neighs[i]) == ref);
+        REQUIRE(get_sorted<Float>(query_neighs[i]) == ref);
+        REQUIRE(full_neighs[i].weight() == ref_neighs[i].weight());
+    }
+}
+
+template <typename Float, Method method>
+static ResultPtr compute(const dm::NumericTablePtr& data,
+                         Float eps,
+                         std::size_t min_observations,
+                         bool memory_saving_mode) {
+    Batch<Float, method> algorithm(eps, min_observations);
+    algorithm.input.set(dbscan::data, data);
+    algorithm.parameter().memorySavingMode = memory_saving_mode;
+    algorithm.parameter().resultsToCompute = computeCoreIndices;
+    REQUIRE(algorithm.compute().ok());
+    return algorithm.getResult();
+}
+
+// The reference is the memory saving mode of defaultDense, which computes the
+// distances directly as the kd-tree method does. The default mode computes them
+// through matrix multiplication, so the observations lying at epsilon from each
+// other up to rounding might be neighbors in one mode and not in the other one.
+// The order of the neighbors in the reference is not fixed, so a border
+// observation is only required to be in the cluster of one of its core neighbors
+TEMPLATE_TEST("kd-tree method gives the same clustering as defaultDense",
+              "[dbscan][kdtree]",
+              float,
+              double) {
+    using Float = TestType;
+
+    const bool memory_saving_mode = GENERATE(false, true);
+    const std::size_t column_count = GENERATE(2, 3);
+    CAPTURE(memory_saving_mode, column_count);
+
+    const std::size_t row_count = 2000;
+    const Float eps = (column_count == 2) ? Float(0.03) : Float(0.08);
+    const std::size_t min_observations = 5;
+    auto data = generate_uniform<Float>(row_count, column_count);
+    const auto table = dm::HomogenNumericTable<Float>::create(data.data(), column_count, row_count);
+
+    const auto ref = compute<Float, defaultDense>(table, eps, min_observations, true);
+    const auto res = compute<Float, kdTreeDense>(table, eps, min_observations, memory_saving_mode);
+
+    REQUIRE(get_column<Float>(res->get(nClusters)) == get_column<Float>(ref->get(nClusters)));
+
+    const auto core_indices = get_column<Float>(res->get(coreIndices));
+    REQUIRE(core_indices == get_column<Float>(ref->get(coreIndices)));
+
+    std::vector<bool> is_core(row_count, false);
+    for (const int i : core_indices) {
+        is_core[i] = true;
+    }
+
+    const auto assignments = get_column<Float>(res->get(dbscan::assignments));
+    const auto ref_assignments = get_column<Float>(ref->get(dbscan::assignments));
+    const Float eps_sq = eps * eps;
+    for (std::size_t i = 0; i < row_count; i++) {
+        CAPTURE(i, assignments[i], ref_assignments[i]);
+        if (is_core[i] || ref_assignments[i] < 0) {
+            REQUIRE(assignments[i] == ref_assignments[i]);
+            continue;
+        }
+        bool has_core_neighbor = false;
+        for (std::size_t j = 0; j < row_count && !has_core_neighbor; j++) {
+            Float dist = 0;
+            for (std::size_t d = 0; d < column_count; d++) {
+                const Float diff = data[j * column_count + d] - data[i * column_count + d];
+                dist += diff * diff;
+            }
+            has_core_neighbor = is_core[j] && dist <= eps_sq && assignments[j] == assignments[i];
+        }
+        REQUIRE(has_core_neighbor);
+    }
+}
+
+} // namespace daal::algorithms::dbscan::test
@@ -92,6 +92,7 @@ public:
     {
         DAAL_NEW_DELETE();
         IndexType numIndices     = 0;       //number of indices or bins
+        IndexType missingIndex   = -1;      //index of the missing values, the last one if any, -1 otherwise
         ModelFPType * binBorders = nullptr; //right bin borders
 
         services::Status allocBorders();
@@ -102,8 +103,11 @@ public:
     IndexedFeatures() : _data(nullptr), _entries(nullptr), _sizeOfIndex(sizeof(IndexType)), _nCols(0), _nRows(0), _capacity(0), _maxNumIndices(0) {}
     ~IndexedFeatures();
 
+    //if bMissingIndex is true, missing values of every feature are mapped to the index next to the last one of the present values,
+    //otherwise they are sorted together with the present values
     template <typename algorithmFPType, CpuType cpu>
-    services::Status init(const NumericTable & nt, const FeatureTypes * featureTypes = nullptr, const BinParams * pBimPrm = nullptr);
+    services::Status init(const NumericTable & nt, const FeatureTypes * featureTypes = nullptr, const BinParams * pBimPrm = nullptr,
+                          bool bMissingIndex = false);
 
     //get max number of indices for that feature
     IndexType numIndices(size_t iCol) const { return _entries[iCol].numIndices; }
@@ -111,6 +115,9 @@ public:
     //get max number of indices among all features
     IndexType maxNumIndices() const { return _maxNumIndices; }
 
+    //get index of the missing values of that feature or -1 if the feature has no missing values
+    IndexType missingIndex(size_t iCol) const { return _entries[iCol].missingIndex; }
+
     //returns true if the feature is mapped to bins
     bool isBinned(size_t iCol) const
     {
@@ -26,6 +26,8 @@
 #include "src/algorithms/service_sort.h"
 #include "src/algorithms/dtrees/service_array.h"
 #include "src/externals/service_memory.h"
+#include "src/services/service_utils.h"
+#include "src/services/service_data_utils.h"
 
 namespace daal
 {
@@ -39,7 +41,7 @@ template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTask
 {
     DAAL_NEW_DELETE();
-    ColIndexTask(size_t nRows) : _index(nRows), maxNumDiffValues(1) {}
+    ColIndexTask(size_t nRows, bool bMissingIndex) : _index(nRows), maxNumDiffValues(1), _bMissingIndex(bMissingIndex) {}
     virtual ~ColIndexTask() {}
     bool isValid() const { return _index.get(); }
 
@@ -64,68 +66,88 @@ struct ColIndexTask
     services::Status makeIndexDefault(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t iCol, size_t nRows,
                                       bool bUnorderedFeature)
     {
-        Status s = this->getSorted(nt, iCol, nRows);
+        size_t nSorted = 0;
+        Status s       = this->getSorted(nt, iCol, nRows, nSorted);
         if (!s) return s;
         const FeatureIdx * index = _index.get();
-        if (index[0].key == index[nRows - 1].key)
+        IndexType iUnique        = 0;
+        if (nSorted && (index[0].key == index[nSorted - 1].key))
         {
-            entry.numIndices = 1;
-            for (size_t i = 0; i < nRows; ++i) aRes[i] = 0;
-            return s;
+            for (size_t i = 0; i < nSorted; ++i) aRes[index[i].val] = 0;
+            iUnique = 1;
         }
-        IndexType iUnique    = 0;
-        aRes[index[0].val]   = iUnique;
-        algorithmFPType prev = index[0].key;
-        for (size_t i = 1; i < nRows; ++i)
+        else if (nSorted)
         {
-            const IndexType idx = index[i].val;
-            if (index[i].key == prev)
-                aRes[idx] = iUnique;
-            else
+            aRes[index[0].val]   = iUnique;
+            algorithmFPType prev = index[0].key;
+            for (size_t i = 1; i < nSorted; ++i)
             {
-                aRes[idx] = ++iUnique;
-                prev      = index[i].key;
+                const IndexType idx = index[i].val;
+                if (index[i].key == prev)
+                    aRes[idx] = iUnique;
+                else
+                {
+                    aRes[idx] = ++iUnique;
+                    prev      = index[i].key;
+                }
             }
+            ++iUnique;
         }
-        ++iUnique;
-        entry.numIndices = iUnique;
-        if (maxNumDiffValues < iUnique) maxNumDiffValues = iUnique;
-        return services::Status();
+        entry.numIndices = assignMissingIndex(entry, aRes, iUnique, nSorted, nRows);
+        if (maxNumDiffValues < entry.numIndices) maxNumDiffValues = entry.numIndices;
+        return s;
     }
 
 public:
     size_t maxNumDiffValues;
 
 protected:
-    Status getSorted(NumericTable & nt, size_t iCol, size_t nRows)
+    //if missing values have an index of their own, they are placed at the end of the index and the rest nSorted values are sorted,
+    //otherwise all the values are sorted
+    Status getSorted(NumericTable & nt, size_t iCol, size_t nRows, size_t & nSorted)
     {
         const algorithmFPType * pBlock = _block.set(&nt, iCol, 0, nRows);
         DAAL_CHECK_BLOCK_STATUS(_block);
         FeatureIdx * index = _index.get();
+        size_t iMissing    = nRows;
+        nSorted            = 0;
         for (size_t i = 0; i < nRows; ++i)
         {
-            index[i].key = pBlock[i];
-            index[i].val = i;
+            FeatureIdx & item = (_bMissingIndex && services::internal::isNaN<cpu>(pBlock[i])) ? index[--iMissing] : index[nSorted++];
+            item.key          = pBlock[i];
+            item.val          = i;
         }
-        daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nRows, index);
+        daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nSorted, index);
         return Status();
     }
 
+    //maps missing values to the index next to the last one of nIndices present values, returns the total number of indices
+    IndexType assignMissingIndex(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, IndexType nIndices, size_t nSorted, size_t nRows)
+    {
+        entry.missingIndex = -1;
+        if (nSorted == nRows) return nIndices;
+        const FeatureIdx * index = _index.get();
+        for (size_t i = nSorted; i < nRows; ++i) aRes[index[i].val] = nIndices;
+        entry.missingIndex = nIndices;
+        return nIndices + 1;
+    }
+
 protected:
     daal::internal::ReadColumns<algorithmFPType, cpu> _block;
     TVector<FeatureIdx, cpu, DefaultAllocator<cpu> > _index;
+    const bool _bMissingIndex;
 };
 
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTaskBins : public ColIndexTask<IndexType, algorithmFPType, cpu>
 {
     typedef ColIndexTask<IndexType, algorithmFPType, cpu> super;
-    ColIndexTaskBins(size_t nRows, const BinParams & prm) : super(nRows), _prm(prm), _bins(_prm.maxBins) {}
+    ColIndexTaskBins(size_t nRows, const BinParams & prm, bool bMissingIndex) : super(nRows, bMissingIndex), _prm(prm), _bins(_prm.maxBins) {}
     virtual services::Status makeIndex(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t iCol, size_t nRows,
                                        bool bUnorderedFeature) DAAL_C11_OVERRIDE;
 
 private:
-    services::Status assignIndexAccordingToBins(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t nBins, size_t nRows);
+    services::Status assignIndexAccordingToBins(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t nBins, size_t nSorted, size_t nRows);
 
 private:
     const BinParams _prm;
@@ -161,31 +183,36 @@ const T * upper_bound(const T * first, const T * last, const T & value)
 
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
 services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::assignIndexAccordingToBins(IndexedFeatures::FeatureEntry & entry,
-                                                                                               IndexType * aRes, size_t nBins, size_t nRows)
+                                                                                               IndexType * aRes, size_t nBins, size_t nSorted,
+                                                                                               size_t nRows)
 {
     const typename super::FeatureIdx * index = this->_index.get();
 
+    entry.numIndices   = nBins + (nSorted < nRows);
+    services::Status s = entry.allocBorders();
+    DAAL_CHECK(s, s);
+
     if (nBins == 1)
     {
-        entry.numIndices   = 1;
-        services::Status s = entry.allocBorders();
-        DAAL_CHECK(s, s);
-        services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nRows);
+        if (nSorted == nRows)
+            services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nRows);
+        else
+            for (size_t i = 0; i < nSorted; ++i) aRes[index[i].val] = 0;
 
-        entry.binBorders[0] = index[nRows - 1].key;
-        _bins[0]            = nRows;
-        return Status();
+        entry.binBorders[0] = index[nSorted - 1].key;
+        _bins[0]            = nSorted;
     }
-    entry.numIndices   = nBins;
-    services::Status s = entry.allocBorders();
-    if (!s) return s;
-
-    size_t i = 0;
-    for (size_t iBin = 0; iBin < nBins; ++iBin)
+    else
     {
-        for (size_t n = i + _bins[iBin]; i < n; ++i) aRes[index[i].val] = iBin;
-        entry.binBorders[iBin] = index[i - 1].key;
+        size_t i = 0;
+        for (size_t iBin = 0; iBin < nBins; ++iBin)
+        {
+            for (size_t n = i + _bins[iBin]; i < n; ++i) aRes[index[i].val] = iBin;
+            entry.binBorders[iBin] = index[i - 1].key;
+        }
     }
+    this->assignMissingIndex(entry, aRes, IndexType(nBins), nSorted, nRows);
+    if (entry.missingIndex >= 0) entry.binBorders[nBins] = services::internal::MaxVal<ModelFPType>::get();
     if (this->maxNumDiffValues < entry.numIndices) this->maxNumDiffValues = entry.numIndices;
     return s;
 }
@@ -196,26 +223,35 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
 {
     if (bUnorderedFeature || nRows <= _prm.maxBins) return this->makeIndexDefault(nt, entry, aRes, iCol, nRows, bUnorderedFeature);
 
-    Status s = this->getSorted(nt, iCol, nRows);
+    size_t nSorted = 0;
+    Status s       = this->getSorted(nt, iCol, nRows, nSorted);
     if (!s) return s;
 
+    //missing values only
+    if (!nSorted) return assignIndexAccordingToBins(entry, aRes, 0, nSorted, nRows);
+
     const typename super::FeatureIdx * index = this->_index.get();
-    if (index[0].key == index[nRows - 1].key)
-    {
-        _bins[0] = nRows;
-        services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nRows);
+    if (index[0].key == index[nSorted - 1].key) return assignIndexAccordingToBins(entry, aRes, 1, nSorted, nRows);
 
-        entry.numIndices = 1;
-        s |= entry.allocBorders();
-        DAAL_CHECK(s, s);
-        entry.binBorders[0] = index[nRows - 1].key;
-        return s;
+    if (nSorted <= _prm.maxBins)
+    {
+        //a bin per each value
+        size_t nBins = 0;
+        for (size_t i = 0; i < nSorted; ++nBins)
+        {
+            size_t n = 1;
+            for (; (i + n < nSorted) && (index[i + n].key == index[i].key); ++n)
+                ;
+            _bins[nBins] = n;
+            i += n;
+        }
+        return assignIndexAccordingToBins(entry, aRes, nBins, nSorted, nRows);
     }
 
     size_t nBins         = 0;
-    const size_t binSize = nRows / _prm.maxBins;
+    const size_t binSize = nSorted / _prm.maxBins;
     size_t i             = 0;
-    for (; (i + binSize < nRows) && (nBins < _prm.maxBins);)
+    for (; (i + binSize < nSorted) && (nBins < _prm.maxBins);)
     {
         //trying to make a bin of size binSize
         size_t newBinSize                     = binSize;
@@ -228,10 +264,10 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
             ++iRight;
             size_t r = iRight + binSize;
             //at first, roughly locate the value bigger than iRight, jumping by binSize to the right
-            for (; (r < nRows) && (index[r].key == ri.key); r += binSize)
+            for (; (r < nSorted) && (index[r].key == ri.key); r += binSize)
             {
             }
-            if (r > nRows) r = nRows;
+            if (r > nSorted) r = nSorted;
             //then locate a new border as the upper_bound between this rough value and iRight
             iRight = upper_bound<typename super::FeatureIdx>(index + iRight + 1, index + r, ri) - index;
             //this is the size of the bin
@@ -265,9 +301,9 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
         append(_bins, nBins, newBinSize);
         i += newBinSize;
     }
-    if (i < nRows)
+    if (i < nSorted)
     {
-        size_t newBinSize = nRows - i;
+        size_t newBinSize = nSorted - i;
         if (((nBins < _prm.maxBins) && (newBinSize >= _prm.minBinSize)) || nBins == 0)
         {
             append(_bins, nBins, newBinSize);
@@ -282,7 +318,7 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
     //run-time check for bins correctness
     size_t nTotal = 0;
     for(size_t i = 0; i < nBins; nTotal += _bins[i], ++i);
-    DAAL_ASSERT(nTotal == nRows);
+    DAAL_ASSERT(nTotal == nSorted);
     size_t iBorder = 0;
     for(size_t i = 1; i < nBins; ++i)
     {
@@ -291,11 +327,11 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
     }
     #endif
 #endif
-    return assignIndexAccordingToBins(entry, aRes, nBins, nRows);
+    return assignIndexAccordingToBins(entry, aRes, nBins, nSorted, nRows);
 }
 
 template <typename algorithmFPType, CpuType cpu>
-services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTypes * featureTypes, const BinParams * pBimPrm)
+services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTypes * featureTypes, const BinParams * pBimPrm, bool bMissingIndex)
 {
     dtrees::internal::FeatureTypes autoFT;
     if (!featureTypes)
@@ -315,7 +351,7 @@ services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTyp
 
     daal::tls<TlsTask *> tlsData([=, &nt]() -> TlsTask * {
         const size_t nRows = nt.getNumberOfRows();
-        TlsTask * res      = (pBimPrm ? new BinningTask(nRows, *pBimPrm) : new DefaultTask(nRows));
+        TlsTask * res      = (pBimPrm ? new BinningTask(nRows, *pBimPrm, bMissingIndex) : new DefaultTask(nRows, bMissingIndex));
         if (res && !res->isValid())
         {
             delete res;
@@ -111,19 +111,21 @@ struct TreeNodeSplit : public TreeNodeBase
     TreeNodeBase * kid[2];
     int featureIdx;
     bool featureUnordered;
+    bool missingRight; //missing values of the feature go to the right child
 
-    TreeNodeSplit() { kid[0] = kid[1] = nullptr; }
+    TreeNodeSplit() : missingRight(false) { kid[0] = kid[1] = nullptr; }
     const TreeNodeBase * left() const { return kid[0]; }
     const TreeNodeBase * right() const { return kid[1]; }
     TreeNodeBase * left() { return kid[0]; }
     TreeNodeBase * right() { return kid[1]; }
 
-    void set(int featIdx, algorithmFPType featValue, bool bUnordered)
+    void set(int featIdx, algorithmFPType featValue, bool bUnordered, bool bMissingRight = false)
     {
         DAAL_ASSERT(featIdx >= 0);
         featureValue     = featValue;
         featureIdx       = featIdx;
         featureUnordered = bUnordered;
+        missingRight     = bMissingRight;
     }
     virtual bool isSplit() const DAAL_C11_OVERRIDE { return true; }
     virtual size_t numChildren() const DAAL_C11_OVERRIDE
@@ -0,0 +1,515 @@
+/* file: dtrees_predict_shap_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of SHAP values computation for tree ensembles
+//  (path-dependent TreeSHAP algorithm).
+//--
+*/
+
+#ifndef __DTREES_PREDICT_SHAP_IMPL_I__
+#define __DTREES_PREDICT_SHAP_IMPL_I__
+
+#include "src/algorithms/dtrees/dtrees_predict_dense_default_impl.i"
+#include "src/algorithms/service_error_handling.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_arrays.h"
+#include "src/threading/threading.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace prediction
+{
+namespace internal
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+// Path-dependent TreeSHAP, see algorithm 2 in [Lundberg, Erion, Lee. Consistent Individualized
+// Feature Attribution for Tree Ensembles, 2018]. The trees are accessed through the TreeView
+// classes that provide the following methods:
+//     size_t root() const
+//     bool isLeaf(size_t iNode) const
+//     size_t left(size_t iNode) const
+//     size_t right(size_t iNode) const
+//     int featureIndex(size_t iNode) const
+//     bool goRight(size_t iNode, const algorithmFPType * x) const
+//     algorithmFPType cover(size_t iNode) const
+//     algorithmFPType value(size_t iNode) const
+//     size_t maxDepth() const
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType>
+struct ShapPathElement
+{
+    int featureIndex;
+    algorithmFPType zeroFraction;
+    algorithmFPType oneFraction;
+    algorithmFPType pathWeight;
+};
+
+/* Returns the number of path elements required to explain the tree of the given depth */
+inline size_t getShapPathSize(size_t maxDepth)
+{
+    return (maxDepth + 2) * (maxDepth + 3) / 2;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void extendShapPath(ShapPathElement<algorithmFPType> * path, int uniqueDepth, algorithmFPType zeroFraction, algorithmFPType oneFraction,
+                    int featureIndex)
+{
+    path[uniqueDepth].featureIndex = featureIndex;
+    path[uniqueDepth].zeroFraction = zeroFraction;
+    path[uniqueDepth].oneFraction  = oneFraction;
+    path[uniqueDepth].pathWeight   = algorithmFPType(uniqueDepth == 0 ? 1 : 0);
+
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(uniqueDepth + 1);
+    for (int i = uniqueDepth - 1; i >= 0; --i)
+    {
+        path[i + 1].pathWeight += oneFraction * path[i].pathWeight * algorithmFPType(i + 1) * div;
+        path[i].pathWeight = zeroFraction * path[i].pathWeight * algorithmFPType(uniqueDepth - i) * div;
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void unwindShapPath(ShapPathElement<algorithmFPType> * path, int uniqueDepth, int pathIndex)
+{
+    const algorithmFPType oneFraction  = path[pathIndex].oneFraction;
+    const algorithmFPType zeroFraction = path[pathIndex].zeroFraction;
+    algorithmFPType nextOnePortion     = path[uniqueDepth].pathWeight;
+
+    for (int i = uniqueDepth - 1; i >= 0; --i)
+    {
+        if (oneFraction != 0)
+        {
+            const algorithmFPType weight = path[i].pathWeight;
+            path[i].pathWeight           = nextOnePortion * algorithmFPType(uniqueDepth + 1) / (algorithmFPType(i + 1) * oneFraction);
+            nextOnePortion = weight - path[i].pathWeight * zeroFraction * algorithmFPType(uniqueDepth - i) / algorithmFPType(uniqueDepth + 1);
+        }
+        else
+        {
+            path[i].pathWeight = path[i].pathWeight * algorithmFPType(uniqueDepth + 1) / (zeroFraction * algorithmFPType(uniqueDepth - i));
+        }
+    }
+
+    for (int i = pathIndex; i < uniqueDepth; ++i)
+    {
+        path[i].featureIndex = path[i + 1].featureIndex;
+        path[i].zeroFraction = path[i + 1].zeroFraction;
+        path[i].oneFraction  = path[i + 1].oneFraction;
+    }
+}
+
+/* Returns the total weight of the path as if the element pathIndex was unwound from it */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType unwoundShapPathSum(const ShapPathElement<algorithmFPType> * path, int uniqueDepth, int pathIndex)
+{
+    const algorithmFPType oneFraction  = path[pathIndex].oneFraction;
+    const algorithmFPType zeroFraction = path[pathIndex].zeroFraction;
+    algorithmFPType nextOnePortion     = path[uniqueDepth].pathWeight;
+    algorithmFPType total              = 0;
+
+    for (int i = uniqueDepth - 1; i >= 0; --i)
+    {
+        if (oneFraction != 0)
+        {
+            const algorithmFPType weight = nextOnePortion * algorithmFPType(uniqueDepth + 1) / (algorithmFPType(i + 1) * oneFraction);
+            total += weight;
+            nextOnePortion = path[i].pathWeight - weight * zeroFraction * algorithmFPType(uniqueDepth - i) / algorithmFPType(uniqueDepth + 1);
+        }
+        else if (zeroFraction != 0)
+        {
+            total += path[i].pathWeight * algorithmFPType(uniqueDepth + 1) / (zeroFraction * algorithmFPType(uniqueDepth - i));
+        }
+    }
+    return total;
+}
+
+/* Adds the contributions of the subtree of the node iNode to phi. If condition is not zero, the feature conditionFeature
+   is considered as always present (condition > 0) or always missing (condition < 0) */
+template <typename algorithmFPType, typename TreeView, CpuType cpu>
+void treeShapRecursive(const TreeView & tree, const algorithmFPType * x, algorithmFPType * phi, size_t iNode,
+                       ShapPathElement<algorithmFPType> * parentPath, int uniqueDepth, algorithmFPType parentZeroFraction,
+                       algorithmFPType parentOneFraction, int parentFeatureIndex, int condition, int conditionFeature,
+                       algorithmFPType conditionFraction)
+{
+    if (conditionFraction == 0) return;
+
+    /* Each level of the recursion works on its own copy of the path placed right after the parent one */
+    ShapPathElement<algorithmFPType> * path = parentPath + uniqueDepth + 1;
+    for (int i = 0; i <= uniqueDepth; ++i) path[i] = parentPath[i];
+
+    if (condition == 0 || conditionFeature != parentFeatureIndex)
+    {
+        extendShapPath<algorithmFPType, cpu>(path, uniqueDepth, parentZeroFraction, parentOneFraction, parentFeatureIndex);
+    }
+
+    if (tree.isLeaf(iNode))
+    {
+        const algorithmFPType leafValue = tree.value(iNode) * conditionFraction;
+        for (int i = 1; i <= uniqueDepth; ++i)
+        {
+            const algorithmFPType w = unwoundShapPathSum<algorithmFPType, cpu>(path, uniqueDepth, i);
+            phi[path[i].featureIndex] += w * (path[i].oneFraction - path[i].zeroFraction) * leafValue;
+        }
+        return;
+    }
+
+    const int splitFeature = tree.featureIndex(iNode);
+    const bool hotIsRight  = tree.goRight(iNode, x);
+    const size_t iHot      = hotIsRight ? tree.right(iNode) : tree.left(iNode);
+    const size_t iCold     = hotIsRight ? tree.left(iNode) : tree.right(iNode);
+
+    const algorithmFPType cover            = tree.cover(iNode);
+    const algorithmFPType hotZeroFraction  = tree.cover(iHot) / cover;
+    const algorithmFPType coldZeroFraction = tree.cover(iCold) / cover;
+    algorithmFPType incomingZeroFraction   = 1;
+    algorithmFPType incomingOneFraction    = 1;
+
+    /* If the feature was already used on the path, its previous split is undone to be redone at this node */
+    int pathIndex = 0;
+    for (; pathIndex <= uniqueDepth; ++pathIndex)
+    {
+        if (path[pathIndex].featureIndex == splitFeature) break;
+    }
+    if (pathIndex != uniqueDepth + 1)
+    {
+        incomingZeroFraction = path[pathIndex].zeroFraction;
+        incomingOneFraction  = path[pathIndex].oneFraction;
+        unwindShapPath<algorithmFPType, cpu>(path, uniqueDepth, pathIndex);
+        --uniqueDepth;
+    }
+
+    algorithmFPType hotConditionFraction  = conditionFraction;
+    algorithmFPType coldConditionFraction = conditionFraction;
+    if (condition > 0 && splitFeature == conditionFeature)
+    {
+        coldConditionFraction = 0;
+        --uniqueDepth;
+    }
+    else if (condition < 0 && splitFeature == conditionFeature)
+    {
+        hotConditionFraction *= hotZeroFraction;
+        coldConditionFraction *= coldZeroFraction;
+        --uniqueDepth;
+    }
+
+    treeShapRecursive<algorithmFPType, TreeView, cpu>(tree, x, phi, iHot, path, uniqueDepth + 1, hotZeroFraction * incomingZeroFraction,
+                                                      incomingOneFraction, splitFeature, condition, conditionFeature, hotConditionFraction);
+    treeShapRecursive<algorithmFPType, TreeView, cpu>(tree, x, phi, iCold, path, uniqueDepth + 1, coldZeroFraction * incomingZeroFraction,
+                                                      algorithmFPType(0), splitFeature, condition, conditionFeature, coldConditionFraction);
+}
+
+/* Adds the feature contributions of the tree for the observation x to phi.
+   The path buffer shall contain at least getShapPathSize(tree.maxDepth()) elements */
+template <typename algorithmFPType, typename TreeView, CpuType cpu>
+void treeShap(const TreeView & tree, const algorithmFPType * x, algorithmFPType * phi, ShapPathElement<algorithmFPType> * path,
+              int condition = 0, int conditionFeature = -1)
+{
+    treeShapRecursive<algorithmFPType, TreeView, cpu>(tree, x, phi, tree.root(), path, 0, algorithmFPType(1), algorithmFPType(1), -1, condition,
+                                                      conditionFeature, algorithmFPType(1));
+}
+
+/* Returns the expected value of the subtree of the node iNode, i.e. its leaf values weighted by their covers */
+template <typename algorithmFPType, typename TreeView, CpuType cpu>
+algorithmFPType treeMeanValue(const TreeView & tree, size_t iNode)
+{
+    if (tree.isLeaf(iNode)) return tree.value(iNode);
+    const size_t iLeft  = tree.left(iNode);
+    const size_t iRight = tree.right(iNode);
+    return (tree.cover(iLeft) * treeMeanValue<algorithmFPType, TreeView, cpu>(tree, iLeft)
+            + tree.cover(iRight) * treeMeanValue<algorithmFPType, TreeView, cpu>(tree, iRight))
+           / tree.cover(iNode);
+}
+
+template <typename TreeView>
+void collectSplitFeatures(const TreeView & tree, size_t iNode, bool * isUsed, int * features, size_t & nFeatures)
+{
+    if (tree.isLeaf(iNode)) return;
+    const int iFeature = tree.featureIndex(iNode);
+    if (!isUsed[iFeature])
+    {
+        isUsed[iFeature]       = true;
+        features[nFeatures++] = iFeature;
+    }
+    collectSplitFeatures(tree, tree.left(iNode), isUsed, features, nFeatures);
+    collectSplitFeatures(tree, tree.right(iNode), isUsed, features, nFeatures);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Access to the tree stored in the DecisionTreeTable layout for SHAP values computation
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class DecisionTreeTableShapView
+{
+public:
+    DecisionTreeTableShapView() {}
+    DecisionTreeTableShapView(const DecisionTreeTable & t, const int * nodeSampleCount, const FeatureTypes & featTypes)
+        : _nodes((const DecisionTreeNode *)t.getArray()), _cover(nodeSampleCount), _featTypes(&featTypes)
+    {
+        _maxDepth = getDepth(0);
+    }
+
+    size_t root() const { return 0; }
+
+    bool isLeaf(size_t i) const { return !_nodes[i].isSplit(); }
+
+    size_t left(size_t i) const { return _nodes[i].leftIndexOrClass; }
+
+    size_t right(size_t i) const { return _nodes[i].leftIndexOrClass + 1; }
+
+    int featureIndex(size_t i) const { return _nodes[i].featureIndex; }
+
+    bool goRight(size_t i, const algorithmFPType * x) const
+    {
+        const DecisionTreeNode & node = _nodes[i];
+        return _featTypes->isUnordered(node.featureIndex) ? (int(x[node.featureIndex]) != int(node.featureValue())) :
+                                                            (x[node.featureIndex] > node.featureValue());
+    }
+
+    algorithmFPType cover(size_t i) const { return algorithmFPType(_cover[i]); }
+
+    algorithmFPType value(size_t i) const { return algorithmFPType(_nodes[i].featureValueOrResponse); }
+
+    size_t maxDepth() const { return _maxDepth; }
+
+private:
+    size_t getDepth(size_t i) const
+    {
+        if (isLeaf(i)) return 0;
+        const size_t leftDepth  = getDepth(left(i));
+        const size_t rightDepth = getDepth(right(i));
+        return 1 + (leftDepth > rightDepth ? leftDepth : rightDepth);
+    }
+
+    const DecisionTreeNode * _nodes = nullptr;
+    const int * _cover              = nullptr;
+    const FeatureTypes * _featTypes = nullptr;
+    size_t _maxDepth                = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Computes SHAP values of the ensemble of trees for each observation of the data.
+// Feature contributions are stored into nFeatures + 1 columns of the result, the last
+// one keeps the bias, i.e. the expected prediction of the model. Feature interactions
+// are stored into (nFeatures + 1) x (nFeatures + 1) columns, the sum of each row of the
+// interactions matrix equals to the corresponding feature contribution.
+// Contributions of each tree are multiplied by the factor.
+// Models with several outputs, e.g. multiclass ones, keep the values of the output iOutput
+// in the segment iOutput of the nOutputs segments of the result row, the trees of each
+// output are processed by a separate call of run.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename TreeView, CpuType cpu>
+class ShapTask
+{
+public:
+    ShapTask(const NumericTable * data, NumericTable * res, bool interactions, size_t nOutputs = 1)
+        : _data(data), _res(res), _interactions(interactions), _nOutputs(nOutputs)
+    {}
+
+    services::Status run(const TreeView * trees, size_t nTrees, size_t treeSize, algorithmFPType factor, services::HostAppIface * pHostApp,
+                         size_t iOutput = 0);
+
+protected:
+    void computeContributions(const TreeView & tree, const algorithmFPType * x, algorithmFPType * res, ShapPathElement<algorithmFPType> * path);
+    void computeInteractions(const TreeView & tree, const int * features, size_t nFeatures, const algorithmFPType * x, algorithmFPType * res,
+                             ShapPathElement<algorithmFPType> * path, algorithmFPType * phi);
+
+protected:
+    const NumericTable * _data;
+    NumericTable * _res;
+    bool _interactions;
+    size_t _nOutputs;
+    size_t _nFeatures = 0;
+};
+
+template <typename algorithmFPType, typename TreeView, CpuType cpu>
+services::Status ShapTask<algorithmFPType, TreeView, cpu>::run(const TreeView * trees, size_t nTrees, size_t treeSize, algorithmFPType factor,
+                                                              services::HostAppIface * pHostApp, size_t iOutput)
+{
+    _nFeatures           = _data->getNumberOfColumns();
+    const size_t nPhi    = _nFeatures + 1;
+    const size_t nResult = _interactions ? nPhi * nPhi : nPhi;
+    const size_t nCols   = nResult * _nOutputs;
+    DAAL_CHECK(_res->getNumberOfColumns() == nCols, services::ErrorIncorrectNumberOfColumnsInOutputNumericTable);
+    DAAL_ASSERT(iOutput < _nOutputs);
+
+    /* Expected value of the ensemble and the features the trees depend on are shared by all observations */
+    size_t maxDepth          = 0;
+    algorithmFPType meanSum = 0;
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        if (maxDepth < trees[iTree].maxDepth()) maxDepth = trees[iTree].maxDepth();
+        meanSum += treeMeanValue<algorithmFPType, TreeView, cpu>(trees[iTree], trees[iTree].root());
+    }
+
+    TArray<int, cpu> aFeatures(_interactions ? nTrees * _nFeatures : 0);
+    TArray<size_t, cpu> aFeaturesOffset(_interactions ? nTrees + 1 : 0);
+    if (_interactions)
+    {
+        DAAL_CHECK_MALLOC(aFeatures.get() && aFeaturesOffset.get());
+        TArrayCalloc<bool, cpu> aIsUsed(_nFeatures);
+        DAAL_CHECK_MALLOC(aIsUsed.get());
+        aFeaturesOffset[0] = 0;
+        for (size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            int * features     = aFeatures.get() + aFeaturesOffset[iTree];
+            size_t nUsed       = 0;
+            collectSplitFeatures(trees[iTree], trees[iTree].root(), aIsUsed.get(), features, nUsed);
+            for (size_t i = 0; i < nUsed; ++i) aIsUsed[features[i]] = false;
+            aFeaturesOffset[iTree + 1] = aFeaturesOffset[iTree] + nUsed;
+        }
+    }
+
+    dtrees::prediction::internal::TileDimensions<algorithmFPType> dim(*_data, nTrees, treeSize, nPhi);
+    /* Segments of the other outputs are kept, so the rows are read as well */
+    WriteRows<algorithmFPType, cpu> resBD(_res, 0, dim.nRowsTotal);
+    DAAL_CHECK_BLOCK_STATUS(resBD);
+    algorithmFPType * const res = resBD.get() + iOutput * nResult;
+    if (_nOutputs > 1)
+    {
+        for (size_t iRow = 0; iRow < dim.nRowsTotal; ++iRow)
+        {
+            services::internal::service_memset_seq<algorithmFPType, cpu>(res + iRow * nCols, algorithmFPType(0), nResult);
+        }
+    }
+    else
+    {
+        services::internal::service_memset<algorithmFPType, cpu>(res, algorithmFPType(0), dim.nRowsTotal * nResult);
+    }
+
+    SafeStatus safeStat;
+    services::Status s;
+    HostAppHelper host(pHostApp, 100);
+    for (size_t iTree = 0; iTree < nTrees; iTree += dim.nTreesInBlock)
+    {
+        if (!s || host.isCancelled(s, 1)) return s;
+        const size_t iLastTree = ((iTree + dim.nTreesInBlock) < nTrees ? iTree + dim.nTreesInBlock : nTrees);
+
+        daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
+            const size_t iStartRow      = iBlock * dim.nRowsInBlock;
+            const size_t nRowsToProcess = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal - iStartRow : dim.nRowsInBlock;
+            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+
+            TArray<ShapPathElement<algorithmFPType>, cpu> aPath(getShapPathSize(maxDepth));
+            TArrayCalloc<algorithmFPType, cpu> aPhi(_interactions ? 3 * nPhi : 0);
+            DAAL_CHECK_MALLOC_THR(aPath.get() && (!_interactions || aPhi.get()));
+
+            /* Rows of the block are processed tree by tree to reuse the tree in cache */
+            for (size_t i = iTree; i < iLastTree; ++i)
+            {
+                for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+                {
+                    const algorithmFPType * x = xBD.get() + iRow * dim.nCols;
+                    algorithmFPType * resRow  = res + (iStartRow + iRow) * nCols;
+                    if (_interactions)
+                    {
+                        computeInteractions(trees[i], aFeatures.get() + aFeaturesOffset[i], aFeaturesOffset[i + 1] - aFeaturesOffset[i], x, resRow,
+                                            aPath.get(), aPhi.get());
+                    }
+                    else
+                    {
+                        computeContributions(trees[i], x, resRow, aPath.get());
+                    }
+                }
+            }
+        });
+
+        s = safeStat.detach();
+    }
+    if (!s) return s;
+
+    const size_t iBias = nResult - 1;
+    daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
+        const size_t iStartRow = iBlock * dim.nRowsInBlock;
+        const size_t iEndRow   = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal : iStartRow + dim.nRowsInBlock;
+        for (size_t iRow = iStartRow; iRow < iEndRow; ++iRow)
+        {
+            algorithmFPType * resRow = res + iRow * nCols;
+            resRow[iBias] += meanSum;
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nResult; ++j) resRow[j] *= factor;
+        }
+    });
+
+    return s;
+}
+
+template <typename algorithmFPType, typename TreeView, CpuType cpu>
+void ShapTask<algorithmFPType, TreeView, cpu>::computeContributions(const TreeView & tree, const algorithmFPType * x, algorithmFPType * res,
+                                                                   ShapPathElement<algorithmFPType> * path)
+{
+    treeShap<algorithmFPType, TreeView, cpu>(tree, x, res, path);
+}
+
+/* Interaction of the features i and j is the half of the difference between the contributions of j computed
+   with i present and with i missing, the main effect of i is its contribution minus its interactions.
+   Only the features the tree splits on have non-zero values, so others are not computed */
+template <typename algorithmFPType, typename TreeView, CpuType cpu>
+void ShapTask<algorithmFPType, TreeView, cpu>::computeInteractions(const TreeView & tree, const int * features, size_t nFeatures,
+                                                                  const algorithmFPType * x, algorithmFPType * res,
+                                                                  ShapPathElement<algorithmFPType> * path, algorithmFPType * phi)
+{
+    const size_t nPhi           = _nFeatures + 1;
+    algorithmFPType * const diag = phi;
+    algorithmFPType * const on   = phi + nPhi;
+    algorithmFPType * const off  = phi + 2 * nPhi;
+
+    treeShap<algorithmFPType, TreeView, cpu>(tree, x, diag, path);
+    for (size_t k = 0; k < nFeatures; ++k)
+    {
+        const int i = features[k];
+        treeShap<algorithmFPType, TreeView, cpu>(tree, x, on, path, 1, i);
+        treeShap<algorithmFPType, TreeView, cpu>(tree, x, off, path, -1, i);
+
+        algorithmFPType * const resRow = res + i * nPhi;
+        for (size_t m = 0; m < nFeatures; ++m)
+        {
+            const int j = features[m];
+            if (j != i)
+            {
+                const algorithmFPType interaction = (on[j] - off[j]) * algorithmFPType(0.5);
+                resRow[j] += interaction;
+                resRow[i] -= interaction;
+            }
+            on[j]  = 0;
+            off[j] = 0;
+        }
+    }
+    for (size_t k = 0; k < nFeatures; ++k)
+    {
+        const int i = features[k];
+        res[i * nPhi + i] += diag[i];
+        diag[i] = 0;
+    }
+}
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace dtrees */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
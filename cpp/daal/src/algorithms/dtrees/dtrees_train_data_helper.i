@@ -110,6 +110,7 @@ struct SplitData
     size_t nLeft;
     size_t iStart;
     bool featureUnordered;
+    bool missingRight; //missing values of the feature go to the right child
     algorithmFPType totalWeights;
     algorithmFPType leftWeights;
 
@@ -118,11 +119,19 @@ struct SplitData
           featureValue(0.0),
           nLeft(0),
           iStart(0),
+          missingRight(false),
           totalWeights(0.0),
           leftWeights(0.0)
     {}
     SplitData(algorithmFPType impDecr, bool bFeatureUnordered)
-        : impurityDecrease(impDecr), featureUnordered(bFeatureUnordered), featureValue(0.0), nLeft(0), iStart(0), totalWeights(0.0), leftWeights(0.0)
+        : impurityDecrease(impDecr),
+          featureUnordered(bFeatureUnordered),
+          missingRight(bFeatureUnordered), //missing values are not equal to any category
+          featureValue(0.0),
+          nLeft(0),
+          iStart(0),
+          totalWeights(0.0),
+          leftWeights(0.0)
     {}
     SplitData(const SplitData & o) = delete;
     void copyTo(SplitData & o) const
@@ -132,6 +141,7 @@ struct SplitData
         o.iStart           = iStart;
         o.left             = left;
         o.featureUnordered = featureUnordered;
+        o.missingRight     = missingRight;
         o.impurityDecrease = impurityDecrease;
         o.totalWeights     = totalWeights;
         o.leftWeights      = leftWeights;
@@ -323,6 +333,22 @@ public:
         return true;
     }
 
+    //initializes the helper with the data and the responses of the other helper,
+    //so that the helpers can process the same set of samples in parallel
+    bool initFrom(const DataHelper & other)
+    {
+        super::init(other._data, nullptr, other._weights);
+        this->_indexedFeatures = other._indexedFeatures;
+        if (!reset(other._aResponse.size())) return false;
+        services::internal::tmemcpy<Response, cpu>(_aResponse.get(), other._aResponse.get(), _aResponse.size());
+        if (other._aWeights.get())
+        {
+            if (!resetWeights(other._aWeights.size())) return false;
+            services::internal::tmemcpy<Weights, cpu>(_aWeights.get(), other._aWeights.get(), _aWeights.size());
+        }
+        return true;
+    }
+
     void getColumnValues(size_t iCol, const IndexType * aIdx, size_t n, algorithmFPType * aVal) const
     {
         if (this->_dataDirect)
@@ -246,6 +246,8 @@ services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::
                                                                       NumericTable * const prob, const size_t nClasses,
                                                                       const VotingMethod votingMethod)
 {
+    /* Returns the scratch blocks of the trees to the system when the prediction ends */
+    services::internal::ArenaScope arenaScope;
     const daal::algorithms::decision_forest::classification::internal::ModelImpl * const pModel =
         static_cast<const daal::algorithms::decision_forest::classification::internal::ModelImpl * const>(m);
     if (_task == nullptr) _task = new PredictClassificationTask<algorithmFPType, cpu>();
@@ -370,9 +372,9 @@ void PredictClassificationTask<algorithmFPType, cpu>::parallelPredict(const algo
                                                                       const size_t blockSize, const size_t residualSize, algorithmFPType * const prob,
                                                                       const size_t iTree)
 {
-    services::internal::TArray<featureIndexType, cpu> tFI(treeSize);
-    services::internal::TArray<leftOrClassType, cpu> tLC(treeSize);
-    services::internal::TArray<algorithmFPType, cpu> tFV(treeSize);
+    services::internal::TArrayArena<featureIndexType, cpu> tFI(treeSize);
+    services::internal::TArrayArena<leftOrClassType, cpu> tLC(treeSize);
+    services::internal::TArrayArena<algorithmFPType, cpu> tFV(treeSize);
 
     featureIndexType * const fi = tFI.get();
     leftOrClassType * const lc  = tLC.get();
@@ -416,8 +418,8 @@ void PredictClassificationTask<algorithmFPType, cpu>::predictByTreeCommon(const
     }
     else
     {
-        services::internal::TArray<uint32_t, cpu> currentNodesT(sizeOfBlock);
-        services::internal::TArray<bool, cpu> isSplitsT(sizeOfBlock);
+        services::internal::TArrayArena<uint32_t, cpu> currentNodesT(sizeOfBlock);
+        services::internal::TArrayArena<bool, cpu> isSplitsT(sizeOfBlock);
         uint32_t * const currentNodes = currentNodesT.get();
         bool * isSplits               = isSplitsT.get();
         if (isSplits && currentNodes)
@@ -84,6 +84,7 @@ public:
     {}
     virtual bool init(const NumericTable * data, const NumericTable * resp, const IndexType * aSample,
                       const NumericTable * weights) DAAL_C11_OVERRIDE;
+    bool initFrom(const UnorderedRespHelper & other) { return super::initFrom(other) && initWorkBuffers(); }
     void convertLeftImpToRight(size_t n, const ImpurityData & total, TSplitData & split)
     {
         computeRightHistogramm(total.hist, split.left.hist, split.left.hist);
@@ -266,6 +267,9 @@ private:
                                          const algorithmFPType accuracy, const ImpurityData & curImpurity, TSplitData & split,
                                          const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const;
 
+private:
+    bool initWorkBuffers();
+
 private:
     const size_t _nClasses;
     //set of buffers for indexed features processing, used in findBestSplitForFeatureIndexed only
@@ -299,6 +303,12 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::init(const NumericTable * data,
                                                      const NumericTable * weights)
 {
     DAAL_CHECK_STATUS_VAR(super::init(data, resp, aSample, weights));
+    return initWorkBuffers();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+bool UnorderedRespHelper<algorithmFPType, cpu>::initWorkBuffers()
+{
     if (this->_indexedFeatures)
     {
         //init work buffers for the computation using indexed features
@@ -0,0 +1,153 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include "daal/include/algorithms/decision_forest/decision_forest_classification_predict.h"
+#include "daal/include/algorithms/decision_forest/decision_forest_classification_training_batch.h"
+#include "daal/include/algorithms/engines/mt2203/mt2203.h"
+#include "daal/include/data_management/data/homogen_numeric_table.h"
+#include "daal/include/services/env_detect.h"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal::algorithms::decision_forest::classification::test {
+
+namespace dm = daal::data_management;
+
+/// Sets the number of threads used by the library and restores it on destruction
+class thread_count_scope {
+public:
+    explicit thread_count_scope(std::size_t thread_count)
+            : default_thread_count_(services::Environment::getInstance()->getNumberOfThreads()) {
+        services::Environment::getInstance()->setNumberOfThreads(thread_count);
+    }
+
+    ~thread_count_scope() {
+        services::Environment::getInstance()->setNumberOfThreads(default_thread_count_);
+    }
+
+private:
+    std::size_t default_thread_count_;
+};
+
+class df_classification_train_test {
+public:
+    using float_t = float;
+
+    static constexpr std::size_t class_count = 3;
+    static constexpr std::size_t column_count = 16;
+    // The nodes with 4096 or more samples on both sides of the split are
+    // built in parallel, so the topmost levels of the trees are large enough
+    static constexpr std::size_t row_count = 50000;
+
+    df_classification_train_test() {
+        std::mt19937 rng(7777);
+        std::normal_distribution<float_t> normal(0.0, 1.0);
+        std::uniform_real_distribution<float_t> noise(-0.5, 0.5);
+
+        x_.resize(row_count * column_count);
+        y_.resize(row_count);
+        for (std::size_t i = 0; i < row_count; i++) {
+            float_t score = 0;
+            for (std::size_t j = 0; j < column_count; j++) {
+                x_[i * column_count + j] = normal(rng);
+                score += x_[i * column_count + j] * float_t(j % 4);
+            }
+            score += noise(rng);
+            y_[i] = (score < -2.0) ? 0 : (score < 2.0 ? 1 : 2);
+        }
+    }
+
+    /// Trains the forest with the given number of threads and returns the
+    /// class probabilities it predicts for the training data
+    std::vector<float_t> train_and_predict(std::size_t thread_count,
+                                           std::size_t tree_count,
+                                           std::size_t max_leaf_node_count,
+                                           bool memory_saving_mode) {
+        const thread_count_scope scope{ thread_count };
+
+        const auto data = get_data_table();
+        training::Batch<float_t> train_algorithm(class_count);
+        train_algorithm.input.set(classifier::training::data, data);
+        const auto labels = dm::HomogenNumericTable<float_t>::create(y_.data(), 1, row_count);
+        train_algorithm.input.set(classifier::training::labels, labels);
+        train_algorithm.parameter().nTrees = tree_count;
+        train_algorithm.parameter().featuresPerNode = 4;
+        train_algorithm.parameter().maxTreeDepth = 10;
+        train_algorithm.parameter().maxLeafNodes = max_leaf_node_count;
+        train_algorithm.parameter().memorySavingMode = memory_saving_mode;
+        train_algorithm.parameter().engine = engines::mt2203::Batch<float_t>::create(777);
+        REQUIRE(train_algorithm.compute().ok());
+        const auto model = train_algorithm.getResult()->get(classifier::training::model);
+
+        prediction::Batch<float_t> predict_algorithm(class_count);
+        predict_algorithm.input.set(classifier::prediction::data, data);
+        predict_algorithm.input.set(classifier::prediction::model, model);
+        predict_algorithm.parameter().resultsToEvaluate =
+            classifier::computeClassLabels | classifier::computeClassProbabilities;
+        REQUIRE(predict_algorithm.compute().ok());
+
+        const auto probabilities =
+            predict_algorithm.getResult()->get(classifier::prediction::probabilities);
+        dm::BlockDescriptor<float_t> block;
+        probabilities->getBlockOfRows(0, row_count, dm::readOnly, block);
+        std::vector<float_t> result(block.getBlockPtr(),
+                                    block.getBlockPtr() + row_count * class_count);
+        probabilities->releaseBlockOfRows(block);
+        return result;
+    }
+
+private:
+    dm::NumericTablePtr get_data_table() {
+        return dm::HomogenNumericTable<float_t>::create(x_.data(), column_count, row_count);
+    }
+
+    std::vector<float_t> x_;
+    std::vector<float_t> y_;
+};
+
+TEST_M(df_classification_train_test,
+       "decision forest gives the same model for the fixed seed and number of threads",
+       "[df][train]") {
+    const std::size_t thread_count = GENERATE(1, 8);
+    const std::size_t max_leaf_node_count = GENERATE(0, 64);
+    CAPTURE(thread_count, max_leaf_node_count);
+
+    const auto first = this->train_and_predict(thread_count, 2, max_leaf_node_count, false);
+    const auto second = this->train_and_predict(thread_count, 2, max_leaf_node_count, false);
+    REQUIRE(first == second);
+}
+
+TEST_M(df_classification_train_test,
+       "decision forest built with nested parallelism matches the serially built one",
+       "[df][train]") {
+    const std::size_t tree_count = GENERATE(1, 2, 3);
+    const std::size_t max_leaf_node_count = GENERATE(0, 64);
+    const bool memory_saving_mode = GENERATE(false, true);
+    CAPTURE(tree_count, max_leaf_node_count, memory_saving_mode);
+
+    // A single thread builds each tree serially, eight threads build the trees
+    // with the parallel split search and the subtrees built in parallel
+    const auto serial =
+        this->train_and_predict(1, tree_count, max_leaf_node_count, memory_saving_mode);
+    const auto parallel =
+        this->train_and_predict(8, tree_count, max_leaf_node_count, memory_saving_mode);
+    REQUIRE(serial == parallel);
+}
+
+} // namespace daal::algorithms::decision_forest::classification::test
@@ -27,6 +27,8 @@
 
 #include "src/algorithms/dtrees/dtrees_train_data_helper.i"
 #include "src/threading/threading.h"
+#include "src/algorithms/service_threading.h"
+#include "src/services/service_unique_ptr.h"
 #include "src/algorithms/dtrees/dtrees_model_impl.h"
 #include "src/algorithms/engines/engine_types_internal.h"
 #include "src/algorithms/service_heap.h"
@@ -380,7 +382,11 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
         daal::services::internal::service_memset<algorithmFPType, cpu>(mainCtx.varImp, 0, nFeatures);
 
     //use tls in case of multiple threads
-    const bool bThreaded = (threader_get_max_threads_number() > 1) && (par.nTrees > 1);
+    const size_t nThreads = threader_get_max_threads_number();
+    const bool bThreaded  = (nThreads > 1) && (par.nTrees > 1);
+    //the threads left when there are fewer trees than threads are used to build each tree in parallel,
+    //the model does not depend on the number of threads
+    const size_t nThreadsPerTree = (par.nTrees < nThreads) ? nThreads / par.nTrees : 1;
     daal::tls<Ctx *> tlsCtx([&]() -> Ctx * {
         //in case of single thread no need to allocate
         return (bThreaded ? createTlsContext<algorithmFPType, cpu, Ctx>(x, par, nClasses) : &mainCtx);
@@ -409,7 +415,19 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
     daal::SafeStatus safeStat;
     daal::threader_for(par.nTrees, par.nTrees, [&](size_t i) {
         if (!safeStat.ok()) return;
-        TaskType * task = tlsTask.local();
+        //the thread waiting for the nested tasks of a tree can start building another one,
+        //so the task can't be shared by the trees of the same thread in this case
+        UniquePtr<TaskType, cpu> treeTask;
+        if (nThreadsPerTree > 1)
+        {
+            Ctx * ctx = tlsCtx.local();
+            DAAL_CHECK_MALLOC_THR(ctx);
+            treeTask.reset(
+                new TaskType(pHostApp, x, y, w, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, binIndex, *ctx, nClasses));
+            DAAL_CHECK_MALLOC_THR(treeTask.get());
+            treeTask->setNumberOfThreadsPerTree(nThreadsPerTree);
+        }
+        TaskType * task = (nThreadsPerTree > 1) ? treeTask.get() : tlsTask.local();
         DAAL_CHECK_MALLOC_THR(task);
         dtrees::internal::Tree * pTree = nullptr;
         numElems[i]                    = 0;
@@ -466,7 +484,12 @@ class TrainBatchTaskBase
 {
 public:
     typedef TreeThreadCtxBase<algorithmFPType, cpu> ThreadCtxType;
+    ~TrainBatchTaskBase()
+    {
+        for (size_t i = 1; i < _aFeatureHelper.size(); ++i) delete _aFeatureHelper[i];
+    }
     services::Status run(engines::internal::BatchBaseImpl * engineImpl, dtrees::internal::Tree *& pTree, size_t & numElems);
+    void setNumberOfThreadsPerTree(size_t nThreads);
 
 protected:
     typedef dtrees::internal::TVector<algorithmFPType, cpu> algorithmFPTypeArray;
@@ -486,13 +509,18 @@ protected:
           _binIndex(binIndex),
           _impurityThreshold(_par.impurityThreshold),
           _nFeatureBufs(1), //for sequential processing
+          _bParallelSubtrees(false),
           _featHelper(featTypes),
           _threadCtx(threadCtx),
           _accuracy(daal::services::internal::EpsilonVal<algorithmFPType>::get()),
           _minSamplesSplit(2),
           _minWeightLeaf(0.),
           _minImpurityDecrease(-daal::services::internal::EpsilonVal<algorithmFPType>::get() * x->getNumberOfRows()),
-          _maxLeafNodes(0)
+          _maxLeafNodes(0),
+          _engineImpl(nullptr),
+          _subtreeEngineState(nullptr),
+          _allocator(&_tree.allocator()),
+          _allocatorMutex(nullptr)
     {
         if (_impurityThreshold < _accuracy) _impurityThreshold = _accuracy;
 
@@ -526,6 +554,36 @@ protected:
         }
     }
 
+    //creates the task building the subtree of the parent task tree in parallel with the parent task
+    TrainBatchTaskBase(const TrainBatchTaskBase & parent, ThreadCtxType & threadCtx, size_t nSamples, void * engineState, size_t * numElems)
+        : _hostApp(parent._hostApp),
+          _data(parent._data),
+          _resp(parent._resp),
+          _weights(parent._weights),
+          _par(parent._par),
+          _nClasses(parent._nClasses),
+          _nSamples(nSamples),
+          _nFeaturesPerNode(parent._nFeaturesPerNode),
+          _helper(nullptr, parent._nClasses),
+          _binIndex(parent._binIndex),
+          _impurityThreshold(parent._impurityThreshold),
+          _nFeatureBufs(1),
+          _bParallelSubtrees(parent._bParallelSubtrees),
+          _featHelper(parent._featHelper),
+          _threadCtx(threadCtx),
+          _accuracy(parent._accuracy),
+          _minSamplesSplit(parent._minSamplesSplit),
+          _minWeightLeaf(parent._minWeightLeaf),
+          _minImpurityDecrease(parent._minImpurityDecrease),
+          _maxLeafNodes(parent._maxLeafNodes),
+          _engineImpl(nullptr),
+          _subtreeEngineState(engineState),
+          _numElems(numElems),
+          _allocator(parent._allocator),
+          _allocatorMutex(parent._allocatorMutex)
+    {}
+    services::Status initSubtree(const TrainBatchTaskBase & parent, size_t iStart);
+
     size_t nFeatures() const { return _data->getNumberOfColumns(); }
     typename DataHelper::NodeType::Base * buildDepthFirst(services::Status & s, size_t iStart, size_t n, size_t level,
                                                           typename DataHelper::ImpurityData & curImpurity, bool & bUnorderedFeaturesUsed,
@@ -533,6 +591,9 @@ protected:
     typename DataHelper::NodeType::Base * buildBestFirst(services::Status & s, size_t iStart, size_t n, size_t level,
                                                          typename DataHelper::ImpurityData & curImpurity, bool & bUnorderedFeaturesUsed,
                                                          size_t nClasses, algorithmFPType totalWeights);
+    void buildSubtrees(services::Status & s, size_t iStart, size_t n, size_t level, const typename DataHelper::ImpurityData & curImpurity,
+                                 typename DataHelper::TSplitData & split, bool & bUnorderedFeaturesUsed, size_t nClasses,
+                                 typename DataHelper::NodeType::Base *& left, typename DataHelper::NodeType::Base *& right);
     template <typename WorkItem>
     typename DataHelper::NodeType::Base * buildNode(const size_t nClasses, size_t & remainingSplitNodes, WorkItem & item,
                                                     typename DataHelper::ImpurityData & impurity);
@@ -565,17 +626,28 @@ protected:
                                                      typename DataHelper::NodeType::Base * left, typename DataHelper::NodeType::Base * right,
                                                      algorithmFPType imp);
     typename DataHelper::NodeType::Leaf * makeLeaf(const IndexType * idx, size_t n, typename DataHelper::ImpurityData & imp, size_t makeLeaf);
+    void deleteNode(typename DataHelper::NodeType::Base * node)
+    {
+        if (_allocatorMutex)
+        {
+            AUTOLOCK(*_allocatorMutex);
+            dtrees::internal::deleteNode<typename DataHelper::NodeType, typename DataHelper::TreeType::Allocator>(node, *_allocator);
+        }
+        else
+            dtrees::internal::deleteNode<typename DataHelper::NodeType, typename DataHelper::TreeType::Allocator>(node, *_allocator);
+    }
 
     bool findBestSplit(size_t iStart, size_t n, const typename DataHelper::ImpurityData & curImpurity, IndexType & iBestFeature,
                        typename DataHelper::TSplitData & split, algorithmFPType totalWeights);
     bool findBestSplitSerial(size_t iStart, size_t n, const typename DataHelper::ImpurityData & curImpurity, IndexType & iBestFeature,
-                             typename DataHelper::TSplitData & split, algorithmFPType totalWeights);
+                             typename DataHelper::TSplitData & split, algorithmFPType totalWeights, bool bChooseFeatures = true);
     bool findBestSplitThreaded(size_t iStart, size_t n, const typename DataHelper::ImpurityData & curImpurity, IndexType & iBestFeature,
                                typename DataHelper::TSplitData & split, algorithmFPType totalWeights);
     bool simpleSplit(size_t iStart, const typename DataHelper::ImpurityData & curImpurity, IndexType & iFeatureBest,
                      typename DataHelper::TSplitData & split);
     void addImpurityDecrease(IndexType iFeature, size_t n, const typename DataHelper::ImpurityData & curImpurity,
                              const typename DataHelper::TSplitData & split);
+    void copyUnorderedSplitToIdx(IndexType * aIdx, const IndexType * bestSplitIdx, size_t n, const typename DataHelper::TSplitData & bestSplit);
 
     void featureValuesToBuf(size_t iFeature, algorithmFPType * featureVal, IndexType * aIdx, size_t n)
     {
@@ -597,11 +669,13 @@ protected:
         {
             *_numElems += n;
             RNGs<IndexType, cpu> rng;
-            rng.uniformWithoutReplacement(_nFeaturesPerNode, _aFeatureIdx.get(), _aFeatureIdx.get() + _nFeaturesPerNode, _engineImpl->getState(), 0,
-                                          n);
+            rng.uniformWithoutReplacement(_nFeaturesPerNode, _aFeatureIdx.get(), _aFeatureIdx.get() + _nFeaturesPerNode, engineState(), 0, n);
         }
     }
 
+    //the subtrees built in parallel use their own random number generators
+    void * engineState() { return _engineImpl ? _engineImpl->getState() : _subtreeEngineState; }
+
     services::Status computeResults(const dtrees::internal::Tree & t);
 
     algorithmFPType computeOOBError(const dtrees::internal::Tree & t, size_t n, const IndexType * aInd);
@@ -617,21 +691,30 @@ protected:
     }
 
 protected:
+    static const size_t _cMinParallelNodeSize = 4096; //nodes with fewer samples are processed by a single thread
+    static const size_t _cSubtreeLevels       = 4;    //number of the topmost levels where the large subtrees use their own generators
+
     TArray<IndexType, cpu> _aFeatureIdx; //indices of features to be used for the soplit at the current level
     DataHelper _helper;
+    TArray<DataHelper *, cpu> _aFeatureHelper; //helpers of the blocks of features processed in parallel, the first one is _helper
     services::internal::HostAppHelper _hostApp;
     typename DataHelper::TreeType _tree;
+    typename DataHelper::TreeType::Allocator * _allocator; //allocator of the tree nodes, the subtree tasks use the one of the parent
+    daal::Mutex * _allocatorMutex;                         //guards the allocator when the subtrees are built in parallel
+    daal::Mutex _treeMutex;
     mutable TVector<IndexType, cpu> _aSample;
     mutable TArray<algorithmFPTypeArray, cpu> _aFeatureBuf;
     mutable TArray<IndexTypeArray, cpu> _aFeatureIndexBuf;
     engines::internal::BatchBaseImpl * _engineImpl;
+    void * _subtreeEngineState;
     const NumericTable * _data;
     const NumericTable * _resp;
     const NumericTable * _weights;
     const Parameter & _par;
     const size_t _nSamples;
     const size_t _nFeaturesPerNode;
-    const size_t _nFeatureBufs; //number of buffers to get feature values (to process features independently in parallel)
+    size_t _nFeatureBufs;    //number of buffers to get feature values (to process features independently in parallel)
+    bool _bParallelSubtrees; //the subtrees with their own generators are built in parallel
 
     const BinIndexType * _binIndex;
     const FeatureTypes & _featHelper;
@@ -690,6 +773,22 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, c
     }
     //init responses buffer, keep _aSample values in it
     DAAL_CHECK_MALLOC(_helper.init(_data, _resp, _aSample.get(), _weights));
+    if (_nFeatureBufs > 1)
+    {
+        if (!_aFeatureHelper.get())
+        {
+            _aFeatureHelper.reset(_nFeatureBufs);
+            DAAL_CHECK_MALLOC(_aFeatureHelper.get());
+            _aFeatureHelper[0] = &_helper;
+            for (size_t i = 1; i < _nFeatureBufs; ++i) _aFeatureHelper[i] = nullptr;
+            for (size_t i = 1; i < _nFeatureBufs; ++i)
+            {
+                _aFeatureHelper[i] = new DataHelper(nullptr, _nClasses);
+                DAAL_CHECK_MALLOC(_aFeatureHelper[i]);
+            }
+        }
+        for (size_t i = 1; i < _nFeatureBufs; ++i) DAAL_CHECK_MALLOC(_aFeatureHelper[i]->initFrom(_helper));
+    }
 
     //use _aSample as an array of response indices stored by helper from now on
     PRAGMA_IVDEP
@@ -727,12 +826,49 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, c
     return s;
 }
 
+template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
+void TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::setNumberOfThreadsPerTree(size_t nThreads)
+{
+    //the features are split into blocks processed in parallel when the best split of a large node is searched for
+    _nFeatureBufs = (nThreads < _nFeaturesPerNode ? nThreads : _nFeaturesPerNode);
+    if (!_nFeatureBufs) _nFeatureBufs = 1;
+
+    //up to 2^_cSubtreeLevels subtrees of a large enough tree are built in parallel
+    _bParallelSubtrees = (nThreads > 1);
+    _allocatorMutex    = (_bParallelSubtrees ? &_treeMutex : nullptr);
+}
+
+template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
+services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::initSubtree(const TrainBatchTaskBase & parent, size_t iStart)
+{
+    _aSample.reset(_nSamples);
+    _aFeatureBuf.reset(_nFeatureBufs);
+    _aFeatureIndexBuf.reset(_nFeatureBufs);
+    _aFeatureIdx.reset(_nFeaturesPerNode * 2);
+    DAAL_CHECK_MALLOC(_aSample.get() && _aFeatureBuf.get() && _aFeatureIndexBuf.get() && _aFeatureIdx.get() && _helper.initFrom(parent._helper));
+
+    _aFeatureBuf[0].reset(_data->getNumberOfRows());
+    _aFeatureIndexBuf[0].reset(_nSamples);
+    DAAL_CHECK_MALLOC(_aFeatureBuf[0].get() && _aFeatureIndexBuf[0].get());
+
+    //the indices of the subtree samples are copied, so the parent task can partition its part of them in parallel
+    services::internal::tmemcpy<IndexType, cpu>(_aSample.get(), parent._aSample.get() + iStart, _nSamples);
+    return services::Status();
+}
+
 template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
 typename DataHelper::NodeType::Split * TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::makeSplit(
     size_t iFeature, algorithmFPType featureValue, bool bUnordered, typename DataHelper::NodeType::Base * left,
     typename DataHelper::NodeType::Base * right, algorithmFPType imp)
 {
-    typename DataHelper::NodeType::Split * pNode = _tree.allocator().allocSplit();
+    typename DataHelper::NodeType::Split * pNode = nullptr;
+    if (_allocatorMutex)
+    {
+        AUTOLOCK(*_allocatorMutex);
+        pNode = _allocator->allocSplit();
+    }
+    else
+        pNode = _allocator->allocSplit();
     pNode->set(iFeature, featureValue, bUnordered);
     pNode->kid[0]   = left;
     pNode->kid[1]   = right;
@@ -744,7 +880,14 @@ template <typename algorithmFPType, typename BinIndexType, typename DataHelper,
 typename DataHelper::NodeType::Leaf * TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::makeLeaf(
     const IndexType * idx, size_t n, typename DataHelper::ImpurityData & imp, size_t nClasses)
 {
-    typename DataHelper::NodeType::Leaf * pNode = _tree.allocator().allocLeaf(_nClasses);
+    typename DataHelper::NodeType::Leaf * pNode = nullptr;
+    if (_allocatorMutex)
+    {
+        AUTOLOCK(*_allocatorMutex);
+        pNode = _allocator->allocLeaf(_nClasses);
+    }
+    else
+        pNode = _allocator->allocLeaf(_nClasses);
     _helper.setLeafData(*pNode, idx, n, imp);
     return pNode;
 }
@@ -771,18 +914,25 @@ typename DataHelper::NodeType::Base * TrainBatchTaskBase<algorithmFPType, BinInd
             < _minImpurityDecrease)
             return makeLeaf(_aSample.get() + iStart, n, curImpurity, nClasses);
         if (_par.varImportance == training::MDI) addImpurityDecrease(iFeature, n, curImpurity, split);
-        typename DataHelper::NodeType::Base * left =
-            buildDepthFirst(s, iStart, split.nLeft, level + 1, split.left, bUnorderedFeaturesUsed, nClasses, split.leftWeights);
-        _helper.convertLeftImpToRight(n, curImpurity, split);
-        typename DataHelper::NodeType::Base * right =
-            s.ok() ? buildDepthFirst(s, iStart + nLeft, split.nLeft, level + 1, split.left, bUnorderedFeaturesUsed, nClasses, split.leftWeights) :
-                     nullptr;
+        typename DataHelper::NodeType::Base * left  = nullptr;
+        typename DataHelper::NodeType::Base * right = nullptr;
+        if ((level < _cSubtreeLevels) && (nLeft >= _cMinParallelNodeSize) && (n - nLeft >= _cMinParallelNodeSize))
+        {
+            buildSubtrees(s, iStart, n, level, curImpurity, split, bUnorderedFeaturesUsed, nClasses, left, right);
+        }
+        else
+        {
+            left = buildDepthFirst(s, iStart, split.nLeft, level + 1, split.left, bUnorderedFeaturesUsed, nClasses, split.leftWeights);
+            _helper.convertLeftImpToRight(n, curImpurity, split);
+            right = s.ok() ?
+                        buildDepthFirst(s, iStart + nLeft, split.nLeft, level + 1, split.left, bUnorderedFeaturesUsed, nClasses, split.leftWeights) :
+                        nullptr;
+        }
         typename DataHelper::NodeType::Base * res = nullptr;
         if (!left || !right || !(res = makeSplit(iFeature, split.featureValue, split.featureUnordered, left, right, curImpurity.var)))
         {
-            if (left) dtrees::internal::deleteNode<typename DataHelper::NodeType, typename DataHelper::TreeType::Allocator>(left, _tree.allocator());
-            if (right)
-                dtrees::internal::deleteNode<typename DataHelper::NodeType, typename DataHelper::TreeType::Allocator>(right, _tree.allocator());
+            if (left) deleteNode(left);
+            if (right) deleteNode(right);
             return nullptr;
         }
         bUnorderedFeaturesUsed |= bool(split.featureUnordered);
@@ -794,6 +944,78 @@ typename DataHelper::NodeType::Base * TrainBatchTaskBase<algorithmFPType, BinInd
     return makeLeaf(_aSample.get() + iStart, n, curImpurity, nClasses);
 }
 
+template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
+void TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::buildSubtrees(
+    services::Status & s, size_t iStart, size_t n, size_t level, const typename DataHelper::ImpurityData & curImpurity,
+    typename DataHelper::TSplitData & split, bool & bUnorderedFeaturesUsed, size_t nClasses, typename DataHelper::NodeType::Base *& left,
+    typename DataHelper::NodeType::Base *& right)
+{
+    //the left subtree uses its own random number generator, its seed is taken from the generator of this task.
+    //The subtrees are seeded at the same levels whatever the number of threads is, so the tree doesn't depend
+    //on the number of threads and on the order of the tasks execution
+    int seed = 0;
+    RNGs<int, cpu> rng;
+    rng.uniform(1, &seed, engineState(), 0, daal::services::internal::MaxVal<int>::get());
+    *_numElems += 1;
+    daal::internal::BaseRNGs<cpu> subtreeEngine(seed);
+    size_t subtreeNumElems = 0;
+
+    const size_t nLeft                = split.nLeft;
+    const algorithmFPType leftWeights = split.leftWeights;
+    typename DataHelper::ImpurityData leftImpurity(split.left);
+    if (!_bParallelSubtrees)
+    {
+        //the left subtree is built by this task with the generator of the subtree
+        engines::internal::BatchBaseImpl * engineImpl = _engineImpl;
+        void * engineStatePtr                         = _subtreeEngineState;
+        size_t * numElems                             = _numElems;
+        _engineImpl                                   = nullptr;
+        _subtreeEngineState                           = subtreeEngine.getState();
+        _numElems                                     = &subtreeNumElems;
+        left                = buildDepthFirst(s, iStart, nLeft, level + 1, leftImpurity, bUnorderedFeaturesUsed, nClasses, leftWeights);
+        _engineImpl         = engineImpl;
+        _subtreeEngineState = engineStatePtr;
+        _numElems           = numElems;
+        if (!s) return;
+
+        _helper.convertLeftImpToRight(n, curImpurity, split);
+        right = buildDepthFirst(s, iStart + nLeft, split.nLeft, level + 1, split.left, bUnorderedFeaturesUsed, nClasses, split.leftWeights);
+        return;
+    }
+
+    TArray<algorithmFPType, cpu> subtreeVarImp;
+    if (_par.varImportance == training::MDI)
+    {
+        subtreeVarImp.reset(nFeatures());
+        DAAL_CHECK_COND_ERROR(subtreeVarImp.get(), s, services::ErrorMemoryAllocationFailed);
+        if (!s) return;
+        daal::services::internal::service_memset<algorithmFPType, cpu>(subtreeVarImp.get(), 0, nFeatures());
+    }
+    ThreadCtxType subtreeCtx(subtreeVarImp.get());
+    TrainBatchTaskBase subtree(*this, subtreeCtx, nLeft, subtreeEngine.getState(), &subtreeNumElems);
+    s = subtree.initSubtree(*this, iStart);
+    if (!s) return;
+
+    services::Status subtreeStatus;
+    bool bSubtreeUnorderedFeaturesUsed = false;
+    auto buildLeft                     = [&]() {
+        left = subtree.buildDepthFirst(subtreeStatus, 0, nLeft, level + 1, leftImpurity, bSubtreeUnorderedFeaturesUsed, nClasses, leftWeights);
+    };
+    daal::task_group group;
+    group.run(buildLeft);
+
+    _helper.convertLeftImpToRight(n, curImpurity, split);
+    right = buildDepthFirst(s, iStart + nLeft, split.nLeft, level + 1, split.left, bUnorderedFeaturesUsed, nClasses, split.leftWeights);
+    group.wait();
+
+    s |= subtreeStatus;
+    bUnorderedFeaturesUsed |= bSubtreeUnorderedFeaturesUsed;
+    if (subtreeVarImp.get())
+    {
+        for (size_t i = 0, nVars = nFeatures(); i < nVars; ++i) _threadCtx.varImp[i] += subtreeVarImp[i];
+    }
+}
+
 template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
 template <typename WorkItem>
 typename DataHelper::NodeType::Base * TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::buildNode(
@@ -991,7 +1213,7 @@ bool TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::simpleS
     {
         IndexType iFeature;
         *_numElems += 1;
-        rng.uniform(1, &iFeature, _engineImpl->getState(), 0, _data->getNumberOfColumns());
+        rng.uniform(1, &iFeature, engineState(), 0, _data->getNumberOfColumns());
         featureValuesToBuf(iFeature, featBuf, aIdx, 2);
         if (featBuf[1] - featBuf[0] <= _accuracy) //all values of the feature are the same
             continue;
@@ -1019,7 +1241,9 @@ bool TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::findBes
 #endif
         return simpleSplit(iStart, curImpurity, iFeatureBest, split);
     }
-    if (_nFeatureBufs == 1) return findBestSplitSerial(iStart, n, curImpurity, iFeatureBest, split, totalWeights);
+    //the indexed feature values are required to get the same split as the serial search does
+    if ((_nFeatureBufs == 1) || (n < _cMinParallelNodeSize) || _par.memorySavingMode)
+        return findBestSplitSerial(iStart, n, curImpurity, iFeatureBest, split, totalWeights);
     return findBestSplitThreaded(iStart, n, curImpurity, iFeatureBest, split, totalWeights);
 }
 
@@ -1029,9 +1253,10 @@ bool TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::findBes
                                                                                              const typename DataHelper::ImpurityData & curImpurity,
                                                                                              IndexType & iBestFeature,
                                                                                              typename DataHelper::TSplitData & bestSplit,
-                                                                                             algorithmFPType totalWeights)
+                                                                                             algorithmFPType totalWeights,
+                                                                                             bool bChooseFeatures)
 {
-    chooseFeatures();
+    if (bChooseFeatures) chooseFeatures();
     const float qMax             = 0.02; //min fracture of observations to be handled as indexed feature values
     IndexType * bestSplitIdx     = featureIndexBuf(0) + iStart;
     IndexType * aIdx             = _aSample.get() + iStart;
@@ -1105,14 +1330,7 @@ bool TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::findBes
     {
         if (bestSplit.iStart)
         {
-            DAAL_ASSERT(bestSplit.iStart + bestSplit.nLeft <= n);
-            services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx + bestSplit.iStart, bestSplit.nLeft);
-            aIdx += bestSplit.nLeft;
-            services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, bestSplit.iStart);
-            aIdx += bestSplit.iStart;
-            bestSplitIdx += bestSplit.iStart + bestSplit.nLeft;
-            if (n > (bestSplit.iStart + bestSplit.nLeft))
-                services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, n - bestSplit.iStart - bestSplit.nLeft);
+            copyUnorderedSplitToIdx(aIdx, bestSplitIdx, n, bestSplit);
             bCopyToIdx = false; //done
         }
     }
@@ -1126,14 +1344,97 @@ bool TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::findBes
 template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
 bool TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::findBestSplitThreaded(size_t iStart, size_t n,
                                                                                                const typename DataHelper::ImpurityData & curImpurity,
-                                                                                               IndexType & iFeatureBest,
-                                                                                               typename DataHelper::TSplitData & split,
+                                                                                               IndexType & iBestFeature,
+                                                                                               typename DataHelper::TSplitData & bestSplit,
                                                                                                algorithmFPType totalWeights)
 {
     chooseFeatures();
-    TArray<typename DataHelper::TSplitData, cpu> aFeatureSplit(_nFeaturesPerNode);
-    //TODO, if parallel for features
-    return false;
+    //the serial search sorts the samples by the values of the features that are not indexed one after another,
+    //so such features are processed serially to get the same split
+    const float qMax = 0.02; //min fracture of observations to be handled as indexed feature values
+    const float fact = float(n);
+    for (size_t i = 0; i < _nFeaturesPerNode; ++i)
+    {
+        if (!(fact > qMax * float(_helper.indexedFeatures().numIndices(_aFeatureIdx[i]))))
+            return findBestSplitSerial(iStart, n, curImpurity, iBestFeature, bestSplit, totalWeights, false);
+    }
+
+    //the features are split into the blocks processed in parallel, each block uses its own helper and buffers
+    //and finds the best split among its features in the same way as findBestSplitSerial() does
+    const size_t nBlocks          = _nFeatureBufs;
+    const size_t nFeaturesInBlock = _nFeaturesPerNode / nBlocks + !!(_nFeaturesPerNode % nBlocks);
+    TArray<typename DataHelper::TSplitData, cpu> aBlockSplit(nBlocks);
+    TArray<int, cpu> aBlockBestSplit(nBlocks);       //index of the best feature of the block in _aFeatureIdx, -1 if not found
+    TArray<int, cpu> aBlockIdxFeatureValue(nBlocks); //index of the best feature value in the array of sorted feature values
+    if (!aBlockSplit.get() || !aBlockBestSplit.get() || !aBlockIdxFeatureValue.get()) //not enough memory to process the blocks
+        return findBestSplitSerial(iStart, n, curImpurity, iBestFeature, bestSplit, totalWeights, false);
+
+    IndexType * aIdx = _aSample.get() + iStart;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const DataHelper & helper     = *_aFeatureHelper[iBlock];
+        const size_t iFirst           = iBlock * nFeaturesInBlock;
+        const size_t iEnd             = (iFirst + nFeaturesInBlock < _nFeaturesPerNode) ? iFirst + nFeaturesInBlock : _nFeaturesPerNode;
+        aBlockBestSplit[iBlock]       = -1;
+        aBlockIdxFeatureValue[iBlock] = -1;
+        typename DataHelper::TSplitData split;
+        for (size_t i = iFirst; i < iEnd; ++i)
+        {
+            const auto iFeature = _aFeatureIdx[i];
+            if (!helper.hasDiffFeatureValues(iFeature, aIdx, n)) continue; //all values of the feature are the same
+            split.featureUnordered = _featHelper.isUnordered(iFeature);
+            const int idxFeatureValue =
+                helper.findBestSplitForFeatureSorted(featureBuf(iBlock), iFeature, aIdx, n, _par.minObservationsInLeafNode, curImpurity, split,
+                                                     _minWeightLeaf, totalWeights, _binIndex + _data->getNumberOfRows() * iFeature);
+            if (idxFeatureValue < 0) continue;
+            aBlockIdxFeatureValue[iBlock] = idxFeatureValue;
+            aBlockBestSplit[iBlock]       = i;
+            split.copyTo(aBlockSplit[iBlock]);
+        }
+    });
+
+    //the earlier block wins if the splits are equally good, as it happens in findBestSplitSerial()
+    int iBestBlock = -1;
+    for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+    {
+        if (aBlockBestSplit[iBlock] < 0) continue;
+        if ((iBestBlock < 0) || (aBlockSplit[iBestBlock].impurityDecrease < aBlockSplit[iBlock].impurityDecrease)) iBestBlock = iBlock;
+    }
+    if (iBestBlock < 0) return false; //not found
+
+    aBlockSplit[iBestBlock].copyTo(bestSplit);
+    iBestFeature                       = _aFeatureIdx[aBlockBestSplit[iBestBlock]];
+    const int idxFeatureValueBestSplit = aBlockIdxFeatureValue[iBestBlock];
+    IndexType * bestSplitIdx           = featureIndexBuf(0) + iStart;
+    //calculate impurity and get split to bestSplitIdx
+    const bool noWeights = !_helper.providedWeights();
+    if (noWeights)
+    {
+        _helper.template finalizeBestSplit<true>(aIdx, _binIndex + _data->getNumberOfRows() * iBestFeature, n, iBestFeature, idxFeatureValueBestSplit,
+                                                 bestSplit, bestSplitIdx);
+    }
+    else
+    {
+        _helper.template finalizeBestSplit<false>(aIdx, _binIndex + _data->getNumberOfRows() * iBestFeature, n, iBestFeature,
+                                                  idxFeatureValueBestSplit, bestSplit, bestSplitIdx);
+    }
+    services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, n);
+    return true;
+}
+
+//put the samples of the split found for the unordered feature to the beginning of aIdx
+template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
+void TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::copyUnorderedSplitToIdx(IndexType * aIdx, const IndexType * bestSplitIdx,
+                                                                                                 size_t n,
+                                                                                                 const typename DataHelper::TSplitData & bestSplit)
+{
+    DAAL_ASSERT(bestSplit.iStart + bestSplit.nLeft <= n);
+    services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx + bestSplit.iStart, bestSplit.nLeft);
+    aIdx += bestSplit.nLeft;
+    services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, bestSplit.iStart);
+    aIdx += bestSplit.iStart;
+    bestSplitIdx += bestSplit.iStart + bestSplit.nLeft;
+    if (n > (bestSplit.iStart + bestSplit.nLeft))
+        services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, n - bestSplit.iStart - bestSplit.nLeft);
 }
 
 template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
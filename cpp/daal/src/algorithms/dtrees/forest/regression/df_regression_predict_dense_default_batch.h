@@ -59,6 +59,22 @@ public:
     services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const regression::Model * m, NumericTable * r);
 };
 
+template <typename algorithmFpType, decision_forest::regression::prediction::Method method, CpuType cpu>
+class PredictShapKernel : public daal::algorithms::Kernel
+{
+public:
+    /**
+     *  \brief Compute SHAP values of decision forest prediction results.
+     *
+     *  \param a[in]    Matrix of input variables X
+     *  \param m[in]    decision forest model obtained on training stage
+     *  \param r[out]   Feature contributions of size n x (p + 1) or feature interactions of size n x (p + 1)^2
+     *  \param interactions[in]  Flag that specifies whether feature interactions are computed instead of contributions
+     */
+    services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const regression::Model * m, NumericTable * r,
+                             bool interactions);
+};
+
 } // namespace internal
 } // namespace prediction
 } // namespace regression
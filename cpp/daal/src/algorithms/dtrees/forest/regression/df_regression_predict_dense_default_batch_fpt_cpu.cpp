@@ -42,6 +42,7 @@ template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
 namespace internal
 {
 template class DAAL_EXPORT PredictKernel<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+template class DAAL_EXPORT PredictShapKernel<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
 }
 } // namespace prediction
 } // namespace regression
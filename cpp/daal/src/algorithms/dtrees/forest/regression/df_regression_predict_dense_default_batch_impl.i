@@ -35,6 +35,7 @@
 #include "src/externals/service_memory.h"
 #include "src/algorithms/dtrees/regression/dtrees_regression_predict_dense_default_impl.i"
 #include "src/services/service_algo_utils.h"
+#include "src/algorithms/dtrees/dtrees_predict_shap_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -90,6 +91,37 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const decision
     return super::run(pHostApp, div);
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// PredictShapKernel
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, prediction::Method method, CpuType cpu>
+services::Status PredictShapKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
+                                                                          const regression::Model * m, NumericTable * r, bool interactions)
+{
+    typedef dtrees::prediction::internal::DecisionTreeTableShapView<algorithmFPType, cpu> TreeView;
+
+    const daal::algorithms::decision_forest::regression::internal::ModelImpl * pModel =
+        static_cast<const daal::algorithms::decision_forest::regression::internal::ModelImpl *>(m);
+    const size_t nTreesTotal = pModel->size();
+    DAAL_CHECK(nTreesTotal, services::ErrorNullModel);
+
+    dtrees::internal::FeatureTypes featHelper;
+    DAAL_CHECK_MALLOC(featHelper.init(*x));
+    TArray<TreeView, cpu> aTree(nTreesTotal);
+    DAAL_CHECK_MALLOC(aTree.get());
+    for (size_t i = 0; i < nTreesTotal; ++i)
+    {
+        /* Covers of the nodes are required to weight the paths, models created by the model builder do not have them */
+        const int * nodeSampleCount = pModel->getNodeSampleCount(i);
+        DAAL_CHECK(nodeSampleCount, services::ErrorModelNotFullInitialized);
+        aTree[i] = TreeView(*pModel->at(i), nodeSampleCount, featHelper);
+    }
+
+    const size_t treeSize = pModel->at(0)->getNumberOfRows() * (sizeof(dtrees::internal::DecisionTreeNode) + sizeof(int));
+    dtrees::prediction::internal::ShapTask<algorithmFPType, TreeView, cpu> task(x, r, interactions);
+    return task.run(aTree.get(), nTreesTotal, treeSize, algorithmFPType(1) / algorithmFPType(nTreesTotal), pHostApp);
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace regression */
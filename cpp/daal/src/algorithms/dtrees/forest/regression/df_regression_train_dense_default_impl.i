@@ -99,6 +99,7 @@ public:
     OrderedRespHelper(const dtrees::internal::IndexedFeatures * indexedFeatures, size_t dummy) : super(indexedFeatures) {}
     virtual bool init(const NumericTable * data, const NumericTable * resp, const IndexType * aSample,
                       const NumericTable * weights) DAAL_C11_OVERRIDE;
+    bool initFrom(const OrderedRespHelper & other) { return super::initFrom(other) && initWorkBuffers(); }
     void convertLeftImpToRight(size_t n, const ImpurityData & total, TSplitData & split)
     {
         subtractImpurity<double, cpu>(total.var, total.mean, split.left.var, split.left.mean, split.leftWeights, split.left.var, split.left.mean,
@@ -182,6 +183,7 @@ public:
 #endif
 
 private:
+    bool initWorkBuffers();
 #ifdef DEBUG_CHECK_IMPURITY
     algorithmFPType calcResponse(algorithmFPType & res, const IndexType * idx, size_t n) const;
 #endif
@@ -224,6 +226,12 @@ bool OrderedRespHelper<algorithmFPType, cpu>::init(const NumericTable * data, co
                                                    const NumericTable * weights)
 {
     DAAL_CHECK_STATUS_VAR(super::init(data, resp, aSample, weights));
+    return initWorkBuffers();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+bool OrderedRespHelper<algorithmFPType, cpu>::initWorkBuffers()
+{
     if (this->_indexedFeatures)
     {
         //init work buffer for the computation using indexed features
@@ -54,8 +54,8 @@ BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
-    Input * input                           = static_cast<Input *>(_in);
-    classifier::prediction::Result * result = static_cast<classifier::prediction::Result *>(_res);
+    Input * input   = static_cast<Input *>(_in);
+    Result * result = static_cast<Result *>(_res);
 
     NumericTable * a               = static_cast<NumericTable *>(input->get(classifier::prediction::data).get());
     gbt::classification::Model * m = static_cast<gbt::classification::Model *>(input->get(classifier::prediction::model).get());
@@ -69,9 +69,11 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * prob = ((par->resultsToEvaluate & classifier::ResultToComputeId::computeClassProbabilities) ?
                                result->get(classifier::prediction::probabilities).get() :
                                nullptr);
+    NumericTable * contributions = ((par->resultsToCompute & computeShapContributions) ? result->get(shapContributions).get() : nullptr);
+    NumericTable * interactions  = ((par->resultsToCompute & computeShapInteractions) ? result->get(shapInteractions).get() : nullptr);
 
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), a, m, r, prob, par->nClasses, par->nIterations);
+                       daal::services::internal::hostApp(*input), a, m, r, prob, par->nClasses, par->nIterations, contributions, interactions);
 }
 
 } // namespace interface2
@@ -55,6 +55,7 @@ namespace prediction
 namespace internal
 {
 using gbt::prediction::internal::VECTOR_BLOCK_SIZE;
+using gbt::regression::prediction::internal::predictShap;
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // PredictBinaryClassificationTask
@@ -201,17 +202,32 @@ protected:
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
                                                                       const classification::Model * m, NumericTable * r, NumericTable * prob,
-                                                                      size_t nClasses, size_t nIterations)
+                                                                      size_t nClasses, size_t nIterations, NumericTable * contributions,
+                                                                      NumericTable * interactions)
 {
     const daal::algorithms::gbt::classification::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::gbt::classification::internal::ModelImpl *>(m);
-    if (nClasses == 2)
+    services::Status s;
+    if (r || prob)
     {
-        PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob);
-        return task.run(pModel, nIterations, pHostApp);
+        if (nClasses == 2)
+        {
+            PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob);
+            s = task.run(pModel, nIterations, pHostApp);
+        }
+        else
+        {
+            PredictMulticlassTask<algorithmFPType, cpu> task(x, r, prob);
+            s = task.run(pModel, nClasses, nIterations, pHostApp);
+        }
     }
-    PredictMulticlassTask<algorithmFPType, cpu> task(x, r, prob);
-    return task.run(pModel, nClasses, nIterations, pHostApp);
+
+    /* The binary model has one tree per iteration, the multiclass one has a tree per class which explains its raw value */
+    const size_t nOutputs    = (nClasses > 2 ? nClasses : 1);
+    const size_t nTreesTotal = (nIterations ? nIterations * nOutputs : pModel->size());
+    if (s && contributions) s = predictShap<algorithmFPType, cpu>(pHostApp, x, pModel, contributions, nTreesTotal, nOutputs, false);
+    if (s && interactions) s = predictShap<algorithmFPType, cpu>(pHostApp, x, pModel, interactions, nTreesTotal, nOutputs, true);
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -56,9 +56,11 @@ public:
      *  \param r[out]   Prediction results
      *  \param nClasses[in]     Number of classes in gradient boosted trees algorithm parameter
      *  \param nIterations[in]  Number of iterations to predict in gradient boosted trees algorithm parameter
+     *  \param contributions[out]  SHAP feature contributions of the raw boosted values, computed if not null
+     *  \param interactions[out]   SHAP feature interactions of the raw boosted values, computed if not null
      */
     services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const classification::Model * m, NumericTable * r,
-                             NumericTable * prob, size_t nClasses, size_t nIterations);
+                             NumericTable * prob, size_t nClasses, size_t nIterations, NumericTable * contributions, NumericTable * interactions);
 };
 
 } // namespace internal
@@ -0,0 +1,81 @@
+/* file: gbt_classification_predict_result_fpt.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees classification prediction result
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_classification_predict_types.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+namespace interface1
+{
+/**
+ * Allocates memory for storing prediction results of gradient boosted trees algorithm
+ * \tparam  algorithmFPType     Data type for storing prediction results
+ * \param[in] input     Pointer to the input objects of the classification algorithm
+ * \param[in] parameter Pointer to the parameters of the classification algorithm
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method)
+{
+    services::Status s = classifier::prediction::Result::allocate<algorithmFPType>(input, parameter, method);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    const interface2::Parameter * const par = dynamic_cast<const interface2::Parameter *>(parameter);
+    DAAL_CHECK(par, services::ErrorNullParameterNotSupported);
+    if (!(par->resultsToCompute & (computeShapContributions | computeShapInteractions))) return s;
+
+    const data_management::NumericTablePtr data = static_cast<const Input *>(input)->get(classifier::prediction::data);
+    const size_t nRows                          = data->getNumberOfRows();
+    const size_t nPhi                           = data->getNumberOfColumns() + 1;
+    const size_t nOutputs                       = (par->nClasses > 2 ? par->nClasses : 1);
+    if (par->resultsToCompute & computeShapContributions)
+    {
+        set(shapContributions, data_management::HomogenNumericTable<algorithmFPType>::create(
+                                   nOutputs * nPhi, nRows, data_management::NumericTableIface::doAllocate, 0, &s));
+    }
+    if (s.ok() && (par->resultsToCompute & computeShapInteractions))
+    {
+        set(shapInteractions, data_management::HomogenNumericTable<algorithmFPType>::create(
+                                  nOutputs * nPhi * nPhi, nRows, data_management::NumericTableIface::doAllocate, 0, &s));
+    }
+    return s;
+}
+
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                    const daal::algorithms::Parameter * parameter, int method);
+
+} // namespace interface1
+} // namespace prediction
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
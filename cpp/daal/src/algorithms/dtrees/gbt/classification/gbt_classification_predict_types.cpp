@@ -41,6 +41,8 @@ namespace prediction
 {
 namespace interface1
 {
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_GBT_CLASSIFICATION_PREDICTION_RESULT_ID);
+
 /**
  * Returns an input object for making gradient boosted trees model-based prediction
  * \param[in] id    Identifier of the input object
@@ -113,6 +115,58 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
     return s;
 }
 
+Result::Result() : classifier::prediction::Result(lastResultId + 1) {}
+
+/**
+ * Returns the result of gradient boosted trees model-based prediction
+ * \param[in] id    Identifier of the result
+ * \return          Result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the result of gradient boosted trees model-based prediction
+ * \param[in] id      Identifier of the result
+ * \param[in] value   Pointer to the result
+ */
+void Result::set(ResultId id, const NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of prediction results of gradient boosted trees algorithm
+ * \param[in] input     Pointer to the the input object
+ * \param[in] parameter Pointer to the algorithm parameters
+ * \param[in] method    Computation method
+ */
+services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, classifier::prediction::Result::checkImpl(input, parameter));
+
+    const interface2::Parameter * const par = dynamic_cast<const interface2::Parameter *>(parameter);
+    DAAL_CHECK(par, services::ErrorNullParameterNotSupported);
+    if (!(par->resultsToCompute & (computeShapContributions | computeShapInteractions))) return s;
+
+    const NumericTablePtr data = static_cast<const Input *>(input)->get(classifier::prediction::data);
+    const size_t nRows         = data->getNumberOfRows();
+    const size_t nPhi          = data->getNumberOfColumns() + 1;
+    const size_t nOutputs      = (par->nClasses > 2 ? par->nClasses : 1);
+    if (par->resultsToCompute & computeShapContributions)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(shapContributions).get(), shapContributionsStr(), 0, 0, nOutputs * nPhi, nRows));
+    }
+    if (par->resultsToCompute & computeShapInteractions)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(shapInteractions).get(), shapInteractionsStr(), 0, 0, nOutputs * nPhi * nPhi, nRows));
+    }
+    return s;
+}
+
 } // namespace interface1
 } // namespace prediction
 } // namespace classification
@@ -0,0 +1,134 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "daal/include/algorithms/gradient_boosted_trees/gbt_classification_predict.h"
+#include "daal/include/algorithms/gradient_boosted_trees/gbt_classification_training_batch.h"
+#include "daal/include/data_management/data/homogen_numeric_table.h"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal::algorithms::gbt::classification::test {
+
+namespace dm = daal::data_management;
+
+template <typename Float>
+static std::vector<Float> get_data(const dm::NumericTablePtr& table) {
+    const std::size_t row_count = table->getNumberOfRows();
+    const std::size_t column_count = table->getNumberOfColumns();
+    dm::BlockDescriptor<Float> block;
+    table->getBlockOfRows(0, row_count, dm::readOnly, block);
+    std::vector<Float> data(block.getBlockPtr(),
+                            block.getBlockPtr() + row_count * column_count);
+    table->releaseBlockOfRows(block);
+    return data;
+}
+
+// SHAP values explain the raw boosted values, so the probabilities are the
+// sigmoid of the sum of the contributions in the binary case and the softmax
+// of the sums of the contributions of the classes in the multiclass case
+TEMPLATE_TEST("SHAP contributions sum up to the raw boosted values", "[gbt][shap]", float, double) {
+    using Float = TestType;
+
+    const std::size_t class_count = GENERATE(2, 3);
+    CAPTURE(class_count);
+
+    const std::size_t row_count = 300;
+    const std::size_t column_count = 3;
+    std::mt19937 rng(7777);
+    std::uniform_real_distribution<Float> distr(Float(0), Float(1));
+    std::vector<Float> x(row_count * column_count);
+    std::vector<Float> y(row_count);
+    for (std::size_t i = 0; i < row_count; i++) {
+        Float* row = x.data() + i * column_count;
+        for (std::size_t j = 0; j < column_count; j++) {
+            row[j] = distr(rng);
+        }
+        const Float score = row[0] + row[1] * row[2];
+        y[i] = Float(std::size_t(score * Float(class_count) / Float(2)) % class_count);
+    }
+    const auto data = dm::HomogenNumericTable<Float>::create(x.data(), column_count, row_count);
+
+    training::Batch<Float> train_algorithm(class_count);
+    train_algorithm.input.set(classifier::training::data, data);
+    train_algorithm.input.set(classifier::training::labels,
+                              dm::HomogenNumericTable<Float>::create(y.data(), 1, row_count));
+    train_algorithm.parameter().maxIterations = 10;
+    train_algorithm.parameter().maxTreeDepth = 4;
+    REQUIRE(train_algorithm.compute().ok());
+    const auto model = train_algorithm.getResult()->get(classifier::training::model);
+
+    prediction::Batch<Float> algorithm(class_count);
+    algorithm.input.set(classifier::prediction::data, data);
+    algorithm.input.set(classifier::prediction::model, model);
+    algorithm.parameter().resultsToEvaluate = classifier::computeClassProbabilities;
+    algorithm.parameter().resultsToCompute =
+        prediction::computeShapContributions | prediction::computeShapInteractions;
+    REQUIRE(algorithm.compute().ok());
+
+    const auto result = algorithm.getResult();
+    const std::size_t output_count = (class_count > 2) ? class_count : 1;
+    const std::size_t phi_count = column_count + 1;
+    REQUIRE(result->get(prediction::shapContributions)->getNumberOfColumns() ==
+            output_count * phi_count);
+    REQUIRE(result->get(prediction::shapInteractions)->getNumberOfColumns() ==
+            output_count * phi_count * phi_count);
+
+    const auto probabilities = get_data<Float>(result->get(classifier::prediction::probabilities));
+    const auto contributions = get_data<Float>(result->get(prediction::shapContributions));
+    const auto interactions = get_data<Float>(result->get(prediction::shapInteractions));
+
+    const Float tolerance = std::is_same_v<Float, float> ? Float(1e-4) : Float(1e-10);
+    std::vector<Float> raw(output_count);
+    for (std::size_t i = 0; i < row_count; i++) {
+        CAPTURE(i);
+        for (std::size_t c = 0; c < output_count; c++) {
+            const Float* phi = contributions.data() + (i * output_count + c) * phi_count;
+            const Float* output_interactions =
+                interactions.data() + (i * output_count + c) * phi_count * phi_count;
+            raw[c] = 0;
+            for (std::size_t j = 0; j < phi_count; j++) {
+                raw[c] += phi[j];
+
+                Float row_sum = 0;
+                for (std::size_t k = 0; k < phi_count; k++) {
+                    row_sum += output_interactions[j * phi_count + k];
+                }
+                REQUIRE(std::abs(row_sum - phi[j]) <= tolerance * (Float(1) + std::abs(phi[j])));
+            }
+        }
+
+        const Float* prob = probabilities.data() + i * class_count;
+        if (class_count == 2) {
+            const Float expected = Float(1) / (Float(1) + std::exp(-raw[0]));
+            REQUIRE(std::abs(prob[1] - expected) <= tolerance);
+        }
+        else {
+            Float exp_sum = 0;
+            for (std::size_t c = 0; c < class_count; c++) {
+                exp_sum += std::exp(raw[c]);
+            }
+            for (std::size_t c = 0; c < class_count; c++) {
+                REQUIRE(std::abs(prob[c] - std::exp(raw[c]) / exp_sum) <= tolerance);
+            }
+        }
+    }
+}
+
+} // namespace daal::algorithms::gbt::classification::test
@@ -67,7 +67,7 @@ void ModelImpl::traverseDF(size_t iTree, algorithms::regression::TreeNodeVisitor
     const gbt::prediction::internal::FeatureIndexType * splitFeatures = gbtTree.getFeatureIndexesForSplit();
 
     auto onSplitNodeFunc = [&splitPoints, &splitFeatures, &visitor](size_t iRowInTable, size_t level) -> bool {
-        return visitor.onSplitNode(level, splitFeatures[iRowInTable], splitPoints[iRowInTable]);
+        return visitor.onSplitNode(level, gbt::prediction::internal::getFeatureIndex(splitFeatures[iRowInTable]), splitPoints[iRowInTable]);
     };
 
     auto onLeafNodeFunc = [&splitPoints, &visitor](size_t iRowInTable, size_t level) -> bool {
@@ -87,7 +87,7 @@ void ModelImpl::traverseBF(size_t iTree, algorithms::regression::TreeNodeVisitor
     const gbt::prediction::internal::FeatureIndexType * splitFeatures = gbtTree.getFeatureIndexesForSplit();
 
     auto onSplitNodeFunc = [&splitFeatures, &splitPoints, &visitor](size_t iRowInTable, size_t level) -> bool {
-        return visitor.onSplitNode(level, splitFeatures[iRowInTable], splitPoints[iRowInTable]);
+        return visitor.onSplitNode(level, gbt::prediction::internal::getFeatureIndex(splitFeatures[iRowInTable]), splitPoints[iRowInTable]);
     };
 
     auto onLeafNodeFunc = [&splitPoints, &visitor](size_t iRowInTable, size_t level) -> bool {
@@ -118,7 +118,7 @@ void ModelImpl::traverseBFS(size_t iTree, tree_utils::regression::TreeNodeVisito
 
         descSplit.impurity         = imp != nullptr ? imp[iRowInTable] : 0;
         descSplit.nNodeSampleCount = nodeSamplesCount != nullptr ? (size_t)(nodeSamplesCount[iRowInTable]) : 0;
-        descSplit.featureIndex     = splitFeatures[iRowInTable];
+        descSplit.featureIndex     = gbt::prediction::internal::getFeatureIndex(splitFeatures[iRowInTable]);
         descSplit.featureValue     = splitPoints[iRowInTable];
         descSplit.level            = level;
         return visitor.onSplitNode(descSplit);
@@ -158,7 +158,7 @@ void ModelImpl::traverseDFS(size_t iTree, tree_utils::regression::TreeNodeVisito
 
         descSplit.impurity         = imp != nullptr ? imp[iRowInTable] : 0;
         descSplit.nNodeSampleCount = nodeSamplesCount != nullptr ? (size_t)(nodeSamplesCount[iRowInTable]) : 0;
-        descSplit.featureIndex     = splitFeatures[iRowInTable];
+        descSplit.featureIndex     = gbt::prediction::internal::getFeatureIndex(splitFeatures[iRowInTable]);
         descSplit.featureValue     = splitPoints[iRowInTable];
         descSplit.level            = level;
         return visitor.onSplitNode(descSplit);
@@ -146,7 +146,7 @@ public:
 
                     sons[nSons++]              = NodeType::castSplit(p->left());
                     sons[nSons++]              = NodeType::castSplit(p->right());
-                    featureIndexes[idxInTable] = p->featureIdx;
+                    featureIndexes[idxInTable] = gbt::prediction::internal::makeSplitFeature(p->featureIdx, p->missingRight, p->featureUnordered);
                 }
                 else
                 {
@@ -270,6 +270,7 @@ public:
     void clear();
 
     const GbtDecisionTree * at(const size_t idx) const;
+    const int * getNodeSampleCount(const size_t idx) const { return super::getNodeSampleCount(idx); }
 
     static void decisionTreeToGbtTree(const DecisionTreeTable & tree, GbtDecisionTree & gbtTree);
     static services::Status convertDecisionTreesToGbtTrees(data_management::DataCollectionPtr & serializationData);
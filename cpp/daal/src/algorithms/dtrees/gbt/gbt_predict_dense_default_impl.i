@@ -30,6 +30,7 @@
 #include "src/algorithms/dtrees/dtrees_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
 #include "src/algorithms/dtrees/gbt/gbt_internal.h"
+#include "src/services/service_utils.h"
 
 namespace daal
 {
@@ -45,6 +46,43 @@ typedef float ModelFPType;
 typedef uint32_t FeatureIndexType;
 const FeatureIndexType VECTOR_BLOCK_SIZE = 64;
 
+// The most significant bit of the split feature index keeps the default direction of the split.
+// The bit is set if missing values of the feature go to the opposite child than they did before
+// the default directions were learned: to the right one for ordered splits and to the left one for
+// categorical splits. The bit is cleared in the models saved earlier, so they route missing values as before
+const FeatureIndexType MISSING_FLIP_BIT   = FeatureIndexType(1) << 31;
+const FeatureIndexType FEATURE_INDEX_MASK = ~MISSING_FLIP_BIT;
+
+inline FeatureIndexType getFeatureIndex(FeatureIndexType splitFeature)
+{
+    return splitFeature & FEATURE_INDEX_MASK;
+}
+
+inline FeatureIndexType getMissingFlip(FeatureIndexType splitFeature)
+{
+    return splitFeature >> 31;
+}
+
+inline FeatureIndexType makeSplitFeature(FeatureIndexType featureIndex, bool missingRight, bool unordered)
+{
+    return featureIndex | ((missingRight != unordered) ? MISSING_FLIP_BIT : FeatureIndexType(0));
+}
+
+// Returns 1 if the value goes to the right child of the split and 0 otherwise. Comparison with NaN is false,
+// so the default direction is merged with the result of the comparison without branches
+template <typename algorithmFPType, CpuType cpu>
+inline FeatureIndexType goRightOrdered(algorithmFPType value, ModelFPType splitPoint, FeatureIndexType splitFeature)
+{
+    return FeatureIndexType(value > splitPoint) | (FeatureIndexType(services::internal::isNaN<cpu>(value)) & getMissingFlip(splitFeature));
+}
+
+// Inequality with NaN is true, so missing values go to the right child unless the default direction is flipped
+template <typename algorithmFPType, CpuType cpu>
+inline FeatureIndexType goRightUnordered(algorithmFPType value, ModelFPType splitPoint, FeatureIndexType splitFeature)
+{
+    return FeatureIndexType(value != splitPoint) ^ (FeatureIndexType(services::internal::isNaN<cpu>(value)) & getMissingFlip(splitFeature));
+}
+
 template <typename algorithmFPType, typename DecisionTreeType, CpuType cpu>
 inline void predictForTreeVector(const DecisionTreeType & t, const FeatureTypes & featTypes, const algorithmFPType * x, algorithmFPType v[])
 {
@@ -67,10 +105,13 @@ inline void predictForTreeVector(const DecisionTreeType & t, const FeatureTypes
             {
                 const FeatureIndexType idx          = i[k];
                 const FeatureIndexType splitFeature = fIndexes[idx];
-                const ModelFPType valueFromDataSet  = x[splitFeature + k * nFeat];
+                const FeatureIndexType iFeature     = getFeatureIndex(splitFeature);
+                const ModelFPType valueFromDataSet  = x[iFeature + k * nFeat];
                 const ModelFPType splitPoint        = values[idx];
 
-                i[k] = idx * 2 + (featTypes.isUnordered(splitFeature) ? valueFromDataSet != splitPoint : valueFromDataSet > splitPoint);
+                i[k] = idx * 2
+                       + (featTypes.isUnordered(iFeature) ? goRightUnordered<ModelFPType, cpu>(valueFromDataSet, splitPoint, splitFeature) :
+                                                            goRightOrdered<ModelFPType, cpu>(valueFromDataSet, splitPoint, splitFeature));
             }
         }
     }
@@ -82,8 +123,9 @@ inline void predictForTreeVector(const DecisionTreeType & t, const FeatureTypes
             PRAGMA_VECTOR_ALWAYS
             for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k++)
             {
-                const FeatureIndexType idx = i[k];
-                i[k]                       = idx * 2 + (x[fIndexes[idx] + k * nFeat] > values[idx]);
+                const FeatureIndexType idx          = i[k];
+                const FeatureIndexType splitFeature = fIndexes[idx];
+                i[k] = idx * 2 + goRightOrdered<algorithmFPType, cpu>(x[getFeatureIndex(splitFeature) + k * nFeat], values[idx], splitFeature);
             }
         }
     }
@@ -110,20 +152,74 @@ inline algorithmFPType predictForTree(const DecisionTreeType & t, const FeatureT
     {
         for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
         {
-            i = i * 2 + (featTypes.isUnordered(fIndexes[i]) ? int(x[fIndexes[i]]) != int(values[i]) : x[fIndexes[i]] > values[i]);
+            const FeatureIndexType iFeature = getFeatureIndex(fIndexes[i]);
+            i = i * 2 + (featTypes.isUnordered(iFeature) ? goRightUnordered<algorithmFPType, cpu>(x[iFeature], values[i], fIndexes[i]) :
+                                                           goRightOrdered<algorithmFPType, cpu>(x[iFeature], values[i], fIndexes[i]));
         }
     }
     else
     {
         for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
         {
-            i = i * 2 + (x[fIndexes[i]] > values[i]);
+            i = i * 2 + goRightOrdered<algorithmFPType, cpu>(x[getFeatureIndex(fIndexes[i])], values[i], fIndexes[i]);
         }
     }
 
     return values[i];
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Access to the tree stored in the gradient boosted trees layout for SHAP values computation.
+// Nodes are numbered from 1 as in the prediction functions above, the children of the node i
+// are 2 * i and 2 * i + 1. Leaves above the last level are duplicated down to it, so a node is
+// a leaf if its left child is the copy of it.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename DecisionTreeType, CpuType cpu>
+class GbtDecisionTreeShapView
+{
+public:
+    GbtDecisionTreeShapView() {}
+    GbtDecisionTreeShapView(const DecisionTreeType & t, const int * nodeSampleCount, const FeatureTypes & featTypes)
+        : _values(t.getSplitPoints() - 1),
+          _fIndexes(t.getFeatureIndexesForSplit() - 1),
+          _cover(nodeSampleCount - 1),
+          _featTypes(&featTypes),
+          _maxLvl(t.getMaxLvl()),
+          _firstLeaf(FeatureIndexType(1) << t.getMaxLvl())
+    {}
+
+    size_t root() const { return 1; }
+
+    bool isLeaf(size_t i) const { return i >= _firstLeaf || (_values[2 * i] == _values[i] && _fIndexes[2 * i] == _fIndexes[i]); }
+
+    size_t left(size_t i) const { return 2 * i; }
+
+    size_t right(size_t i) const { return 2 * i + 1; }
+
+    int featureIndex(size_t i) const { return int(getFeatureIndex(_fIndexes[i])); }
+
+    bool goRight(size_t i, const algorithmFPType * x) const
+    {
+        const FeatureIndexType iFeature = getFeatureIndex(_fIndexes[i]);
+        return _featTypes->isUnordered(iFeature) ? goRightUnordered<algorithmFPType, cpu>(x[iFeature], _values[i], _fIndexes[i]) :
+                                                   goRightOrdered<algorithmFPType, cpu>(x[iFeature], _values[i], _fIndexes[i]);
+    }
+
+    algorithmFPType cover(size_t i) const { return algorithmFPType(_cover[i]); }
+
+    algorithmFPType value(size_t i) const { return algorithmFPType(_values[i]); }
+
+    size_t maxDepth() const { return _maxLvl; }
+
+private:
+    const ModelFPType * _values        = nullptr;
+    const FeatureIndexType * _fIndexes = nullptr;
+    const int * _cover                 = nullptr;
+    const FeatureTypes * _featTypes    = nullptr;
+    size_t _maxLvl                     = 0;
+    size_t _firstLeaf                  = 0;
+};
+
 template <typename algorithmFPType>
 struct TileDimensions
 {
@@ -73,19 +73,22 @@ public:
                      DAAL_INT & idxFeatureBestSplit, bool featureUnordered,
                      SharedDataForTree<algorithmFPType, RowIndexType, BinIndexType, cpu> & data, size_t iFeature)
     {
+        const DAAL_INT idxMissing = data.ctx.dataHelper().indexedFeatures().missingIndex(iFeature);
         if (featureUnordered)
-            findCategorical(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit);
+            findCategorical(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit, idxMissing);
         else
-            findOrdered(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit, data, iFeature);
+            findOrdered(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit, idxMissing);
     }
 
+    // The bin of missing values is the last one. It is excluded from the scan, instead the missing values
+    // are tried on both sides of each split and the best side becomes the default direction of the split
     static void findOrdered(size_t n, size_t minObservationsInLeafNode, algorithmFPType lambda, SplitType & split, const ResultType & res,
-                            DAAL_INT & idxFeatureBestSplit, SharedDataForTree<algorithmFPType, RowIndexType, BinIndexType, cpu> & data,
-                            size_t iFeature)
+                            DAAL_INT & idxFeatureBestSplit, DAAL_INT idxMissing)
     {
-        const size_t nUnique = res.nUnique;
-        auto * aGHSum        = res.ghSums;
-        size_t nLeft         = 0;
+        const size_t nUnique  = (idxMissing >= 0) ? size_t(idxMissing) : res.nUnique;
+        auto * aGHSum         = res.ghSums;
+        const size_t nMissing = (idxMissing >= 0) ? aGHSum[idxMissing].n : 0;
+        size_t nLeft          = 0;
 
         ImpurityType imp(res.gTotal, res.hTotal);
 
@@ -98,24 +101,44 @@ public:
             nLeft += aGHSum[i].n;
             if ((n - nLeft) < minObservationsInLeafNode) break;
             left.add(aGHSum[i]);
-            if (nLeft < minObservationsInLeafNode) continue;
 
-            ImpurityType right(imp, left);
-            //the part of the impurity decrease dependent on split itself
-            const algorithmFPType impDecrease = left.value(lambda) + right.value(lambda);
-            if ((impDecrease > bestImpDecrease))
+            if (nLeft >= minObservationsInLeafNode)
             {
-                split.left          = left;
-                split.nLeft         = nLeft;
-                idxFeatureBestSplit = i;
-                bestImpDecrease     = impDecrease;
+                ImpurityType right(imp, left);
+                //the part of the impurity decrease dependent on split itself
+                const algorithmFPType impDecrease = left.value(lambda) + right.value(lambda);
+                if ((impDecrease > bestImpDecrease))
+                {
+                    split.left          = left;
+                    split.nLeft         = nLeft;
+                    split.missingRight  = (nMissing > 0);
+                    idxFeatureBestSplit = i;
+                    bestImpDecrease     = impDecrease;
+                }
+            }
+
+            if (nMissing && (n - nLeft - nMissing) >= minObservationsInLeafNode && (nLeft + nMissing) >= minObservationsInLeafNode)
+            {
+                ImpurityType leftWithMissing(left);
+                leftWithMissing.add(aGHSum[idxMissing]);
+                ImpurityType right(imp, leftWithMissing);
+                const algorithmFPType impDecrease = leftWithMissing.value(lambda) + right.value(lambda);
+                if ((impDecrease > bestImpDecrease))
+                {
+                    split.left          = leftWithMissing;
+                    split.nLeft         = nLeft + nMissing;
+                    split.missingRight  = false;
+                    idxFeatureBestSplit = i;
+                    bestImpDecrease     = impDecrease;
+                }
             }
         }
         split.impurityDecrease = bestImpDecrease;
     }
 
+    // The missing values are a category of their own, they go to the left child only if it is the category of the split
     static void findCategorical(size_t n, size_t minObservationsInLeafNode, algorithmFPType lambda, SplitType & split, const ResultType & res,
-                                DAAL_INT & idxFeatureBestSplit)
+                                DAAL_INT & idxFeatureBestSplit, DAAL_INT idxMissing)
     {
         const size_t nUnique = res.nUnique;
         auto * aGHSum        = res.ghSums;
@@ -139,8 +162,9 @@ public:
         }
         if (idxFeatureBestSplit >= 0)
         {
-            split.left  = (const GHSumType &)aGHSum[idxFeatureBestSplit];
-            split.nLeft = aGHSum[idxFeatureBestSplit].n;
+            split.left         = (const GHSumType &)aGHSum[idxFeatureBestSplit];
+            split.nLeft        = aGHSum[idxFeatureBestSplit].n;
+            split.missingRight = (idxFeatureBestSplit != idxMissing);
         }
 
         split.impurityDecrease = bestImpDecrease;
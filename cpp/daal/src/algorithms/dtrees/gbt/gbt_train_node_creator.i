@@ -63,7 +63,7 @@ public:
     {
         if (iFeature >= 0)
         {
-            typename NodeType::Split * res = makeSplit(iFeature, _split.featureValue, _split.featureUnordered);
+            typename NodeType::Split * res = makeSplit(iFeature, _split.featureValue, _split.featureUnordered, _split.missingRight);
             _node.res                      = res;
             res->kid[0]                    = buildLeaf(_node.iStart, _split.nLeft, _node.level + 1, _split.left);
 
@@ -160,7 +160,7 @@ protected:
         return pNode;
     }
 
-    typename NodeType::Split * makeSplit(size_t iFeature, algorithmFPType featureValue, bool bUnordered)
+    typename NodeType::Split * makeSplit(size_t iFeature, algorithmFPType featureValue, bool bUnordered, bool bMissingRight)
     {
         typename NodeType::Split * pNode = nullptr;
         if (_data.ctx.isThreaded())
@@ -171,7 +171,7 @@ protected:
         }
         else
             pNode = _data.tree.allocator().allocSplit();
-        pNode->set(iFeature, featureValue, bUnordered);
+        pNode->set(iFeature, featureValue, bUnordered, bMissingRight);
         return pNode;
     }
 
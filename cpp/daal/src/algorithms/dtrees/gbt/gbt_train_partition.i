@@ -151,12 +151,15 @@ protected:
 
     DAAL_INT doPartition(size_t n, size_t iStart, SplitDataType & split, DAAL_INT iFeature, size_t idxFeatureValueBestSplit)
     {
-        return doPartitionIdx(n, _sharedData.aIdx + iStart, _sharedData.ctx.dataHelper().indexedFeatures().data(iFeature), split.featureUnordered,
-                              idxFeatureValueBestSplit, _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
+        const auto & indexedFeatures = _sharedData.ctx.dataHelper().indexedFeatures();
+        //missing values have the last index, so they go to the right child by default
+        const RowIndexType idxMissingLeft = split.missingRight ? -1 : indexedFeatures.missingIndex(iFeature);
+        return doPartitionIdx(n, _sharedData.aIdx + iStart, indexedFeatures.data(iFeature), split.featureUnordered, idxFeatureValueBestSplit,
+                              idxMissingLeft, _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
     }
 
     DAAL_INT doPartitionIdx(IndexType n, RowIndexType * aIdx, const RowIndexType * indexedFeature, bool featureUnordered,
-                            RowIndexType idxFeatureValueBestSplit, RowIndexType * buffer, RowIndexType nLeft)
+                            RowIndexType idxFeatureValueBestSplit, RowIndexType idxMissingLeft, RowIndexType * buffer, RowIndexType nLeft)
     {
         DAAL_INT iRowSplitVal = -1;
 
@@ -201,7 +204,8 @@ protected:
                 PRAGMA_VECTOR_ALWAYS
                 for (IndexType i = iStart; i < iEnd; ++i)
                 {
-                    if (indexedFeature[aIdx[i]] > idxFeatureValueBestSplit)
+                    const RowIndexType idx = indexedFeature[aIdx[i]];
+                    if ((idx > idxFeatureValueBestSplit) && (idx != idxMissingLeft))
                         bestSplitIdxRight[iRight++] = aIdx[i];
                     else
                         bestSplitIdx[iLeft++] = aIdx[i];
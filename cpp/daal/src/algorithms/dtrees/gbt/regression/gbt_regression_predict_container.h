@@ -60,9 +60,14 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * r                                   = static_cast<NumericTable *>(result->get(prediction).get());
     const gbt::regression::prediction::Parameter * par = static_cast<gbt::regression::prediction::Parameter *>(_par);
 
+    NumericTable * contributions = nullptr;
+    NumericTable * interactions  = nullptr;
+    if (par->resultsToCompute & computeShapContributions) contributions = result->get(shapContributions).get();
+    if (par->resultsToCompute & computeShapInteractions) interactions = result->get(shapInteractions).get();
+
     daal::services::Environment::env & env = *_env;
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), a, m, r, par->nIterations);
+                       daal::services::internal::hostApp(*input), a, m, r, par->nIterations, contributions, interactions);
 }
 
 } // namespace prediction
@@ -35,6 +35,7 @@
 #include "src/externals/service_memory.h"
 #include "src/algorithms/dtrees/regression/dtrees_regression_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/algorithms/dtrees/dtrees_predict_shap_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -76,17 +77,59 @@ protected:
     NumericTable * _res;
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Computes SHAP feature contributions or interactions of the first nTrees trees of the model.
+// The tree i contributes to the output i % nOutputs, the values of each output are stored
+// into a separate segment of the result row.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+services::Status predictShap(services::HostAppIface * pHostApp, const NumericTable * x, const gbt::internal::ModelImpl * m, NumericTable * r,
+                             size_t nTrees, size_t nOutputs, bool interactions)
+{
+    typedef gbt::prediction::internal::GbtDecisionTreeShapView<algorithmFPType, gbt::internal::GbtDecisionTree, cpu> TreeView;
+
+    dtrees::internal::FeatureTypes featHelper;
+    DAAL_CHECK_MALLOC(featHelper.init(*x));
+    const size_t nTreesInOutput = nTrees / nOutputs;
+    TArray<TreeView, cpu> aTree(nTreesInOutput);
+    DAAL_CHECK_MALLOC(aTree.get());
+
+    const size_t treeSize = m->at(0)->getNumberOfNodes()
+                            * (sizeof(gbt::prediction::internal::ModelFPType) + sizeof(gbt::prediction::internal::FeatureIndexType) + sizeof(int));
+    dtrees::prediction::internal::ShapTask<algorithmFPType, TreeView, cpu> task(x, r, interactions, nOutputs);
+
+    services::Status s;
+    for (size_t iOutput = 0; s && iOutput < nOutputs; ++iOutput)
+    {
+        for (size_t i = 0; i < nTreesInOutput; ++i)
+        {
+            /* Covers of the nodes are required to weight the paths, models created by the model builder do not have them */
+            const size_t iTree          = i * nOutputs + iOutput;
+            const int * nodeSampleCount = m->getNodeSampleCount(iTree);
+            DAAL_CHECK(nodeSampleCount, services::ErrorModelNotFullInitialized);
+            aTree[i] = TreeView(*m->at(iTree), nodeSampleCount, featHelper);
+        }
+        s = task.run(aTree.get(), nTreesInOutput, treeSize, algorithmFPType(1), pHostApp, iOutput);
+    }
+    return s;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // PredictKernel
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
-                                                                      const regression::Model * m, NumericTable * r, size_t nIterations)
+                                                                      const regression::Model * m, NumericTable * r, size_t nIterations,
+                                                                      NumericTable * contributions, NumericTable * interactions)
 {
     const daal::algorithms::gbt::regression::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl *>(m);
     PredictRegressionTask<algorithmFPType, cpu> task(x, r);
-    return task.run(pModel, nIterations, pHostApp);
+    services::Status s       = task.run(pModel, nIterations, pHostApp);
+    const size_t nTreesTotal = (nIterations ? nIterations : pModel->size());
+    if (s && contributions) s = predictShap<algorithmFPType, cpu>(pHostApp, x, pModel, contributions, nTreesTotal, 1, false);
+    if (s && interactions) s = predictShap<algorithmFPType, cpu>(pHostApp, x, pModel, interactions, nTreesTotal, 1, true);
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -47,6 +47,21 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     const size_t nVectors = dataPtr->getNumberOfRows();
     Argument::set(prediction,
                   data_management::HomogenNumericTable<algorithmFPType>::create(1, nVectors, data_management::NumericTableIface::doAllocate, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+
+    const Parameter * param = static_cast<const Parameter *>(par);
+    const size_t nPhi       = dataPtr->getNumberOfColumns() + 1;
+    if (param->resultsToCompute & computeShapContributions)
+    {
+        Argument::set(shapContributions, data_management::HomogenNumericTable<algorithmFPType>::create(
+                                             nPhi, nVectors, data_management::NumericTableIface::doAllocate, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+    if (param->resultsToCompute & computeShapInteractions)
+    {
+        Argument::set(shapInteractions, data_management::HomogenNumericTable<algorithmFPType>::create(
+                                            nPhi * nPhi, nVectors, data_management::NumericTableIface::doAllocate, &s));
+    }
     return s;
 }
 
@@ -142,7 +142,21 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
 {
     Status s;
     DAAL_CHECK_STATUS(s, algorithms::regression::prediction::Result::check(input, par, method));
+
     DAAL_CHECK_EX(get(prediction)->getNumberOfColumns() == 1, ErrorIncorrectNumberOfColumns, ArgumentName, predictionStr());
+
+    const Input * algInput  = static_cast<const Input *>(input);
+    const Parameter * param = static_cast<const Parameter *>(par);
+    const size_t nRows      = algInput->get(data)->getNumberOfRows();
+    const size_t nPhi       = algInput->get(data)->getNumberOfColumns() + 1;
+    if (param->resultsToCompute & computeShapContributions)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(shapContributions).get(), shapContributionsStr(), 0, 0, nPhi, nRows));
+    }
+    if (param->resultsToCompute & computeShapInteractions)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(shapInteractions).get(), shapInteractionsStr(), 0, 0, nPhi * nPhi, nRows));
+    }
     return s;
 }
 
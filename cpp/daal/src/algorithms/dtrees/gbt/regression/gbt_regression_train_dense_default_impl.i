@@ -181,8 +181,10 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compu
     if (!par.memorySavingMode)
     {
         BinParams prm(par.maxBins, par.minBinSize);
-        DAAL_CHECK_STATUS(s,
-                          (indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, par.splitMethod == gbt::training::inexact ? &prm : nullptr)));
+        //missing values get an index of their own, the split search learns the direction they go to
+        const bool bMissingIndex = true;
+        DAAL_CHECK_STATUS(s, (indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, par.splitMethod == gbt::training::inexact ? &prm : nullptr,
+                                                                        bMissingIndex)));
     }
 
     WriteOnlyRows<algorithmFPType, cpu> weightsRows, totalCoverRows, coverRows, totalGainRows, gainRows;
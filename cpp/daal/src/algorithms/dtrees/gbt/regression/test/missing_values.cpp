@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <limits>
+#include <vector>
+
+#include "daal/include/algorithms/gradient_boosted_trees/gbt_regression_model_builder.h"
+#include "daal/include/algorithms/gradient_boosted_trees/gbt_regression_predict.h"
+#include "daal/include/algorithms/gradient_boosted_trees/gbt_regression_training_batch.h"
+#include "daal/include/data_management/data/homogen_numeric_table.h"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal::algorithms::gbt::regression::test {
+
+namespace dm = daal::data_management;
+
+static const float missing = std::numeric_limits<float>::quiet_NaN();
+
+static dm::NumericTablePtr make_table(std::vector<float>& data,
+                                      std::size_t column_count,
+                                      bool categorical_feature) {
+    const std::size_t row_count = data.size() / column_count;
+    auto table = dm::HomogenNumericTable<float>::create(data.data(), column_count, row_count);
+    if (categorical_feature) {
+        (*table->getDictionarySharedPtr())[column_count - 1].featureType =
+            dm::features::DAAL_CATEGORICAL;
+    }
+    return table;
+}
+
+static std::vector<float> predict(const ModelPtr& model, const dm::NumericTablePtr& data) {
+    prediction::Batch<float> algorithm;
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, model);
+    REQUIRE(algorithm.compute().ok());
+
+    const auto result = algorithm.getResult()->get(prediction::prediction);
+    dm::BlockDescriptor<float> block;
+    result->getBlockOfRows(0, result->getNumberOfRows(), dm::readOnly, block);
+    std::vector<float> responses(block.getBlockPtr(),
+                                 block.getBlockPtr() + result->getNumberOfRows());
+    result->releaseBlockOfRows(block);
+    return responses;
+}
+
+// The model is built by the model builder, so its splits do not store the
+// default directions as the models trained by the earlier versions do
+TEST("model without default directions routes missing values as before", "[gbt][missing]") {
+    ModelBuilder builder(2, 2);
+
+    const auto ordered_tree = builder.createTree(3);
+    const auto ordered_root = builder.addSplitNode(ordered_tree, ModelBuilder::noParent, 0, 0, 0.5);
+    builder.addLeafNode(ordered_tree, ordered_root, 0, 1.0);
+    builder.addLeafNode(ordered_tree, ordered_root, 1, 2.0);
+
+    const auto categorical_tree = builder.createTree(3);
+    const auto categorical_root =
+        builder.addSplitNode(categorical_tree, ModelBuilder::noParent, 0, 1, 3.0);
+    builder.addLeafNode(categorical_tree, categorical_root, 0, 10.0);
+    builder.addLeafNode(categorical_tree, categorical_root, 1, 20.0);
+
+    const auto model = builder.getModel();
+
+    std::vector<float> data = { 0.0f, 3.0f, 1.0f, 1.0f, missing, missing };
+    const auto responses = predict(model, make_table(data, 2, true));
+
+    REQUIRE(responses[0] == 11.0f);
+    REQUIRE(responses[1] == 22.0f);
+    // Missing values go to the left child of the ordered split
+    // and to the right child of the categorical split
+    REQUIRE(responses[2] == 21.0f);
+}
+
+// Every fourth observation has a missing value of the feature, and these
+// observations have the response of the large values of the feature for the
+// ordered one and of the category of their own for the categorical one.
+// The routing used for the models without default directions sends them the
+// other way in both cases
+TEST("trained model routes missing values to the learned direction", "[gbt][missing]") {
+    const bool categorical_feature = GENERATE(false, true);
+    const auto split_method = GENERATE(gbt::training::exact, gbt::training::inexact);
+    CAPTURE(categorical_feature, split_method);
+
+    const std::size_t row_count = 400;
+    std::vector<float> x(row_count);
+    std::vector<float> y(row_count);
+    for (std::size_t i = 0; i < row_count; i++) {
+        const float value = float(i % 4);
+        if (i % 4 == 3) {
+            x[i] = missing;
+            y[i] = 10.0f;
+        }
+        else {
+            x[i] = value;
+            y[i] = (!categorical_feature && value >= 2.0f) ? 10.0f : 0.0f;
+        }
+    }
+
+    training::Batch<float> train_algorithm;
+    train_algorithm.input.set(training::data, make_table(x, 1, categorical_feature));
+    train_algorithm.input.set(training::dependentVariable, make_table(y, 1, false));
+    train_algorithm.parameter().maxIterations = 50;
+    train_algorithm.parameter().splitMethod = split_method;
+    REQUIRE(train_algorithm.compute().ok());
+    const auto model = train_algorithm.getResult()->get(training::model);
+
+    std::vector<float> data = { 0.0f, 1.0f, 2.0f, missing };
+    const auto responses = predict(model, make_table(data, 1, categorical_feature));
+
+    REQUIRE(responses[0] < 1.0f);
+    REQUIRE(responses[1] < 1.0f);
+    REQUIRE(responses[3] > 9.0f);
+    if (!categorical_feature) {
+        REQUIRE(responses[2] > 9.0f);
+    }
+}
+
+} // namespace daal::algorithms::gbt::regression::test
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "daal/include/algorithms/gradient_boosted_trees/gbt_regression_predict.h"
+#include "daal/include/algorithms/gradient_boosted_trees/gbt_regression_training_batch.h"
+#include "daal/include/data_management/data/homogen_numeric_table.h"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal::algorithms::gbt::regression::test {
+
+namespace dm = daal::data_management;
+
+template <typename Float>
+static std::vector<Float> get_data(const dm::NumericTablePtr& table) {
+    const std::size_t row_count = table->getNumberOfRows();
+    const std::size_t column_count = table->getNumberOfColumns();
+    dm::BlockDescriptor<Float> block;
+    table->getBlockOfRows(0, row_count, dm::readOnly, block);
+    std::vector<Float> data(block.getBlockPtr(),
+                            block.getBlockPtr() + row_count * column_count);
+    table->releaseBlockOfRows(block);
+    return data;
+}
+
+template <typename Float>
+static ModelPtr train(std::vector<Float>& x, std::vector<Float>& y, std::size_t column_count) {
+    const std::size_t row_count = y.size();
+    training::Batch<Float> algorithm;
+    algorithm.input.set(training::data,
+                        dm::HomogenNumericTable<Float>::create(x.data(), column_count, row_count));
+    algorithm.input.set(training::dependentVariable,
+                        dm::HomogenNumericTable<Float>::create(y.data(), 1, row_count));
+    algorithm.parameter().maxIterations = 20;
+    algorithm.parameter().maxTreeDepth = 4;
+    REQUIRE(algorithm.compute().ok());
+    return algorithm.getResult()->get(training::model);
+}
+
+// The response depends on the interaction of the second and the third features,
+// the last feature is noise
+TEMPLATE_TEST("SHAP contributions sum up to the prediction", "[gbt][shap]", float, double) {
+    using Float = TestType;
+
+    const std::size_t n_iterations = GENERATE(0, 5);
+    CAPTURE(n_iterations);
+
+    const std::size_t row_count = 300;
+    const std::size_t column_count = 4;
+    std::mt19937 rng(7777);
+    std::uniform_real_distribution<Float> distr(Float(0), Float(1));
+    std::vector<Float> x(row_count * column_count);
+    std::vector<Float> y(row_count);
+    for (std::size_t i = 0; i < row_count; i++) {
+        Float* row = x.data() + i * column_count;
+        for (std::size_t j = 0; j < column_count; j++) {
+            row[j] = distr(rng);
+        }
+        y[i] = row[0] + Float(2) * row[1] * row[2];
+    }
+    const auto model = train(x, y, column_count);
+
+    const auto data = dm::HomogenNumericTable<Float>::create(x.data(), column_count, row_count);
+    prediction::Batch<Float> algorithm;
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, model);
+    algorithm.parameter().nIterations = n_iterations;
+    algorithm.parameter().resultsToCompute =
+        prediction::computeShapContributions | prediction::computeShapInteractions;
+    REQUIRE(algorithm.compute().ok());
+
+    const auto result = algorithm.getResult();
+    const std::size_t phi_count = column_count + 1;
+    REQUIRE(result->get(prediction::prediction)->getNumberOfColumns() == 1);
+    REQUIRE(result->get(prediction::shapContributions)->getNumberOfColumns() == phi_count);
+    REQUIRE(result->get(prediction::shapInteractions)->getNumberOfColumns() ==
+            phi_count * phi_count);
+
+    const auto responses = get_data<Float>(result->get(prediction::prediction));
+    const auto contributions = get_data<Float>(result->get(prediction::shapContributions));
+    const auto interactions = get_data<Float>(result->get(prediction::shapInteractions));
+
+    const Float tolerance = std::is_same_v<Float, float> ? Float(1e-4) : Float(1e-10);
+    for (std::size_t i = 0; i < row_count; i++) {
+        CAPTURE(i);
+        const Float* phi = contributions.data() + i * phi_count;
+        Float sum = 0;
+        for (std::size_t j = 0; j < phi_count; j++) {
+            sum += phi[j];
+
+            // Each row of the interactions matrix sums up to the contribution of the feature
+            const Float* interaction_row =
+                interactions.data() + (i * phi_count + j) * phi_count;
+            Float row_sum = 0;
+            for (std::size_t k = 0; k < phi_count; k++) {
+                row_sum += interaction_row[k];
+            }
+            REQUIRE(std::abs(row_sum - phi[j]) <= tolerance * (Float(1) + std::abs(phi[j])));
+        }
+        REQUIRE(std::abs(sum - responses[i]) <= tolerance * (Float(1) + std::abs(responses[i])));
+    }
+}
+
+} // namespace daal::algorithms::gbt::regression::test
@@ -176,16 +176,47 @@ template <typename algorithmFPType, CpuType cpu>
 struct AlsTls
 {
     DAAL_NEW_DELETE();
-    AlsTls(size_t nBlocks, const Parameter & parameter) : _nBlocks(nBlocks), _prm(parameter), _lhs(parameter.nFactors * parameter.nFactors) {}
+    /* The conjugate gradient method does not form the matrix of the system and needs 3 vectors of size nFactors only */
+    AlsTls(size_t nBlocks, const Parameter & parameter)
+        : _nBlocks(nBlocks), _prm(parameter), _lhs(parameter.nCGIterations ? 3 * parameter.nFactors : parameter.nFactors * parameter.nFactors)
+    {}
     bool isValid() const { return _lhs.get(); }
 
     Status run(NumericTable & dstFactors, ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, const algorithmFPType * xtx,
                NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices);
 
 protected:
+    /* Visits the column factors of the ratings in the i-th row of the data, see ImplicitALSTrainKernelBase::solveCG */
+    struct RowRatings
+    {
+        RowRatings(AlsTls * tls, ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors, const size_t * nColFactorsRows,
+                   const int ** indices)
+            : tls(tls), mtData(mtData), i(i), aSrcFactors(aSrcFactors), nColFactorsRows(nColFactorsRows), indices(indices)
+        {}
+
+        template <typename Op>
+        Status operator()(const Op & op) const
+        {
+            return tls->forEachRating(mtData, i, aSrcFactors, nColFactorsRows, indices, op);
+        }
+
+        AlsTls * tls;
+        ReadRowsCSR<algorithmFPType, cpu> & mtData;
+        size_t i;
+        NumericTable ** aSrcFactors;
+        const size_t * nColFactorsRows;
+        const int ** indices;
+    };
+
     Status formSystem(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors, const size_t * nColFactorsRows,
                       const int ** indices);
 
+    template <typename Op>
+    Status forEachRating(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors, const size_t * nColFactorsRows,
+                         const int ** indices, const Op & op);
+
+    Status findColFactors(int colIndex, NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices);
+
 protected:
     WriteOnlyRows<algorithmFPType, cpu> _mtDstFactors;
     TArray<algorithmFPType, cpu> _lhs;
@@ -204,6 +235,16 @@ Status AlsTls<algorithmFPType, cpu>::run(NumericTable & dstFactors, ReadRowsCSR<
     DAAL_CHECK_BLOCK_STATUS(_mtDstFactors);
     algorithmFPType * rhs = _mtDstFactors.get();
     service_memset<algorithmFPType, cpu>(rhs, 0.0, _prm.nFactors);
+
+    if (_prm.nCGIterations)
+    {
+        /* Factors of the previous iteration are not available on this step, so the iterations start from zero */
+        const size_t nRatings       = mtData.rows()[i + 1] - mtData.rows()[i];
+        const algorithmFPType gamma = algorithmFPType(_prm.lambda) * nRatings;
+        const RowRatings rowRatings(this, mtData, i, aSrcFactors, nColFactorsRows, indices);
+        return ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solveCG(_prm.nFactors, xtx, gamma, _prm.nCGIterations, rowRatings, rhs, _lhs.get());
+    }
+
     result = daal::services::internal::daal_memcpy_s(_lhs.get(), _prm.nFactors * _prm.nFactors * sizeof(algorithmFPType), xtx,
                                                      _prm.nFactors * _prm.nFactors * sizeof(algorithmFPType));
 
@@ -276,60 +317,83 @@ Status ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
 }
 
 template <typename algorithmFPType, CpuType cpu>
-Status AlsTls<algorithmFPType, cpu>::formSystem(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors,
-                                                const size_t * nColFactorsRows, const int ** indices)
+Status AlsTls<algorithmFPType, cpu>::findColFactors(int colIndex, NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices)
+{
+    int blockIndex = -1;
+    /* find block that contains needed index */
+    for (size_t block = 0; block < _nBlocks; block++)
+    {
+        if (indices[block] && indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
+        {
+            blockIndex = block;
+            break;
+        }
+    }
+    if (blockIndex == -1) return Status(ErrorALSInconsistentSparseDataBlocks);
+
+    const int * blockIndices = indices[blockIndex];
+    /* find index in the block using binary search */
+    size_t hiIndex = nColFactorsRows[blockIndex] - 1;
+    size_t loIndex = 0;
+    size_t meIndex = ((loIndex + hiIndex) >> 1);
+    while (colIndex != blockIndices[meIndex])
+    {
+        if (colIndex < blockIndices[meIndex])
+            hiIndex = meIndex - 1;
+        else if (colIndex > blockIndices[meIndex])
+            loIndex = meIndex + 1;
+        meIndex = ((loIndex + hiIndex) >> 1);
+        if (loIndex >= hiIndex) break;
+    }
+    if (colIndex != blockIndices[meIndex]) return Status(ErrorALSInconsistentSparseDataBlocks);
+
+    _mtSrcFactors.set(*aSrcFactors[blockIndex], meIndex, 1);
+    DAAL_CHECK_BLOCK_STATUS(_mtSrcFactors);
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+template <typename Op>
+Status AlsTls<algorithmFPType, cpu>::forEachRating(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors,
+                                                   const size_t * nColFactorsRows, const int ** indices, const Op & op)
 {
-    algorithmFPType * rhs = _mtDstFactors.get();
-    algorithmFPType * lhs = _lhs.get();
     const size_t startIdx = mtData.rows()[i] - 1;
     const size_t endIdx   = mtData.rows()[i + 1] - 1;
 
-    /* Update the linear system of normal equations */
     for (size_t j = startIdx; j < endIdx; j++)
     {
-        algorithmFPType c1 = algorithmFPType(_prm.alpha) * mtData.values()[j];
-        algorithmFPType c  = c1 + 1.0;
         DAAL_ASSERT(mtData.cols()[j] <= services::internal::MaxVal<int>::get())
-        int colIndex = (int)mtData.cols()[j] - 1;
+        const int colIndex = (int)mtData.cols()[j] - 1;
 
-        int blockIndex = -1;
-        /* find block that contains needed index */
-        for (size_t block = 0; block < _nBlocks; block++)
-        {
-            if (indices[block] && indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
-            {
-                blockIndex = block;
-                break;
-            }
-        }
-        if (blockIndex == -1) return Status(ErrorALSInconsistentSparseDataBlocks);
-
-        const int * blockIndices = indices[blockIndex];
-        /* find index in the block using binary search */
-        size_t hiIndex = nColFactorsRows[blockIndex] - 1;
-        size_t loIndex = 0;
-        size_t meIndex = ((loIndex + hiIndex) >> 1);
-        while (colIndex != blockIndices[meIndex])
-        {
-            if (colIndex < blockIndices[meIndex])
-                hiIndex = meIndex - 1;
-            else if (colIndex > blockIndices[meIndex])
-                loIndex = meIndex + 1;
-            meIndex = ((loIndex + hiIndex) >> 1);
-            if (loIndex >= hiIndex) break;
-        }
-        if (colIndex != blockIndices[meIndex]) return Status(ErrorALSInconsistentSparseDataBlocks);
-
-        _mtSrcFactors.set(*aSrcFactors[blockIndex], meIndex, 1);
-        DAAL_CHECK_BLOCK_STATUS(_mtSrcFactors);
-        ImplicitALSTrainKernelBase<algorithmFPType, cpu>::updateSystem(_prm.nFactors, _mtSrcFactors.get(), &c1, &c, lhs, rhs);
+        Status s = findColFactors(colIndex, aSrcFactors, nColFactorsRows, indices);
+        DAAL_CHECK_STATUS_VAR(s);
+        op(_mtSrcFactors.get(), algorithmFPType(_prm.alpha) * mtData.values()[j]);
     }
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status AlsTls<algorithmFPType, cpu>::formSystem(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors,
+                                                const size_t * nColFactorsRows, const int ** indices)
+{
+    algorithmFPType * rhs = _mtDstFactors.get();
+    algorithmFPType * lhs = _lhs.get();
+    const size_t nFactors = _prm.nFactors;
+    const size_t startIdx = mtData.rows()[i] - 1;
+    const size_t endIdx   = mtData.rows()[i + 1] - 1;
+
+    /* Update the linear system of normal equations */
+    Status s = forEachRating(mtData, i, aSrcFactors, nColFactorsRows, indices, [=](const algorithmFPType * colFactors, algorithmFPType c1) {
+        const algorithmFPType c = c1 + 1.0;
+        ImplicitALSTrainKernelBase<algorithmFPType, cpu>::updateSystem(nFactors, colFactors, &c1, &c, lhs, rhs);
+    });
+    DAAL_CHECK_STATUS_VAR(s);
 
     /* Add regularization term */
     const algorithmFPType gamma = algorithmFPType(_prm.lambda) * (endIdx - startIdx);
-    for (size_t k = 0; k < _prm.nFactors; k++)
+    for (size_t k = 0; k < nFactors; k++)
     {
-        lhs[k * _prm.nFactors + k] += gamma;
+        lhs[k * nFactors + k] += gamma;
     }
     return Status();
 }
@@ -76,6 +76,114 @@ bool ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solve(size_t nCols, algor
     return daal::algorithms::internal::solveSymmetricEquationsSystem<algorithmFPType, cpu>(a, b, nCols, 1, true);
 }
 
+template <typename algorithmFPType, CpuType cpu, typename ForEachRating>
+static services::Status multiplyBySystemMatrix(size_t nCols, const algorithmFPType * xtx, algorithmFPType gamma, const ForEachRating & forEachRating,
+                                               const algorithmFPType * v, algorithmFPType * av)
+{
+    /* SYMM parameters */
+    char side            = 'L';
+    char uplo            = 'U';
+    DAAL_INT n           = (DAAL_INT)nCols;
+    DAAL_INT iOne        = 1;
+    algorithmFPType one  = 1.0;
+    algorithmFPType zero = 0.0;
+    Blas<algorithmFPType, cpu>::xxsymm(&side, &uplo, &n, &iOne, &one, const_cast<algorithmFPType *>(xtx), &n, const_cast<algorithmFPType *>(v), &n,
+                                       &zero, av, &n);
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t k = 0; k < nCols; k++)
+    {
+        av[k] += gamma * v[k];
+    }
+
+    return forEachRating([=](const algorithmFPType * y, algorithmFPType c1) {
+        algorithmFPType dot = 0.0;
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nCols; k++)
+        {
+            dot += y[k] * v[k];
+        }
+        dot *= c1;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nCols; k++)
+        {
+            av[k] += dot * y[k];
+        }
+    });
+}
+
+template <typename algorithmFPType, CpuType cpu>
+template <typename ForEachRating>
+services::Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solveCG(size_t nCols, const algorithmFPType * xtx, algorithmFPType gamma,
+                                                                           size_t nIterations, const ForEachRating & forEachRating,
+                                                                           algorithmFPType * x, algorithmFPType * buffer)
+{
+    algorithmFPType * r  = buffer;
+    algorithmFPType * d  = buffer + nCols;
+    algorithmFPType * ad = buffer + 2 * nCols;
+
+    /* r = b - A * x */
+    Status s = multiplyBySystemMatrix<algorithmFPType, cpu>(nCols, xtx, gamma, forEachRating, x, ad);
+    DAAL_CHECK_STATUS_VAR(s);
+    for (size_t k = 0; k < nCols; k++)
+    {
+        r[k] = -ad[k];
+    }
+    s = forEachRating([=](const algorithmFPType * y, algorithmFPType c1) {
+        if (c1 > 0.0)
+        {
+            const algorithmFPType c = c1 + 1.0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t k = 0; k < nCols; k++)
+            {
+                r[k] += c * y[k];
+            }
+        }
+    });
+    DAAL_CHECK_STATUS_VAR(s);
+
+    algorithmFPType rr = 0.0;
+    for (size_t k = 0; k < nCols; k++)
+    {
+        d[k] = r[k];
+        rr += r[k] * r[k];
+    }
+
+    for (size_t iter = 0; iter < nIterations && rr > 0.0; iter++)
+    {
+        s = multiplyBySystemMatrix<algorithmFPType, cpu>(nCols, xtx, gamma, forEachRating, d, ad);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        algorithmFPType dad = 0.0;
+        for (size_t k = 0; k < nCols; k++)
+        {
+            dad += d[k] * ad[k];
+        }
+        /* The matrix is positive semi-definite, zero curvature means the solution cannot be improved along d */
+        if (!(dad > 0.0)) break;
+
+        const algorithmFPType step = rr / dad;
+        algorithmFPType rrNew      = 0.0;
+        for (size_t k = 0; k < nCols; k++)
+        {
+            x[k] += step * d[k];
+            r[k] -= step * ad[k];
+            rrNew += r[k] * r[k];
+        }
+
+        const algorithmFPType beta = rrNew / rr;
+        for (size_t k = 0; k < nCols; k++)
+        {
+            d[k] = r[k] + beta * d[k];
+        }
+        rr = rrNew;
+    }
+    return s;
+}
+
 static inline void getSizes(size_t nRows, size_t nCols, size_t & nBlocks, size_t & blockSize, size_t & tailSize)
 {
     const size_t nThreads       = threader_get_threads_number();
@@ -101,7 +209,7 @@ Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(size_t n
                                                                         const size_t * colIndices, const size_t * rowOffsets, size_t nFactors,
                                                                         algorithmFPType * colFactors, algorithmFPType * rowFactors,
                                                                         algorithmFPType alpha, algorithmFPType lambda, algorithmFPType * xtx,
-                                                                        daal::tls<algorithmFPType *> & lhs)
+                                                                        daal::tls<algorithmFPType *> & lhs, size_t nCGIterations)
 {
     SafeStatus safeStat;
     size_t nBlocks, blockSize, tailSize;
@@ -118,6 +226,15 @@ Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(size_t n
             algorithmFPType * lhs_local = lhs.local();
             algorithmFPType * rhs       = rowFactors + (offset + j) * nFactors;
 
+            if (nCGIterations)
+            {
+                /* Warm start from the factors computed at the previous iteration */
+                Status s = solveSystemCG(offset + j, nCols, data, colIndices, rowOffsets, nFactors, colFactors, alpha, xtx, lambda, nCGIterations,
+                                         rhs, lhs_local);
+                if (!s) safeStat.add(s);
+                continue;
+            }
+
             for (size_t f = 0; f < nFactors; f++)
             {
                 rhs[f] = 0.0;
@@ -284,6 +401,97 @@ void ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::formSystem(size
     }
 }
 
+/* Visits the factors of the columns rated in a row of the data in CSR format and the confidence increments of the ratings */
+template <typename algorithmFPType>
+struct CSRRowRatings
+{
+    CSRRowRatings(const algorithmFPType * data, const size_t * colIndices, size_t startIdx, size_t endIdx, size_t nFactors,
+                  const algorithmFPType * colFactors, algorithmFPType alpha)
+        : data(data), colIndices(colIndices), startIdx(startIdx), endIdx(endIdx), nFactors(nFactors), colFactors(colFactors), alpha(alpha)
+    {}
+
+    template <typename Op>
+    Status operator()(const Op & op) const
+    {
+        for (size_t j = startIdx; j < endIdx; j++)
+        {
+            op(colFactors + (colIndices[j] - 1) * nFactors, alpha * data[j]);
+        }
+        return Status();
+    }
+
+    const algorithmFPType * data;
+    const size_t * colIndices;
+    size_t startIdx;
+    size_t endIdx;
+    size_t nFactors;
+    const algorithmFPType * colFactors;
+    algorithmFPType alpha;
+};
+
+/* Visits the factors of the columns with positive ratings in a row of the dense data and the confidence increments of the ratings */
+template <typename algorithmFPType>
+struct DenseRowRatings
+{
+    DenseRowRatings(const algorithmFPType * ratings, size_t nCols, size_t nFactors, const algorithmFPType * colFactors, algorithmFPType alpha)
+        : ratings(ratings), nCols(nCols), nFactors(nFactors), colFactors(colFactors), alpha(alpha)
+    {}
+
+    template <typename Op>
+    Status operator()(const Op & op) const
+    {
+        for (size_t j = 0; j < nCols; j++)
+        {
+            if (ratings[j] > 0.0)
+            {
+                op(colFactors + j * nFactors, alpha * ratings[j]);
+            }
+        }
+        return Status();
+    }
+
+    const algorithmFPType * ratings;
+    size_t nCols;
+    size_t nFactors;
+    const algorithmFPType * colFactors;
+    algorithmFPType alpha;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::solveSystemCG(size_t i, size_t nCols, const algorithmFPType * data,
+                                                                            const size_t * colIndices, const size_t * rowOffsets, size_t nFactors,
+                                                                            algorithmFPType * colFactors, algorithmFPType alpha,
+                                                                            const algorithmFPType * xtx, algorithmFPType lambda, size_t nCGIterations,
+                                                                            algorithmFPType * rowFactors, algorithmFPType * buffer)
+{
+    const size_t startIdx = rowOffsets[i] - 1;
+    const size_t endIdx   = rowOffsets[i + 1] - 1;
+    const CSRRowRatings<algorithmFPType> forEachRating(data, colIndices, startIdx, endIdx, nFactors, colFactors, alpha);
+
+    const algorithmFPType gamma = lambda * (endIdx - startIdx);
+    return this->solveCG(nFactors, xtx, gamma, nCGIterations, forEachRating, rowFactors, buffer);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::solveSystemCG(size_t i, size_t nCols, const algorithmFPType * data,
+                                                                                 const size_t * colIndices, const size_t * rowOffsets,
+                                                                                 size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha,
+                                                                                 const algorithmFPType * xtx, algorithmFPType lambda,
+                                                                                 size_t nCGIterations, algorithmFPType * rowFactors,
+                                                                                 algorithmFPType * buffer)
+{
+    const algorithmFPType * ratings = data + i * nCols;
+    const DenseRowRatings<algorithmFPType> forEachRating(ratings, nCols, nFactors, colFactors, alpha);
+
+    size_t nRatings = 0;
+    for (size_t j = 0; j < nCols; j++)
+    {
+        nRatings += (ratings[j] > 0.0);
+    }
+    const algorithmFPType gamma = lambda * (algorithmFPType)(nRatings + 1);
+    return this->solveCG(nFactors, xtx, gamma, nCGIterations, forEachRating, rowFactors, buffer);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::compute(const NumericTable * dataTable, implicit_als::Model * initModel,
                                                                                      implicit_als::Model * model, const Parameter * parameter)
@@ -318,9 +526,17 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::com
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors, parameter->nFactors);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors * parameter->nFactors, sizeof(algorithmFPType));
 
+    /* The conjugate gradient method does not form the matrix of the system and needs 3 vectors of size nFactors only */
+    const size_t nCGIterations = parameter->nCGIterations;
+    const size_t lhsSize       = nCGIterations ? 3 * parameter->nFactors : parameter->nFactors * parameter->nFactors;
+    if (nCGIterations)
+    {
+        /* Users factors are the initial guess of the first iteration */
+        service_memset<algorithmFPType, cpu>(usersFactors, algorithmFPType(0), nUsers * nFactors);
+    }
+
     daal::tls<algorithmFPType *> lhs([=]() -> algorithmFPType * {
-        return (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(parameter->nFactors * parameter->nFactors
-                                                                                                 * sizeof(algorithmFPType));
+        return (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(lhsSize * sizeof(algorithmFPType));
     });
 
     algorithmFPType beta = 0.0;
@@ -328,12 +544,14 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::com
     {
         this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx, lhs);
+        s = this->computeFactors(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx, lhs,
+                                 nCGIterations);
         if (!s) break;
 
         this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx, lhs);
+        s = this->computeFactors(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx, lhs,
+                                 nCGIterations);
         if (!s) break;
 
 #if 0
@@ -382,21 +600,29 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors, parameter->nFactors);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors * parameter->nFactors, sizeof(algorithmFPType));
 
+    /* The conjugate gradient method does not form the matrix of the system and needs 3 vectors of size nFactors only */
+    const size_t nCGIterations = parameter->nCGIterations;
+    const size_t lhsSize       = nCGIterations ? 3 * parameter->nFactors : parameter->nFactors * parameter->nFactors;
+    if (nCGIterations)
+    {
+        /* Users factors are the initial guess of the first iteration */
+        service_memset<algorithmFPType, cpu>(usersFactors, algorithmFPType(0), nUsers * nFactors);
+    }
+
     daal::tls<algorithmFPType *> lhs([=]() -> algorithmFPType * {
-        return (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(parameter->nFactors * parameter->nFactors
-                                                                                                 * sizeof(algorithmFPType));
+        return (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(lhsSize * sizeof(algorithmFPType));
     });
     algorithmFPType beta = 0.0;
     for (size_t i = 0; i < parameter->maxIterations; i++)
     {
         this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx, lhs);
+        s = this->computeFactors(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx, lhs, nCGIterations);
         if (!s) break;
 
         this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx, lhs);
+        s = this->computeFactors(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx, lhs, nCGIterations);
         if (!s) break;
 
 #if 0
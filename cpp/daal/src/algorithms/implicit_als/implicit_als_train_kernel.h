@@ -67,6 +67,13 @@ public:
 
     static bool solve(size_t nCols, algorithmFPType * a, algorithmFPType * b);
 
+    /* Refines the solution x of the system of normal equations (xtx + sum(c1 * y * y^t) + gamma * I) * x = sum((1 + c1) * y)
+       with the conjugate gradient method. The sums are taken over the pairs (y, c1) visited by forEachRating(op) with op(y, c1).
+       The matrix of the system is not formed, buffer holds 3 * nCols elements */
+    template <typename ForEachRating>
+    static services::Status solveCG(size_t nCols, const algorithmFPType * xtx, algorithmFPType gamma, size_t nIterations,
+                                    const ForEachRating & forEachRating, algorithmFPType * x, algorithmFPType * buffer);
+
 protected:
     friend struct ImplicitALSTrainTaskBase<algorithmFPType, cpu>;
     friend struct ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu>;
@@ -74,12 +81,17 @@ protected:
 
     services::Status computeFactors(size_t nRows, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
                                     size_t nFactors, algorithmFPType * colFactors, algorithmFPType * rowFactors, algorithmFPType alpha,
-                                    algorithmFPType lambda, algorithmFPType * xtx, daal::tls<algorithmFPType *> & lhs);
+                                    algorithmFPType lambda, algorithmFPType * xtx, daal::tls<algorithmFPType *> & lhs, size_t nCGIterations);
 
     virtual void formSystem(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
                             size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType * lhs, algorithmFPType * rhs,
                             algorithmFPType lambda) = 0;
 
+    virtual services::Status solveSystemCG(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices,
+                                           const size_t * rowOffsets, size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha,
+                                           const algorithmFPType * xtx, algorithmFPType lambda, size_t nCGIterations, algorithmFPType * rowFactors,
+                                           algorithmFPType * buffer) = 0;
+
     virtual void computeCostFunction(size_t nUsers, size_t nItems, size_t nFactors, algorithmFPType * data, size_t * colIndices, size_t * rowOffsets,
                                      algorithmFPType * itemsFactors, algorithmFPType * usersFactors, algorithmFPType alpha, algorithmFPType lambda,
                                      algorithmFPType * costFunctionPtr) = 0;
@@ -97,6 +109,11 @@ protected:
                             size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType * lhs, algorithmFPType * rhs,
                             algorithmFPType lambda) DAAL_C11_OVERRIDE;
 
+    virtual services::Status solveSystemCG(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices,
+                                           const size_t * rowOffsets, size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha,
+                                           const algorithmFPType * xtx, algorithmFPType lambda, size_t nCGIterations, algorithmFPType * rowFactors,
+                                           algorithmFPType * buffer) DAAL_C11_OVERRIDE;
+
     virtual void computeCostFunction(size_t nUsers, size_t nItems, size_t nFactors, algorithmFPType * data, size_t * colIndices, size_t * rowOffsets,
                                      algorithmFPType * itemsFactors, algorithmFPType * usersFactors, algorithmFPType alpha, algorithmFPType lambda,
                                      algorithmFPType * costFunctionPtr) DAAL_C11_OVERRIDE;
@@ -110,6 +127,11 @@ protected:
                             size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType * lhs, algorithmFPType * rhs,
                             algorithmFPType lambda) DAAL_C11_OVERRIDE;
 
+    virtual services::Status solveSystemCG(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices,
+                                           const size_t * rowOffsets, size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha,
+                                           const algorithmFPType * xtx, algorithmFPType lambda, size_t nCGIterations, algorithmFPType * rowFactors,
+                                           algorithmFPType * buffer) DAAL_C11_OVERRIDE;
+
     virtual void computeCostFunction(size_t nUsers, size_t nItems, size_t nFactors, algorithmFPType * data, size_t * colIndices, size_t * rowOffsets,
                                      algorithmFPType * itemsFactors, algorithmFPType * usersFactors, algorithmFPType alpha, algorithmFPType lambda,
                                      algorithmFPType * costFunctionPtr) DAAL_C11_OVERRIDE;
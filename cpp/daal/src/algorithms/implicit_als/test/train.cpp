@@ -0,0 +1,387 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "daal/include/algorithms/implicit_als/implicit_als_training_batch.h"
+#include "daal/include/algorithms/implicit_als/implicit_als_training_distributed.h"
+#include "daal/include/algorithms/implicit_als/implicit_als_training_init_batch.h"
+#include "daal/include/algorithms/implicit_als/implicit_als_training_init_distributed.h"
+#include "daal/include/data_management/data/csr_numeric_table.h"
+#include "daal/include/data_management/data/homogen_numeric_table.h"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal::algorithms::implicit_als::test {
+
+namespace dm = daal::data_management;
+
+class implicit_als_train_test {
+public:
+    using float_t = double;
+
+    static constexpr std::size_t user_count = 40;
+    static constexpr std::size_t item_count = 30;
+    static constexpr std::size_t factor_count = 4;
+    static constexpr std::size_t iteration_count = 5;
+    static constexpr std::size_t block_count = 2;
+    // The conjugate gradient method solves a system of order factor_count
+    // exactly in factor_count iterations, the rest absorb the rounding errors
+    static constexpr std::size_t cg_iteration_count = 5 * factor_count;
+
+    static constexpr float_t alpha = 40.0;
+    static constexpr float_t lambda = 0.01;
+
+    struct factors {
+        std::vector<float_t> users;
+        std::vector<float_t> items;
+    };
+
+    implicit_als_train_test() {
+        std::mt19937 rng(7777);
+        std::uniform_real_distribution<float_t> uniform(0.0, 1.0);
+        std::uniform_int_distribution<int> rating(1, 5);
+
+        ratings_.assign(user_count * item_count, 0.0);
+        for (std::size_t u = 0; u < user_count; u++) {
+            for (std::size_t i = 0; i < item_count; i++) {
+                // Each user and each item has at least one rating
+                if (uniform(rng) < 0.25 || i == u % item_count) {
+                    ratings_[u * item_count + i] = float_t(rating(rng));
+                }
+            }
+        }
+    }
+
+    factors train_batch_csr(std::size_t cg_iteration_count) {
+        const auto data =
+            make_csr_table(user_count, item_count, 0, [&](std::size_t u, std::size_t i) {
+                return ratings_[u * item_count + i];
+            });
+
+        training::init::Batch<float_t, training::init::fastCSR> init_algorithm;
+        init_algorithm.parameter.nFactors = factor_count;
+        init_algorithm.input.set(training::init::data, data);
+        REQUIRE(init_algorithm.compute().ok());
+        const auto initial_model = init_algorithm.getResult()->get(training::init::model);
+
+        training::Batch<float_t, training::fastCSR> train_algorithm;
+        set_parameter(train_algorithm.parameter, cg_iteration_count);
+        train_algorithm.input.set(training::data, data);
+        train_algorithm.input.set(training::inputModel, initial_model);
+        REQUIRE(train_algorithm.compute().ok());
+        return get_factors(train_algorithm.getResult()->get(training::model));
+    }
+
+    factors train_batch_dense(std::size_t cg_iteration_count) {
+        const auto data =
+            dm::HomogenNumericTable<float_t>::create(ratings_.data(), item_count, user_count);
+
+        training::init::Batch<float_t, training::init::defaultDense> init_algorithm;
+        init_algorithm.parameter.nFactors = factor_count;
+        init_algorithm.input.set(training::init::data, data);
+        REQUIRE(init_algorithm.compute().ok());
+        const auto initial_model = init_algorithm.getResult()->get(training::init::model);
+
+        training::Batch<float_t, training::defaultDense> train_algorithm;
+        set_parameter(train_algorithm.parameter, cg_iteration_count);
+        train_algorithm.input.set(training::data, data);
+        train_algorithm.input.set(training::inputModel, initial_model);
+        REQUIRE(train_algorithm.compute().ok());
+        return get_factors(train_algorithm.getResult()->get(training::model));
+    }
+
+    /// Trains the model on the blocks of items in the distributed processing
+    /// mode, the factors of the blocks are concatenated in the block order
+    factors train_distributed(std::size_t cg_iteration_count) {
+        using init_step1_t =
+            training::init::Distributed<step1Local, float_t, training::init::fastCSR>;
+        using init_step2_t =
+            training::init::Distributed<step2Local, float_t, training::init::fastCSR>;
+        using partial_result_step4_ptr = training::DistributedPartialResultStep4Ptr;
+
+        const std::size_t block_item_count = item_count / block_count;
+        int user_partition[] = { int(block_count) };
+
+        dm::KeyValueDataCollectionPtr init_step1_results[block_count];
+        dm::KeyValueDataCollectionPtr item_step3_inputs[block_count];
+        dm::KeyValueDataCollectionPtr user_step3_inputs[block_count];
+        dm::NumericTablePtr user_offsets[block_count];
+        dm::NumericTablePtr item_offsets[block_count];
+        dm::CSRNumericTablePtr data[block_count];
+        dm::CSRNumericTablePtr transposed_data[block_count];
+        partial_result_step4_ptr item_results[block_count];
+        partial_result_step4_ptr user_results[block_count];
+
+        for (std::size_t b = 0; b < block_count; b++) {
+            const std::size_t first_item = b * block_item_count;
+            data[b] = make_csr_table(block_item_count,
+                                     user_count,
+                                     first_item,
+                                     [&](std::size_t i, std::size_t u) {
+                                         return ratings_[u * item_count + i];
+                                     });
+
+            init_step1_t init_algorithm;
+            init_algorithm.parameter.fullNUsers = user_count;
+            init_algorithm.parameter.nFactors = factor_count;
+            init_algorithm.parameter.seed += b;
+            init_algorithm.parameter.partition =
+                dm::HomogenNumericTable<int>::create(user_partition, 1, 1);
+            init_algorithm.input.set(training::init::data, data[b]);
+            REQUIRE(init_algorithm.compute().ok());
+
+            const auto partial_result = init_algorithm.getPartialResult();
+            item_step3_inputs[b] = partial_result->get(training::init::outputOfInitForComputeStep3);
+            user_offsets[b] = partial_result->get(training::init::offsets, b);
+            item_results[b].reset(new training::DistributedPartialResultStep4());
+            item_results[b]->set(training::outputOfStep4ForStep1,
+                                 partial_result->get(training::init::partialModel));
+            init_step1_results[b] = partial_result->get(training::init::outputOfStep1ForStep2);
+        }
+
+        for (std::size_t b = 0; b < block_count; b++) {
+            init_step2_t init_algorithm;
+            dm::KeyValueDataCollectionPtr input(new dm::KeyValueDataCollection());
+            for (std::size_t j = 0; j < block_count; j++) {
+                (*input)[j] = (*init_step1_results[j])[b];
+            }
+            init_algorithm.input.set(training::init::inputOfStep2FromStep1, input);
+            REQUIRE(init_algorithm.compute().ok());
+
+            const auto partial_result = init_algorithm.getPartialResult();
+            transposed_data[b] =
+                dm::CSRNumericTable::cast(partial_result->get(training::init::transposedData));
+            user_step3_inputs[b] = partial_result->get(training::init::outputOfInitForComputeStep3);
+            item_offsets[b] = partial_result->get(training::init::offsets, b);
+        }
+
+        for (std::size_t iteration = 0; iteration < iteration_count; iteration++) {
+            update_distributed(cg_iteration_count,
+                               item_results,
+                               item_offsets,
+                               item_step3_inputs,
+                               transposed_data,
+                               user_results);
+            update_distributed(cg_iteration_count,
+                               user_results,
+                               user_offsets,
+                               user_step3_inputs,
+                               data,
+                               item_results);
+        }
+
+        factors result;
+        for (std::size_t b = 0; b < block_count; b++) {
+            append_rows(user_results[b]->get(training::outputOfStep4)->getFactors(), result.users);
+            append_rows(item_results[b]->get(training::outputOfStep4)->getFactors(), result.items);
+        }
+        return result;
+    }
+
+    /// The cost function of the implicit ALS problem over all user-item pairs
+    float_t compute_cost(const factors& f) const {
+        float_t cost = 0;
+        for (std::size_t u = 0; u < user_count; u++) {
+            for (std::size_t i = 0; i < item_count; i++) {
+                const float_t rating = ratings_[u * item_count + i];
+                const float_t preference = (rating > 0.0) ? 1.0 : 0.0;
+                const float_t confidence = 1.0 + alpha * rating;
+
+                float_t dot_product = 0;
+                for (std::size_t k = 0; k < factor_count; k++) {
+                    dot_product +=
+                        f.users[u * factor_count + k] * f.items[i * factor_count + k];
+                }
+                cost += confidence * (preference - dot_product) * (preference - dot_product);
+            }
+        }
+        for (const float_t x : f.users) {
+            cost += lambda * x * x;
+        }
+        for (const float_t y : f.items) {
+            cost += lambda * y * y;
+        }
+        return cost;
+    }
+
+    void check_factors_match(const factors& cg, const factors& direct) const {
+        REQUIRE(cg.users.size() == user_count * factor_count);
+        REQUIRE(cg.items.size() == item_count * factor_count);
+        REQUIRE(direct.users.size() == cg.users.size());
+        REQUIRE(direct.items.size() == cg.items.size());
+
+        const float_t tolerance = 1e-6;
+        for (std::size_t j = 0; j < cg.users.size(); j++) {
+            CAPTURE(j);
+            REQUIRE(std::abs(cg.users[j] - direct.users[j]) <=
+                    tolerance * std::max(float_t(1), std::abs(direct.users[j])));
+        }
+        for (std::size_t j = 0; j < cg.items.size(); j++) {
+            CAPTURE(j);
+            REQUIRE(std::abs(cg.items[j] - direct.items[j]) <=
+                    tolerance * std::max(float_t(1), std::abs(direct.items[j])));
+        }
+
+        const float_t cg_cost = compute_cost(cg);
+        const float_t direct_cost = compute_cost(direct);
+        CAPTURE(cg_cost, direct_cost);
+        REQUIRE(std::abs(cg_cost - direct_cost) <= tolerance * direct_cost);
+    }
+
+private:
+    template <typename Parameter>
+    static void set_parameter(Parameter& parameter, std::size_t cg_iteration_count) {
+        parameter.nFactors = factor_count;
+        parameter.maxIterations = iteration_count;
+        parameter.alpha = alpha;
+        parameter.lambda = lambda;
+        parameter.nCGIterations = cg_iteration_count;
+    }
+
+    /// Runs steps 1-4 of the distributed training that compute the factors
+    /// of the other side from the given partial results
+    static void update_distributed(std::size_t cg_iteration_count,
+                                   training::DistributedPartialResultStep4Ptr* inputs,
+                                   dm::NumericTablePtr* offsets,
+                                   dm::KeyValueDataCollectionPtr* step3_inputs,
+                                   dm::CSRNumericTablePtr* data,
+                                   training::DistributedPartialResultStep4Ptr* results) {
+        training::Distributed<step2Master, float_t> step2_algorithm;
+        set_parameter(step2_algorithm.parameter, cg_iteration_count);
+        for (std::size_t b = 0; b < block_count; b++) {
+            training::Distributed<step1Local, float_t> step1_algorithm;
+            set_parameter(step1_algorithm.parameter, cg_iteration_count);
+            step1_algorithm.input.set(training::partialModel,
+                                      inputs[b]->get(training::outputOfStep4ForStep1));
+            REQUIRE(step1_algorithm.compute().ok());
+            step2_algorithm.input.add(training::inputOfStep2FromStep1,
+                                      step1_algorithm.getPartialResult());
+        }
+        REQUIRE(step2_algorithm.compute().ok());
+        const auto step2_result =
+            step2_algorithm.getPartialResult()->get(training::outputOfStep2ForStep4);
+
+        dm::KeyValueDataCollectionPtr step3_results[block_count];
+        for (std::size_t b = 0; b < block_count; b++) {
+            training::Distributed<step3Local, float_t> step3_algorithm;
+            set_parameter(step3_algorithm.parameter, cg_iteration_count);
+            step3_algorithm.input.set(training::partialModel,
+                                      inputs[b]->get(training::outputOfStep4ForStep3));
+            step3_algorithm.input.set(training::inputOfStep3FromInit, step3_inputs[b]);
+            step3_algorithm.input.set(training::offset, offsets[b]);
+            REQUIRE(step3_algorithm.compute().ok());
+            step3_results[b] =
+                step3_algorithm.getPartialResult()->get(training::outputOfStep3ForStep4);
+        }
+
+        for (std::size_t b = 0; b < block_count; b++) {
+            dm::KeyValueDataCollectionPtr step4_input(new dm::KeyValueDataCollection());
+            for (std::size_t j = 0; j < block_count; j++) {
+                (*step4_input)[j] = (*step3_results[j])[b];
+            }
+
+            training::Distributed<step4Local, float_t> step4_algorithm;
+            set_parameter(step4_algorithm.parameter, cg_iteration_count);
+            step4_algorithm.input.set(training::partialModels, step4_input);
+            step4_algorithm.input.set(training::partialData, data[b]);
+            step4_algorithm.input.set(training::inputOfStep4FromStep2, step2_result);
+            REQUIRE(step4_algorithm.compute().ok());
+            results[b] = step4_algorithm.getPartialResult();
+        }
+    }
+
+    /// Creates the CSR table with the given rows of the ratings, starting from
+    /// first_row, the storage lives as long as the test object
+    template <typename Rating>
+    dm::CSRNumericTablePtr make_csr_table(std::size_t row_count,
+                                          std::size_t column_count,
+                                          std::size_t first_row,
+                                          const Rating& rating) {
+        csr_storage& storage = csr_storages_.emplace_back();
+        storage.row_offsets.push_back(1);
+        for (std::size_t r = 0; r < row_count; r++) {
+            for (std::size_t c = 0; c < column_count; c++) {
+                const float_t value = rating(first_row + r, c);
+                if (value > 0.0) {
+                    storage.values.push_back(value);
+                    storage.column_indices.push_back(c + 1);
+                }
+            }
+            storage.row_offsets.push_back(storage.values.size() + 1);
+        }
+        return dm::CSRNumericTable::create(storage.values.data(),
+                                           storage.column_indices.data(),
+                                           storage.row_offsets.data(),
+                                           column_count,
+                                           row_count);
+    }
+
+    static factors get_factors(const ModelPtr& model) {
+        factors result;
+        append_rows(model->getUsersFactors(), result.users);
+        append_rows(model->getItemsFactors(), result.items);
+        return result;
+    }
+
+    static void append_rows(const dm::NumericTablePtr& table, std::vector<float_t>& rows) {
+        const std::size_t row_count = table->getNumberOfRows();
+        dm::BlockDescriptor<float_t> block;
+        table->getBlockOfRows(0, row_count, dm::readOnly, block);
+        rows.insert(rows.end(),
+                    block.getBlockPtr(),
+                    block.getBlockPtr() + row_count * table->getNumberOfColumns());
+        table->releaseBlockOfRows(block);
+    }
+
+    struct csr_storage {
+        std::vector<float_t> values;
+        std::vector<std::size_t> column_indices;
+        std::vector<std::size_t> row_offsets;
+    };
+
+    std::vector<float_t> ratings_;
+    std::list<csr_storage> csr_storages_;
+};
+
+TEST_M(implicit_als_train_test,
+       "implicit ALS trained with CG matches the direct solver in batch fastCSR mode",
+       "[implicit_als][train]") {
+    const auto direct = this->train_batch_csr(0);
+    const auto cg = this->train_batch_csr(cg_iteration_count);
+    this->check_factors_match(cg, direct);
+}
+
+TEST_M(implicit_als_train_test,
+       "implicit ALS trained with CG matches the direct solver in batch defaultDense mode",
+       "[implicit_als][train]") {
+    const auto direct = this->train_batch_dense(0);
+    const auto cg = this->train_batch_dense(cg_iteration_count);
+    this->check_factors_match(cg, direct);
+}
+
+TEST_M(implicit_als_train_test,
+       "implicit ALS trained with CG matches the direct solver in distributed mode",
+       "[implicit_als][train]") {
+    const auto direct = this->train_distributed(0);
+    const auto cg = this->train_distributed(cg_iteration_count);
+    this->check_factors_match(cg, direct);
+}
+
+} // namespace daal::algorithms::implicit_als::test
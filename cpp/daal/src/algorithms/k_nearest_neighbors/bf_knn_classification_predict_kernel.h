@@ -42,6 +42,7 @@ struct KernelParameter : bf_knn_classification::Parameter
     bf_knn_classification::VoteWeights voteWeights = bf_knn_classification::VoteWeights::voteUniform;
     PairwiseDistanceType pairwiseDistance          = PairwiseDistanceType::minkowski;
     double minkowskiDegree                         = 2.0;
+    bool regression                                = false; /* Average the responses of the neighbors instead of voting for the class label */
 };
 
 template <typename algorithmFpType, CpuType cpu>
@@ -54,10 +54,11 @@ services::Status KNNClassificationPredictKernel<algorithmFPType, cpu>::compute(c
     const DAAL_UINT64 resultsToCompute          = par->resultsToCompute;
     const PairwiseDistanceType pairwiseDistance = par->pairwiseDistance;
     const double minkowskiDegree                = par->minkowskiDegree;
+    const bool regression                       = par->regression;
 
     daal::algorithms::bf_knn_classification::internal::BruteForceNearestNeighbors<algorithmFPType, cpu> bfnn;
     bfnn.kNeighbors(k, nClasses, voteWeights, resultsToCompute, resultsToEvaluate, trainDataTable.get(), data, trainLabelTable.get(), label, indices,
-                    distances, pairwiseDistance, minkowskiDegree);
+                    distances, pairwiseDistance, minkowskiDegree, regression);
 
     return services::Status();
 }
@@ -61,7 +61,7 @@ public:
                                 DAAL_UINT64 resultsToEvaluate, const NumericTable * trainTable, const NumericTable * testTable,
                                 const NumericTable * trainLabelTable, NumericTable * testLabelTable, NumericTable * indicesTable,
                                 NumericTable * distancesTable, bf_knn_classification::prediction::internal::PairwiseDistanceType pairwiseDistance,
-                                const double minkowskiDegree)
+                                const double minkowskiDegree, const bool regression)
     {
         using bf_knn_classification::prediction::internal::PairwiseDistanceType;
 
@@ -117,14 +117,17 @@ public:
 
         SafeStatus safeStat;
 
-        daal::threader_for(nOuterBlocks, nOuterBlocks, [&](size_t outerBlock) {
+        /* The test blocks are processed by the NUMA nodes the rows of a NUMA-local table are placed on */
+        const bool bNumaSplit = isNumaLocal<FPType, cpu>(*testTable);
+        daal::threader_for_numa(nOuterBlocks, nOuterBlocks, bNumaSplit, [&](size_t outerBlock) {
             const size_t outerStart = outerBlock * outBlockSize;
             const size_t outerEnd   = outerBlock + 1 == nOuterBlocks ? nTest : outerStart + outBlockSize;
             const size_t outerSize  = outerEnd - outerStart;
 
             DAAL_CHECK_STATUS_THR(computeKNearestBlock(dist.get(), outerSize, inBlockSize, outerStart, nTrain, resultsToEvaluate, resultsToCompute,
                                                        nClasses, k, voteWeights, trainLabel, trainTable, testTable, testLabelTable, indicesTable,
-                                                       distancesTable, tlsDistances, tlsIdx, tlsKDistances, tlsKIndexes, tlsVoting, nOuterBlocks));
+                                                       distancesTable, tlsDistances, tlsIdx, tlsKDistances, tlsKIndexes, tlsVoting, nOuterBlocks,
+                                                       regression));
         });
 
         if (resultsToEvaluate & daal::algorithms::classifier::computeClassLabels)
@@ -179,7 +182,7 @@ protected:
                                           const NumericTable * trainTable, const NumericTable * testTable, NumericTable * testLabelTable,
                                           NumericTable * indicesTable, NumericTable * distancesTable, TlsMem<FPType, cpu> & tlsDistances,
                                           TlsMem<int, cpu> & tlsIdx, TlsMem<FPType, cpu> & tlsKDistances, TlsMem<int, cpu> & tlsKIndexes,
-                                          TlsMem<FPType, cpu> & tlsVoting, size_t nOuterBlocks)
+                                          TlsMem<FPType, cpu> & tlsVoting, size_t nOuterBlocks, const bool regression)
     {
         const size_t inBlockSize = trainBlockSize;
         const size_t inRows      = nTrain;
@@ -311,7 +314,22 @@ protected:
             DAAL_CHECK(!daal::services::internal::daal_memcpy_s(distances, size, kDistances, size), daal::services::ErrorMemoryCopyFailedInternal);
         }
 
-        if (resultsToEvaluate & daal::algorithms::classifier::computeClassLabels)
+        if ((resultsToEvaluate & daal::algorithms::classifier::computeClassLabels) && regression)
+        {
+            daal::internal::WriteOnlyRows<FPType, cpu> testResponseRows(testLabelTable, startTestIdx, iSize);
+            DAAL_CHECK_BLOCK_STATUS(testResponseRows);
+            FPType * testResponse = testResponseRows.get();
+
+            if (voteWeights == VoteWeights::voteUniform)
+            {
+                uniformWeightedRegression(k, iSize, kIndexes, trainLabel, testResponse);
+            }
+            else
+            {
+                distanceWeightedRegression(k, iSize, kDistances, kIndexes, trainLabel, testResponse);
+            }
+        }
+        else if (resultsToEvaluate & daal::algorithms::classifier::computeClassLabels)
         {
             daal::internal::WriteOnlyRows<int, cpu> testLabelRows(testLabelTable, startTestIdx, iSize);
             DAAL_CHECK_BLOCK_STATUS(testLabelRows);
@@ -393,6 +411,53 @@ protected:
         return services::Status();
     }
 
+    void uniformWeightedRegression(const size_t k, const size_t n, const int * indices, const FPType * trainResponse, FPType * testResponse)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            FPType responseSum = 0;
+            for (size_t j = 0; j < k; ++j)
+            {
+                responseSum += trainResponse[indices[i * k + j]];
+            }
+            testResponse[i] = responseSum / FPType(k);
+        }
+    }
+
+    /* The neighbors are weighted by the inverse of their distances. If some of the neighbors coincide with the query,
+       the response is the average of their responses */
+    void distanceWeightedRegression(const size_t k, const size_t n, const FPType * distances, const int * indices, const FPType * trainResponse,
+                                    FPType * testResponse)
+    {
+        const FPType epsilon = daal::services::internal::EpsilonVal<FPType>::get();
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            const FPType * const rowDistances = distances + i * k;
+            const int * const rowIndices      = indices + i * k;
+
+            bool isContainZero = false;
+            for (size_t j = 0; j < k; ++j)
+            {
+                if (rowDistances[j] < epsilon)
+                {
+                    isContainZero = true;
+                    break;
+                }
+            }
+
+            FPType responseSum = 0;
+            FPType weightSum   = 0;
+            for (size_t j = 0; j < k; ++j)
+            {
+                const FPType weight = isContainZero ? FPType(rowDistances[j] < epsilon) : 1 / rowDistances[j];
+                responseSum += weight * trainResponse[rowIndices[j]];
+                weightSum += weight;
+            }
+            testResponse[i] = responseSum / weightSum;
+        }
+    }
+
     services::Status distanceWeightedVoting(const size_t nClasses, const size_t k, const size_t n, const size_t nTrain, FPType * distances,
                                             int * indices, const FPType * trainLabel, int * testLabel, FPType * classWeights)
     {
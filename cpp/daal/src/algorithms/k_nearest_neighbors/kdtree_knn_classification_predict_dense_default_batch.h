@@ -52,9 +52,19 @@ namespace internal
 using namespace daal::data_management;
 using namespace daal::internal;
 
+struct KernelParameter : kdtree_knn_classification::Parameter
+{
+    using kdtree_knn_classification::Parameter::Parameter;
+
+    bool regression = false; /* Average the responses of the neighbors instead of voting for the class label */
+};
+
 template <typename algorithmFpType>
 struct SearchNode;
 
+template <typename algorithmFpType>
+struct GroupSearchNode;
+
 template <typename algorithmFpType, prediction::Method method, CpuType cpu>
 class KNNClassificationPredictKernel : public daal::algorithms::Kernel
 {};
@@ -72,10 +82,18 @@ protected:
                               const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data, const bool isHomogenSOA,
                               services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays);
 
+    void findNearestNeighborsInGroup(const algorithmFpType * const * queries, size_t queryCount,
+                                     Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> * heaps,
+                                     kdtree_knn_classification::internal::Stack<GroupSearchNode<algorithmFpType>, cpu> & stack, size_t k,
+                                     algorithmFpType radius, const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data,
+                                     const bool isHomogenSOA, services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays);
+
+    size_t findLeafStart(const algorithmFpType * query, const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex);
+
     services::Status predict(algorithmFpType * predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
                              const NumericTable * labels, size_t k, VoteWeights voteWeights, const NumericTable * modelIndices,
                              data_management::BlockDescriptor<int> & indices, data_management::BlockDescriptor<algorithmFpType> & distances,
-                             size_t index, const size_t nClasses);
+                             size_t index, const size_t nClasses, const bool regression);
 };
 
 } // namespace internal
@@ -55,6 +55,8 @@ using namespace daal::services;
 using namespace daal::internal;
 using namespace kdtree_knn_classification::internal;
 
+#define __KDTREE_SEARCH_GROUP_SIZE 16
+
 template <typename algorithmFpType>
 struct SearchNode
 {
@@ -62,6 +64,14 @@ struct SearchNode
     algorithmFpType minDistance;
 };
 
+/* Node to visit by the group of queries, keeps the distance estimate for each query of the group */
+template <typename algorithmFpType>
+struct GroupSearchNode
+{
+    size_t nodeIndex;
+    algorithmFpType minDistance[__KDTREE_SEARCH_GROUP_SIZE];
+};
+
 template <typename algorithmFpType, CpuType cpu>
 DAAL_FORCEINLINE bool checkHomogenSOA(const NumericTable & data, services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays)
 {
@@ -121,11 +131,14 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
                                                                                    NumericTable * y, NumericTable * indices, NumericTable * distances,
                                                                                    const daal::algorithms::Parameter * par)
 {
+    /* Returns the scratch blocks of the search to the system when the prediction ends */
+    services::internal::ArenaScope arenaScope;
     Status status;
 
     typedef GlobalNeighbors<algorithmFpType, cpu> Neighbors;
     typedef Heap<Neighbors, cpu> MaxHeap;
     typedef kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> SearchStack;
+    typedef kdtree_knn_classification::internal::Stack<GroupSearchNode<algorithmFpType>, cpu> GroupSearchStack;
     typedef daal::services::internal::MaxVal<algorithmFpType> MaxVal;
     typedef daal::internal::Math<algorithmFpType, cpu> Math;
 
@@ -145,6 +158,9 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
 
     if (par3 == NULL) return Status(ErrorNullParameterNotSupported);
 
+    const auto kernelPar  = dynamic_cast<const KernelParameter *>(par);
+    const bool regression = kernelPar && kernelPar->regression;
+
     const Model * const model    = static_cast<const Model *>(m);
     const auto & kdTreeTable     = *(model->impl()->getKDTreeTable());
     const auto rootTreeNodeIndex = model->impl()->getRootNodeIndex();
@@ -168,25 +184,38 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
     const algorithmFpType base    = 2.0;
     const size_t expectedMaxDepth = (Math::sLog(xRowCount) / Math::sLog(base) + 1) * __KDTREE_DEPTH_MULTIPLICATION_FACTOR;
     const size_t stackSize        = Math::sPowx(base, Math::sCeil(Math::sLog(expectedMaxDepth) / Math::sLog(base)));
+    const size_t groupSize = __KDTREE_SEARCH_GROUP_SIZE;
     struct Local
     {
         MaxHeap heap;
         SearchStack stack;
+        MaxHeap groupHeaps[groupSize];
+        GroupSearchStack groupStack;
+
+        void clear()
+        {
+            stack.clear();
+            heap.clear();
+            groupStack.clear();
+            for (size_t i = 0; i < groupSize; ++i)
+            {
+                groupHeaps[i].clear();
+            }
+        }
     };
     daal::tls<Local *> localTLS([&]() -> Local * {
         Local * const ptr = service_scalable_calloc<Local, cpu>(1);
         if (ptr)
         {
-            if (!ptr->heap.init(heapSize))
+            bool isInitialized = ptr->heap.init(heapSize) && ptr->stack.init(stackSize) && ptr->groupStack.init(stackSize);
+            for (size_t i = 0; i < groupSize; ++i)
             {
-                status.add(services::ErrorMemoryAllocationFailed);
-                service_scalable_free<Local, cpu>(ptr);
-                return nullptr;
+                isInitialized = isInitialized && ptr->groupHeaps[i].init(heapSize);
             }
-            if (!ptr->stack.init(stackSize))
+            if (!isInitialized)
             {
                 status.add(services::ErrorMemoryAllocationFailed);
-                ptr->heap.clear();
+                ptr->clear();
                 service_scalable_free<Local, cpu>(ptr);
                 return nullptr;
             }
@@ -236,7 +265,60 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
                 DAAL_CHECK_STATUS_THR(s);
             }
 
-            if (labels)
+            if (last - first >= groupSize)
+            {
+                /* The queries of the block are ordered by the leaf they fall into and searched in groups,
+                   so that the nodes of the tree and the observations in the leaves are loaded once per group */
+                const size_t blockRowCount = last - first;
+                services::internal::TArrayArena<size_t, cpu> leafStarts(blockRowCount);
+                services::internal::TArrayArena<size_t, cpu> order(blockRowCount);
+                DAAL_CHECK_THR(leafStarts.get() && order.get(), services::ErrorMemoryAllocationFailed);
+
+                for (size_t i = 0; i < blockRowCount; ++i)
+                {
+                    leafStarts[i] = findLeafStart(&dx[i * xColumnCount], kdTreeTable, rootTreeNodeIndex);
+                    order[i]      = i;
+                }
+                daal::algorithms::internal::qSort<size_t, size_t, cpu>(blockRowCount, leafStarts.get(), order.get());
+
+                data_management::BlockDescriptor<algorithmFpType> yBD;
+                algorithmFpType * dy      = nullptr;
+                const size_t yColumnCount = labels ? y->getNumberOfColumns() : 0;
+                if (labels)
+                {
+                    s = y->getBlockOfRows(first, blockRowCount, writeOnly, yBD);
+                    DAAL_CHECK_STATUS_THR(s);
+                    dy = yBD.getBlockPtr();
+                }
+
+                const algorithmFpType * queries[groupSize];
+                for (size_t groupFirst = 0; groupFirst < blockRowCount; groupFirst += groupSize)
+                {
+                    const size_t queryCount = min<cpu>(groupSize, blockRowCount - groupFirst);
+                    for (size_t q = 0; q < queryCount; ++q)
+                    {
+                        queries[q] = &dx[order[groupFirst + q] * xColumnCount];
+                    }
+
+                    findNearestNeighborsInGroup(queries, queryCount, local->groupHeaps, local->groupStack, k, radius, kdTreeTable, rootTreeNodeIndex,
+                                                data, isHomogenSOA, soa_arrays);
+
+                    for (size_t q = 0; q < queryCount; ++q)
+                    {
+                        const size_t i = order[groupFirst + q];
+                        s = predict(dy ? &(dy[i * yColumnCount]) : nullptr, local->groupHeaps[q], labels, k, voteWeights, modelIndices, indicesBD,
+                                    distancesBD, i, nClasses, regression);
+                        DAAL_CHECK_STATUS_THR(s)
+                    }
+                }
+
+                if (labels)
+                {
+                    s |= y->releaseBlockOfRows(yBD);
+                    DAAL_CHECK_STATUS_THR(s);
+                }
+            }
+            else if (labels)
             {
                 const size_t yColumnCount = y->getNumberOfColumns();
                 data_management::BlockDescriptor<algorithmFpType> yBD;
@@ -247,7 +329,8 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
                 {
                     findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data,
                                          isHomogenSOA, soa_arrays);
-                    s = predict(&(dy[i * yColumnCount]), local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses);
+                    s = predict(&(dy[i * yColumnCount]), local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses,
+                                regression);
                     DAAL_CHECK_STATUS_THR(s)
                 }
 
@@ -260,7 +343,7 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
                 {
                     findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data,
                                          isHomogenSOA, soa_arrays);
-                    s = predict(nullptr, local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses);
+                    s = predict(nullptr, local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses, regression);
                     DAAL_CHECK_STATUS_THR(s)
                 }
             }
@@ -285,8 +368,7 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
     localTLS.reduce([&](Local * ptr) -> void {
         if (ptr)
         {
-            ptr->stack.clear();
-            ptr->heap.clear();
+            ptr->clear();
             service_scalable_free<Local, cpu>(ptr);
         }
     });
@@ -386,7 +468,7 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNea
                     }
                     else
                     {
-                        if (heap.getMax()->distance > curNeighbor.distance)
+                        if (curNeighbor < *heap.getMax())
                         {
                             heap.replaceMax(curNeighbor);
                             radius = heap.getMax()->distance;
@@ -429,13 +511,205 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNea
             }
         }
     }
+
+    heap.sort();
+}
+
+template <typename algorithmFpType, CpuType cpu>
+size_t KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findLeafStart(const algorithmFpType * query,
+                                                                                         const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex)
+{
+    const KDTreeNode * const nodes = static_cast<const KDTreeNode *>(kdTreeTable.getArray());
+    const KDTreeNode * node        = nodes + rootTreeNodeIndex;
+    while (node->dimension != __KDTREE_NULLDIMENSION)
+    {
+        const algorithmFpType diff = query[node->dimension] - node->cutPoint;
+        node                       = nodes + ((diff < 0) ? node->leftIndex : node->rightIndex);
+    }
+    return node->leftIndex;
+}
+
+template <typename algorithmFpType, CpuType cpu>
+DAAL_FORCEINLINE void computeGroupDistance(size_t start, size_t end, algorithmFpType * distance, const algorithmFpType * const * queries,
+                                           const bool * isActive, size_t queryCount, const bool isHomogenSOA, const NumericTable & data,
+                                           data_management::BlockDescriptor<algorithmFpType> & xBD,
+                                           services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays)
+{
+    const size_t distanceStride = __KDTREE_LEAF_BUCKET_SIZE + 1;
+    const size_t count          = end - start;
+
+    for (size_t q = 0; q < queryCount; ++q)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            distance[q * distanceStride + i] = 0;
+        }
+    }
+
+    const size_t xColumnCount = data.getNumberOfColumns();
+    for (size_t j = 0; j < xColumnCount; ++j)
+    {
+        const algorithmFpType * const dx = getNtData(isHomogenSOA, j, start, count, data, xBD, soa_arrays);
+
+        for (size_t q = 0; q < queryCount; ++q)
+        {
+            if (!isActive[q]) continue;
+
+            const algorithmFpType value       = queries[q][j];
+            algorithmFpType * const qDistance = distance + q * distanceStride;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < count; ++i)
+            {
+                qDistance[i] += (value - dx[i]) * (value - dx[i]);
+            }
+        }
+
+        releaseNtData<algorithmFpType, cpu>(isHomogenSOA, data, xBD);
+    }
+}
+
+/* Searches the nearest neighbors for the group of queries with the single traversal of the tree.
+   The lower bound of the distance to the node and the search radius are tracked for each query. The distance to
+   the far child is bounded by the maximum of the parent bound and the squared distance to the cut plane, so no
+   subtree that contains the true neighbor is pruned. The negative bound marks the query that has left the subtree,
+   and the node is visited while at least one query of the group remains. The neighbors are selected and sorted by
+   the pair of the distance and the index, so the result, including the ties, is the same as for the single query search */
+template <typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNearestNeighborsInGroup(
+    const algorithmFpType * const * queries, size_t queryCount, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> * heaps,
+    kdtree_knn_classification::internal::Stack<GroupSearchNode<algorithmFpType>, cpu> & stack, size_t k, algorithmFpType radius,
+    const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data, const bool isHomogenSOA,
+    services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays)
+{
+    const size_t groupSize      = __KDTREE_SEARCH_GROUP_SIZE;
+    const size_t distanceStride = __KDTREE_LEAF_BUCKET_SIZE + 1;
+    DAAL_ASSERT(queryCount <= groupSize);
+
+    algorithmFpType radiuses[groupSize];
+    bool isActive[groupSize];
+    for (size_t q = 0; q < queryCount; ++q)
+    {
+        heaps[q].reset();
+        radiuses[q] = radius;
+    }
+    stack.reset();
+
+    GroupSearchNode<algorithmFpType> cur, toPush;
+    cur.nodeIndex = rootTreeNodeIndex;
+    for (size_t q = 0; q < queryCount; ++q)
+    {
+        cur.minDistance[q] = 0;
+    }
+
+    DAAL_ALIGNAS(256) algorithmFpType distance[__KDTREE_SEARCH_GROUP_SIZE * (__KDTREE_LEAF_BUCKET_SIZE + 1)];
+    GlobalNeighbors<algorithmFpType, cpu> curNeighbor;
+    data_management::BlockDescriptor<algorithmFpType> xBD;
+
+    for (;;)
+    {
+        const KDTreeNode * const node = static_cast<const KDTreeNode *>(kdTreeTable.getArray()) + cur.nodeIndex;
+        const bool isLeaf             = (node->dimension == __KDTREE_NULLDIMENSION);
+
+        size_t activeCount = 0;
+        for (size_t q = 0; q < queryCount; ++q)
+        {
+            isActive[q] = (cur.minDistance[q] >= 0) && (isLeaf || cur.minDistance[q] <= radiuses[q]);
+            activeCount += isActive[q];
+        }
+
+        if (activeCount > 0 && isLeaf)
+        {
+            const size_t start = node->leftIndex;
+            const size_t end   = node->rightIndex;
+
+            computeGroupDistance<algorithmFpType, cpu>(start, end, distance, queries, isActive, queryCount, isHomogenSOA, data, xBD, soa_arrays);
+
+            for (size_t q = 0; q < queryCount; ++q)
+            {
+                if (!isActive[q]) continue;
+
+                Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap = heaps[q];
+                const algorithmFpType * const qDistance                = distance + q * distanceStride;
+                for (size_t i = start; i < end; ++i)
+                {
+                    if (qDistance[i - start] <= radiuses[q])
+                    {
+                        curNeighbor.distance = qDistance[i - start];
+                        curNeighbor.index    = i;
+                        if (heap.size() < k)
+                        {
+                            heap.push(curNeighbor, k);
+
+                            if (heap.size() == k)
+                            {
+                                radiuses[q] = heap.getMax()->distance;
+                            }
+                        }
+                        else if (curNeighbor < *heap.getMax())
+                        {
+                            heap.replaceMax(curNeighbor);
+                            radiuses[q] = heap.getMax()->distance;
+                        }
+                    }
+                }
+            }
+        }
+        else if (activeCount > 0)
+        {
+            /* The group goes first to the child that is nearer for the most of the active queries */
+            algorithmFpType diffs[groupSize];
+            size_t leftCount = 0;
+            for (size_t q = 0; q < queryCount; ++q)
+            {
+                diffs[q] = queries[q][node->dimension] - node->cutPoint;
+                leftCount += (isActive[q] && diffs[q] < 0);
+            }
+            const bool isLeftNear = (2 * leftCount >= activeCount);
+
+            cur.nodeIndex    = isLeftNear ? node->leftIndex : node->rightIndex;
+            toPush.nodeIndex = isLeftNear ? node->rightIndex : node->leftIndex;
+            for (size_t q = 0; q < queryCount; ++q)
+            {
+                const algorithmFpType cutDistance = diffs[q] * diffs[q];
+                const algorithmFpType farDistance = (cur.minDistance[q] < cutDistance) ? cutDistance : cur.minDistance[q];
+                if (!isActive[q])
+                {
+                    toPush.minDistance[q] = cur.minDistance[q] = -1;
+                }
+                else if ((diffs[q] < 0) == isLeftNear)
+                {
+                    toPush.minDistance[q] = farDistance;
+                }
+                else
+                {
+                    toPush.minDistance[q] = cur.minDistance[q];
+                    cur.minDistance[q]    = farDistance;
+                }
+            }
+            stack.push(toPush);
+            continue;
+        }
+
+        if (stack.empty())
+        {
+            break;
+        }
+        cur = stack.pop();
+        DAAL_PREFETCH_READ_T0(static_cast<const KDTreeNode *>(kdTreeTable.getArray()) + cur.nodeIndex);
+    }
+
+    for (size_t q = 0; q < queryCount; ++q)
+    {
+        heaps[q].sort();
+    }
 }
 
 template <typename algorithmFpType, CpuType cpu>
 services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::predict(
     algorithmFpType * predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable * labels, size_t k,
     VoteWeights voteWeights, const NumericTable * modelIndices, data_management::BlockDescriptor<int> & indices,
-    data_management::BlockDescriptor<algorithmFpType> & distances, size_t index, const size_t nClasses)
+    data_management::BlockDescriptor<algorithmFpType> & distances, size_t index, const size_t nClasses, const bool regression)
 {
     typedef daal::internal::Math<algorithmFpType, cpu> Math;
 
@@ -487,13 +761,54 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
         }
     }
 
-    if (labels)
+    if (labels && regression)
+    {
+        DAAL_ASSERT(predictedClass);
+
+        /* The response is the average of the neighbor responses weighted in the same way as the votes */
+        data_management::BlockDescriptor<algorithmFpType> labelBD;
+        const algorithmFpType epsilon = daal::services::internal::EpsilonVal<algorithmFpType>::get();
+
+        bool isContainZero = false;
+        if (voteWeights == voteDistance)
+        {
+            for (size_t i = 0; i < heapSize; ++i)
+            {
+                if (heap[i].distance <= epsilon)
+                {
+                    isContainZero = true;
+                    break;
+                }
+            }
+        }
+
+        algorithmFpType responseSum = 0;
+        algorithmFpType weightSum   = 0;
+        for (size_t i = 0; i < heapSize; ++i)
+        {
+            algorithmFpType weight = 1;
+            if (voteWeights == voteDistance)
+            {
+                weight = isContainZero ? algorithmFpType(heap[i].distance <= epsilon) : Math::sSqrt(1 / heap[i].distance);
+            }
+            if (weight > 0)
+            {
+                const_cast<NumericTable *>(labels)->getBlockOfColumnValues(0, heap[i].index, 1, readOnly, labelBD);
+                responseSum += weight * *(labelBD.getBlockPtr());
+                const_cast<NumericTable *>(labels)->releaseBlockOfColumnValues(labelBD);
+                weightSum += weight;
+            }
+        }
+        *predictedClass = responseSum / weightSum;
+    }
+    else if (labels)
     {
         DAAL_ASSERT(predictedClass);
 
         data_management::BlockDescriptor<algorithmFpType> labelBD;
-        algorithmFpType * classes      = static_cast<algorithmFpType *>(daal::services::internal::service_malloc<algorithmFpType, cpu>(heapSize));
-        algorithmFpType * classWeights = static_cast<algorithmFpType *>(daal::services::internal::service_malloc<algorithmFpType, cpu>(nClasses));
+        /* The buffers are allocated for each query, so they are taken from the arena of the thread */
+        algorithmFpType * classes      = daal::services::internal::service_arena_malloc<algorithmFpType, cpu>(heapSize);
+        algorithmFpType * classWeights = daal::services::internal::service_arena_malloc<algorithmFpType, cpu>(nClasses);
         DAAL_CHECK_MALLOC(classWeights);
         DAAL_CHECK_MALLOC(classes);
 
@@ -564,8 +879,8 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
         }
         *predictedClass = maxWeightClass;
 
-        service_free<algorithmFpType, cpu>(classes);
-        service_free<algorithmFpType, cpu>(classWeights);
+        service_arena_free<algorithmFpType, cpu>(classes);
+        service_arena_free<algorithmFpType, cpu>(classWeights);
         classes = nullptr;
     }
 
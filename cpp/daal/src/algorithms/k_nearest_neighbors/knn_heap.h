@@ -179,6 +179,16 @@ public:
         }
     }
 
+    /* Sorts the elements in the ascending order, the heap is no longer valid after that */
+    void sort()
+    {
+        makeMaxHeap<cpu>(_elements, _elements + _count);
+        for (size_t count = _count; count > 1; --count)
+        {
+            popMaxHeap<cpu>(_elements, _elements + count);
+        }
+    }
+
     size_t size() const { return _count; }
 
     T * getMax() { return _elements; }
@@ -196,7 +206,8 @@ struct GlobalNeighbors
     algorithmFpType distance;
     size_t index;
 
-    inline bool operator<(const GlobalNeighbors & rhs) const { return (distance < rhs.distance); }
+    /* Neighbors at the same distance are ordered by the index, so the selected set does not depend on the search order */
+    inline bool operator<(const GlobalNeighbors & rhs) const { return (distance < rhs.distance) || (distance == rhs.distance && index < rhs.index); }
 };
 
 } // namespace internal
@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "daal/include/algorithms/k_nearest_neighbors/kdtree_knn_classification_predict.h"
+#include "daal/include/algorithms/k_nearest_neighbors/kdtree_knn_classification_training_batch.h"
+#include "daal/include/data_management/data/homogen_numeric_table.h"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal::algorithms::kdtree_knn_classification::test {
+
+namespace dm = daal::data_management;
+
+template <typename T>
+static std::vector<T> get_data(const dm::NumericTablePtr& table) {
+    const std::size_t row_count = table->getNumberOfRows();
+    const std::size_t column_count = table->getNumberOfColumns();
+    dm::BlockDescriptor<T> block;
+    table->getBlockOfRows(0, row_count, dm::readOnly, block);
+    std::vector<T> data(block.getBlockPtr(), block.getBlockPtr() + row_count * column_count);
+    table->releaseBlockOfRows(block);
+    return data;
+}
+
+/// The points have small integer coordinates, so the squared distances are exact
+/// and many neighbors are at the same distance from the query
+template <typename Float>
+static std::vector<Float> generate_grid_points(std::size_t row_count,
+                                               std::size_t column_count,
+                                               int min_value,
+                                               int max_value,
+                                               std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> distr(min_value, max_value);
+    std::vector<Float> points(row_count * column_count);
+    for (auto& value : points) {
+        value = Float(distr(rng));
+    }
+    return points;
+}
+
+template <typename Float>
+static ModelPtr train(const std::vector<Float>& x, std::size_t column_count, std::size_t k) {
+    training::Batch<Float> algorithm;
+    algorithm.input.set(classifier::training::data,
+                        dm::HomogenNumericTable<Float>::create(const_cast<Float*>(x.data()),
+                                                               column_count,
+                                                               x.size() / column_count));
+    algorithm.parameter.k = k;
+    algorithm.parameter.resultsToEvaluate = classifier::none;
+    REQUIRE(algorithm.compute().ok());
+    return algorithm.getResult()->get(classifier::training::model);
+}
+
+template <typename Float>
+static prediction::ResultPtr infer(const ModelPtr& model,
+                                   const Float* queries,
+                                   std::size_t query_count,
+                                   std::size_t column_count,
+                                   std::size_t k) {
+    prediction::Batch<Float> algorithm;
+    algorithm.input.set(classifier::prediction::data,
+                        dm::HomogenNumericTable<Float>::create(const_cast<Float*>(queries),
+                                                               column_count,
+                                                               query_count));
+    algorithm.input.set(classifier::prediction::model, model);
+    algorithm.parameter.k = k;
+    algorithm.parameter.resultsToEvaluate = classifier::none;
+    algorithm.parameter.resultsToCompute = computeIndicesOfNeighbors | computeDistances;
+    REQUIRE(algorithm.compute().ok());
+    return algorithm.getResult();
+}
+
+TEMPLATE_TEST("kd-tree search of the query group matches the single query search and brute force",
+              "[kdtree_knn][search]",
+              float,
+              double) {
+    using Float = TestType;
+
+    const std::size_t k = GENERATE(1, 5, 20);
+    CAPTURE(k);
+
+    const std::size_t column_count = 3;
+    const std::size_t train_row_count = 2000;
+    // The queries are split between the threads, and the block of 16 or more
+    // queries is searched in groups
+    const std::size_t query_count = 4096;
+
+    const auto x = generate_grid_points<Float>(train_row_count, column_count, 0, 4, 7777);
+    const auto queries = generate_grid_points<Float>(query_count, column_count, -1, 5, 8888);
+
+    const auto model = train(x, column_count, k);
+
+    const auto group_result = infer(model, queries.data(), query_count, column_count, k);
+    const auto group_indices = get_data<int>(group_result->get(prediction::indices));
+    const auto group_distances = get_data<Float>(group_result->get(prediction::distances));
+    REQUIRE(group_indices.size() == query_count * k);
+    REQUIRE(group_distances.size() == query_count * k);
+
+    std::vector<Float> brute_force_distances(train_row_count);
+    for (std::size_t q = 0; q < query_count; q++) {
+        CAPTURE(q);
+        const Float* query = queries.data() + q * column_count;
+
+        // The single query is always searched alone
+        const auto single_result = infer(model, query, 1, column_count, k);
+        const auto single_indices = get_data<int>(single_result->get(prediction::indices));
+        const auto single_distances = get_data<Float>(single_result->get(prediction::distances));
+
+        for (std::size_t i = 0; i < train_row_count; i++) {
+            Float distance = 0;
+            for (std::size_t j = 0; j < column_count; j++) {
+                const Float diff = query[j] - x[i * column_count + j];
+                distance += diff * diff;
+            }
+            brute_force_distances[i] = distance;
+        }
+        auto sorted_distances = brute_force_distances;
+        std::sort(sorted_distances.begin(), sorted_distances.end());
+
+        std::set<int> unique_indices;
+        for (std::size_t j = 0; j < k; j++) {
+            const int index = group_indices[q * k + j];
+            const Float distance = group_distances[q * k + j];
+            CAPTURE(j, index, distance);
+
+            REQUIRE(index == single_indices[j]);
+            REQUIRE(distance == single_distances[j]);
+
+            REQUIRE(index >= 0);
+            REQUIRE(std::size_t(index) < train_row_count);
+            REQUIRE(unique_indices.insert(index).second);
+
+            const Float expected = std::sqrt(sorted_distances[j]);
+            const Float tolerance = Float(1e-5) * (Float(1) + expected);
+            REQUIRE(std::abs(distance - expected) <= tolerance);
+            REQUIRE(std::abs(distance - std::sqrt(brute_force_distances[index])) <= tolerance);
+        }
+    }
+}
+
+} // namespace daal::algorithms::kdtree_knn_classification::test
@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include "daal/include/algorithms/k_nearest_neighbors/kdtree_knn_classification_predict.h"
+#include "daal/include/algorithms/k_nearest_neighbors/kdtree_knn_classification_training_batch.h"
+#include "daal/include/data_management/data/homogen_numeric_table.h"
+#include "daal/src/threading/threading.h"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal::algorithms::kdtree_knn_classification::test {
+
+namespace dm = daal::data_management;
+
+/// Compares the time of the group search, which is used when every thread gets
+/// 16 or more queries, with the single query search, which is used when the
+/// queries are passed one by one
+class kdtree_search_perf_test {
+public:
+    using float_t = float;
+
+    void generate(std::size_t train_row_count, std::size_t query_count, std::size_t column_count) {
+        std::mt19937 rng(7777);
+        std::uniform_real_distribution<float_t> uniform(-1.0, 1.0);
+
+        x_.resize(train_row_count * column_count);
+        for (auto& value : x_) {
+            value = uniform(rng);
+        }
+        queries_.resize(query_count * column_count);
+        for (auto& value : queries_) {
+            value = uniform(rng);
+        }
+        column_count_ = column_count;
+    }
+
+    void train(std::size_t k) {
+        training::Batch<float_t> algorithm;
+        algorithm.input.set(classifier::training::data,
+                            dm::HomogenNumericTable<float_t>::create(x_.data(),
+                                                                     column_count_,
+                                                                     x_.size() / column_count_));
+        algorithm.parameter.k = k;
+        algorithm.parameter.resultsToEvaluate = classifier::none;
+        REQUIRE(algorithm.compute().ok());
+        model_ = algorithm.getResult()->get(classifier::training::model);
+        k_ = k;
+    }
+
+    void run_group_search() {
+        const std::size_t query_count = queries_.size() / column_count_;
+        const auto name = fmt::format("group search: query_count {}, k {}, thread_count {}",
+                                      query_count,
+                                      k_,
+                                      daal::threader_get_threads_number());
+        BENCHMARK(name.c_str()) {
+            return infer(queries_.data(), query_count);
+        };
+    }
+
+    void run_single_query_search() {
+        const std::size_t query_count = queries_.size() / column_count_;
+        const auto name = fmt::format("single query search: query_count {}, k {}",
+                                      query_count,
+                                      k_);
+        BENCHMARK(name.c_str()) {
+            bool ok = true;
+            for (std::size_t q = 0; q < query_count; q++) {
+                ok &= infer(queries_.data() + q * column_count_, 1);
+            }
+            return ok;
+        };
+    }
+
+private:
+    bool infer(float_t* queries, std::size_t query_count) const {
+        prediction::Batch<float_t> algorithm;
+        algorithm.input.set(
+            classifier::prediction::data,
+            dm::HomogenNumericTable<float_t>::create(queries, column_count_, query_count));
+        algorithm.input.set(classifier::prediction::model, model_);
+        algorithm.parameter.k = k_;
+        algorithm.parameter.resultsToEvaluate = classifier::none;
+        algorithm.parameter.resultsToCompute = computeIndicesOfNeighbors | computeDistances;
+        return algorithm.compute().ok();
+    }
+
+    std::vector<float_t> x_;
+    std::vector<float_t> queries_;
+    ModelPtr model_;
+    std::size_t column_count_ = 0;
+    std::size_t k_ = 0;
+};
+
+TEST_M(kdtree_search_perf_test,
+       "kd-tree group search is compared with the single query search",
+       "[kdtree_knn][search][perf]") {
+    const std::size_t k = GENERATE(1, 10);
+    const std::size_t column_count = GENERATE(3, 16);
+    this->generate(100000, 20000, column_count);
+    this->train(k);
+
+    this->run_group_search();
+    this->run_single_query_search();
+}
+
+} // namespace daal::algorithms::kdtree_knn_classification::test
@@ -50,6 +50,8 @@ namespace internal
 template <Method method, typename algorithmFPType, CpuType cpu>
 Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTable * const * a, const NumericTable * const * r, const Parameter * par)
 {
+    /* Returns the scratch blocks of the iterations to the system when the training ends */
+    ArenaScope arenaScope;
     Status s;
     NumericTable * ntData  = const_cast<NumericTable *>(a[0]);
     const size_t nIter     = par->maxIterations;
@@ -124,8 +126,8 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
 
-    TArray<double, cpu> dS1(method == defaultDense ? p : 0);
-    if (method == defaultDense)
+    TArray<double, cpu> dS1(method != lloydCSR ? p : 0);
+    if (method != lloydCSR)
     {
         DAAL_CHECK(dS1.get(), services::ErrorMemoryAllocationFailed);
     }
@@ -141,6 +143,12 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
     size_t blockSize = 0;
     DAAL_SAFE_CPU_CALL((blockSize = BSHelper<method, algorithmFPType, cpu>::kmeansGetBlockSize(n, p, nClusters)), (blockSize = 512))
 
+    HamerlyBounds<algorithmFPType, cpu> bounds;
+    if (method == hamerlyDense && nIter)
+    {
+        DAAL_CHECK_STATUS(s, bounds.init(n, nClusters, p));
+    }
+
     size_t kIter;
 
     for (kIter = 0; kIter < nIter; kIter++)
@@ -150,8 +158,18 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(addNTToTaskThreaded);
             /* For the last iteration we do not need to recount of assignmets */
-            s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), blockSize,
-                                                           assignmetsNT && (kIter == nIter - 1) ? assignmetsNT : nullptr);
+            NumericTable * const ntAssign = assignmetsNT && (kIter == nIter - 1) ? assignmetsNT : nullptr;
+            if (method == hamerlyDense)
+            {
+                /* The objective function that stops the iterations is computed in the same way as by the Lloyd method */
+                const bool bExactGoals = (par->accuracyThreshold > (algorithmFPType)0.0);
+                s                      = bounds.setCentroids(inClusters);
+                if (s) s = task->addNTToTaskThreadedHamerly(ntData, blockSize, bounds, bExactGoals, ntAssign);
+            }
+            else
+            {
+                s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), blockSize, ntAssign);
+            }
         }
 
         if (!s)
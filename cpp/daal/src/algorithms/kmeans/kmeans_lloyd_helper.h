@@ -145,6 +145,10 @@ struct BSHelper<lloydDense, algorithmFPType, cpu>
     }
 };
 
+template <typename algorithmFPType, CpuType cpu>
+struct BSHelper<hamerlyDense, algorithmFPType, cpu> : public BSHelper<lloydDense, algorithmFPType, cpu>
+{};
+
 template <typename algorithmFPType, CpuType cpu>
 struct BSHelper<lloydCSR, algorithmFPType, cpu>
 {
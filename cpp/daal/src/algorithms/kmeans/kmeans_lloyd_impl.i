@@ -31,6 +31,8 @@
 #include "src/externals/service_blas.h"
 #include "src/externals/service_spblas.h"
 #include "src/services/service_data_utils.h"
+#include "src/services/service_arrays.h"
+#include "src/externals/service_math.h"
 
 #include "src/algorithms/kmeans/kmeans_lloyd_helper.h"
 
@@ -46,6 +48,108 @@ using namespace daal::internal;
 using namespace daal::services;
 using namespace daal::services::internal;
 
+/*
+ * Bounds of the Hamerly method kept for the observations between the iterations.
+ * lowerBounds[i] is a lower bound of the distance from the i-th observation to the closest centroid
+ * other than the assigned one. The observations with negative assignments have no bounds yet.
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct HamerlyBounds
+{
+    Status init(size_t nRows, size_t nClustersValue, size_t dimValue)
+    {
+        nClusters = nClustersValue;
+        dim       = dimValue;
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, dim);
+        assignments.reset(nRows);
+        lowerBounds.reset(nRows);
+        halfDistances.reset(nClusters);
+        prevCentroids.reset(nClusters * dim);
+        DAAL_CHECK_MALLOC(assignments.get() && lowerBounds.get() && halfDistances.get() && prevCentroids.get());
+
+        service_memset<int, cpu>(assignments.get(), -1, nRows);
+        hasCentroids = false;
+        return Status();
+    }
+
+    /* Sets the centroids of the next iteration. Computes the shifts of the centroids the lower bounds are decreased by,
+       and the halves of the distances from the centroids to the closest other centroids */
+    Status setCentroids(const algorithmFPType * const centroids)
+    {
+        maxShift       = algorithmFPType(0);
+        secondMaxShift = algorithmFPType(0);
+        maxShiftIdx    = 0;
+        if (hasCentroids)
+        {
+            for (size_t k = 0; k < nClusters; k++)
+            {
+                const algorithmFPType shift = Math<algorithmFPType, cpu>::sSqrt(getDistanceSq(&centroids[k * dim], &prevCentroids[k * dim]));
+                if (shift > maxShift)
+                {
+                    secondMaxShift = maxShift;
+                    maxShift       = shift;
+                    maxShiftIdx    = k;
+                }
+                else if (shift > secondMaxShift)
+                {
+                    secondMaxShift = shift;
+                }
+            }
+        }
+        int result = daal::services::internal::daal_memcpy_s(prevCentroids.get(), nClusters * dim * sizeof(algorithmFPType), centroids,
+                                                             nClusters * dim * sizeof(algorithmFPType));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+        hasCentroids = true;
+
+        algorithmFPType * const halfDist = halfDistances.get();
+        daal::threader_for(nClusters, nClusters, [&](size_t k) {
+            algorithmFPType minDistSq = MaxVal<algorithmFPType>::get();
+            for (size_t j = 0; j < nClusters; j++)
+            {
+                if (j == k) continue;
+                const algorithmFPType distSq = getDistanceSq(&centroids[k * dim], &centroids[j * dim]);
+                if (distSq < minDistSq)
+                {
+                    minDistSq = distSq;
+                }
+            }
+            halfDist[k] = Math<algorithmFPType, cpu>::sSqrt(minDistSq) * algorithmFPType(0.5);
+        });
+        return Status();
+    }
+
+    /* Lower bound of the i-th observation decreased by the shifts of the centroids other than the assigned one */
+    algorithmFPType getLowerBound(size_t i, size_t assignment) const
+    {
+        return lowerBounds[i] - (assignment == maxShiftIdx ? secondMaxShift : maxShift);
+    }
+
+    algorithmFPType getDistanceSq(const algorithmFPType * const a, const algorithmFPType * const b) const
+    {
+        algorithmFPType sum = algorithmFPType(0);
+        PRAGMA_IVDEP
+        PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
+        for (size_t j = 0; j < dim; j++)
+        {
+            sum += (a[j] - b[j]) * (a[j] - b[j]);
+        }
+        return sum;
+    }
+
+    TArray<int, cpu> assignments;
+    TArray<algorithmFPType, cpu> lowerBounds;
+    TArray<algorithmFPType, cpu> halfDistances;
+    TArray<algorithmFPType, cpu> prevCentroids;
+
+    size_t nClusters               = 0;
+    size_t dim                     = 0;
+    bool hasCentroids              = false;
+    algorithmFPType maxShift       = 0;
+    algorithmFPType secondMaxShift = 0;
+    size_t maxShiftIdx             = 0;
+};
+
 template <typename algorithmFPType, CpuType cpu>
 struct TaskKMeansLloyd
 {
@@ -108,6 +212,9 @@ struct TaskKMeansLloyd
     Status addNTToTaskThreadedCSR(const NumericTable * const ntData, const algorithmFPType * const catCoef, const size_t blockSizeDefault,
                                   NumericTable * ntAssign = nullptr);
 
+    Status addNTToTaskThreadedHamerly(const NumericTable * const ntData, const size_t blockSizeDefault, HamerlyBounds<algorithmFPType, cpu> & bounds,
+                                      const bool bExactGoals, NumericTable * ntAssign = nullptr);
+
     template <Method method>
     Status addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef, const size_t blockSizeDefault,
                                NumericTable * ntAssign = nullptr);
@@ -143,8 +250,10 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedDense(const Num
     size_t nBlocks = n / blockSizeDefault;
     nBlocks += (nBlocks * blockSizeDefault != n);
 
+    /* The blocks are processed by the NUMA nodes the rows of a NUMA-local table are placed on */
+    const bool bNumaSplit = isNumaLocal<algorithmFPType, cpu>(*ntData);
     SafeStatus safeStat;
-    daal::static_threader_for(nBlocks, [=, &safeStat](const int k, size_t tid) {
+    daal::static_threader_for_numa(nBlocks, bNumaSplit, [=, &safeStat](const int k, size_t tid) {
         struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local(tid);
         DAAL_CHECK_MALLOC_THR(tt);
         const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDefault : blockSizeDefault;
@@ -343,6 +452,234 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const Numer
     return safeStat.detach();
 }
 
+/*
+ * Assigns the observations to the centroids like addNTToTaskThreadedDense, but computes only the distance to the assigned centroid
+ * for the observations whose bounds prove that the assignment is not changed. The distances to all centroids are computed by the
+ * same distance block as in addNTToTaskThreadedDense for the rest of the observations, which also gives their new lower bounds.
+ * The observations close to the decision boundary within the rounding error of the distances are always recomputed,
+ * so the assignments are the same as of the Lloyd method. The goal of the skipped observation is computed by the scalar
+ * dot product and differs from the one of the Lloyd method by rounding. If bExactGoals is set, no observation is skipped
+ * and the goals, and so the objective function and the candidates for the empty clusters, are the same as of the Lloyd method.
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedHamerly(const NumericTable * const ntData, const size_t blockSizeDefault,
+                                                                         HamerlyBounds<algorithmFPType, cpu> & bounds, const bool bExactGoals,
+                                                                         NumericTable * ntAssign)
+{
+    const size_t n = ntData->getNumberOfRows();
+
+    size_t nBlocks = n / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != n);
+
+    algorithmFPType maxClustersSq = algorithmFPType(0);
+    for (size_t j = 0; j < clNum; j++)
+    {
+        maxClustersSq = (clSq[j] > maxClustersSq) ? clSq[j] : maxClustersSq;
+    }
+    /* Relative error of the distances computed as the sums of dim products */
+    const algorithmFPType tolerance = algorithmFPType(4 * (dim + 2)) * EpsilonVal<algorithmFPType>::get();
+
+    int * const allAssignments             = bounds.assignments.get();
+    algorithmFPType * const allLowerBounds = bounds.lowerBounds.get();
+    const algorithmFPType * const halfDist = bounds.halfDistances.get();
+
+    const bool bNumaSplit = isNumaLocal<algorithmFPType, cpu>(*ntData);
+    SafeStatus safeStat;
+    daal::static_threader_for_numa(nBlocks, bNumaSplit, [=, &safeStat, &bounds](const int k, size_t tid) {
+        struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local(tid);
+        DAAL_CHECK_MALLOC_THR(tt);
+        const size_t blockStart = k * blockSizeDefault;
+        const size_t blockSize  = (k == nBlocks - 1) ? n - blockStart : blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), blockStart, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+        const algorithmFPType * const data = mtData.get();
+
+        const size_t p                           = dim;
+        const size_t nClusters                   = clNum;
+        const algorithmFPType * const inClusters = cCenters;
+        const algorithmFPType * const clustersSq = clSq;
+
+        algorithmFPType * trg        = &(tt->goalFunc);
+        algorithmFPType * x_clusters = tt->mklBuff;
+
+        int * cS0             = tt->cS0;
+        algorithmFPType * cS1 = tt->cS1;
+
+        int * const blockAssignments             = allAssignments + blockStart;
+        algorithmFPType * const blockLowerBounds = allLowerBounds + blockStart;
+
+        int * assignments = nullptr;
+        WriteOnlyRows<int, cpu> assignBlock(ntAssign, blockStart, blockSize);
+        if (ntAssign)
+        {
+            DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
+            assignments = assignBlock.get();
+        }
+
+        TArrayArena<algorithmFPType, cpu> goals(blockSize);
+        TArrayArena<size_t, cpu> recomputed(blockSize);
+        DAAL_CHECK_MALLOC_THR(goals.get() && recomputed.get());
+
+        size_t nRecomputed = 0;
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const algorithmFPType * const x = &data[i * p];
+
+            algorithmFPType xSq = algorithmFPType(0);
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                xSq += x[j] * x[j];
+            }
+
+            const int assigned = blockAssignments[i];
+            if (assigned >= 0 && !bExactGoals)
+            {
+                const algorithmFPType * const c = &inClusters[assigned * p];
+
+                algorithmFPType xc = algorithmFPType(0);
+                PRAGMA_IVDEP
+                for (size_t j = 0; j < p; j++)
+                {
+                    xc += x[j] * c[j];
+                }
+
+                const algorithmFPType goal       = (clustersSq[assigned] - xc) * 2.0 + xSq;
+                const algorithmFPType lowerBound = bounds.getLowerBound(blockStart + i, assigned);
+                const algorithmFPType bound      = (halfDist[assigned] > lowerBound) ? halfDist[assigned] : lowerBound;
+
+                if (bound * bound - goal > tolerance * (xSq + maxClustersSq * 2.0))
+                {
+                    goals[i]            = goal;
+                    blockLowerBounds[i] = lowerBound;
+                    continue;
+                }
+            }
+            goals[i]                  = xSq;
+            recomputed[nRecomputed++] = i;
+        }
+
+        if (nRecomputed)
+        {
+            const algorithmFPType * rows = data;
+            TArrayArena<algorithmFPType, cpu> gathered;
+            if (nRecomputed < blockSize)
+            {
+                gathered.reset(nRecomputed * p);
+                DAAL_CHECK_MALLOC_THR(gathered.get());
+                for (size_t r = 0; r < nRecomputed; r++)
+                {
+                    const algorithmFPType * const x = &data[recomputed[r] * p];
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        gathered[r * p + j] = x[j];
+                    }
+                }
+                rows = gathered.get();
+            }
+
+            const char transa           = 't';
+            const char transb           = 'n';
+            const DAAL_INT _m           = nRecomputed;
+            const DAAL_INT _n           = nClusters;
+            const DAAL_INT _k           = p;
+            const algorithmFPType alpha = -1.0;
+            const DAAL_INT lda          = p;
+            const DAAL_INT ldy          = p;
+            const algorithmFPType beta  = 1.0;
+            const DAAL_INT ldaty        = nRecomputed;
+
+            for (size_t j = 0; j < nClusters; j++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t r = 0; r < nRecomputed; r++)
+                {
+                    x_clusters[r + j * nRecomputed] = clustersSq[j];
+                }
+            }
+
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, rows, &lda, inClusters, &ldy, &beta, x_clusters, &ldaty);
+
+            for (size_t r = 0; r < nRecomputed; r++)
+            {
+                algorithmFPType minGoalVal    = x_clusters[r];
+                algorithmFPType secondGoalVal = MaxVal<algorithmFPType>::get();
+                size_t minIdx                 = 0;
+
+                for (size_t j = 1; j < nClusters; j++)
+                {
+                    const algorithmFPType localGoalVal = x_clusters[r + j * nRecomputed];
+                    if (localGoalVal < minGoalVal)
+                    {
+                        secondGoalVal = minGoalVal;
+                        minGoalVal    = localGoalVal;
+                        minIdx        = j;
+                    }
+                    else if (localGoalVal < secondGoalVal)
+                    {
+                        secondGoalVal = localGoalVal;
+                    }
+                }
+
+                const size_t i            = recomputed[r];
+                const algorithmFPType xSq = goals[i];
+                blockAssignments[i]       = (int)minIdx;
+                /* The squared norm is added in the same way as in addNTToTaskThreadedDense below */
+                goals[i] = minGoalVal * 2.0;
+
+                /* With one cluster the half distance keeps the assignment, so the lower bound is not used */
+                algorithmFPType secondDistSq = (nClusters > 1) ? secondGoalVal * 2.0 + xSq : algorithmFPType(0);
+                secondDistSq                 = (secondDistSq > algorithmFPType(0)) ? secondDistSq : algorithmFPType(0);
+                blockLowerBounds[i]          = Math<algorithmFPType, cpu>::sSqrt(secondDistSq);
+            }
+        }
+
+        algorithmFPType goal = algorithmFPType(0);
+        size_t r             = 0;
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const size_t minIdx     = blockAssignments[i];
+            algorithmFPType goalVal = goals[i];
+
+            if (r < nRecomputed && recomputed[r] == i)
+            {
+                PRAGMA_IVDEP
+                for (size_t j = 0; j < p; j++)
+                {
+                    cS1[minIdx * p + j] += data[i * p + j];
+                    goalVal += data[i * p + j] * data[i * p + j];
+                }
+                r++;
+            }
+            else
+            {
+                PRAGMA_IVDEP
+                for (size_t j = 0; j < p; j++)
+                {
+                    cS1[minIdx * p + j] += data[i * p + j];
+                }
+            }
+
+            kmeansInsertCandidate(tt, goalVal, blockStart + i);
+            cS0[minIdx]++;
+
+            goal += goalVal;
+
+            if (ntAssign)
+            {
+                assignments[i] = (int)minIdx;
+            }
+        }
+
+        *trg += goal;
+    });
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 template <Method method>
 Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef,
@@ -356,6 +693,11 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreaded(const NumericT
     {
         return addNTToTaskThreadedCSR(ntData, catCoef, blockSizeDefault, ntAssign);
     }
+    else if (method == hamerlyDense)
+    {
+        /* Without the bounds the Hamerly method is the Lloyd method */
+        return addNTToTaskThreadedDense(ntData, catCoef, blockSizeDefault, ntAssign);
+    }
     DAAL_ASSERT(false);
     return Status();
 }
@@ -385,7 +727,7 @@ template <typename algorithmFPType, CpuType cpu>
 template <Method method>
 void TaskKMeansLloyd<algorithmFPType, cpu>::kmeansComputeCentroids(int * clusterS0, algorithmFPType * clusterS1, double * auxData)
 {
-    if (method == defaultDense && auxData)
+    if (method != lloydCSR && auxData)
     {
         for (size_t i = 0; i < clNum; i++)
         {
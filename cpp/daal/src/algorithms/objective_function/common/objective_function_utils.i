@@ -64,6 +64,65 @@ services::Status getXY(NumericTable * dataNT, NumericTable * dependentVariablesN
     return services::Status();
 }
 
+/* Gathers the rows of the CSR table with the given indices into the one-based CSR arrays */
+template <typename algorithmFPType, CpuType cpu>
+services::Status getXYCSR(CSRNumericTableIface * dataNT, NumericTable * dependentVariablesNT, const NumericTable * indNT,
+                          TArrayScalable<algorithmFPType, cpu> & aValues, TArrayScalable<size_t, cpu> & aCols, TArrayScalable<size_t, cpu> & aRows,
+                          algorithmFPType * aY, size_t nRows, size_t n)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(getXYCSR);
+    DAAL_ASSERT(indNT != nullptr);
+    DAAL_ASSERT(dataNT != nullptr);
+    DAAL_ASSERT(dependentVariablesNT != nullptr);
+    DAAL_ASSERT(aY != nullptr);
+
+    ReadRows<int, cpu> rInd(*const_cast<NumericTable *>(indNT), 0, n);
+    DAAL_CHECK_BLOCK_STATUS(rInd);
+    const int * ind = rInd.get();
+
+    DAAL_OVERFLOW_CHECK_BY_ADDING(size_t, n, 1);
+    if (aRows.size() < n + 1)
+    {
+        aRows.reset(n + 1);
+        DAAL_CHECK_MALLOC(aRows.get());
+    }
+    size_t * rows = aRows.get();
+
+    ReadRowsCSR<algorithmFPType, cpu> xr;
+    rows[0] = 1;
+    for (size_t i = 0; i < n; ++i)
+    {
+        xr.set(dataNT, ind[i], 1);
+        DAAL_CHECK_BLOCK_STATUS(xr);
+        rows[i + 1] = rows[i] + (xr.rows()[1] - xr.rows()[0]);
+    }
+
+    const size_t nNonZeros = rows[n] - 1;
+    if (aValues.size() < nNonZeros)
+    {
+        aValues.reset(nNonZeros);
+        DAAL_CHECK_MALLOC(aValues.get());
+    }
+    if (aCols.size() < nNonZeros)
+    {
+        aCols.reset(nNonZeros);
+        DAAL_CHECK_MALLOC(aCols.get());
+    }
+
+    ReadRows<algorithmFPType, cpu> yr(*dependentVariablesNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yr);
+    for (size_t i = 0; i < n; ++i)
+    {
+        xr.set(dataNT, ind[i], 1);
+        DAAL_CHECK_BLOCK_STATUS(xr);
+        const size_t nValues = rows[i + 1] - rows[i];
+        services::internal::tmemcpy<algorithmFPType, cpu>(aValues.get() + rows[i] - 1, xr.values(), nValues);
+        services::internal::tmemcpy<size_t, cpu>(aCols.get() + rows[i] - 1, xr.cols(), nValues);
+        aY[i] = yr.get()[ind[i]];
+    }
+    return services::Status();
+}
+
 } // namespace internal
 
 } // namespace objective_function
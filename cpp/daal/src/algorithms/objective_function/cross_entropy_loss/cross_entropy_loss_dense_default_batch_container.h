@@ -73,6 +73,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * nonSmoothTermValue      = nullptr;
     NumericTable * proximalProjection      = nullptr;
     NumericTable * lipschitzConstant       = nullptr;
+    NumericTable * hessianVectorProduct    = nullptr;
 
     if (parameter->resultsToCompute & objective_function::value)
     {
@@ -104,14 +105,19 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
         lipschitzConstant = result->get(objective_function::lipschitzConstantIdx).get();
     }
 
+    if (parameter->resultsToCompute & objective_function::hessianVectorProduct)
+    {
+        hessianVectorProduct = result->get(objective_function::hessianVectorProductIdx).get();
+    }
+
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
-    if (deviceInfo.isCpu)
+    if (deviceInfo.isCpu || hessianVectorProduct)
     {
         __DAAL_CALL_KERNEL(env, internal::CrossEntropyLossKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                            input->get(cross_entropy_loss::data).get(), input->get(cross_entropy_loss::dependentVariables).get(),
                            input->get(cross_entropy_loss::argument).get(), value, hessian, gradient, nonSmoothTermValue, proximalProjection,
-                           lipschitzConstant, parameter);
+                           lipschitzConstant, input->get(cross_entropy_loss::hessianVector).get(), hessianVectorProduct, parameter);
     }
     else
     {
@@ -22,6 +22,7 @@
 */
 #include "src/services/service_data_utils.h"
 #include "src/externals/service_math.h"
+#include "src/externals/service_spblas.h"
 #include "src/services/service_utils.h"
 #include "src/services/service_environment.h"
 #include "src/externals/service_ittnotify.h"
@@ -75,6 +76,69 @@ static void applyBetaImpl(const algorithmFPType * x, const algorithmFPType * bet
     }
 }
 
+/* xb = X*b + b0 for the block of rows of the table in one-based CSR format,
+   xbT is the buffer of nRows*nClasses size for the column-major product */
+template <typename algorithmFPType, CpuType cpu>
+static void applyBetaCSR(const algorithmFPType * values, const size_t * cols, const size_t * rows, const algorithmFPType * beta,
+                         algorithmFPType * xb, algorithmFPType * xbT, size_t nRows, size_t nClasses, size_t nCols, bool bIntercept)
+{
+    const char transa          = 'N';
+    const algorithmFPType one  = 1.0;
+    const algorithmFPType zero = 0.0;
+    const DAAL_INT m           = (DAAL_INT)nRows;
+    const DAAL_INT n           = (DAAL_INT)nClasses;
+    const DAAL_INT k           = (DAAL_INT)nCols;
+    const size_t nBetaPerClass = nCols + 1;
+    const DAAL_INT ldb         = (DAAL_INT)nBetaPerClass;
+    const char matdescra[6]    = { 'G', 0, 0, 'F', 0, 0 };
+
+    SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &m, &n, &k, &one, matdescra, values, (const DAAL_INT *)cols, (const DAAL_INT *)rows, beta + 1,
+                                          &ldb, &zero, xbT, &m);
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        for (size_t j = 0; j < nClasses; ++j)
+        {
+            xb[i * nClasses + j] = xbT[j * nRows + i] + (bIntercept ? beta[j * nBetaPerClass + 0] : 0);
+        }
+    }
+}
+
+/* r = X^T*t for the block of rows of the table, given either dense (x) or in one-based CSR format (values, cols, rows),
+   t is the nRows x nClasses matrix, tT is the buffer of nRows*nClasses size for its transposition,
+   r is written with the leading dimension nCols + 1 to skip the intercepts */
+template <typename algorithmFPType, CpuType cpu>
+static void applyTransposed(const algorithmFPType * x, const algorithmFPType * values, const size_t * cols, const size_t * rows,
+                            const algorithmFPType * t, algorithmFPType * tT, algorithmFPType * r, size_t nRows, size_t nClasses, size_t nCols,
+                            bool bCSR)
+{
+    const char trans           = 'T';
+    const char notrans         = 'N';
+    const algorithmFPType one  = 1.0;
+    const algorithmFPType zero = 0.0;
+    DAAL_ASSERT(nCols <= services::internal::MaxVal<DAAL_INT>::get());
+    const DAAL_INT m = static_cast<DAAL_INT>(nCols);
+    DAAL_ASSERT(nClasses <= services::internal::MaxVal<DAAL_INT>::get());
+    const DAAL_INT n = static_cast<DAAL_INT>(nClasses);
+    DAAL_ASSERT(nRows <= services::internal::MaxVal<DAAL_INT>::get());
+    const DAAL_INT k   = static_cast<DAAL_INT>(nRows);
+    const DAAL_INT lda = m;
+    const DAAL_INT ldb = n;
+    DAAL_ASSERT((m + 1) <= services::internal::MaxVal<DAAL_INT>::get());
+    const DAAL_INT ldc = m + 1;
+
+    if (bCSR)
+    {
+        const char matdescra[6] = { 'G', 0, 0, 'F', 0, 0 };
+        services::internal::transpose<algorithmFPType, cpu>(t, nRows, nClasses, tT);
+        SpBlas<algorithmFPType, cpu>::xxcsrmm(&trans, &k, &n, &m, &one, matdescra, values, (const DAAL_INT *)cols, (const DAAL_INT *)rows, tT, &k,
+                                              &zero, r, &ldc);
+    }
+    else
+    {
+        daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &m, &n, &k, &one, x, &lda, t, &ldb, &zero, r, &ldc);
+    }
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 void CrossEntropyLossKernel<algorithmFPType, method, cpu>::applyBeta(const algorithmFPType * x, const algorithmFPType * beta, algorithmFPType * xb,
                                                                      size_t nRows, size_t nClasses, size_t nCols, bool bIntercept)
@@ -200,13 +264,43 @@ void addHessInPt(algorithmFPType * h, const algorithmFPType * xi, const algorith
     }
 }
 
+/* Same as addHessInPt for the row in one-based CSR format, only the nonzero features are visited */
+template <typename algorithmFPType, CpuType cpu>
+void addHessInPtCSR(algorithmFPType * h, const algorithmFPType * values, const size_t * cols, size_t nValues, const algorithmFPType * pi,
+                    const algorithmFPType interceptFactor, size_t nClasses, size_t nBetaPerClass, size_t nBetaTotal)
+{
+    //index 0 stands for the intercept, index a > 0 for the value a - 1 of the row
+    for (size_t c = 0; c < nClasses; c++)
+    {
+        for (size_t a = 0; a <= nValues; a++)
+        {
+            const size_t k             = c * nBetaPerClass + (a ? cols[a - 1] : 0);
+            const algorithmFPType pkx  = pi[c] * (a ? values[a - 1] : interceptFactor);
+            algorithmFPType * const hk = h + k * nBetaTotal;
+            for (size_t d = c; d < nClasses; d++)
+            {
+                const algorithmFPType factor = pkx * (algorithmFPType(c == d) - pi[d]);
+                for (size_t b = 0; b <= nValues; b++)
+                {
+                    const size_t m = d * nBetaPerClass + (b ? cols[b - 1] : 0);
+                    if (k <= m)
+                    {
+                        hk[m] += factor * (b ? values[b - 1] : interceptFactor);
+                    }
+                }
+            }
+        }
+    }
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute(const NumericTable * dataNT,
                                                                                  const NumericTable * dependentVariablesNT, size_t nRows, size_t n,
                                                                                  size_t p, NumericTable * betaNT, NumericTable * valueNT,
                                                                                  NumericTable * hessianNT, NumericTable * gradientNT,
                                                                                  NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
-                                                                                 NumericTable * lipschitzConstant, Parameter * parameter)
+                                                                                 NumericTable * lipschitzConstant, NumericTable * hessianVectorNT,
+                                                                                 NumericTable * hessianVectorProductNT, Parameter * parameter)
 {
     const size_t nClasses = parameter->nClasses;
 
@@ -222,6 +316,9 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
     DAAL_CHECK_BLOCK_STATUS(betar);
     const algorithmFPType * b = betar.get();
 
+    /* Sparse data is processed in CSR format without conversion to dense blocks */
+    CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(dataNT));
+
     if (proximalProjection)
     {
         WriteRows<algorithmFPType, cpu> proxPtr(proximalProjection, 0, nBeta);
@@ -286,6 +383,26 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             const size_t startRow      = iBlock * blockSize;
             const size_t finishRow     = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
             algorithmFPType curentNorm = 0;
+            if (csrData)
+            {
+                ReadRowsCSR<algorithmFPType, cpu> xr(csrData, startRow, finishRow - startRow);
+                DAAL_CHECK_BLOCK_STATUS_THR(xr);
+                const algorithmFPType * const values = xr.values();
+                const size_t * const rows            = xr.rows();
+                for (size_t i = 0; i < finishRow - startRow; i++)
+                {
+                    curentNorm = 0;
+                    for (size_t j = rows[i] - 1; j < rows[i + 1] - 1; j++)
+                    {
+                        curentNorm += values[j] * values[j];
+                    }
+                    if (curentNorm > _maxNorm)
+                    {
+                        _maxNorm = curentNorm;
+                    }
+                }
+                return;
+            }
             ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), startRow, finishRow - startRow);
             DAAL_CHECK_BLOCK_STATUS_THR(xr);
             const algorithmFPType * const x = xr.get();
@@ -330,6 +447,7 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRowsInBlock, nClasses);
     TlsMem<algorithmFPType, cpu> tlsLogP(nRowsInBlock * nClasses);
+    TlsMem<algorithmFPType, cpu> tlsTransposed(nRowsInBlock * nClasses);
     TArrayScalable<algorithmFPType, cpu> grads;
     if (gradientNT)
     {
@@ -337,21 +455,51 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
         grads.reset(nDataBlocks * nBeta);
         DAAL_CHECK_MALLOC(grads.get());
     }
+
+    /* The hessian-vector product is X^T*W + 2*penaltyL2*v, where the row i of W is P_i*(t_i - <p_i, t_i>), t = X*v and
+       P_i is the diagonal of the probabilities p_i of the row, so the hessian is never formed */
+    ReadRows<algorithmFPType, cpu> hessianVectorRows;
+    const algorithmFPType * v = nullptr;
+    TArrayScalable<algorithmFPType, cpu> hessVecProds;
+    if (hessianVectorProductNT)
+    {
+        DAAL_ASSERT(hessianVectorNT->getNumberOfRows() == nBeta);
+        hessianVectorRows.set(hessianVectorNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(hessianVectorRows);
+        v = hessianVectorRows.get();
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nDataBlocks, nBeta);
+        hessVecProds.reset(nDataBlocks * nBeta);
+        DAAL_CHECK_MALLOC(hessVecProds.get());
+    }
     TlsMem<algorithmFPType, cpu> tlsSoftmaxSum(nClasses);
     const algorithmFPType div = static_cast<algorithmFPType>(1) / static_cast<algorithmFPType>(n);
     const bool bL1            = parameter->penaltyL1 > 0;
     const bool bL2            = parameter->penaltyL2 > 0;
     const bool interceptFlag  = parameter->interceptFlag;
 
-    if (valueNT || gradientNT || hessianNT)
+    if (valueNT || gradientNT || hessianNT || hessianVectorProductNT)
     {
         SafeStatus safeStat;
         daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
             const size_t iStartRow      = iBlock * nRowsInBlock;
             const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? n - iBlock * nRowsInBlock : nRowsInBlock;
 
-            ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), iStartRow, nRowsToProcess);
-            DAAL_CHECK_BLOCK_STATUS_THR(xr);
+            ReadRows<algorithmFPType, cpu> xr;
+            ReadRowsCSR<algorithmFPType, cpu> xrCSR;
+            algorithmFPType * transposed = nullptr;
+            if (csrData)
+            {
+                xrCSR.set(csrData, iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(xrCSR);
+                transposed = tlsTransposed.local();
+                DAAL_CHECK_THR(transposed, services::ErrorMemoryAllocationFailed);
+            }
+            else
+            {
+                xr.set(const_cast<NumericTable *>(dataNT), iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(xr);
+            }
             const algorithmFPType * const xLocal = xr.get();
 
             ReadRows<algorithmFPType, cpu> yr(const_cast<NumericTable *>(dependentVariablesNT), iStartRow, nRowsToProcess);
@@ -363,7 +511,15 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             //f = X*b + b0
             {
                 DAAL_ITTNOTIFY_SCOPED_TASK(applyBeta);
-                applyBeta(xLocal, b, fPtrLocal, nRowsToProcess, nClasses, p, interceptFlag);
+                if (csrData)
+                {
+                    applyBetaCSR<algorithmFPType, cpu>(xrCSR.values(), xrCSR.cols(), xrCSR.rows(), b, fPtrLocal, transposed, nRowsToProcess,
+                                                       nClasses, p, interceptFlag);
+                }
+                else
+                {
+                    applyBeta(xLocal, b, fPtrLocal, nRowsToProcess, nClasses, p, interceptFlag);
+                }
             }
 
             //f = softmax(f)
@@ -409,23 +565,8 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
                     --(fPtrInternal[size_t(yLocal[i])]);
                 }
 
-                const char trans           = 'T';
-                const char notrans         = 'N';
-                const algorithmFPType one  = 1.0;
-                const algorithmFPType zero = 0.0;
-                DAAL_ASSERT(p <= services::internal::MaxVal<DAAL_INT>::get());
-                const DAAL_INT m = static_cast<algorithmFPType>(p);
-                DAAL_ASSERT(nClasses <= services::internal::MaxVal<DAAL_INT>::get());
-                const DAAL_INT n = static_cast<DAAL_INT>(nClasses);
-                DAAL_ASSERT(nRowsToProcess <= services::internal::MaxVal<DAAL_INT>::get());
-                const DAAL_INT k   = static_cast<DAAL_INT>(nRowsToProcess);
-                const DAAL_INT lda = m;
-                const DAAL_INT ldb = n;
-                DAAL_ASSERT((m + 1) <= services::internal::MaxVal<DAAL_INT>::get());
-                const DAAL_INT ldc = m + 1;
-
-                daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &m, &n, &k, &one, xLocal, &lda, fPtrLocal, &ldb, &zero, g + 1,
-                                                                   &ldc);
+                applyTransposed<algorithmFPType, cpu>(xLocal, xrCSR.values(), xrCSR.cols(), xrCSR.rows(), fPtrLocal, transposed, g + 1,
+                                                      nRowsToProcess, nClasses, p, csrData);
 
                 if (interceptFlag)
                 {
@@ -442,7 +583,7 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
                     }
                 }
 
-                if (hessianNT)
+                if (hessianNT || hessianVectorProductNT)
                 {
                     for (size_t i = 0; i < nRowsToProcess; ++i)
                     {
@@ -451,6 +592,58 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
                     }
                 }
             }
+
+            if (hessianVectorProductNT)
+            {
+                DAAL_ITTNOTIFY_SCOPED_TASK(applyHessian);
+
+                algorithmFPType * const t = tlsLogP.local();
+                DAAL_CHECK_THR(t, services::ErrorMemoryAllocationFailed);
+
+                //t = X*v + v0
+                if (csrData)
+                {
+                    applyBetaCSR<algorithmFPType, cpu>(xrCSR.values(), xrCSR.cols(), xrCSR.rows(), v, t, transposed, nRowsToProcess, nClasses, p,
+                                                       interceptFlag);
+                }
+                else
+                {
+                    applyBeta(xLocal, v, t, nRowsToProcess, nClasses, p, interceptFlag);
+                }
+
+                //t_i = P_i*(t_i - <p_i, t_i>)
+                for (size_t i = 0; i < nRowsToProcess; ++i)
+                {
+                    const algorithmFPType * const pi = fPtrLocal + i * nClasses;
+                    algorithmFPType * const ti       = t + i * nClasses;
+                    algorithmFPType pt(0);
+                    for (size_t c = 0; c < nClasses; ++c)
+                    {
+                        pt += pi[c] * ti[c];
+                    }
+                    for (size_t c = 0; c < nClasses; ++c)
+                    {
+                        ti[c] = pi[c] * (ti[c] - pt);
+                    }
+                }
+
+                algorithmFPType * const hv = hessVecProds.get() + iBlock * nBeta;
+                applyTransposed<algorithmFPType, cpu>(xLocal, xrCSR.values(), xrCSR.cols(), xrCSR.rows(), t, transposed, hv + 1, nRowsToProcess,
+                                                      nClasses, p, csrData);
+
+                for (size_t c = 0; c < nClasses; ++c)
+                {
+                    algorithmFPType interceptLocal(0);
+                    if (interceptFlag)
+                    {
+                        for (size_t i = 0; i < nRowsToProcess; ++i)
+                        {
+                            interceptLocal += t[i * nClasses + c];
+                        }
+                    }
+                    hv[c * nBetaPerClass] = interceptLocal;
+                }
+            }
         });
 
         if (valueNT)
@@ -531,10 +724,42 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             }
         }
 
+        if (hessianVectorProductNT)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(applyHessian);
+            DAAL_ASSERT(hessianVectorProductNT->getNumberOfRows() == nBeta);
+            WriteRows<algorithmFPType, cpu> hvr(hessianVectorProductNT, 0, nBeta);
+            DAAL_CHECK_BLOCK_STATUS(hvr);
+            algorithmFPType * const hv               = hvr.get();
+            const algorithmFPType * const hvBlockPtr = hessVecProds.get();
+
+            services::internal::service_memset_seq<algorithmFPType, cpu>(hv, 0, nBeta);
+            for (size_t indexBlock = 0; indexBlock < nDataBlocks; ++indexBlock)
+            {
+                for (size_t i = 0; i < nBeta; ++i)
+                {
+                    hv[i] += hvBlockPtr[indexBlock * nBeta + i];
+                }
+            }
+
+            for (size_t i = 0; i < nBeta; ++i) hv[i] *= div;
+
+            if (bL2)
+            {
+                for (size_t i = 0; i < nClasses; i++)
+                {
+                    for (size_t j = 1; j < nBetaPerClass; j++)
+                    {
+                        hv[i * nBetaPerClass + j] += 2 * v[i * nBetaPerClass + j] * parameter->penaltyL2;
+                    }
+                }
+            }
+        }
+
         if (hessianNT)
         {
             const algorithmFPType * pp = f.get();
-            WriteRows<algorithmFPType, cpu> hr(hessianNT, 0, n);
+            WriteRows<algorithmFPType, cpu> hr(hessianNT, 0, nBeta);
             DAAL_CHECK_BLOCK_STATUS(hr);
             DAAL_ASSERT(hessianNT->getNumberOfColumns() == nBeta);
             DAAL_ASSERT(hessianNT->getNumberOfRows() == nBeta);
@@ -544,6 +769,14 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             TlsSum<algorithmFPType, cpu> tlsData(hSize);
             SafeStatus safeStat;
             daal::threader_for(n, n, [&](size_t i) {
+                if (csrData)
+                {
+                    ReadRowsCSR<algorithmFPType, cpu> xr(csrData, i, 1);
+                    DAAL_CHECK_BLOCK_STATUS_THR(xr);
+                    addHessInPtCSR<algorithmFPType, cpu>(tlsData.local(), xr.values(), xr.cols(), xr.rows()[1] - xr.rows()[0], pp + i * nClasses,
+                                                         interceptFactor, nClasses, nBetaPerClass, nBeta);
+                    return;
+                }
                 ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), i, 1);
                 DAAL_CHECK_BLOCK_STATUS_THR(xr);
                 const algorithmFPType * const x = xr.get();
@@ -581,7 +814,8 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::compute(N
                                                                                NumericTable * betaNT, NumericTable * valueNT,
                                                                                NumericTable * hessianNT, NumericTable * gradientNT,
                                                                                NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
-                                                                               NumericTable * lipschitzConstant, Parameter * parameter)
+                                                                               NumericTable * lipschitzConstant, NumericTable * hessianVector,
+                                                                               NumericTable * hessianVectorProduct, Parameter * parameter)
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(CrossEntropyLossKernel.compute);
 
@@ -596,29 +830,43 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::compute(N
 
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, sizeof(algorithmFPType));
 
-        if (_aX.size() < n * p)
-        {
-            _aX.reset(n * p);
-            DAAL_CHECK_MALLOC(_aX.get());
-        }
         if (_aY.size() < n)
         {
             _aY.reset(n);
             DAAL_CHECK_MALLOC(_aY.get());
         }
+        auto internalDependentVariablesNT = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_aY.get(), 1, n);
+        DAAL_CHECK_MALLOC(internalDependentVariablesNT.get());
+
+        CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(dataNT);
+        if (csrData)
+        {
+            s |= objective_function::internal::getXYCSR<algorithmFPType, cpu>(csrData, dependentVariablesNT, ntInd, _aX, _aXCols, _aXRows,
+                                                                              _aY.get(), nRows, n);
+            DAAL_CHECK_STATUS_VAR(s);
+            auto internalDataNT = CSRNumericTable::create(_aX.get(), _aXCols.get(), _aXRows.get(), p, n, CSRNumericTableIface::oneBased, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+            s |= doCompute(internalDataNT.get(), internalDependentVariablesNT.get(), nRows, n, p, betaNT, valueNT, hessianNT, gradientNT,
+                           nonSmoothTermValue, proximalProjection, lipschitzConstant, hessianVector, hessianVectorProduct, parameter);
+            return s;
+        }
+
+        if (_aX.size() < n * p)
+        {
+            _aX.reset(n * p);
+            DAAL_CHECK_MALLOC(_aX.get());
+        }
 
         s |= objective_function::internal::getXY<algorithmFPType, cpu>(dataNT, dependentVariablesNT, ntInd, _aX.get(), _aY.get(), nRows, n, p);
         auto internalDataNT = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_aX.get(), p, n);
         DAAL_CHECK_MALLOC(internalDataNT.get());
-        auto internalDependentVariablesNT = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_aY.get(), 1, n);
-        DAAL_CHECK_MALLOC(internalDependentVariablesNT.get());
         s |= doCompute(internalDataNT.get(), internalDependentVariablesNT.get(), nRows, n, p, betaNT, valueNT, hessianNT, gradientNT,
-                       nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter);
+                       nonSmoothTermValue, proximalProjection, lipschitzConstant, hessianVector, hessianVectorProduct, parameter);
         return s;
     }
 
     return doCompute(dataNT, dependentVariablesNT, nRows, nRows, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection,
-                     lipschitzConstant, parameter);
+                     lipschitzConstant, hessianVector, hessianVectorProduct, parameter);
 }
 
 } // namespace internal
@@ -48,7 +48,8 @@ class CrossEntropyLossKernel : public Kernel
 public:
     services::Status compute(NumericTable * data, NumericTable * dependentVariables, NumericTable * argument, NumericTable * value,
                              NumericTable * hessian, NumericTable * gradient, NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
-                             NumericTable * lipschitzConstant, Parameter * parameter);
+                             NumericTable * lipschitzConstant, NumericTable * hessianVector, NumericTable * hessianVectorProduct,
+                             Parameter * parameter);
 
     static void applyBeta(const algorithmFPType * x, const algorithmFPType * beta, algorithmFPType * xb, size_t nRows, size_t nClasses, size_t nCols,
                           bool bIntercept);
@@ -62,11 +63,13 @@ protected:
     services::Status doCompute(const NumericTable * dataNT, const NumericTable * dependentVariablesNT, size_t nRows, size_t n, size_t p,
                                NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT,
                                NumericTable * nonSmoothTermValue, NumericTable * proximalProjection, NumericTable * lipschitzConstant,
-                               Parameter * parameter);
+                               NumericTable * hessianVectorNT, NumericTable * hessianVectorProductNT, Parameter * parameter);
 
 private:
     TArrayScalable<algorithmFPType, cpu> _aX;
     TArrayScalable<algorithmFPType, cpu> _aY;
+    TArrayScalable<size_t, cpu> _aXCols;
+    TArrayScalable<size_t, cpu> _aXRows;
 };
 
 } // namespace internal
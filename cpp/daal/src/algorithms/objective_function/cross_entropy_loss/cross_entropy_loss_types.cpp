@@ -110,7 +110,7 @@ data_management::NumericTablePtr Input::get(InputId id) const
 services::Status Input::check(const daal::algorithms::Parameter * par, int method) const
 {
     sum_of_functions::Input::check(par, method);
-    DAAL_CHECK(Argument::size() == 3, services::ErrorIncorrectNumberOfInputNumericTables);
+    DAAL_CHECK(Argument::size() == 4, services::ErrorIncorrectNumberOfInputNumericTables);
 
     services::Status s = checkNumericTable(get(data).get(), dataStr(), 0, 0);
     if (!s) return s;
@@ -120,6 +120,10 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
     const Parameter * pPar   = static_cast<const Parameter *>(par);
     s                        = checkNumericTable(get(dependentVariables).get(), dependentVariablesStr(), 0, 0, 1, nRowsInData);
     s |= checkNumericTable(get(argument).get(), argumentStr(), 0, 0, 1, pPar->nClasses * (nColsInData + 1));
+    if (pPar->resultsToCompute & objective_function::hessianVectorProduct)
+    {
+        s |= checkNumericTable(get(hessianVector).get(), hessianVectorStr(), 0, 0, 1, pPar->nClasses * (nColsInData + 1));
+    }
     return s;
 }
 
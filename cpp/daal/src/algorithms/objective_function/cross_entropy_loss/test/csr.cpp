@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "daal/include/algorithms/optimization_solver/objective_function/cross_entropy_loss_batch.h"
+#include "daal/include/data_management/data/csr_numeric_table.h"
+#include "daal/include/data_management/data/homogen_numeric_table.h"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal::algorithms::optimization_solver::cross_entropy_loss::test {
+
+namespace dm = daal::data_management;
+namespace of = daal::algorithms::optimization_solver::objective_function;
+
+template <typename Float>
+static std::vector<Float> get_data(const dm::NumericTablePtr& table) {
+    const std::size_t row_count = table->getNumberOfRows();
+    const std::size_t column_count = table->getNumberOfColumns();
+    dm::BlockDescriptor<Float> block;
+    table->getBlockOfRows(0, row_count, dm::readOnly, block);
+    std::vector<Float> data(block.getBlockPtr(),
+                            block.getBlockPtr() + row_count * column_count);
+    table->releaseBlockOfRows(block);
+    return data;
+}
+
+template <typename Float>
+static of::ResultPtr compute_loss(const dm::NumericTablePtr& data,
+                                  const dm::NumericTablePtr& responses,
+                                  const dm::NumericTablePtr& argument,
+                                  const dm::NumericTablePtr& hessian_vector,
+                                  std::size_t class_count,
+                                  bool intercept,
+                                  DAAL_UINT64 results_to_compute) {
+    Batch<Float> algorithm(class_count, data->getNumberOfRows());
+    algorithm.input.set(cross_entropy_loss::data, data);
+    algorithm.input.set(cross_entropy_loss::dependentVariables, responses);
+    algorithm.input.set(cross_entropy_loss::argument, argument);
+    algorithm.input.set(cross_entropy_loss::hessianVector, hessian_vector);
+    algorithm.parameter().interceptFlag = intercept;
+    algorithm.parameter().penaltyL2 = 0.1;
+    algorithm.parameter().resultsToCompute = results_to_compute;
+    REQUIRE(algorithm.compute().ok());
+    return algorithm.getResult();
+}
+
+template <typename Float>
+static void check_close(const std::vector<Float>& actual, const std::vector<Float>& expected) {
+    const Float tolerance = std::is_same_v<Float, float> ? Float(1e-4) : Float(1e-10);
+    REQUIRE(actual.size() == expected.size());
+    for (std::size_t i = 0; i < actual.size(); i++) {
+        CAPTURE(i, actual[i], expected[i]);
+        REQUIRE(std::abs(actual[i] - expected[i]) <=
+                tolerance * (Float(1) + std::abs(expected[i])));
+    }
+}
+
+TEMPLATE_TEST("CSR and dense data give the same value, gradient and hessian-vector product",
+              "[cross_entropy_loss][csr]",
+              float,
+              double) {
+    using Float = TestType;
+
+    const bool intercept = GENERATE(true, false);
+    CAPTURE(intercept);
+
+    const std::size_t class_count = 3;
+    const std::size_t row_count = 1100;
+    const std::size_t column_count = 7;
+    const std::size_t beta_count = class_count * (column_count + 1);
+
+    std::mt19937 rng(7777);
+    std::uniform_real_distribution<Float> distr(Float(-1), Float(1));
+    std::bernoulli_distribution is_nonzero(0.3);
+
+    // The CSR table uses one-based indices
+    std::vector<Float> x(row_count * column_count, Float(0));
+    std::vector<Float> y(row_count);
+    std::vector<Float> values;
+    std::vector<std::size_t> column_indices;
+    std::vector<std::size_t> row_offsets{ 1 };
+    for (std::size_t i = 0; i < row_count; i++) {
+        Float score = 0;
+        for (std::size_t j = 0; j < column_count; j++) {
+            if (is_nonzero(rng)) {
+                x[i * column_count + j] = distr(rng);
+                values.push_back(x[i * column_count + j]);
+                column_indices.push_back(j + 1);
+                score += x[i * column_count + j] * Float(j % 3);
+            }
+        }
+        row_offsets.push_back(values.size() + 1);
+        y[i] = Float(std::size_t(std::abs(score + distr(rng)) * Float(2)) % class_count);
+    }
+
+    std::vector<Float> beta(beta_count);
+    std::vector<Float> v(beta_count);
+    for (std::size_t j = 0; j < beta_count; j++) {
+        beta[j] = distr(rng);
+        v[j] = distr(rng);
+    }
+
+    const auto dense = dm::HomogenNumericTable<Float>::create(x.data(), column_count, row_count);
+    const auto csr = dm::CSRNumericTable::create(values.data(),
+                                                 column_indices.data(),
+                                                 row_offsets.data(),
+                                                 column_count,
+                                                 row_count);
+    const auto responses = dm::HomogenNumericTable<Float>::create(y.data(), 1, row_count);
+    const auto argument = dm::HomogenNumericTable<Float>::create(beta.data(), 1, beta_count);
+    const auto hessian_vector = dm::HomogenNumericTable<Float>::create(v.data(), 1, beta_count);
+
+    const DAAL_UINT64 csr_results = of::value | of::gradient | of::hessianVectorProduct;
+    const auto dense_result = compute_loss<Float>(dense,
+                                                  responses,
+                                                  argument,
+                                                  hessian_vector,
+                                                  class_count,
+                                                  intercept,
+                                                  csr_results | of::hessian);
+    const auto csr_result = compute_loss<Float>(csr,
+                                                responses,
+                                                argument,
+                                                hessian_vector,
+                                                class_count,
+                                                intercept,
+                                                csr_results);
+
+    const auto hessian = get_data<Float>(dense_result->get(of::hessianIdx));
+    std::vector<Float> expected_product(beta_count, Float(0));
+    for (std::size_t j = 0; j < beta_count; j++) {
+        for (std::size_t k = 0; k < beta_count; k++) {
+            expected_product[j] += hessian[j * beta_count + k] * v[k];
+        }
+    }
+    const auto dense_product =
+        get_data<Float>(dense_result->get(of::hessianVectorProductIdx));
+    check_close(dense_product, expected_product);
+
+    check_close(get_data<Float>(csr_result->get(of::valueIdx)),
+                get_data<Float>(dense_result->get(of::valueIdx)));
+    check_close(get_data<Float>(csr_result->get(of::gradientIdx)),
+                get_data<Float>(dense_result->get(of::gradientIdx)));
+    check_close(get_data<Float>(csr_result->get(of::hessianVectorProductIdx)), dense_product);
+}
+
+} // namespace daal::algorithms::optimization_solver::cross_entropy_loss::test
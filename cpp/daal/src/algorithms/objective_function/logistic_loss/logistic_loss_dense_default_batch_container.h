@@ -73,6 +73,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * nonSmoothTermValue      = nullptr;
     NumericTable * proximalProjection      = nullptr;
     NumericTable * lipschitzConstant       = nullptr;
+    NumericTable * hessianVectorProduct    = nullptr;
 
     if (parameter->resultsToCompute & objective_function::value)
     {
@@ -104,15 +105,20 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
         lipschitzConstant = result->get(objective_function::lipschitzConstantIdx).get();
     }
 
+    if (parameter->resultsToCompute & objective_function::hessianVectorProduct)
+    {
+        hessianVectorProduct = result->get(objective_function::hessianVectorProductIdx).get();
+    }
+
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu || nonSmoothTermValue || proximalProjection || lipschitzConstant)
+    if (deviceInfo.isCpu || nonSmoothTermValue || proximalProjection || lipschitzConstant || hessianVectorProduct)
     {
         __DAAL_CALL_KERNEL(env, internal::LogLossKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                            input->get(logistic_loss::data).get(), input->get(logistic_loss::dependentVariables).get(),
                            input->get(logistic_loss::argument).get(), value, hessian, gradient, nonSmoothTermValue, proximalProjection,
-                           lipschitzConstant, parameter);
+                           lipschitzConstant, input->get(logistic_loss::hessianVector).get(), hessianVectorProduct, parameter);
     }
     else
     {
@@ -22,6 +22,7 @@
 */
 #include "src/services/service_data_utils.h"
 #include "src/externals/service_math.h"
+#include "src/externals/service_spblas.h"
 #include "src/services/service_utils.h"
 #include "src/externals/service_ittnotify.h"
 
@@ -72,6 +73,59 @@ static void applyBetaImpl(const algorithmFPType * x, const algorithmFPType * bet
     }
 }
 
+/* xb = X*b + b0 for the block of rows of the table in one-based CSR format */
+template <typename algorithmFPType, CpuType cpu>
+static void applyBetaCSR(const algorithmFPType * values, const size_t * cols, const size_t * rows, const algorithmFPType * beta,
+                         algorithmFPType * xb, size_t nRows, size_t nCols, bool bIntercept)
+{
+    const char transa          = 'N';
+    const algorithmFPType one  = 1.0;
+    const algorithmFPType zero = 0.0;
+    const DAAL_INT m           = (DAAL_INT)nRows;
+    const DAAL_INT k           = (DAAL_INT)nCols;
+    const DAAL_INT ione        = 1;
+    const char matdescra[6]    = { 'G', 0, 0, 'F', 0, 0 };
+
+    SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &m, &ione, &k, &one, matdescra, values, (const DAAL_INT *)cols, (const DAAL_INT *)rows,
+                                          beta + 1, &k, &zero, xb, &m);
+    if (bIntercept)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            xb[i] += beta[0];
+        }
+    }
+}
+
+/* r = X^T*t for the block of rows of the table, given either dense (x) or in one-based CSR format (values, cols, rows) */
+template <typename algorithmFPType, CpuType cpu>
+static void applyTransposed(const algorithmFPType * x, const algorithmFPType * values, const size_t * cols, const size_t * rows,
+                            const algorithmFPType * t, algorithmFPType * r, size_t nRows, size_t nCols, bool bCSR)
+{
+    const char notrans         = 'N';
+    const algorithmFPType one  = 1.0;
+    const algorithmFPType zero = 0.0;
+    const DAAL_INT yDim        = 1;
+    DAAL_ASSERT(nCols <= services::internal::MaxVal<DAAL_INT>::get());
+    const DAAL_INT dim = static_cast<DAAL_INT>(nCols);
+    DAAL_ASSERT(nRows <= services::internal::MaxVal<DAAL_INT>::get());
+    const DAAL_INT nN = static_cast<DAAL_INT>(nRows);
+
+    if (bCSR)
+    {
+        const char trans        = 'T';
+        const char matdescra[6] = { 'G', 0, 0, 'F', 0, 0 };
+        SpBlas<algorithmFPType, cpu>::xxcsrmm(&trans, &nN, &yDim, &dim, &one, matdescra, values, (const DAAL_INT *)cols, (const DAAL_INT *)rows, t,
+                                              &nN, &zero, r, &dim);
+    }
+    else
+    {
+        daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &dim, &yDim, &nN, &one, x, &dim, t, &nN, &zero, r, &dim);
+    }
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 void LogLossKernel<algorithmFPType, method, cpu>::applyBeta(const algorithmFPType * x, const algorithmFPType * beta, algorithmFPType * xb,
                                                             size_t nRows, size_t nCols, bool bIntercept)
@@ -127,13 +181,17 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
                                                                         size_t n, size_t p, NumericTable * betaNT, NumericTable * valueNT,
                                                                         NumericTable * hessianNT, NumericTable * gradientNT,
                                                                         NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
-                                                                        NumericTable * lipschitzConstant, Parameter * parameter)
+                                                                        NumericTable * lipschitzConstant, NumericTable * hessianVectorNT,
+                                                                        NumericTable * hessianVectorProductNT, Parameter * parameter)
 {
     SafeStatus safeStat;
     const size_t nBeta = p + 1;
     DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
     DAAL_ASSERT(betaNT->getNumberOfRows() == nBeta);
 
+    /* Sparse data is processed in CSR format without conversion to dense blocks */
+    CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(dataNT));
+
     const algorithmFPType * b;
     HomogenNumericTable<algorithmFPType> * hmgBeta = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(betaNT);
     ReadRows<algorithmFPType, cpu> betar;
@@ -201,10 +259,30 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
             algorithmFPType & _maxNorm = *tlsData.local();
             const size_t startRow      = iBlock * blockSize;
             const size_t finishRow     = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
+            algorithmFPType curentNorm = 0;
+            if (csrData)
+            {
+                ReadRowsCSR<algorithmFPType, cpu> xr(csrData, startRow, finishRow - startRow);
+                DAAL_CHECK_BLOCK_STATUS_THR(xr);
+                const algorithmFPType * const values = xr.values();
+                const size_t * const rows            = xr.rows();
+                for (size_t i = 0; i < finishRow - startRow; i++)
+                {
+                    curentNorm = 0;
+                    for (size_t j = rows[i] - 1; j < rows[i + 1] - 1; j++)
+                    {
+                        curentNorm += values[j] * values[j];
+                    }
+                    if (curentNorm > _maxNorm)
+                    {
+                        _maxNorm = curentNorm;
+                    }
+                }
+                return;
+            }
             ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), startRow, finishRow - startRow);
             DAAL_CHECK_BLOCK_STATUS_THR(xr);
             const algorithmFPType * const x = xr.get();
-            algorithmFPType curentNorm      = 0;
             for (size_t i = 0; i < finishRow - startRow; i++)
             {
                 curentNorm = 0;
@@ -248,7 +326,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
         v = nonSmoothTerm;
     }
 
-    if (valueNT || gradientNT || hessianNT)
+    if (valueNT || gradientNT || hessianNT || hessianVectorProductNT)
     {
         TNArray<algorithmFPType, 16, cpu> f;
         TNArray<algorithmFPType, 32, cpu> sg;
@@ -307,12 +385,41 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
             DAAL_CHECK_MALLOC(interceptGrad.get());
         }
 
+        /* The hessian-vector product is X^T*D*(X*v) + 2*penaltyL2*v, where D is the diagonal of sigmoid derivatives,
+           so the p x p hessian is never formed */
+        ReadRows<algorithmFPType, cpu> hessianVectorRows;
+        const algorithmFPType * v = nullptr;
+        TArrayScalable<algorithmFPType, cpu> hessVecProds;
+        TArrayScalable<algorithmFPType, cpu> interceptHessVecProd;
+        if (hessianVectorProductNT)
+        {
+            DAAL_ASSERT(hessianVectorNT->getNumberOfRows() == nBeta);
+            hessianVectorRows.set(hessianVectorNT, 0, nBeta);
+            DAAL_CHECK_BLOCK_STATUS(hessianVectorRows);
+            v = hessianVectorRows.get();
+
+            DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nDataBlocks, p);
+            hessVecProds.reset(nDataBlocks * p);
+            interceptHessVecProd.reset(nDataBlocks);
+            DAAL_CHECK_MALLOC(hessVecProds.get() && interceptHessVecProd.get());
+        }
+
         daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
             const size_t iStartRow      = iBlock * nRowsInBlock;
             const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? n - iBlock * nRowsInBlock : nRowsInBlock;
 
-            ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), iStartRow, nRowsToProcess);
-            DAAL_CHECK_BLOCK_STATUS_THR(xr);
+            ReadRows<algorithmFPType, cpu> xr;
+            ReadRowsCSR<algorithmFPType, cpu> xrCSR;
+            if (csrData)
+            {
+                xrCSR.set(csrData, iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(xrCSR);
+            }
+            else
+            {
+                xr.set(const_cast<NumericTable *>(dataNT), iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(xr);
+            }
             ReadRows<algorithmFPType, cpu> yr(const_cast<NumericTable *>(dependentVariablesNT), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(yr);
             const algorithmFPType * const xLocal = xr.get();
@@ -324,7 +431,15 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
             //f = X*b + b0
             {
                 DAAL_ITTNOTIFY_SCOPED_TASK(applyBeta);
-                applyBeta(xLocal, b, fPtrLocal, nRowsToProcess, p, parameter->interceptFlag);
+                if (csrData)
+                {
+                    applyBetaCSR<algorithmFPType, cpu>(xrCSR.values(), xrCSR.cols(), xrCSR.rows(), b, fPtrLocal, nRowsToProcess, p,
+                                                       parameter->interceptFlag);
+                }
+                else
+                {
+                    applyBeta(xLocal, b, fPtrLocal, nRowsToProcess, p, parameter->interceptFlag);
+                }
             }
 
             {
@@ -362,14 +477,6 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
                 DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
                 DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
 
-                const char notrans         = 'N';
-                const algorithmFPType one  = 1.0;
-                const algorithmFPType zero = 0.0;
-                const DAAL_INT yDim        = 1;
-                DAAL_ASSERT(p <= services::internal::MaxVal<DAAL_INT>::get());
-                const DAAL_INT dim = static_cast<DAAL_INT>(p);
-                DAAL_ASSERT(nRowsToProcess <= services::internal::MaxVal<DAAL_INT>::get());
-                const DAAL_INT nN          = static_cast<DAAL_INT>(nRowsToProcess);
                 algorithmFPType * const pg = grads.get() + iBlock * p;
 
                 PRAGMA_IVDEP
@@ -379,8 +486,8 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
                     sgPtrLocal[i] -= yLocal[i];
                 }
 
-                daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &dim, &yDim, &nN, &one, xLocal, &dim, sgPtrLocal, &nN, &zero,
-                                                                   pg, &dim);
+                applyTransposed<algorithmFPType, cpu>(xLocal, xrCSR.values(), xrCSR.cols(), xrCSR.rows(), sgPtrLocal, pg, nRowsToProcess, p,
+                                                      csrData);
 
                 PRAGMA_IVDEP
                 PRAGMA_VECTOR_ALWAYS
@@ -401,6 +508,42 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
                     interceptGrad[iBlock] = interceptGradLocal;
                 }
             }
+
+            if (hessianVectorProductNT)
+            {
+                DAAL_ITTNOTIFY_SCOPED_TASK(applyHessian);
+                algorithmFPType * const t = tlsData.local();
+                DAAL_CHECK_THR(t, services::ErrorMemoryAllocationFailed);
+
+                //t = X*v + v0
+                if (csrData)
+                {
+                    applyBetaCSR<algorithmFPType, cpu>(xrCSR.values(), xrCSR.cols(), xrCSR.rows(), v, t, nRowsToProcess, p,
+                                                       parameter->interceptFlag);
+                }
+                else
+                {
+                    applyBeta(xLocal, v, t, nRowsToProcess, p, parameter->interceptFlag);
+                }
+
+                //t = D*t
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nRowsToProcess; ++i)
+                {
+                    t[i] *= sgPtrLocal[i] * sgPtrLocal[i + n];
+                }
+
+                applyTransposed<algorithmFPType, cpu>(xLocal, xrCSR.values(), xrCSR.cols(), xrCSR.rows(), t, hessVecProds.get() + iBlock * p,
+                                                      nRowsToProcess, p, csrData);
+
+                algorithmFPType interceptLocal(0);
+                for (size_t i = 0; i < nRowsToProcess; ++i)
+                {
+                    interceptLocal += t[i];
+                }
+                interceptHessVecProd[iBlock] = interceptLocal;
+            }
         });
 
         if (valueNT)
@@ -494,7 +637,90 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
             }
         }
 
-        if (hessianNT)
+        if (hessianVectorProductNT)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(applyHessian);
+            DAAL_ASSERT(hessianVectorProductNT->getNumberOfRows() == nBeta);
+            WriteRows<algorithmFPType, cpu> hvr(hessianVectorProductNT, 0, nBeta);
+            DAAL_CHECK_BLOCK_STATUS(hvr);
+            algorithmFPType * const hv = hvr.get();
+
+            services::internal::service_memset_seq<algorithmFPType, cpu>(hv, 0, nBeta);
+            for (size_t i = 0; i < nDataBlocks; i++)
+            {
+                const algorithmFPType * const blockProd = hessVecProds.get() + i * p;
+                for (size_t j = 0; j < p; j++)
+                {
+                    hv[j + 1] += blockProd[j];
+                }
+                if (parameter->interceptFlag)
+                {
+                    hv[0] += interceptHessVecProd[i];
+                }
+            }
+            for (size_t i = iFirstBeta; i < nBeta; ++i)
+            {
+                hv[i] *= div;
+            }
+
+            if (bL2)
+            {
+                for (size_t i = 1; i < nBeta; ++i)
+                {
+                    hv[i] += 2. * v[i] * parameter->penaltyL2;
+                }
+            }
+        }
+
+        if (hessianNT && csrData)
+        {
+            ReadRowsCSR<algorithmFPType, cpu> xr(csrData, 0, n);
+            DAAL_CHECK_BLOCK_STATUS(xr);
+            const algorithmFPType * const values = xr.values();
+            const size_t * const cols            = xr.cols();
+            const size_t * const rows            = xr.rows();
+            DAAL_ASSERT(hessianNT->getNumberOfRows() == nBeta);
+            WriteRows<algorithmFPType, cpu> hr(hessianNT, 0, nBeta * nBeta);
+            DAAL_CHECK_BLOCK_STATUS(hr);
+            algorithmFPType * h = hr.get();
+            services::internal::service_memset_seq<algorithmFPType, cpu>(h, 0, nBeta * nBeta);
+
+            algorithmFPType * s = sgPtr;
+            //the column indices are one-based, so they are the indices of the betas
+            for (size_t i = 0; i < n; ++i)
+            {
+                s[i] *= s[i + n]; //sigmoid derivative at x[i]
+                if (parameter->interceptFlag)
+                {
+                    h[0] += s[i];
+                }
+                for (size_t j = rows[i] - 1; j < rows[i + 1] - 1; ++j)
+                {
+                    const algorithmFPType sx   = s[i] * values[j];
+                    algorithmFPType * const hj = h + cols[j] * nBeta;
+                    if (parameter->interceptFlag)
+                    {
+                        hj[0] += sx;
+                    }
+                    for (size_t k = rows[i] - 1; k < rows[i + 1] - 1; ++k)
+                    {
+                        hj[cols[k]] += sx * values[k];
+                    }
+                }
+            }
+
+            h[0] *= div;
+            for (size_t j = 1; j < nBeta; ++j)
+            {
+                for (size_t k = 0; k < nBeta; ++k)
+                {
+                    h[j * nBeta + k] *= div;
+                }
+                h[j] = h[j * nBeta];
+                h[j * nBeta + j] += 2. * parameter->penaltyL2;
+            }
+        }
+        else if (hessianNT)
         {
             ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), 0, n);
             DAAL_CHECK_BLOCK_STATUS(xr);
@@ -566,6 +792,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
                                                                       NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT,
                                                                       NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
                                                                       NumericTable * proximalProjection, NumericTable * lipschitzConstant,
+                                                                      NumericTable * hessianVector, NumericTable * hessianVectorProduct,
                                                                       Parameter * parameter)
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(LogLossKernel.compute);
@@ -583,6 +810,27 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
         HomogenNumericTable<algorithmFPType> * hmgDependentVariables = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(dependentVariablesNT);
 
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, sizeof(algorithmFPType));
+        if (_aY.size() < n)
+        {
+            _aY.reset(n);
+            DAAL_CHECK_MALLOC(_aY.get());
+        }
+        auto internalDependentVariablesNT = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_aY.get(), 1, n);
+        DAAL_CHECK_MALLOC(internalDependentVariablesNT.get());
+
+        CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(dataNT);
+        if (csrData)
+        {
+            s |= objective_function::internal::getXYCSR<algorithmFPType, cpu>(csrData, dependentVariablesNT, ntInd, _aX, _aXCols, _aXRows,
+                                                                              _aY.get(), nRows, n);
+            DAAL_CHECK_STATUS_VAR(s);
+            auto internalDataNT = CSRNumericTable::create(_aX.get(), _aXCols.get(), _aXRows.get(), p, n, CSRNumericTableIface::oneBased, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+            s |= doCompute(internalDataNT.get(), internalDependentVariablesNT.get(), n, p, betaNT, valueNT, hessianNT, gradientNT,
+                           nonSmoothTermValue, proximalProjection, lipschitzConstant, hessianVector, hessianVectorProduct, parameter);
+            return s;
+        }
+
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, p);
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * p, sizeof(algorithmFPType));
 
@@ -591,11 +839,6 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
             _aX.reset(n * p);
             DAAL_CHECK_MALLOC(_aX.get());
         }
-        if (_aY.size() < n)
-        {
-            _aY.reset(n);
-            DAAL_CHECK_MALLOC(_aY.get());
-        }
 
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(getXY);
@@ -603,14 +846,12 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
         }
         auto internalDataNT = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_aX.get(), p, n);
         DAAL_CHECK_MALLOC(internalDataNT.get());
-        auto internalDependentVariablesNT = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_aY.get(), 1, n);
-        DAAL_CHECK_MALLOC(internalDependentVariablesNT.get());
         s |= doCompute(internalDataNT.get(), internalDependentVariablesNT.get(), n, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue,
-                       proximalProjection, lipschitzConstant, parameter);
+                       proximalProjection, lipschitzConstant, hessianVector, hessianVectorProduct, parameter);
         return s;
     }
     return doCompute(dataNT, dependentVariablesNT, nRows, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection,
-                     lipschitzConstant, parameter);
+                     lipschitzConstant, hessianVector, hessianVectorProduct, parameter);
 }
 
 } // namespace internal
@@ -29,8 +29,10 @@
 #include "src/algorithms/service_error_handling.h"
 #include "data_management/data/memory_block.h"
 #include "src/threading/threading.h"
+#include "src/algorithms/service_threading.h"
 #include "src/algorithms/distributions/uniform/uniform_kernel.h"
 #include "src/algorithms/distributions/uniform/uniform_impl.i"
+#include "src/algorithms/engines/engine_types_internal.h"
 #include "src/services/service_data_utils.h"
 
 using namespace daal::data_management;
@@ -221,6 +223,130 @@ protected:
     daal::algorithms::engines::internal::BatchBaseImpl * _engine;
 };
 
+/**
+ *  \brief Relaxed atomic access to the elements of the arrays that the asynchronous solvers share between the threads.
+ *  Each element is loaded and stored as a whole without ordering the other memory accesses, so a concurrent
+ *  read-modify-write of the same element may be lost, but the result is well-defined.
+ */
+template <typename T>
+DAAL_FORCEINLINE T atomicLoadRelaxed(const T * ptr)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    return *static_cast<const volatile T *>(ptr);
+#else
+    T value;
+    __atomic_load(ptr, &value, __ATOMIC_RELAXED);
+    return value;
+#endif
+}
+
+template <typename T>
+DAAL_FORCEINLINE void atomicStoreRelaxed(T * ptr, T value)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    *static_cast<volatile T *>(ptr) = value;
+#else
+    __atomic_store(ptr, &value, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ *  \brief Schedule of the term indices for the solvers that process the terms asynchronously.
+ *  The indices are generated by chunks of chunkSize elements when a task reaches them, so the memory
+ *  does not depend on the number of iterations. If the number of streams is zero, the tasks are chunks
+ *  that take the next indices of the user engine in the order the threads reach them. Otherwise, each stream
+ *  is a task with its own engine derived from the user engine, so the indices of a stream do not depend on
+ *  the number of threads.
+ */
+template <CpuType cpu>
+class AsyncSchedule
+{
+public:
+    static const size_t chunkSize = 1024;
+
+    AsyncSchedule() : _predefined(nullptr), _nIterations(0), _nTasks(0), _maxVal(0) {}
+
+    services::Status init(const int * predefined, size_t nIterations, size_t nStreams, int maxVal, const engines::EnginePtr & engine)
+    {
+        _predefined  = predefined;
+        _nIterations = nIterations;
+        _nTasks      = nStreams ? nStreams : (nIterations + chunkSize - 1) / chunkSize;
+        _maxVal      = maxVal;
+        _engine      = engine;
+        if (predefined || !nStreams) return services::Status();
+
+        engines::internal::ParallelizationTechnique technique = engines::internal::skipahead;
+        DAAL_CHECK_STATUS_VAR(selectParallelizationTechnique(engine, technique));
+        engines::internal::Params<cpu> params(nStreams);
+        for (size_t i = 0; i < nStreams; i++)
+        {
+            params.nSkip[i] = getBegin(i);
+        }
+        _streamEngines.reset(nStreams);
+        DAAL_CHECK_MALLOC(_streamEngines.get());
+        services::Status s;
+        engines::internal::EnginesCollection<cpu> enginesCollection(engine, technique, params, _streamEngines, &s);
+        return s;
+    }
+
+    /**
+     *  Provides the indices of the iterations [iter, iter + count) of the task. The iterations of a task
+     *  must be requested in order, by at most chunkSize at once. The indices are generated into the buffer
+     *  of chunkSize elements unless they are predefined.
+     */
+    services::Status getIndices(size_t iTask, size_t iter, size_t count, int * buffer, const int *& indices)
+    {
+        DAAL_ASSERT(count <= chunkSize);
+        if (_predefined)
+        {
+            indices = _predefined + iter;
+            return services::Status();
+        }
+        indices = buffer;
+        if (_streamEngines.get())
+        {
+            return UniformKernelType::compute(0, _maxVal, *_streamEngines[iTask], count, buffer);
+        }
+        /* The chunks share the user engine, so the indices of all iterations form its sequence */
+        AutoLock lock(_engineMutex);
+        return UniformKernelType::compute(0, _maxVal, *_engine, count, buffer);
+    }
+
+    size_t getNumberOfTasks() const { return _nTasks; }
+    size_t getBegin(size_t iTask) const { return iTask * _nIterations / _nTasks; }
+    size_t getEnd(size_t iTask) const { return (iTask + 1) * _nIterations / _nTasks; }
+
+protected:
+    typedef distributions::uniform::internal::UniformKernel<int, distributions::uniform::defaultDense, cpu> UniformKernelType;
+
+    static services::Status selectParallelizationTechnique(const engines::EnginePtr & engine, engines::internal::ParallelizationTechnique & technique)
+    {
+        auto engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(engine.get());
+        DAAL_CHECK(engineImpl, ErrorEngineNotSupported);
+
+        /* skipahead goes first as the streams then continue the sequence of the user engine */
+        engines::internal::ParallelizationTechnique techniques[] = { engines::internal::skipahead, engines::internal::leapfrog,
+                                                                     engines::internal::family };
+        for (auto & t : techniques)
+        {
+            if (engineImpl->hasSupport(t))
+            {
+                technique = t;
+                return services::Status();
+            }
+        }
+        return services::Status(ErrorEngineNotSupported);
+    }
+
+    const int * _predefined;
+    size_t _nIterations;
+    size_t _nTasks;
+    int _maxVal;
+    engines::EnginePtr _engine;
+    TArray<engines::EnginePtr, cpu> _streamEngines;
+    Mutex _engineMutex;
+};
+
 } // namespace internal
 } // namespace iterative_solver
 } // namespace optimization_solver
@@ -28,8 +28,9 @@
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_math.h"
 #include "src/services/service_utils.h"
-#include "src/data_management/service_numeric_table.h"
 #include "src/algorithms/optimization_solver/iterative_solver_kernel.h"
+#include "src/threading/threading.h"
+#include "services/daal_atomic_int.h"
 #include "algorithms/optimization_solver/iterative_solver/iterative_solver_types.h"
 #include "algorithms/optimization_solver/saga/saga_types.h"
 
@@ -47,6 +48,61 @@ using namespace daal::internal;
 using namespace daal::services;
 using namespace daal::algorithms::optimization_solver::iterative_solver::internal;
 
+/**
+ *  \brief Context of the thread that processes the terms of the objective function in the asynchronous mode
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct SagaAsyncContext
+{
+    SagaAsyncContext(HostAppIface * pHost, size_t sizeArgument)
+        : host(pHost, 10),
+          batchIndex(0),
+          point(sizeArgument),
+          gradientDiff(sizeArgument),
+          previous(sizeArgument),
+          indices(AsyncSchedule<cpu>::chunkSize)
+    {}
+
+    services::Status init(const sum_of_functions::BatchPtr & prototype, size_t sizeArgument)
+    {
+        DAAL_CHECK_MALLOC(point.get() && gradientDiff.get() && previous.get() && indices.get());
+        services::Status s;
+
+        function                                            = prototype->clone();
+        function->sumOfFunctionsParameter->batchIndices     = HomogenNumericTableCPU<int, cpu>::create(&batchIndex, 1, 1, &s);
+        function->sumOfFunctionsParameter->resultsToCompute = optimization_solver::objective_function::gradient;
+        function->enableChecks(false);
+        DAAL_CHECK_STATUS_VAR(s);
+        /* the gradient is computed for the thread-local copy of the argument, as the shared argument is updated by the other threads */
+        function->sumOfFunctionsInput->set(sum_of_functions::argument,
+                                           HomogenNumericTableCPU<algorithmFPType, cpu>::create(previous.get(), 1, sizeArgument, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+
+        /* the projection is computed for the thread-local point, as the shared argument is updated by the other threads */
+        proximalProjection = prototype->clone();
+        proximalProjection->sumOfFunctionsInput->set(sum_of_functions::argument,
+                                                     HomogenNumericTableCPU<algorithmFPType, cpu>::create(point.get(), 1, sizeArgument, &s));
+        proximalProjection->sumOfFunctionsParameter->resultsToCompute = optimization_solver::objective_function::proximalProjection;
+        proximalProjection->enableChecks(false);
+        return s;
+    }
+
+    NumericTable * getGradient() { return function->getResult()->get(optimization_solver::objective_function::gradientIdx).get(); }
+    NumericTable * getProximalProjection()
+    {
+        return proximalProjection->getResult()->get(optimization_solver::objective_function::proximalProjectionIdx).get();
+    }
+
+    sum_of_functions::BatchPtr function;           /* Computes the gradient of the term with batchIndex */
+    sum_of_functions::BatchPtr proximalProjection; /* Computes the proximal projection of the point */
+    services::internal::HostAppHelper host;
+    int batchIndex;
+    TArray<algorithmFPType, cpu> point;
+    TArray<algorithmFPType, cpu> gradientDiff;
+    TArray<algorithmFPType, cpu> previous; /* Copy of the shared argument the gradient is computed for */
+    TArray<int, cpu> indices; /* Buffer for the term indices of the current chunk of iterations */
+};
+
 /**
  *  \Kernel for Saga calculation
  */
@@ -145,6 +201,12 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
             savedGradients = gradientsTableInputPtr.get();
         }
     }
+    if (parameter->asynchronous)
+    {
+        return computeAsync(pHost, function, parameter, workValue, savedGradients, !gradientsTableInput, auto_step, learningRateArray,
+                            learningRateLength, nIterations);
+    }
+
     TArray<int, cpu> batchIndicesT(batchSize);
     int * batchIndicesPtr = batchIndicesT.get();
 
@@ -343,6 +405,185 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
     return (!result) ? s : Status(ErrorMemoryCopyFailedInternal);
 }
 
+/**
+ *  \brief Asynchronous SAGA: the threads process the terms concurrently and update the argument, the table of gradients
+ *  and the sum of gradients without locks, as in the Hogwild! and ASAGA schemes. The shared arrays are accessed element-wise
+ *  with relaxed atomic loads and stores, so a concurrent update of an element may be lost. Each update of the argument is
+ *  applied as the difference to the copy of the argument read by the thread.
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status SagaKernel<algorithmFPType, method, cpu>::computeAsync(HostAppIface * pHost, const sum_of_functions::BatchPtr & function,
+                                                                        Parameter * parameter, algorithmFPType * workValue,
+                                                                        algorithmFPType * savedGradients, bool computeSavedGradients,
+                                                                        algorithmFPType autoStep, const algorithmFPType * learningRateArray,
+                                                                        size_t learningRateLength, NumericTable * nIterations)
+{
+    typedef SagaAsyncContext<algorithmFPType, cpu> Ctx;
+    typedef daal::internal::Math<algorithmFPType, cpu> MathType;
+
+    const size_t sizeArgument       = function->sumOfFunctionsInput->get(sum_of_functions::argument)->getNumberOfRows();
+    const size_t n                  = function->sumOfFunctionsParameter->numberOfTerms;
+    const size_t maxIterations      = parameter->nIterations;
+    const algorithmFPType tolerance = parameter->accuracyThreshold;
+    const algorithmFPType inverse_n = algorithmFPType(1) / algorithmFPType(n);
+
+    daal::tls<Ctx *> tlsCtx([&]() -> Ctx * {
+        Ctx * ctx = new Ctx(pHost, sizeArgument);
+        if (ctx && !ctx->init(function, sizeArgument))
+        {
+            delete ctx;
+            ctx = nullptr;
+        }
+        return ctx;
+    });
+
+    daal::SafeStatus safeStat;
+    if (computeSavedGradients)
+    {
+        const size_t blockSize = 256;
+        const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            Ctx * ctx = tlsCtx.local();
+            DAAL_CHECK_MALLOC_THR(ctx);
+            /* the argument is not updated until the table of gradients is computed */
+            services::internal::tmemcpy<algorithmFPType, cpu>(ctx->previous.get(), workValue, sizeArgument);
+            const size_t end = services::internal::min<cpu, size_t>(n, (iBlock + 1) * blockSize);
+            for (size_t k = iBlock * blockSize; k < end; k++)
+            {
+                ctx->batchIndex = int(k);
+                DAAL_CHECK_STATUS_THR(ctx->function->computeNoThrow());
+                ReadRows<algorithmFPType, cpu> gradientBD(*ctx->getGradient(), 0, sizeArgument);
+                DAAL_CHECK_BLOCK_STATUS_THR(gradientBD);
+                services::internal::tmemcpy<algorithmFPType, cpu>(savedGradients + k * sizeArgument, gradientBD.get(), sizeArgument);
+            }
+        });
+    }
+
+    TArray<algorithmFPType, cpu> summGradsPtr(sizeArgument);
+    algorithmFPType * summGrads = summGradsPtr.get();
+    if (!summGrads) safeStat.add(services::ErrorMemoryAllocationFailed);
+
+    NumericTablePtr batchIndicesNT = parameter->batchIndices;
+    ReadRows<int, cpu> batchIndicesBD;
+    if (batchIndicesNT)
+    {
+        batchIndicesBD.set(*batchIndicesNT, 0, maxIterations);
+        if (!batchIndicesBD.status()) safeStat.add(batchIndicesBD.status());
+    }
+
+    AsyncSchedule<cpu> schedule;
+    if (safeStat) safeStat.add(schedule.init(batchIndicesBD.get(), maxIterations, parameter->nStreams, int(n), parameter->engine));
+
+    const size_t nTasks = schedule.getNumberOfTasks();
+    TArray<size_t, cpu> nTaskIterations(nTasks);
+    if (safeStat && nTasks && !nTaskIterations.get()) safeStat.add(services::ErrorMemoryAllocationFailed);
+
+    if (safeStat)
+    {
+        /* compute sum of gradients */
+        for (size_t i = 0; i < sizeArgument; i++) summGrads[i] = 0;
+        for (size_t k = 0; k < n; k++)
+        {
+            for (size_t i = 0; i < sizeArgument; i++)
+            {
+                summGrads[i] += savedGradients[k * sizeArgument + i];
+            }
+        }
+
+        daal::services::Atomic<int> isStopped(0);
+        daal::threader_for(nTasks, nTasks, [&](size_t iTask) {
+            nTaskIterations[iTask] = 0;
+            if (isStopped.get()) return;
+            Ctx * ctx = tlsCtx.local();
+            DAAL_CHECK_MALLOC_THR(ctx);
+            algorithmFPType * point        = ctx->point.get();
+            algorithmFPType * gradientDiff = ctx->gradientDiff.get();
+            algorithmFPType * previous     = ctx->previous.get();
+
+            const size_t begin  = schedule.getBegin(iTask);
+            const size_t end    = schedule.getEnd(iTask);
+            const int * indices = nullptr;
+            for (size_t iter = begin; iter < end && !isStopped.get(); iter++)
+            {
+                const size_t iChunk = (iter - begin) % AsyncSchedule<cpu>::chunkSize;
+                if (iChunk == 0)
+                {
+                    const size_t count = services::internal::min<cpu, size_t>(AsyncSchedule<cpu>::chunkSize, end - iter);
+                    services::Status s = schedule.getIndices(iTask, iter, count, ctx->indices.get(), indices);
+                    if (!s)
+                    {
+                        isStopped.set(1);
+                        safeStat.add(s);
+                        return;
+                    }
+                }
+                ctx->batchIndex                         = indices[iChunk];
+                const size_t displacement               = size_t(ctx->batchIndex) * sizeArgument;
+                const algorithmFPType stepLength        = learningRateLength ? learningRateArray[iter % learningRateLength] : autoStep;
+                const algorithmFPType inverseStepLength = algorithmFPType(1) / stepLength;
+
+                for (size_t k = 0; k < sizeArgument; k++) previous[k] = atomicLoadRelaxed(workValue + k);
+
+                services::Status s = ctx->function->computeNoThrow();
+                if (!s || ctx->host.isCancelled(s, 1))
+                {
+                    isStopped.set(1);
+                    safeStat.add(s);
+                    return;
+                }
+                ReadRows<algorithmFPType, cpu> gradientBD(*ctx->getGradient(), 0, sizeArgument);
+                DAAL_CHECK_BLOCK_STATUS_THR(gradientBD);
+                const algorithmFPType * gradient = gradientBD.get();
+
+                for (size_t k = 0; k < sizeArgument; k++)
+                {
+                    gradientDiff[k]                = gradient[k] - atomicLoadRelaxed(savedGradients + displacement + k);
+                    const algorithmFPType summGrad = atomicLoadRelaxed(summGrads + k);
+                    point[k] = (previous[k] - stepLength * (gradientDiff[k] + (summGrad + gradientDiff[k]) * inverse_n)) * inverseStepLength;
+                }
+
+                s = ctx->proximalProjection->computeNoThrow();
+                if (!s)
+                {
+                    isStopped.set(1);
+                    safeStat.add(s);
+                    return;
+                }
+                ReadRows<algorithmFPType, cpu> proxBD(*ctx->getProximalProjection(), 0, sizeArgument);
+                DAAL_CHECK_BLOCK_STATUS_THR(proxBD);
+                const algorithmFPType * prox = proxBD.get();
+
+                bool continueCheck = false;
+                for (size_t k = 0; k < sizeArgument; k++)
+                {
+                    const algorithmFPType value = stepLength * prox[k];
+                    atomicStoreRelaxed(workValue + k, atomicLoadRelaxed(workValue + k) + (value - previous[k]));
+                    atomicStoreRelaxed(summGrads + k, atomicLoadRelaxed(summGrads + k) + gradientDiff[k]);
+                    atomicStoreRelaxed(savedGradients + displacement + k, gradient[k]);
+                    continueCheck |= (MathType::sFabs(previous[k] - value) >= tolerance * MathType::sMax(1, MathType::sFabs(value)));
+                }
+                nTaskIterations[iTask]++;
+
+                if (!continueCheck)
+                {
+                    isStopped.set(1);
+                }
+            }
+        });
+    }
+
+    tlsCtx.reduce([](Ctx * ctx) -> void { delete ctx; });
+    DAAL_CHECK_SAFE_STATUS();
+
+    size_t iterationsPerformed = 0;
+    for (size_t i = 0; i < nTasks; i++) iterationsPerformed += nTaskIterations[i];
+
+    WriteRows<algorithmFPType, cpu> nIterationsPerformed(*nIterations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nIterationsPerformed);
+    *nIterationsPerformed.get() = iterationsPerformed;
+    return services::Status();
+}
+
 } // namespace internal
 
 } // namespace saga
@@ -49,6 +49,11 @@ public:
     services::Status compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum, NumericTable * nIterations,
                              NumericTable * gradientsTableInput, NumericTable * gradientsTableResult, Parameter * parameter,
                              engines::BatchBase & engine);
+
+private:
+    services::Status computeAsync(HostAppIface * pHost, const sum_of_functions::BatchPtr & function, Parameter * parameter,
+                                  algorithmFPType * workValue, algorithmFPType * savedGradients, bool computeSavedGradients, algorithmFPType autoStep,
+                                  const algorithmFPType * learningRateArray, size_t learningRateLength, NumericTable * nIterations);
 };
 
 } // namespace internal
@@ -46,7 +46,9 @@ Parameter::Parameter(const sum_of_functions::BatchPtr & function, size_t nIterat
       batchIndices(batchIndices),
       learningRateSequence(learningRateSequence),
       seed(seed),
-      engine(engines::mt19937::Batch<>::create())
+      engine(engines::mt19937::Batch<>::create()),
+      asynchronous(false),
+      nStreams(0)
 {}
 
 services::Status Parameter::check() const
@@ -68,6 +70,11 @@ services::Status Parameter::check() const
     if (batchSize > function->sumOfFunctionsParameter->numberOfTerms || batchSize == 0)
         return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ArgumentName, batchSizeStr()));
 
+    if (asynchronous)
+    {
+        DAAL_CHECK_EX(nStreams <= nIterations, services::ErrorIncorrectParameter, services::ArgumentName, "nStreams");
+    }
+
     return s;
 }
 
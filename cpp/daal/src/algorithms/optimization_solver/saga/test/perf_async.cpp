@@ -0,0 +1,168 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include "daal/include/algorithms/optimization_solver/objective_function/logistic_loss_batch.h"
+#include "daal/include/algorithms/optimization_solver/saga/saga_batch.h"
+#include "daal/include/algorithms/optimization_solver/sgd/sgd_batch.h"
+#include "daal/include/data_management/data/homogen_numeric_table.h"
+#include "daal/src/threading/threading.h"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal::algorithms::optimization_solver::saga::test {
+
+namespace dm = daal::data_management;
+
+/// Compares the time of the sequential and the asynchronous solvers on the same
+/// number of iterations. The objective value reached by each run is reported
+/// next to the time, as the asynchronous updates converge differently
+class async_solver_perf_test {
+public:
+    using float_t = float;
+
+    void generate(std::size_t row_count, std::size_t column_count) {
+        std::mt19937 rng(7777);
+        std::uniform_real_distribution<float_t> uniform(-1.0, 1.0);
+
+        x_.resize(row_count * column_count);
+        y_.resize(row_count);
+        std::vector<float_t> beta(column_count);
+        for (auto& value : beta) {
+            value = uniform(rng);
+        }
+        for (std::size_t i = 0; i < row_count; i++) {
+            float_t score = 0;
+            for (std::size_t j = 0; j < column_count; j++) {
+                x_[i * column_count + j] = uniform(rng);
+                score += x_[i * column_count + j] * beta[j];
+            }
+            y_[i] = (score > 0) ? float_t(1) : float_t(0);
+        }
+
+        x_table_ = dm::HomogenNumericTable<float_t>::create(x_.data(), column_count, row_count);
+        y_table_ = dm::HomogenNumericTable<float_t>::create(y_.data(), 1, row_count);
+        column_count_ = column_count;
+    }
+
+    void run_saga(std::size_t iteration_count, bool asynchronous, std::size_t stream_count) {
+        saga::Batch<float_t> solver(create_loss());
+        solver.parameter().nIterations = iteration_count;
+        solver.parameter().accuracyThreshold = 0.0;
+        solver.parameter().batchSize = 1;
+        solver.parameter().asynchronous = asynchronous;
+        solver.parameter().nStreams = stream_count;
+        run(solver, "saga", iteration_count, asynchronous, stream_count);
+    }
+
+    void run_sgd(std::size_t iteration_count, bool asynchronous, std::size_t stream_count) {
+        sgd::Batch<float_t> solver(create_loss());
+        solver.parameter.learningRateSequence =
+            dm::HomogenNumericTable<float_t>::create(1, 1, dm::NumericTable::doAllocate, 1e-3f);
+        solver.parameter.nIterations = iteration_count;
+        solver.parameter.accuracyThreshold = 0.0;
+        solver.parameter.asynchronous = asynchronous;
+        solver.parameter.nStreams = stream_count;
+        run(solver, "sgd", iteration_count, asynchronous, stream_count);
+    }
+
+private:
+    services::SharedPtr<logistic_loss::Batch<float_t>> create_loss() const {
+        services::SharedPtr<logistic_loss::Batch<float_t>> loss(
+            new logistic_loss::Batch<float_t>(x_table_->getNumberOfRows()));
+        loss->input.set(logistic_loss::data, x_table_);
+        loss->input.set(logistic_loss::dependentVariables, y_table_);
+        loss->parameter().penaltyL2 = 0.001f;
+        loss->parameter().interceptFlag = true;
+        return loss;
+    }
+
+    float_t compute_objective(const dm::NumericTablePtr& argument) const {
+        auto loss = create_loss();
+        loss->parameter().resultsToCompute = objective_function::value;
+        loss->input.set(logistic_loss::argument, argument);
+        REQUIRE(loss->compute().ok());
+
+        dm::BlockDescriptor<float_t> block;
+        const auto value = loss->getResult()->get(objective_function::valueIdx);
+        value->getBlockOfRows(0, 1, dm::readOnly, block);
+        const float_t result = block.getBlockPtr()[0];
+        value->releaseBlockOfRows(block);
+        return result;
+    }
+
+    template <typename Solver>
+    void run(Solver& solver,
+             const char* solver_name,
+             std::size_t iteration_count,
+             bool asynchronous,
+             std::size_t stream_count) {
+        std::vector<float_t> initial_point(column_count_ + 1, float_t(0));
+        solver.input.set(iterative_solver::inputArgument,
+                         dm::HomogenNumericTable<float_t>::create(initial_point.data(),
+                                                                  1,
+                                                                  column_count_ + 1));
+
+        REQUIRE(solver.compute().ok());
+        const auto objective =
+            compute_objective(solver.getResult()->get(iterative_solver::minimum));
+
+        const auto name = fmt::format(
+            "{} {}: iteration_count {}, stream_count {}, thread_count {}, objective {}",
+            solver_name,
+            asynchronous ? "asynchronous" : "sequential",
+            iteration_count,
+            stream_count,
+            daal::threader_get_threads_number(),
+            objective);
+
+        BENCHMARK(name.c_str()) {
+            return solver.compute().ok();
+        };
+    }
+
+    std::vector<float_t> x_;
+    std::vector<float_t> y_;
+    dm::NumericTablePtr x_table_;
+    dm::NumericTablePtr y_table_;
+    std::size_t column_count_ = 0;
+};
+
+TEST_M(async_solver_perf_test,
+       "asynchronous saga is compared with the sequential one",
+       "[saga][async][perf]") {
+    const std::size_t iteration_count = GENERATE(10000, 160000);
+    this->generate(100000, 20);
+
+    this->run_saga(iteration_count, false, 0);
+    this->run_saga(iteration_count, true, 0);
+    this->run_saga(iteration_count, true, 8);
+}
+
+TEST_M(async_solver_perf_test,
+       "asynchronous sgd is compared with the sequential one",
+       "[sgd][async][perf]") {
+    const std::size_t iteration_count = GENERATE(10000, 160000);
+    this->generate(100000, 20);
+
+    this->run_sgd(iteration_count, false, 0);
+    this->run_sgd(iteration_count, true, 0);
+    this->run_sgd(iteration_count, true, 8);
+}
+
+} // namespace daal::algorithms::optimization_solver::saga::test
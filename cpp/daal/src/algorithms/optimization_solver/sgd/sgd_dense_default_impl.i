@@ -31,6 +31,7 @@
 #include "src/algorithms/optimization_solver/iterative_solver_kernel.h"
 #include "src/threading/threading.h"
 #include "src/services/service_data_utils.h"
+#include "services/daal_atomic_int.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -46,6 +47,37 @@ namespace sgd
 {
 namespace internal
 {
+/**
+ *  \brief Context of the thread that processes the terms of the objective function in the asynchronous mode
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct SGDAsyncContext
+{
+    SGDAsyncContext(HostAppIface * pHost, size_t nRows) : host(pHost, 10), batchIndex(0), point(nRows), indices(AsyncSchedule<cpu>::chunkSize) {}
+
+    services::Status init(const sum_of_functions::BatchPtr & prototype, size_t nRows)
+    {
+        DAAL_CHECK_MALLOC(point.get() && indices.get());
+        services::Status s;
+        function                                        = prototype->clone();
+        function->sumOfFunctionsParameter->batchIndices = HomogenNumericTableCPU<int, cpu>::create(&batchIndex, 1, 1, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        /* the gradient is computed for the thread-local copy of the argument, as the shared argument is updated by the other threads */
+        function->sumOfFunctionsInput->set(sum_of_functions::argument,
+                                           HomogenNumericTableCPU<algorithmFPType, cpu>::create(point.get(), 1, nRows, &s));
+        function->enableChecks(false);
+        return s;
+    }
+
+    NumericTable * getGradient() { return function->getResult()->get(objective_function::gradientIdx).get(); }
+
+    sum_of_functions::BatchPtr function; /* Computes the gradient of the term with batchIndex */
+    services::internal::HostAppHelper host;
+    int batchIndex;
+    TArray<algorithmFPType, cpu> point; /* Copy of the shared argument the gradient is computed for */
+    TArray<int, cpu> indices;           /* Buffer for the term indices of the current chunk of iterations */
+};
+
 /**
  *  \brief Kernel for SGD calculation
  */
@@ -95,7 +127,7 @@ services::Status SGDKernel<algorithmFPType, defaultDense, cpu>::compute(HostAppI
 
     const size_t nTerms = function->sumOfFunctionsParameter->numberOfTerms;
     ReadRows<int, cpu, NumericTable> predefinedBatchIndicesBD(batchIndices, 0, nIter);
-    const bool bGenerateAllIndices = !(parameter->batchIndices || parameter->optionalResultRequired);
+    const bool bGenerateAllIndices = !(parameter->batchIndices || parameter->optionalResultRequired || parameter->asynchronous);
     TArray<int, cpu> aPredefinedBatchIndices(bGenerateAllIndices ? nIter : 0);
     if (bGenerateAllIndices)
     {
@@ -134,60 +166,69 @@ services::Status SGDKernel<algorithmFPType, defaultDense, cpu>::compute(HostAppI
         startIteration                      = lastIterationInputArray[0];
     }
 
-    services::internal::HostAppHelper host(pHost, 10);
-    for (epoch = startIteration; s.ok() && (epoch < (startIteration + nIter)); epoch++)
+    if (parameter->asynchronous)
     {
-        const int * pValues = nullptr;
-        s                   = rngTask.get(pValues);
-        if (s)
-        {
-            ntBatchIndices->setArray(const_cast<int *>(pValues), ntBatchIndices->getNumberOfRows());
-            s = function->computeNoThrow();
-        }
-        if (!s || host.isCancelled(s, 1))
-        {
-            nProceededIterations[0] = nProceededIters;
-            return s;
-        }
-
-        NumericTable * gradient = function->getResult()->get(objective_function::gradientIdx).get();
-        if (nIter != 1)
+        DAAL_CHECK_STATUS_VAR(computeAsync(pHost, minimum, parameter, predefinedBatchIndicesBD.get(), learningRateArray, learningRateLength,
+                                           startIteration, nProceededIters));
+        nProceededIterations[0] = (int)nProceededIters;
+    }
+    else
+    {
+        services::internal::HostAppHelper host(pHost, 10);
+        for (epoch = startIteration; s.ok() && (epoch < (startIteration + nIter)); epoch++)
         {
-            algorithmFPType pointNorm, gradientNorm;
-            s = vectorNorm(minimum, pointNorm);
-            s |= vectorNorm(gradient, gradientNorm);
-            DAAL_CHECK_BREAK(!s);
-
-            const algorithmFPType one(1.0);
-            const algorithmFPType gradientThreshold = accuracyThreshold * daal::internal::Math<algorithmFPType, cpu>::sMax(one, pointNorm);
-            if (gradientNorm < gradientThreshold)
+            const int * pValues = nullptr;
+            s                   = rngTask.get(pValues);
+            if (s)
             {
-                DAAL_ASSERT(nProceededIters <= services::internal::MaxVal<int>::get())
-                nProceededIterations[0] = (int)nProceededIters;
-                break;
+                ntBatchIndices->setArray(const_cast<int *>(pValues), ntBatchIndices->getNumberOfRows());
+                s = function->computeNoThrow();
             }
-        }
+            if (!s || host.isCancelled(s, 1))
+            {
+                nProceededIterations[0] = nProceededIters;
+                return s;
+            }
+
+            NumericTable * gradient = function->getResult()->get(objective_function::gradientIdx).get();
+            if (nIter != 1)
+            {
+                algorithmFPType pointNorm, gradientNorm;
+                s = vectorNorm(minimum, pointNorm);
+                s |= vectorNorm(gradient, gradientNorm);
+                DAAL_CHECK_BREAK(!s);
 
-        const algorithmFPType learningRate = learningRateArray[epoch % learningRateLength];
-
-        processByBlocks<cpu>(
-            nRows,
-            [=, &safeStat](size_t startOffset, size_t nRowsInBlock) {
-                WriteRows<algorithmFPType, cpu, NumericTable> workValueBD(*minimum, startOffset, nRowsInBlock);
-                DAAL_CHECK_BLOCK_STATUS_THR(workValueBD);
-                algorithmFPType * workLocal = workValueBD.get();
-                ReadRows<algorithmFPType, cpu, NumericTable> ntGradientBD(*gradient, startOffset, nRowsInBlock);
-                DAAL_CHECK_BLOCK_STATUS_THR(ntGradientBD);
-                const algorithmFPType * gradientLocal = ntGradientBD.get();
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t j = 0; j < nRowsInBlock; j++)
+                const algorithmFPType one(1.0);
+                const algorithmFPType gradientThreshold = accuracyThreshold * daal::internal::Math<algorithmFPType, cpu>::sMax(one, pointNorm);
+                if (gradientNorm < gradientThreshold)
                 {
-                    workLocal[j] = workLocal[j] - learningRate * gradientLocal[j];
+                    DAAL_ASSERT(nProceededIters <= services::internal::MaxVal<int>::get())
+                    nProceededIterations[0] = (int)nProceededIters;
+                    break;
                 }
-            },
-            256);
-        if (!safeStat) s |= safeStat.detach();
-        nProceededIters++;
+            }
+
+            const algorithmFPType learningRate = learningRateArray[epoch % learningRateLength];
+
+            processByBlocks<cpu>(
+                nRows,
+                [=, &safeStat](size_t startOffset, size_t nRowsInBlock) {
+                    WriteRows<algorithmFPType, cpu, NumericTable> workValueBD(*minimum, startOffset, nRowsInBlock);
+                    DAAL_CHECK_BLOCK_STATUS_THR(workValueBD);
+                    algorithmFPType * workLocal = workValueBD.get();
+                    ReadRows<algorithmFPType, cpu, NumericTable> ntGradientBD(*gradient, startOffset, nRowsInBlock);
+                    DAAL_CHECK_BLOCK_STATUS_THR(ntGradientBD);
+                    const algorithmFPType * gradientLocal = ntGradientBD.get();
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nRowsInBlock; j++)
+                    {
+                        workLocal[j] = workLocal[j] - learningRate * gradientLocal[j];
+                    }
+                },
+                256);
+            if (!safeStat) s |= safeStat.detach();
+            nProceededIters++;
+        }
     }
     if (lastIterationResult)
     {
@@ -198,6 +239,120 @@ services::Status SGDKernel<algorithmFPType, defaultDense, cpu>::compute(HostAppI
     return s;
 }
 
+/**
+ *  \brief Asynchronous SGD: the threads process the terms concurrently and update the argument without locks
+ *  as in the Hogwild! scheme. Each thread computes the gradient for its own copy of the argument and applies the step
+ *  to the shared argument element-wise with relaxed atomic loads and stores, so a concurrent update may be lost.
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SGDKernel<algorithmFPType, defaultDense, cpu>::computeAsync(HostAppIface * pHost, NumericTable * minimum,
+                                                                             Parameter<defaultDense> * parameter, const int * predefinedBatchIndices,
+                                                                             const algorithmFPType * learningRateArray, size_t learningRateLength,
+                                                                             size_t startIteration, size_t & nProceededIters)
+{
+    typedef SGDAsyncContext<algorithmFPType, cpu> Ctx;
+    typedef daal::internal::Math<algorithmFPType, cpu> MathType;
+
+    const size_t nRows                  = minimum->getNumberOfRows();
+    const size_t nIter                  = parameter->nIterations;
+    const algorithmFPType accuracy      = parameter->accuracyThreshold;
+    sum_of_functions::BatchPtr function = parameter->function;
+    nProceededIters                     = 0;
+
+    WriteRows<algorithmFPType, cpu, NumericTable> workValueBD(*minimum, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(workValueBD);
+    algorithmFPType * workValue = workValueBD.get();
+
+    Status s;
+    AsyncSchedule<cpu> schedule;
+    DAAL_CHECK_STATUS(s, schedule.init(predefinedBatchIndices, nIter, parameter->nStreams, int(function->sumOfFunctionsParameter->numberOfTerms),
+                                       parameter->engine));
+    const size_t nTasks = schedule.getNumberOfTasks();
+    TArray<size_t, cpu> nTaskIterations(nTasks);
+    DAAL_CHECK_MALLOC(!nTasks || nTaskIterations.get());
+
+    daal::tls<Ctx *> tlsCtx([&]() -> Ctx * {
+        Ctx * ctx = new Ctx(pHost, nRows);
+        if (ctx && !ctx->init(function, nRows))
+        {
+            delete ctx;
+            ctx = nullptr;
+        }
+        return ctx;
+    });
+
+    SafeStatus safeStat;
+    daal::services::Atomic<int> isStopped(0);
+    daal::threader_for(nTasks, nTasks, [&](size_t iTask) {
+        nTaskIterations[iTask] = 0;
+        if (isStopped.get()) return;
+        Ctx * ctx = tlsCtx.local();
+        DAAL_CHECK_MALLOC_THR(ctx);
+        algorithmFPType * point = ctx->point.get();
+
+        const size_t begin  = schedule.getBegin(iTask);
+        const size_t end    = schedule.getEnd(iTask);
+        const int * indices = nullptr;
+        for (size_t iter = begin; iter < end && !isStopped.get(); iter++)
+        {
+            const size_t iChunk = (iter - begin) % AsyncSchedule<cpu>::chunkSize;
+            if (iChunk == 0)
+            {
+                const size_t count  = services::internal::min<cpu, size_t>(AsyncSchedule<cpu>::chunkSize, end - iter);
+                services::Status st = schedule.getIndices(iTask, iter, count, ctx->indices.get(), indices);
+                if (!st)
+                {
+                    isStopped.set(1);
+                    safeStat.add(st);
+                    return;
+                }
+            }
+            algorithmFPType pointNorm = 0;
+            for (size_t j = 0; j < nRows; j++)
+            {
+                point[j] = atomicLoadRelaxed(workValue + j);
+                pointNorm += point[j] * point[j];
+            }
+
+            ctx->batchIndex     = indices[iChunk];
+            services::Status st = ctx->function->computeNoThrow();
+            if (!st || ctx->host.isCancelled(st, 1))
+            {
+                isStopped.set(1);
+                safeStat.add(st);
+                return;
+            }
+            ReadRows<algorithmFPType, cpu, NumericTable> gradientBD(*ctx->getGradient(), 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(gradientBD);
+            const algorithmFPType * gradient = gradientBD.get();
+
+            /* the step is applied to the current value of the shared argument, the norms are those of the thread-local
+               point and of its gradient, so the stopping criterion does not read the elements updated by the other threads */
+            const algorithmFPType learningRate = learningRateArray[(startIteration + iter) % learningRateLength];
+            algorithmFPType gradientNorm       = 0;
+            for (size_t j = 0; j < nRows; j++)
+            {
+                atomicStoreRelaxed(workValue + j, atomicLoadRelaxed(workValue + j) - learningRate * gradient[j]);
+                gradientNorm += gradient[j] * gradient[j];
+            }
+            nTaskIterations[iTask]++;
+
+            const algorithmFPType one(1.0);
+            if (nIter != 1 && MathType::sSqrt(gradientNorm) < accuracy * MathType::sMax(one, MathType::sSqrt(pointNorm)))
+            {
+                isStopped.set(1);
+                return;
+            }
+        }
+    });
+
+    tlsCtx.reduce([](Ctx * ctx) -> void { delete ctx; });
+    DAAL_CHECK_SAFE_STATUS();
+
+    for (size_t i = 0; i < nTasks; i++) nProceededIters += nTaskIterations[i];
+    return s;
+}
+
 } // namespace internal
 
 } // namespace sgd
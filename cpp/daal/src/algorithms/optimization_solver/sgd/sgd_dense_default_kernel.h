@@ -50,6 +50,11 @@ public:
 
     using iterative_solver::internal::IterativeSolverKernel<algorithmFPType, cpu>::vectorNorm;
     using iterative_solver::internal::IterativeSolverKernel<algorithmFPType, cpu>::getRandom;
+
+private:
+    services::Status computeAsync(HostAppIface * pHost, NumericTable * minimum, Parameter<defaultDense> * parameter,
+                                  const int * predefinedBatchIndices, const algorithmFPType * learningRateArray, size_t learningRateLength,
+                                  size_t startIteration, size_t & nProceededIters);
 };
 
 } // namespace internal
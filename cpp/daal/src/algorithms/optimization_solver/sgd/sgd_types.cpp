@@ -72,7 +72,9 @@ Parameter<defaultDense>::Parameter(const sum_of_functions::BatchPtr & function,
                                    NumericTablePtr batchIndices, NumericTablePtr learningRateSequence, size_t seed)
     : BaseParameter(function, nIterations, accuracyThreshold, batchIndices, learningRateSequence,
                     1, // batchSize
-                    seed)
+                    seed),
+      asynchronous(false),
+      nStreams(0)
 {}
 /**
  * Checks the correctness of the parameter
@@ -81,6 +83,10 @@ services::Status Parameter<defaultDense>::check() const
 {
     services::Status s = BaseParameter::check();
     if (!s) return s;
+    if (asynchronous)
+    {
+        DAAL_CHECK_EX(nStreams <= nIterations, ErrorIncorrectParameter, ArgumentName, "nStreams");
+    }
     if (batchIndices.get() != NULL)
     {
         return checkNumericTable(batchIndices.get(), batchIndicesStr(), 0, 0, 1, nIterations);
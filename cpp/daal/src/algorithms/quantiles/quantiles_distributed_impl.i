@@ -0,0 +1,147 @@
+/* file: quantiles_distributed_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Quantiles computation algorithm implementation in the distributed processing mode
+//--
+*/
+
+#ifndef __QUANTILES_DISTRIBUTED_IMPL__
+#define __QUANTILES_DISTRIBUTED_IMPL__
+
+#include "src/algorithms/quantiles/quantiles_sketch_impl.i"
+#include "src/services/service_utils.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesDistributedKernel<method, algorithmFPType, cpu>::compute(const DataCollection & partialResults,
+                                                                                   NumericTable & sketchLevelsTable, NumericTable & sketchItemsTable,
+                                                                                   const Parameter & parameter)
+{
+    const size_t nPartialResults = partialResults.size();
+    const size_t nFeatures       = sketchItemsTable.getNumberOfRows();
+    const size_t sketchSize      = sketchItemsTable.getNumberOfColumns();
+    const size_t topCapacity     = getSketchTopCapacity(parameter.accuracy);
+    const size_t nBlocks         = nFeatures / sketchFeatureBlockSize + !!(nFeatures % sketchFeatureBlockSize);
+    const size_t nLevelValues    = nSketchLevelsRows * sketchMaxLevels;
+
+    WriteRows<int, cpu> levelsBlock(sketchLevelsTable, 0, nSketchLevelsRows);
+    DAAL_CHECK_BLOCK_STATUS(levelsBlock)
+    int * levels = levelsBlock.get();
+
+    size_t nItems = 0;
+    for (size_t h = 0; h < sketchMaxLevels; ++h) nItems += size_t(levels[levelSizesRow * sketchMaxLevels + h]);
+
+    /* The levels of a partial result are the same for all features, so they are read once */
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nPartialResults, nLevelValues);
+    TArray<int, cpu> partialLevels(nPartialResults * nLevelValues);
+    TArray<NumericTable *, cpu> partialItems(nPartialResults);
+    DAAL_CHECK_MALLOC(partialLevels.get() && partialItems.get());
+
+    for (size_t i = 0; i < nPartialResults; ++i)
+    {
+        const PartialResult * partialResult = static_cast<const PartialResult *>(partialResults[i].get());
+
+        ReadRows<int, cpu> partialLevelsBlock(partialResult->get(sketchLevels).get(), 0, nSketchLevelsRows);
+        DAAL_CHECK_BLOCK_STATUS(partialLevelsBlock)
+        const int * partialLevelsArray = partialLevelsBlock.get();
+        for (size_t j = 0; j < nLevelValues; ++j) partialLevels[i * nLevelValues + j] = partialLevelsArray[j];
+
+        partialItems[i] = partialResult->get(sketchItems).get();
+    }
+
+    /* The merged sketch of each feature may keep twice as many values as the sketch before the compaction */
+    const size_t workSize = 2 * sketchSize;
+    daal::TlsMem<algorithmFPType, cpu> tlsBuffer((sketchFeatureBlockSize + 1) * workSize);
+
+    int newLevels[nSketchLevelsRows * sketchMaxLevels];
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        algorithmFPType * buffer = tlsBuffer.local();
+        DAAL_CHECK_MALLOC_THR(buffer);
+        algorithmFPType * mergeBuffer = buffer + sketchFeatureBlockSize * workSize;
+
+        const size_t iFirstFeature  = iBlock * sketchFeatureBlockSize;
+        const size_t nBlockFeatures = services::internal::min<cpu, size_t>(sketchFeatureBlockSize, nFeatures - iFirstFeature);
+
+        WriteRows<algorithmFPType, cpu> itemsBlock(sketchItemsTable, iFirstFeature, nBlockFeatures);
+        DAAL_CHECK_BLOCK_STATUS_THR(itemsBlock);
+        algorithmFPType * items = itemsBlock.get();
+
+        Sketch<algorithmFPType, cpu> sketches[sketchFeatureBlockSize];
+        for (size_t j = 0; j < nBlockFeatures; ++j)
+        {
+            algorithmFPType * work = buffer + j * workSize;
+            for (size_t k = 0; k < nItems; ++k) work[k] = items[j * sketchSize + k];
+            sketches[j].init(topCapacity, levels, work, mergeBuffer);
+        }
+
+        for (size_t i = 0; i < nPartialResults; ++i)
+        {
+            ReadRows<algorithmFPType, cpu> partialItemsBlock(partialItems[i], iFirstFeature, nBlockFeatures);
+            DAAL_CHECK_BLOCK_STATUS_THR(partialItemsBlock);
+            const algorithmFPType * partialItemsArray = partialItemsBlock.get();
+
+            for (size_t j = 0; j < nBlockFeatures; ++j) sketches[j].merge(partialLevels.get() + i * nLevelValues, partialItemsArray + j * sketchSize);
+        }
+
+        for (size_t j = 0; j < nBlockFeatures; ++j)
+        {
+            const algorithmFPType * work = buffer + j * workSize;
+            const size_t nMergedItems    = sketches[j].getNumberOfItems();
+            DAAL_ASSERT(nMergedItems <= sketchSize);
+            for (size_t k = 0; k < nMergedItems; ++k) items[j * sketchSize + k] = work[k];
+        }
+
+        if (iBlock == 0) sketches[0].getLevels(newLevels);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    for (size_t i = 0; i < nLevelValues; ++i) levels[i] = newLevels[i];
+    return Status();
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesDistributedKernel<method, algorithmFPType, cpu>::finalizeCompute(const NumericTable & sketchLevelsTable,
+                                                                                           const NumericTable & sketchItemsTable,
+                                                                                           const NumericTable & quantileOrdersTable,
+                                                                                           NumericTable & quantilesTable, const Parameter & parameter)
+{
+    return computeSketchQuantiles<algorithmFPType, cpu>(sketchLevelsTable, sketchItemsTable, quantileOrdersTable, quantilesTable, parameter.accuracy);
+}
+
+} // namespace internal
+
+} // namespace quantiles
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/quantiles/quantiles_types.h"
+#include "src/algorithms/quantiles/quantiles_sketch.h"
 
 namespace daal
 {
@@ -52,8 +53,78 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     return s;
 }
 
+/**
+ * Allocates memory to store final results of the quantile algorithms
+ * \param[in] partialResult Partial results of the quantiles algorithm
+ * \param[in] parameter     Parameters of the quantiles algorithm
+ * \param[in] method        Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * parameter,
+                                              const int method)
+{
+    services::Status s;
+    const PartialResult * pres = static_cast<const PartialResult *>(partialResult);
+    const Parameter * par      = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, pres->getNumberOfColumns(nFeatures));
+    size_t nQuantileOrders = par->quantileOrders->getNumberOfColumns();
+
+    set(quantiles,
+        data_management::HomogenNumericTable<algorithmFPType>::create(nQuantileOrders, nFeatures, data_management::NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Allocates memory to store partial results of the quantiles algorithm
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                     const int method)
+{
+    services::Status s;
+    const InputIface * in = static_cast<const InputIface *>(input);
+    const Parameter * par = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, in->getNumberOfColumns(nFeatures));
+    const size_t sketchSize = internal::getSketchSize(internal::getSketchTopCapacity(par->accuracy));
+
+    set(sketchLevels, data_management::HomogenNumericTable<int>::create(internal::sketchMaxLevels, internal::nSketchLevelsRows,
+                                                                        data_management::NumericTable::doAllocate, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+    set(sketchItems,
+        data_management::HomogenNumericTable<algorithmFPType>::create(sketchSize, nFeatures, data_management::NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Initializes partial results of the quantiles algorithm with an empty sketch
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ * \return Status of initialization
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                       const int method)
+{
+    /* The sketch is empty when all its levels are empty, the values of the items are not used then */
+    return get(sketchLevels)->assign(0);
+}
+
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par,
                                                                     const int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult * partialResult,
+                                                                    const daal::algorithms::Parameter * par, const int method);
+template DAAL_EXPORT services::Status PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                           const daal::algorithms::Parameter * par, const int method);
+template DAAL_EXPORT services::Status PartialResult::initialize<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                             const daal::algorithms::Parameter * par, const int method);
 
 } // namespace interface1
 } // namespace quantiles
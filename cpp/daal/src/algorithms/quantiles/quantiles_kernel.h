@@ -26,6 +26,8 @@
 
 #include "data_management/data/numeric_table.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
 
 #include "src/services/service_defines.h"
 #include "src/data_management/service_micro_table.h"
@@ -47,6 +49,26 @@ struct QuantilesKernel : public Kernel
     services::Status compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable);
 };
 
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesOnlineKernel : public Kernel
+{
+    virtual ~QuantilesOnlineKernel() {}
+    services::Status compute(const NumericTable & dataTable, NumericTable & sketchLevelsTable, NumericTable & sketchItemsTable,
+                             const Parameter & parameter);
+    services::Status finalizeCompute(const NumericTable & sketchLevelsTable, const NumericTable & sketchItemsTable,
+                                     const NumericTable & quantileOrdersTable, NumericTable & quantilesTable, const Parameter & parameter);
+};
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesDistributedKernel : public Kernel
+{
+    virtual ~QuantilesDistributedKernel() {}
+    services::Status compute(const DataCollection & partialResults, NumericTable & sketchLevelsTable, NumericTable & sketchItemsTable,
+                             const Parameter & parameter);
+    services::Status finalizeCompute(const NumericTable & sketchLevelsTable, const NumericTable & sketchItemsTable,
+                                     const NumericTable & quantileOrdersTable, NumericTable & quantilesTable, const Parameter & parameter);
+};
+
 } // namespace internal
 
 } // namespace quantiles
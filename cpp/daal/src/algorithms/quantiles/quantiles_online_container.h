@@ -0,0 +1,88 @@
+/* file: quantiles_online_container.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of quantiles algorithm container in the online processing mode.
+//--
+*/
+
+#ifndef __QUANTILES_ONLINE_CONTAINER_H__
+#define __QUANTILES_ONLINE_CONTAINER_H__
+
+#include "algorithms/quantiles/quantiles_online.h"
+#include "src/algorithms/quantiles/quantiles_kernel.h"
+#include "src/algorithms/kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::QuantilesOnlineKernel, defaultDense, algorithmFPType);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input * input                 = static_cast<Input *>(_in);
+    PartialResult * partialResult = static_cast<PartialResult *>(_pres);
+    Parameter * par               = static_cast<Parameter *>(_par);
+
+    NumericTable * dataTable         = input->get(data).get();
+    NumericTable * sketchLevelsTable = partialResult->get(sketchLevels).get();
+    NumericTable * sketchItemsTable  = partialResult->get(sketchItems).get();
+
+    daal::services::Environment::env & env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::QuantilesOnlineKernel, __DAAL_KERNEL_ARGUMENTS(defaultDense, algorithmFPType), compute, *dataTable,
+                       *sketchLevelsTable, *sketchItemsTable, *par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult * partialResult = static_cast<PartialResult *>(_pres);
+    Result * result               = static_cast<Result *>(_res);
+    Parameter * par               = static_cast<Parameter *>(_par);
+
+    NumericTable * sketchLevelsTable   = partialResult->get(sketchLevels).get();
+    NumericTable * sketchItemsTable    = partialResult->get(sketchItems).get();
+    NumericTable * quantileOrdersTable = par->quantileOrders.get();
+    NumericTable * quantilesTable      = result->get(quantiles).get();
+
+    daal::services::Environment::env & env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::QuantilesOnlineKernel, __DAAL_KERNEL_ARGUMENTS(defaultDense, algorithmFPType), finalizeCompute,
+                       *sketchLevelsTable, *sketchItemsTable, *quantileOrdersTable, *quantilesTable, *par);
+}
+
+} // namespace quantiles
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
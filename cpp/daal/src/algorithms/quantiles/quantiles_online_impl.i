@@ -0,0 +1,117 @@
+/* file: quantiles_online_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Quantiles computation algorithm implementation in the online processing mode
+//--
+*/
+
+#ifndef __QUANTILES_ONLINE_IMPL__
+#define __QUANTILES_ONLINE_IMPL__
+
+#include "src/algorithms/quantiles/quantiles_sketch_impl.i"
+#include "src/services/service_utils.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesOnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable & dataTable, NumericTable & sketchLevelsTable,
+                                                                              NumericTable & sketchItemsTable, const Parameter & parameter)
+{
+    const size_t nFeatures   = dataTable.getNumberOfColumns();
+    const size_t nVectors    = dataTable.getNumberOfRows();
+    const size_t sketchSize  = sketchItemsTable.getNumberOfColumns();
+    const size_t topCapacity = getSketchTopCapacity(parameter.accuracy);
+    const size_t nBlocks     = nFeatures / sketchFeatureBlockSize + !!(nFeatures % sketchFeatureBlockSize);
+
+    WriteRows<int, cpu> levelsBlock(sketchLevelsTable, 0, nSketchLevelsRows);
+    DAAL_CHECK_BLOCK_STATUS(levelsBlock)
+    int * levels = levelsBlock.get();
+
+    ReadRows<algorithmFPType, cpu> dataBlock(const_cast<NumericTable &>(dataTable), 0, nVectors);
+    DAAL_CHECK_BLOCK_STATUS(dataBlock)
+    const algorithmFPType * data = dataBlock.get();
+
+    /* Compaction buffer followed by the columns of a block of observations */
+    daal::TlsMem<algorithmFPType, cpu> tlsBuffer(sketchSize + sketchFeatureBlockSize * sketchRowBlockSize);
+
+    int newLevels[nSketchLevelsRows * sketchMaxLevels];
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        algorithmFPType * buffer = tlsBuffer.local();
+        DAAL_CHECK_MALLOC_THR(buffer);
+        algorithmFPType * columns = buffer + sketchSize;
+
+        const size_t iFirstFeature  = iBlock * sketchFeatureBlockSize;
+        const size_t nBlockFeatures = services::internal::min<cpu, size_t>(sketchFeatureBlockSize, nFeatures - iFirstFeature);
+
+        WriteRows<algorithmFPType, cpu> itemsBlock(sketchItemsTable, iFirstFeature, nBlockFeatures);
+        DAAL_CHECK_BLOCK_STATUS_THR(itemsBlock);
+        algorithmFPType * items = itemsBlock.get();
+
+        /* The sketches of the features share the compaction buffer */
+        Sketch<algorithmFPType, cpu> sketches[sketchFeatureBlockSize];
+        for (size_t j = 0; j < nBlockFeatures; ++j) sketches[j].init(topCapacity, levels, items + j * sketchSize, buffer);
+
+        for (size_t iFirstRow = 0; iFirstRow < nVectors; iFirstRow += sketchRowBlockSize)
+        {
+            const size_t nRows           = services::internal::min<cpu, size_t>(sketchRowBlockSize, nVectors - iFirstRow);
+            const algorithmFPType * rows = data + iFirstRow * nFeatures + iFirstFeature;
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                for (size_t j = 0; j < nBlockFeatures; ++j) columns[j * sketchRowBlockSize + i] = rows[i * nFeatures + j];
+            }
+            for (size_t j = 0; j < nBlockFeatures; ++j) sketches[j].insert(columns + j * sketchRowBlockSize, nRows);
+        }
+
+        if (iBlock == 0) sketches[0].getLevels(newLevels);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    for (size_t i = 0; i < nSketchLevelsRows * sketchMaxLevels; ++i) levels[i] = newLevels[i];
+    return Status();
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(const NumericTable & sketchLevelsTable,
+                                                                                      const NumericTable & sketchItemsTable,
+                                                                                      const NumericTable & quantileOrdersTable,
+                                                                                      NumericTable & quantilesTable, const Parameter & parameter)
+{
+    return computeSketchQuantiles<algorithmFPType, cpu>(sketchLevelsTable, sketchItemsTable, quantileOrdersTable, quantilesTable, parameter.accuracy);
+}
+
+} // namespace internal
+
+} // namespace quantiles
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
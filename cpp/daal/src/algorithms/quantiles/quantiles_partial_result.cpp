@@ -0,0 +1,120 @@
+/* file: quantiles_partial_result.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of quantiles algorithm partial result methods.
+//--
+*/
+
+#include "algorithms/quantiles/quantiles_types.h"
+#include "src/algorithms/quantiles/quantiles_sketch.h"
+#include "src/services/serialization_utils.h"
+#include "src/services/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID);
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Gets the number of columns in the data set summarized by the partial result
+ * \param[out] nCols Number of columns
+ * \return Status of the call
+ */
+Status PartialResult::getNumberOfColumns(size_t & nCols) const
+{
+    NumericTablePtr ntPtr = get(sketchItems);
+    Status s              = checkNumericTable(ntPtr.get(), sketchItemsStr());
+    nCols                 = (s ? ntPtr->getNumberOfRows() : 0);
+    return s;
+}
+
+/**
+ * Returns the partial result of the quantiles algorithm
+ * \param[in] id   Identifier of the partial result, \ref PartialResultId
+ * \return Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the partial result of the quantiles algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks correctness of the partial result
+ * \param[in] parameter %Parameter of the algorithm
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    size_t nFeatures = 0;
+    Status s;
+    DAAL_CHECK_STATUS(s, getNumberOfColumns(nFeatures));
+    return checkImpl(nFeatures, parameter);
+}
+
+/**
+ * Checks the correctness of partial result
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const
+{
+    size_t nFeatures = 0;
+    Status s;
+    DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfColumns(nFeatures));
+    return checkImpl(nFeatures, parameter);
+}
+
+Status PartialResult::checkImpl(size_t nFeatures, const daal::algorithms::Parameter * parameter) const
+{
+    const Parameter * par   = static_cast<const Parameter *>(parameter);
+    const size_t sketchSize = internal::getSketchSize(internal::getSketchTopCapacity(par->accuracy));
+
+    Status s;
+    const int unexpectedLayouts = (int)packed_mask | (int)NumericTableIface::csrArray;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(sketchLevels).get(), sketchLevelsStr(), unexpectedLayouts, 0, internal::sketchMaxLevels,
+                                           internal::nSketchLevelsRows));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(sketchItems).get(), sketchItemsStr(), unexpectedLayouts, 0, sketchSize, nFeatures));
+    return s;
+}
+
+} // namespace interface1
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
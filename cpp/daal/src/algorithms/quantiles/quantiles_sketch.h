@@ -0,0 +1,110 @@
+/* file: quantiles_sketch.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Layout of the quantile sketch used in the online and distributed processing modes.
+//
+//  The sketch is a hierarchy of compactors in the spirit of the KLL sketch.
+//  Level l keeps values of weight 2^l. When a level reaches its capacity it is
+//  sorted, every other value of it is promoted to the next level, and the
+//  rest is dropped. The capacity of the top level is k, and the capacities of
+//  the lower levels decrease geometrically with the depth, but not below 2.
+//
+//  The values of all features are stored in the same layout: each row of the
+//  items table keeps the levels of one feature from the top level down to
+//  level 0. The level sizes depend on the number of processed observations
+//  only, so they are stored once for all features in the levels table together
+//  with the numbers of compactions of the levels. The offset of the values
+//  promoted by a compaction is a pseudo-random bit of the level and the number
+//  of its compactions, so that the sketch is deterministic but not biased.
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_H__
+#define __QUANTILES_SKETCH_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+/* Level l keeps values of weight 2^l, so 64 levels are enough for any number of observations */
+const size_t sketchMaxLevels = 64;
+
+/* Rows of the table with the levels of the sketch */
+enum SketchLevelsRow
+{
+    levelSizesRow       = 0,
+    levelCompactionsRow = 1,
+    nSketchLevelsRows   = 2
+};
+
+/* Capacity k of the top level of the sketch that gives the requested rank error */
+inline size_t getSketchTopCapacity(double accuracy)
+{
+    const double k           = 3.0 / accuracy;
+    const size_t minCapacity = 8;
+    return (k > double(minCapacity)) ? size_t(k) + 1 : minCapacity;
+}
+
+/* Capacities of the levels of the sketch that has nLevels levels */
+inline void getSketchLevelCapacities(size_t topCapacity, size_t nLevels, size_t * capacities)
+{
+    const size_t minCapacity = 2;
+    double capacity          = double(topCapacity);
+    for (size_t depth = 0; depth < nLevels; ++depth)
+    {
+        size_t levelCapacity = size_t(capacity);
+        if (double(levelCapacity) < capacity) ++levelCapacity;
+        capacities[nLevels - 1 - depth] = (levelCapacity < minCapacity) ? minCapacity : levelCapacity;
+        capacity *= 2.0 / 3.0;
+    }
+}
+
+/* Offset of the values promoted by the next compaction of the level */
+inline size_t getSketchCompactionOffset(size_t level, unsigned int nCompactions)
+{
+    DAAL_UINT64 x = (DAAL_UINT64)nCompactions * 0x9E3779B97F4A7C15ULL ^ (DAAL_UINT64)(level + 1) * 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 31;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 29;
+    return size_t(x & 1);
+}
+
+/* Maximal number of values the sketch keeps for one feature */
+inline size_t getSketchSize(size_t topCapacity)
+{
+    size_t capacities[sketchMaxLevels];
+    getSketchLevelCapacities(topCapacity, sketchMaxLevels, capacities);
+
+    size_t size = 0;
+    for (size_t i = 0; i < sketchMaxLevels; ++i) size += capacities[i];
+    return size;
+}
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
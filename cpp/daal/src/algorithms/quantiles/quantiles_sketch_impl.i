@@ -0,0 +1,360 @@
+/* file: quantiles_sketch_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the quantile sketch operations used in the online and
+//  distributed processing modes
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_IMPL_I__
+#define __QUANTILES_SKETCH_IMPL_I__
+
+#include "src/algorithms/quantiles/quantiles_sketch.h"
+#include "src/algorithms/service_sort.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+/* Number of features processed by one thread in the online and distributed modes */
+const size_t sketchFeatureBlockSize = 16;
+/* Number of observations copied at once from the rows of the input data set to the feature columns */
+const size_t sketchRowBlockSize = 256;
+
+/*
+ * Sketch of the values of one feature. It works on the items of the feature
+ * stored from the top level down to level 0 and on its own copy of the level sizes.
+ * Each operation depends on the level sizes only, so the sketches of all features
+ * that start from the same levels end up with the same levels too
+ */
+template <typename algorithmFPType, CpuType cpu>
+class Sketch
+{
+public:
+    Sketch() : _topCapacity(0), _nLevels(1), _items(nullptr), _buffer(nullptr) {}
+
+    /*
+     * Initializes the sketch
+     * \param[in] topCapacity   Capacity of the top level of the sketch
+     * \param[in] levels        Table of levels of the sketch, sketchMaxLevels values in each of nSketchLevelsRows rows
+     * \param[in] items         Values of the sketch
+     * \param[in] buffer        Buffer for the compaction that is as large as the items array
+     */
+    void init(size_t topCapacity, const int * levels, algorithmFPType * items, algorithmFPType * buffer)
+    {
+        _topCapacity = topCapacity;
+        _items       = items;
+        _buffer      = buffer;
+        _nLevels     = 1;
+        for (size_t h = 0; h < sketchMaxLevels; ++h)
+        {
+            _sizes[h]       = size_t(levels[levelSizesRow * sketchMaxLevels + h]);
+            _compactions[h] = (unsigned int)levels[levelCompactionsRow * sketchMaxLevels + h];
+            if (_sizes[h]) _nLevels = h + 1;
+        }
+        getSketchLevelCapacities(_topCapacity, _nLevels, _capacities);
+    }
+
+    /* Stores the levels of the sketch in the table of levels */
+    void getLevels(int * levels) const
+    {
+        for (size_t h = 0; h < sketchMaxLevels; ++h)
+        {
+            levels[levelSizesRow * sketchMaxLevels + h]       = int(_sizes[h]);
+            levels[levelCompactionsRow * sketchMaxLevels + h] = int(_compactions[h]);
+        }
+    }
+
+    /* Number of values kept by the sketch */
+    size_t getNumberOfItems() const { return getLevelBegin(0) + _sizes[0]; }
+
+    /* Adds n values to the sketch */
+    void insert(const algorithmFPType * values, size_t n)
+    {
+        while (n > 0)
+        {
+            const size_t nFree = _capacities[0] - _sizes[0];
+            const size_t nAdd  = (n < nFree) ? n : nFree;
+
+            algorithmFPType * level0 = _items + getNumberOfItems();
+            for (size_t i = 0; i < nAdd; ++i) level0[i] = values[i];
+
+            _sizes[0] += nAdd;
+            values += nAdd;
+            n -= nAdd;
+
+            if (_sizes[0] >= _capacities[0]) compress();
+        }
+    }
+
+    /*
+     * Merges another sketch into this one. The items array of this sketch
+     * and the buffer should be able to keep the values of both sketches
+     * \param[in] levels    Table of levels of the other sketch
+     * \param[in] items     Values of the other sketch
+     */
+    void merge(const int * levels, const algorithmFPType * items)
+    {
+        size_t nLevels = _nLevels;
+        size_t otherSizes[sketchMaxLevels];
+        for (size_t h = 0; h < sketchMaxLevels; ++h)
+        {
+            otherSizes[h] = size_t(levels[levelSizesRow * sketchMaxLevels + h]);
+            if (otherSizes[h] && h >= nLevels) nLevels = h + 1;
+        }
+
+        const algorithmFPType * level      = _items;
+        const algorithmFPType * otherLevel = items;
+        algorithmFPType * merged           = _buffer;
+        for (size_t i = 0; i < nLevels; ++i)
+        {
+            const size_t h = nLevels - 1 - i;
+            if (h > 0)
+            {
+                mergeSorted(level, _sizes[h], otherLevel, otherSizes[h], merged);
+            }
+            else
+            {
+                for (size_t j = 0; j < _sizes[h]; ++j) merged[j] = level[j];
+                for (size_t j = 0; j < otherSizes[h]; ++j) merged[_sizes[h] + j] = otherLevel[j];
+            }
+            level += _sizes[h];
+            otherLevel += otherSizes[h];
+            merged += _sizes[h] + otherSizes[h];
+
+            _sizes[h] += otherSizes[h];
+            _compactions[h] += (unsigned int)levels[levelCompactionsRow * sketchMaxLevels + h];
+        }
+
+        const size_t nItems = merged - _buffer;
+        for (size_t j = 0; j < nItems; ++j) _items[j] = _buffer[j];
+
+        _nLevels = nLevels;
+        getSketchLevelCapacities(_topCapacity, _nLevels, _capacities);
+        compress();
+    }
+
+    /*
+     * Computes the quantiles of the values added to the sketch
+     * \param[in]  nQuantileOrders  Number of quantile orders
+     * \param[in]  quantileOrders   Quantile orders from the [0, 1] range
+     * \param[out] quantiles        Quantiles
+     * \param[in]  values           Buffer for the values of the sketch
+     * \param[in]  weights          Buffer for the weights of the values of the sketch
+     */
+    void computeQuantiles(size_t nQuantileOrders, const algorithmFPType * quantileOrders, algorithmFPType * quantiles, algorithmFPType * values,
+                          size_t * weights) const
+    {
+        const size_t nItems = getNumberOfItems();
+        DAAL_ASSERT(nItems > 0);
+
+        size_t nObservations          = 0;
+        const algorithmFPType * level = _items;
+        size_t iItem                  = 0;
+        for (size_t i = 0; i < _nLevels; ++i)
+        {
+            const size_t h      = _nLevels - 1 - i;
+            const size_t weight = size_t(1) << h;
+            for (size_t j = 0; j < _sizes[h]; ++j, ++iItem)
+            {
+                values[iItem]  = level[j];
+                weights[iItem] = weight;
+            }
+            level += _sizes[h];
+            nObservations += _sizes[h] * weight;
+        }
+        daal::algorithms::internal::qSort<algorithmFPType, size_t, cpu>(nItems, values, weights);
+
+        for (size_t k = 0; k < nQuantileOrders; ++k)
+        {
+            /* Value of the rank floor(q * (n - 1)) in the sorted observations */
+            const double rank = double(quantileOrders[k]) * double(nObservations - 1);
+            size_t nLower     = 0;
+            size_t j          = 0;
+            for (; j + 1 < nItems; ++j)
+            {
+                nLower += weights[j];
+                if (double(nLower) > rank) break;
+            }
+            quantiles[k] = values[j];
+        }
+    }
+
+protected:
+    /* Offset of the level in the items array */
+    size_t getLevelBegin(size_t level) const
+    {
+        size_t begin = 0;
+        for (size_t h = level + 1; h < _nLevels; ++h) begin += _sizes[h];
+        return begin;
+    }
+
+    /* Compacts the levels that reached their capacities */
+    void compress()
+    {
+        bool isCompacted = true;
+        while (isCompacted)
+        {
+            isCompacted = false;
+            for (size_t h = 0; h < _nLevels; ++h)
+            {
+                if (_sizes[h] >= _capacities[h])
+                {
+                    compact(h);
+                    isCompacted = true;
+                }
+            }
+        }
+    }
+
+    /* Promotes every other value of the level to the next level */
+    void compact(size_t h)
+    {
+        DAAL_ASSERT(h + 1 < sketchMaxLevels);
+
+        const size_t levelBegin  = getLevelBegin(h);
+        const size_t size        = _sizes[h];
+        const size_t upperSize   = _sizes[h + 1];
+        algorithmFPType * level  = _items + levelBegin;
+        algorithmFPType * upper  = level - upperSize;
+        const size_t nLowerItems = getNumberOfItems() - levelBegin - size;
+
+        /* Level 0 is not sorted, the other levels are sorted by construction */
+        if (h == 0) daal::algorithms::internal::qSort<algorithmFPType, cpu>(size, level);
+
+        /* The smallest value of a level of odd size stays on the level */
+        const size_t nPromoted          = size / 2;
+        const size_t nLeft              = size - 2 * nPromoted;
+        const algorithmFPType * first   = level + nLeft + getSketchCompactionOffset(h, _compactions[h]);
+        const algorithmFPType leftValue = level[0];
+        ++_compactions[h];
+
+        size_t i = 0, j = 0, k = 0;
+        while (i < upperSize && j < nPromoted) _buffer[k++] = (upper[i] <= first[2 * j]) ? upper[i++] : first[2 * (j++)];
+        while (i < upperSize) _buffer[k++] = upper[i++];
+        while (j < nPromoted) _buffer[k++] = first[2 * (j++)];
+
+        for (size_t t = 0; t < k; ++t) upper[t] = _buffer[t];
+        algorithmFPType * end = upper + k;
+        if (nLeft) *(end++) = leftValue;
+
+        /* Move the lower levels to close the gap left by the dropped values */
+        const algorithmFPType * lower = level + size;
+        for (size_t t = 0; t < nLowerItems; ++t) end[t] = lower[t];
+
+        _sizes[h + 1] += nPromoted;
+        _sizes[h] = nLeft;
+        if (h + 1 == _nLevels)
+        {
+            ++_nLevels;
+            getSketchLevelCapacities(_topCapacity, _nLevels, _capacities);
+        }
+    }
+
+    static void mergeSorted(const algorithmFPType * a, size_t nA, const algorithmFPType * b, size_t nB, algorithmFPType * result)
+    {
+        size_t i = 0, j = 0, k = 0;
+        while (i < nA && j < nB) result[k++] = (a[i] <= b[j]) ? a[i++] : b[j++];
+        while (i < nA) result[k++] = a[i++];
+        while (j < nB) result[k++] = b[j++];
+    }
+
+    size_t _topCapacity;
+    size_t _nLevels;
+    size_t _sizes[sketchMaxLevels];
+    size_t _capacities[sketchMaxLevels];
+    unsigned int _compactions[sketchMaxLevels];
+    algorithmFPType * _items;
+    algorithmFPType * _buffer;
+};
+
+/*
+ * Computes the quantiles of each feature from the sketch
+ * \param[in]  levelsTable          Table of levels of the sketch
+ * \param[in]  itemsTable           Table of values of the sketch
+ * \param[in]  quantileOrdersTable  Table of quantile orders
+ * \param[out] quantilesTable       Table of quantiles
+ * \param[in]  accuracy             Accuracy parameter of the algorithm
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeSketchQuantiles(const NumericTable & levelsTable, const NumericTable & itemsTable, const NumericTable & quantileOrdersTable,
+                                        NumericTable & quantilesTable, double accuracy)
+{
+    const size_t nFeatures       = itemsTable.getNumberOfRows();
+    const size_t sketchSize      = itemsTable.getNumberOfColumns();
+    const size_t nQuantileOrders = quantileOrdersTable.getNumberOfColumns();
+    const size_t topCapacity     = getSketchTopCapacity(accuracy);
+
+    ReadRows<int, cpu> levelsBlock(const_cast<NumericTable &>(levelsTable), 0, nSketchLevelsRows);
+    DAAL_CHECK_BLOCK_STATUS(levelsBlock)
+    const int * levels = levelsBlock.get();
+
+    size_t nItems = 0;
+    for (size_t h = 0; h < sketchMaxLevels; ++h) nItems += size_t(levels[levelSizesRow * sketchMaxLevels + h]);
+    DAAL_CHECK(nItems > 0, services::ErrorIncorrectNumberOfObservations)
+
+    ReadRows<algorithmFPType, cpu> quantileOrdersBlock(const_cast<NumericTable &>(quantileOrdersTable), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(quantileOrdersBlock)
+    const algorithmFPType * quantileOrders = quantileOrdersBlock.get();
+    for (size_t k = 0; k < nQuantileOrders; ++k)
+    {
+        DAAL_CHECK(quantileOrders[k] >= algorithmFPType(0) && quantileOrders[k] <= algorithmFPType(1), services::ErrorQuantileOrderValueIsInvalid)
+    }
+
+    ReadRows<algorithmFPType, cpu> itemsBlock(const_cast<NumericTable &>(itemsTable), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(itemsBlock)
+    const algorithmFPType * items = itemsBlock.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> quantilesBlock(quantilesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(quantilesBlock)
+    algorithmFPType * quantiles = quantilesBlock.get();
+
+    daal::TlsMem<algorithmFPType, cpu> tlsValues(sketchSize);
+    daal::TlsMem<size_t, cpu> tlsWeights(sketchSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j) {
+        algorithmFPType * values = tlsValues.local();
+        size_t * weights         = tlsWeights.local();
+        DAAL_CHECK_MALLOC_THR(values && weights);
+
+        Sketch<algorithmFPType, cpu> sketch;
+        sketch.init(topCapacity, levels, const_cast<algorithmFPType *>(items + j * sketchSize), nullptr);
+        sketch.computeQuantiles(nQuantileOrders, quantileOrders, quantiles + j * nQuantileOrders, values, weights);
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
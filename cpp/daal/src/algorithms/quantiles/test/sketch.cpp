@@ -0,0 +1,236 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "daal/include/algorithms/quantiles/quantiles_batch.h"
+#include "daal/include/algorithms/quantiles/quantiles_distributed.h"
+#include "daal/include/algorithms/quantiles/quantiles_online.h"
+#include "daal/include/data_management/data/data_archive.h"
+#include "daal/include/data_management/data/homogen_numeric_table.h"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal::algorithms::quantiles::test {
+
+namespace dm = daal::data_management;
+
+class quantiles_sketch_test {
+public:
+    using float_t = double;
+
+    static constexpr std::size_t row_count = 20000;
+    static constexpr std::size_t column_count = 4;
+    static constexpr float_t accuracy = 0.01;
+
+    quantiles_sketch_test() : orders_{ 0.0, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 1.0 } {
+        std::mt19937 rng(7777);
+        std::uniform_real_distribution<float_t> uniform(-10.0, 10.0);
+        std::normal_distribution<float_t> normal(5.0, 2.0);
+        std::exponential_distribution<float_t> exponential(0.5);
+        std::uniform_int_distribution<int> discrete(0, 9);
+
+        // The features have different distributions, the last one has many ties
+        x_.resize(row_count * column_count);
+        for (std::size_t i = 0; i < row_count; i++) {
+            x_[i * column_count + 0] = uniform(rng);
+            x_[i * column_count + 1] = normal(rng);
+            x_[i * column_count + 2] = exponential(rng);
+            x_[i * column_count + 3] = float_t(discrete(rng));
+        }
+    }
+
+    std::vector<float_t> compute_batch() {
+        Batch<float_t> algorithm;
+        algorithm.parameter.quantileOrders = get_orders_table();
+        algorithm.input.set(data, get_data_table(0, row_count));
+        REQUIRE(algorithm.compute().ok());
+        return to_vector(algorithm.getResult()->get(quantiles));
+    }
+
+    /// Feeds the data to the online algorithm by chunks of chunk_row_count rows
+    std::vector<float_t> compute_online(std::size_t chunk_row_count) {
+        Online<float_t> algorithm;
+        algorithm.parameter.quantileOrders = get_orders_table();
+        algorithm.parameter.accuracy = accuracy;
+        for (std::size_t first = 0; first < row_count; first += chunk_row_count) {
+            const std::size_t count = std::min(chunk_row_count, row_count - first);
+            algorithm.input.set(data, get_data_table(first, count));
+            REQUIRE(algorithm.compute().ok());
+        }
+        REQUIRE(algorithm.finalizeCompute().ok());
+        return to_vector(algorithm.getResult()->get(quantiles));
+    }
+
+    /// Computes the partial results of the nodes that hold consecutive blocks
+    /// of rows of the data, each node feeds its block by two chunks
+    std::vector<PartialResultPtr> compute_step1(std::size_t node_count) {
+        std::vector<PartialResultPtr> partial_results;
+        const std::size_t block_row_count = row_count / node_count;
+        for (std::size_t node = 0; node < node_count; node++) {
+            const std::size_t first = node * block_row_count;
+            const std::size_t count =
+                (node + 1 == node_count) ? row_count - first : block_row_count;
+
+            Distributed<step1Local, float_t> algorithm;
+            algorithm.parameter.quantileOrders = get_orders_table();
+            algorithm.parameter.accuracy = accuracy;
+            algorithm.input.set(data, get_data_table(first, count / 2));
+            REQUIRE(algorithm.compute().ok());
+            algorithm.input.set(data, get_data_table(first + count / 2, count - count / 2));
+            REQUIRE(algorithm.compute().ok());
+            partial_results.push_back(algorithm.getPartialResult());
+        }
+        return partial_results;
+    }
+
+    std::vector<float_t> compute_step2(const std::vector<PartialResultPtr>& partial_results) {
+        Distributed<step2Master, float_t> algorithm;
+        algorithm.parameter.quantileOrders = get_orders_table();
+        algorithm.parameter.accuracy = accuracy;
+        for (const auto& partial_result : partial_results) {
+            algorithm.input.add(partialResults, partial_result);
+        }
+        REQUIRE(algorithm.compute().ok());
+        REQUIRE(algorithm.finalizeCompute().ok());
+        return to_vector(algorithm.getResult()->get(quantiles));
+    }
+
+    static PartialResultPtr round_trip(const PartialResultPtr& partial_result) {
+        dm::InputDataArchive input_archive;
+        partial_result->serialize(input_archive);
+        std::vector<daal::byte> buffer(input_archive.getSizeOfArchive());
+        input_archive.copyArchiveToArray(buffer.data(), buffer.size());
+
+        dm::OutputDataArchive output_archive(buffer.data(), buffer.size());
+        PartialResultPtr result(new PartialResult());
+        result->deserialize(output_archive);
+        return result;
+    }
+
+    /// Checks that the rank of each computed quantile differs from the rank of
+    /// the exact one by accuracy * row_count at most. A value that occurs
+    /// several times has the range of ranks, so the distance between the
+    /// ranges is checked
+    void check_rank_error(const std::vector<float_t>& computed,
+                          const std::vector<float_t>& exact) const {
+        const std::size_t order_count = orders_.size();
+        REQUIRE(computed.size() == column_count * order_count);
+        REQUIRE(exact.size() == column_count * order_count);
+
+        std::vector<float_t> column(row_count);
+        for (std::size_t j = 0; j < column_count; j++) {
+            for (std::size_t i = 0; i < row_count; i++) {
+                column[i] = x_[i * column_count + j];
+            }
+            std::sort(column.begin(), column.end());
+
+            for (std::size_t k = 0; k < order_count; k++) {
+                const float_t computed_value = computed[j * order_count + k];
+                const float_t exact_value = exact[j * order_count + k];
+                const auto computed_ranks =
+                    std::equal_range(column.begin(), column.end(), computed_value);
+                const auto exact_ranks =
+                    std::equal_range(column.begin(), column.end(), exact_value);
+
+                const auto distance = std::max({ computed_ranks.first - exact_ranks.second,
+                                                 exact_ranks.first - computed_ranks.second,
+                                                 std::ptrdiff_t(0) });
+                CAPTURE(j, orders_[k], computed_value, exact_value, distance);
+                REQUIRE(float_t(distance) <= accuracy * float_t(row_count));
+            }
+        }
+    }
+
+    static void check_tables_equal(const dm::NumericTablePtr& left,
+                                   const dm::NumericTablePtr& right) {
+        REQUIRE(left->getNumberOfRows() == right->getNumberOfRows());
+        REQUIRE(left->getNumberOfColumns() == right->getNumberOfColumns());
+        REQUIRE(to_vector(left) == to_vector(right));
+    }
+
+private:
+    dm::NumericTablePtr get_data_table(std::size_t first_row, std::size_t count) {
+        return dm::HomogenNumericTable<float_t>::create(x_.data() + first_row * column_count,
+                                                        column_count,
+                                                        count);
+    }
+
+    dm::NumericTablePtr get_orders_table() {
+        return dm::HomogenNumericTable<float_t>::create(orders_.data(), orders_.size(), 1);
+    }
+
+    static std::vector<float_t> to_vector(const dm::NumericTablePtr& table) {
+        const std::size_t row_count = table->getNumberOfRows();
+        const std::size_t column_count = table->getNumberOfColumns();
+        dm::BlockDescriptor<float_t> block;
+        table->getBlockOfRows(0, row_count, dm::readOnly, block);
+        std::vector<float_t> result(block.getBlockPtr(),
+                                    block.getBlockPtr() + row_count * column_count);
+        table->releaseBlockOfRows(block);
+        return result;
+    }
+
+    std::vector<float_t> orders_;
+    std::vector<float_t> x_;
+};
+
+TEST_M(quantiles_sketch_test,
+       "online quantiles are within the accuracy from the exact ones",
+       "[quantiles][online]") {
+    const std::size_t chunk_row_count = GENERATE(1000, 997, 20000);
+    CAPTURE(chunk_row_count);
+
+    const auto exact = this->compute_batch();
+    const auto online = this->compute_online(chunk_row_count);
+    this->check_rank_error(online, exact);
+}
+
+TEST_M(quantiles_sketch_test,
+       "distributed quantiles are within the accuracy from the exact ones",
+       "[quantiles][distributed]") {
+    const std::size_t node_count = GENERATE(1, 4, 7);
+    CAPTURE(node_count);
+
+    const auto exact = this->compute_batch();
+    const auto distributed = this->compute_step2(this->compute_step1(node_count));
+    this->check_rank_error(distributed, exact);
+}
+
+TEST_M(quantiles_sketch_test,
+       "partial results of quantiles do not change after serialization",
+       "[quantiles][distributed]") {
+    const std::size_t node_count = 4;
+
+    const auto partial_results = this->compute_step1(node_count);
+    std::vector<PartialResultPtr> deserialized_results;
+    for (const auto& partial_result : partial_results) {
+        const auto deserialized_result = round_trip(partial_result);
+        check_tables_equal(partial_result->get(sketchLevels),
+                           deserialized_result->get(sketchLevels));
+        check_tables_equal(partial_result->get(sketchItems),
+                           deserialized_result->get(sketchItems));
+        deserialized_results.push_back(deserialized_result);
+    }
+
+    const auto merged = this->compute_step2(partial_results);
+    const auto deserialized_merged = this->compute_step2(deserialized_results);
+    REQUIRE(merged == deserialized_merged);
+}
+
+} // namespace daal::algorithms::quantiles::test
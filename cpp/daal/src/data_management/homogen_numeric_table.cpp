@@ -33,10 +33,7 @@ HomogenNumericTable<DataType>::HomogenNumericTable(DictionaryIface::FeaturesEqua
 
     st |= _ddict->setAllFeatures(df);
 
-    if (memoryAllocationFlag == doAllocate)
-    {
-        st |= allocateDataMemoryImpl();
-    }
+    st |= allocateDataMemoryByFlag(memoryAllocationFlag);
 
     st |= assign<DataType>(constValue);
 }
@@ -32,6 +32,7 @@
 #include "src/services/service_defines.h"
 #include "src/externals/service_memory.h"
 #include "src/services/service_arrays.h"
+#include "src/threading/threading.h"
 
 using namespace daal::data_management;
 using namespace daal::data_management::internal;
@@ -755,6 +756,16 @@ using WritePacked = GetPacked<algorithmFPType, algorithmFPType, cpu, readWrite,
 template <typename algorithmFPType, CpuType cpu, typename NumericTableType = NumericTable>
 using WriteOnlyPacked = GetPacked<algorithmFPType, algorithmFPType, cpu, writeOnly, NumericTableType>;
 
+/* Returns true if the rows of the table are read directly from the memory placed on the NUMA nodes by daal_numa_malloc,
+   so the loops over the rows are worth splitting between the nodes in the same way */
+template <typename algorithmFPType, CpuType cpu>
+bool isNumaLocal(const NumericTable & table)
+{
+    if (threader_get_numa_node_count() < 2 || table.getNumberOfRows() == 0) return false;
+    ReadRows<algorithmFPType, cpu> firstRow(const_cast<NumericTable &>(table), 0, 1);
+    return services::internal::daal_is_numa_local(firstRow.get());
+}
+
 template <typename algorithmFPType>
 services::Status createSparseTable(const NumericTablePtr & inputTable, CSRNumericTablePtr & resTable);
 
@@ -260,6 +260,8 @@ typedef void (*_daal_threader_for_blocked_t)(int, int, const void *, daal::funct
 typedef int (*_daal_threader_get_max_threads_t)(void);
 typedef int (*_daal_threader_get_current_thread_index_t)(void);
 typedef void (*_daal_threader_for_break_t)(int, int, const void *, daal::functype_break);
+typedef int (*_daal_threader_get_numa_node_count_t)(void);
+typedef void (*_daal_threader_set_numa_node_count_t)(int);
 
 typedef int64_t (*_daal_parallel_reduce_int32_int64_t)(int32_t, int64_t, const void *, daal::loop_functype_int32_int64, const void *,
                                                        daal::reduction_functype_int64);
@@ -290,6 +292,10 @@ typedef void (*_daal_del_task_group_t)(void * taskGroupPtr);
 typedef void (*_daal_run_task_group_t)(void * taskGroupPtr, daal::task * t);
 typedef void (*_daal_wait_task_group_t)(void * taskGroupPtr);
 
+typedef void * (*_daal_new_arena_t)(int maxThreads, const int * cpus, int nCpus, int numaNode);
+typedef void (*_daal_del_arena_t)(void * arenaPtr);
+typedef void (*_daal_execute_in_arena_t)(void * arenaPtr, const void * a, daal::functype_arena func);
+
 typedef bool (*_daal_is_in_parallel_t)();
 typedef void (*_daal_tbb_task_scheduler_free_t)(void *& globalControl);
 typedef size_t (*_setNumberOfThreads_t)(const size_t, void **);
@@ -324,6 +330,10 @@ static _daal_static_threader_for_t _daal_static_threader_for_ptr
 static _daal_threader_for_blocked_t _daal_threader_for_blocked_ptr                           = NULL;
 static _daal_threader_for_t _daal_threader_for_optional_ptr                                  = NULL;
 static _daal_threader_get_max_threads_t _daal_threader_get_max_threads_ptr                   = NULL;
+static _daal_threader_get_numa_node_count_t _daal_threader_get_numa_node_count_ptr           = NULL;
+static _daal_threader_set_numa_node_count_t _daal_threader_set_numa_node_count_ptr           = NULL;
+static _daal_threader_for_t _daal_threader_for_numa_ptr                                      = NULL;
+static _daal_static_threader_for_t _daal_static_threader_for_numa_ptr                        = NULL;
 static _daal_threader_get_current_thread_index_t _daal_threader_get_current_thread_index_ptr = NULL;
 static _daal_threader_for_break_t _daal_threader_for_break_ptr                               = NULL;
 
@@ -353,6 +363,10 @@ static _daal_del_task_group_t _daal_del_task_group_ptr   = NULL;
 static _daal_run_task_group_t _daal_run_task_group_ptr   = NULL;
 static _daal_wait_task_group_t _daal_wait_task_group_ptr = NULL;
 
+static _daal_new_arena_t _daal_new_arena_ptr               = NULL;
+static _daal_del_arena_t _daal_del_arena_ptr               = NULL;
+static _daal_execute_in_arena_t _daal_execute_in_arena_ptr = NULL;
+
 static _daal_is_in_parallel_t _daal_is_in_parallel_ptr                   = NULL;
 static _daal_tbb_task_scheduler_free_t _daal_tbb_task_scheduler_free_ptr = NULL;
 static _setNumberOfThreads_t _setNumberOfThreads_ptr                     = NULL;
@@ -446,6 +460,46 @@ DAAL_EXPORT void _daal_static_threader_for(size_t n, const void * a, daal::funct
     _daal_static_threader_for_ptr(n, a, func);
 }
 
+DAAL_EXPORT int _daal_threader_get_numa_node_count()
+{
+    load_daal_thr_dll();
+    if (_daal_threader_get_numa_node_count_ptr == NULL)
+    {
+        _daal_threader_get_numa_node_count_ptr = (_daal_threader_get_numa_node_count_t)load_daal_thr_func("_daal_threader_get_numa_node_count");
+    }
+    return _daal_threader_get_numa_node_count_ptr();
+}
+
+DAAL_EXPORT void _daal_threader_set_numa_node_count(int nNodes)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_set_numa_node_count_ptr == NULL)
+    {
+        _daal_threader_set_numa_node_count_ptr = (_daal_threader_set_numa_node_count_t)load_daal_thr_func("_daal_threader_set_numa_node_count");
+    }
+    _daal_threader_set_numa_node_count_ptr(nNodes);
+}
+
+DAAL_EXPORT void _daal_threader_for_numa(int n, int threads_request, const void * a, daal::functype func)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_for_numa_ptr == NULL)
+    {
+        _daal_threader_for_numa_ptr = (_daal_threader_for_t)load_daal_thr_func("_daal_threader_for_numa");
+    }
+    _daal_threader_for_numa_ptr(n, threads_request, a, func);
+}
+
+DAAL_EXPORT void _daal_static_threader_for_numa(size_t n, const void * a, daal::functype_static func)
+{
+    load_daal_thr_dll();
+    if (_daal_static_threader_for_numa_ptr == NULL)
+    {
+        _daal_static_threader_for_numa_ptr = (_daal_static_threader_for_t)load_daal_thr_func("_daal_static_threader_for_numa");
+    }
+    _daal_static_threader_for_numa_ptr(n, a, func);
+}
+
 DAAL_EXPORT void _daal_parallel_sort_int32(int * begin_ptr, int * end_ptr)
 {
     load_daal_thr_dll();
@@ -764,6 +818,36 @@ DAAL_EXPORT void _daal_wait_task_group(void * taskGroupPtr)
     _daal_wait_task_group_ptr(taskGroupPtr);
 }
 
+DAAL_EXPORT void * _daal_new_arena(int maxThreads, const int * cpus, int nCpus, int numaNode)
+{
+    load_daal_thr_dll();
+    if (_daal_new_arena_ptr == NULL)
+    {
+        _daal_new_arena_ptr = (_daal_new_arena_t)load_daal_thr_func("_daal_new_arena");
+    }
+    return _daal_new_arena_ptr(maxThreads, cpus, nCpus, numaNode);
+}
+
+DAAL_EXPORT void _daal_del_arena(void * arenaPtr)
+{
+    load_daal_thr_dll();
+    if (_daal_del_arena_ptr == NULL)
+    {
+        _daal_del_arena_ptr = (_daal_del_arena_t)load_daal_thr_func("_daal_del_arena");
+    }
+    _daal_del_arena_ptr(arenaPtr);
+}
+
+DAAL_EXPORT void _daal_execute_in_arena(void * arenaPtr, const void * a, daal::functype_arena func)
+{
+    load_daal_thr_dll();
+    if (_daal_execute_in_arena_ptr == NULL)
+    {
+        _daal_execute_in_arena_ptr = (_daal_execute_in_arena_t)load_daal_thr_func("_daal_execute_in_arena");
+    }
+    _daal_execute_in_arena_ptr(arenaPtr, a, func);
+}
+
 DAAL_EXPORT bool _daal_is_in_parallel()
 {
     load_daal_thr_dll();
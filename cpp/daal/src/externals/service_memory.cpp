@@ -21,8 +21,12 @@
 //--
 */
 
+#include <limits.h>
+
 #include "src/externals/service_memory.h"
 #include "src/externals/service_service.h"
+#include "src/threading/threading.h"
+#include "src/algorithms/service_threading.h"
 
 void * daal::services::daal_malloc(size_t size, size_t alignment)
 {
@@ -52,6 +56,308 @@ void daal::services::daal_free(void * ptr)
     daal::internal::Service<>::serv_free(ptr);
 }
 
+namespace
+{
+/* Number of the blocks allocated with daal_numa_malloc that are not deallocated yet */
+daal::services::Atomic<int> nNumaBlocks;
+
+/* Blocks allocated with daal_numa_malloc. The loops over the rows of a table are split between
+   the NUMA nodes only if the rows are stored in one of these blocks, as other memory is not placed
+   to match the split. The blocks are registered and unregistered by daal_numa_malloc and daal_numa_free,
+   so daal_free doesn't look them up */
+class NumaBlocks
+{
+public:
+    static NumaBlocks & get()
+    {
+        static NumaBlocks numaBlocks;
+        return numaBlocks;
+    }
+
+    /* Returns false if there is not enough memory to register the block */
+    bool add(const void * ptr, size_t size)
+    {
+        daal::AutoLock lock(_mutex);
+        if (_nBlocks == _capacity)
+        {
+            const size_t capacity = _capacity ? 2 * _capacity : 16;
+            Block * blocks        = static_cast<Block *>(daal::services::daal_malloc(capacity * sizeof(Block)));
+            if (blocks == NULL) return false;
+            for (size_t i = 0; i < _nBlocks; ++i) blocks[i] = _blocks[i];
+            daal::services::daal_free(_blocks);
+            _blocks   = blocks;
+            _capacity = capacity;
+        }
+        _blocks[_nBlocks].begin = static_cast<const char *>(ptr);
+        _blocks[_nBlocks].size  = size;
+        ++_nBlocks;
+        nNumaBlocks.inc();
+        return true;
+    }
+
+    void remove(const void * ptr)
+    {
+        daal::AutoLock lock(_mutex);
+        for (size_t i = 0; i < _nBlocks; ++i)
+        {
+            if (_blocks[i].begin == ptr)
+            {
+                _blocks[i] = _blocks[--_nBlocks];
+                nNumaBlocks.dec();
+                return;
+            }
+        }
+    }
+
+    bool contains(const void * ptr)
+    {
+        daal::AutoLock lock(_mutex);
+        const char * cptr = static_cast<const char *>(ptr);
+        for (size_t i = 0; i < _nBlocks; ++i)
+        {
+            if (cptr >= _blocks[i].begin && cptr < _blocks[i].begin + _blocks[i].size) return true;
+        }
+        return false;
+    }
+
+private:
+    NumaBlocks() : _blocks(NULL), _nBlocks(0), _capacity(0) {}
+    ~NumaBlocks() { daal::services::daal_free(_blocks); }
+
+    struct Block
+    {
+        const char * begin;
+        size_t size;
+    };
+
+    daal::Mutex _mutex;
+    Block * _blocks;
+    size_t _nBlocks;
+    size_t _capacity;
+};
+
+} // namespace
+
+namespace
+{
+/* Blocks of 2^arenaMinClass to 2^arenaMaxClass bytes are cached, larger or overaligned blocks bypass the arena.
+   The cap is kept small as the arenas of the worker threads stay alive between the calls of the library */
+const size_t arenaMinClass      = 6;
+const size_t arenaMaxClass      = 20;
+const size_t arenaClassCount    = arenaMaxClass - arenaMinClass + 1;
+const size_t arenaUncachedClass = arenaClassCount;
+const size_t arenaMaxCachedSize = size_t(4) << 20;
+const size_t arenaBlockOffset   = daal::DAAL_MALLOC_DEFAULT_ALIGNMENT;
+
+/* Incremented when the outermost scope on any thread is left. The arenas of the other threads
+   release the memory they cache when they see the new value on their next call */
+daal::services::Atomic<int> arenaEpoch;
+
+/* Header stored right before the memory returned by daal_arena_malloc */
+struct ArenaBlockHeader
+{
+    void * block;            /* Memory allocated with daal_malloc */
+    ArenaBlockHeader * next; /* Next free block of the same size class */
+    size_t sizeClass;        /* Size class of the block or arenaUncachedClass */
+};
+
+inline ArenaBlockHeader * getArenaBlockHeader(void * ptr)
+{
+    return reinterpret_cast<ArenaBlockHeader *>(static_cast<char *>(ptr) - sizeof(ArenaBlockHeader));
+}
+
+inline size_t getArenaClassSize(size_t sizeClass)
+{
+    return size_t(1) << (sizeClass + arenaMinClass);
+}
+
+/* Per-thread lists of free scratch blocks grouped by size classes that are powers of two */
+class ThreadArena
+{
+public:
+    ThreadArena() : _cachedSize(0), _scopeDepth(0), _epoch(arenaEpoch.get())
+    {
+        for (size_t i = 0; i < arenaClassCount; ++i) _freeLists[i] = NULL;
+    }
+
+    ~ThreadArena();
+
+    void * allocate(size_t size, size_t alignment)
+    {
+        trim();
+        if (alignment > arenaBlockOffset || size > getArenaClassSize(arenaClassCount - 1)) return allocateUncached(size, alignment);
+
+        size_t sizeClass = 0;
+        while (getArenaClassSize(sizeClass) < size) ++sizeClass;
+
+        ArenaBlockHeader * header = _freeLists[sizeClass];
+        if (header)
+        {
+            _freeLists[sizeClass] = header->next;
+            _cachedSize -= getArenaClassSize(sizeClass);
+            return static_cast<char *>(header->block) + arenaBlockOffset;
+        }
+
+        void * block = daal::services::daal_malloc(getArenaClassSize(sizeClass) + arenaBlockOffset, arenaBlockOffset);
+        if (block == NULL) return NULL;
+
+        void * ptr        = static_cast<char *>(block) + arenaBlockOffset;
+        header            = getArenaBlockHeader(ptr);
+        header->block     = block;
+        header->next      = NULL;
+        header->sizeClass = sizeClass;
+        return ptr;
+    }
+
+    void deallocate(void * ptr)
+    {
+        trim();
+        ArenaBlockHeader * header = getArenaBlockHeader(ptr);
+        const size_t sizeClass    = header->sizeClass;
+        if (sizeClass == arenaUncachedClass || _cachedSize + getArenaClassSize(sizeClass) > arenaMaxCachedSize)
+        {
+            daal::services::daal_free(header->block);
+            return;
+        }
+        header->next          = _freeLists[sizeClass];
+        _freeLists[sizeClass] = header;
+        _cachedSize += getArenaClassSize(sizeClass);
+    }
+
+    void enterScope() { ++_scopeDepth; }
+
+    void leaveScope()
+    {
+        if (_scopeDepth > 0 && --_scopeDepth == 0)
+        {
+            release();
+            _epoch = arenaEpoch.inc();
+        }
+    }
+
+    void release()
+    {
+        for (size_t i = 0; i < arenaClassCount; ++i)
+        {
+            while (_freeLists[i])
+            {
+                ArenaBlockHeader * next = _freeLists[i]->next;
+                daal::services::daal_free(_freeLists[i]->block);
+                _freeLists[i] = next;
+            }
+        }
+        _cachedSize = 0;
+    }
+
+private:
+    /* Releases the cached memory if a scope was left on another thread since the last call */
+    void trim()
+    {
+        const int epoch = arenaEpoch.get();
+        if (epoch == _epoch) return;
+        _epoch = epoch;
+        if (_scopeDepth == 0) release();
+    }
+
+    static void * allocateUncached(size_t size, size_t alignment)
+    {
+        const size_t offset = (alignment > arenaBlockOffset) ? alignment : arenaBlockOffset;
+        if (size > size_t(-1) - offset) return NULL;
+
+        void * block = daal::services::daal_malloc(size + offset, offset);
+        if (block == NULL) return NULL;
+
+        void * ptr                = static_cast<char *>(block) + offset;
+        ArenaBlockHeader * header = getArenaBlockHeader(ptr);
+        header->block             = block;
+        header->next              = NULL;
+        header->sizeClass         = arenaUncachedClass;
+        return ptr;
+    }
+
+    ArenaBlockHeader * _freeLists[arenaClassCount];
+    size_t _cachedSize;
+    size_t _scopeDepth;
+    int _epoch;
+};
+
+/* The flag is trivially destructible, so it stays valid when the arena of an exiting thread is destroyed */
+thread_local bool isThreadArenaDestroyed = false;
+thread_local ThreadArena threadArena;
+
+ThreadArena::~ThreadArena()
+{
+    release();
+    isThreadArenaDestroyed = true;
+}
+
+} // namespace
+
+void * daal::services::internal::daal_arena_malloc(size_t size, size_t alignment)
+{
+    if (isThreadArenaDestroyed) return ThreadArena().allocate(size, alignment);
+    return threadArena.allocate(size, alignment);
+}
+
+void daal::services::internal::daal_arena_free(void * ptr)
+{
+    if (ptr == NULL) return;
+    if (isThreadArenaDestroyed)
+    {
+        daal::services::daal_free(getArenaBlockHeader(ptr)->block);
+        return;
+    }
+    threadArena.deallocate(ptr);
+}
+
+void daal::services::internal::daal_arena_enter_scope()
+{
+    if (!isThreadArenaDestroyed) threadArena.enterScope();
+}
+
+void daal::services::internal::daal_arena_leave_scope()
+{
+    if (!isThreadArenaDestroyed) threadArena.leaveScope();
+}
+
+void * daal::services::internal::daal_numa_malloc(size_t size, size_t alignment)
+{
+    void * ptr = daal::services::daal_malloc(size, alignment);
+    if (ptr == NULL)
+    {
+        return NULL;
+    }
+
+    /* The pages are placed on the NUMA node of the thread that writes them first,
+       so each page is touched by the node that processes the same part of the buffer */
+    const size_t pageSize = 4096;
+    const size_t nPages   = size / pageSize + !!(size % pageSize);
+    if (daal::threader_get_numa_node_count() > 1 && nPages <= size_t(INT_MAX))
+    {
+        char * cptr = (char *)ptr;
+        daal::threader_for_numa(int(nPages), int(nPages), true, [&](int iPage) { cptr[size_t(iPage) * pageSize] = '\0'; });
+        if (!NumaBlocks::get().add(ptr, size))
+        {
+            daal::services::daal_free(ptr);
+            return NULL;
+        }
+    }
+
+    return ptr;
+}
+
+void daal::services::internal::daal_numa_free(void * ptr)
+{
+    /* The counter keeps the lookup off the deallocations while there are no NUMA-local blocks */
+    if (ptr && nNumaBlocks.get() > 0) NumaBlocks::get().remove(ptr);
+    daal::services::daal_free(ptr);
+}
+
+bool daal::services::internal::daal_is_numa_local(const void * ptr)
+{
+    return ptr && nNumaBlocks.get() > 0 && NumaBlocks::get().contains(ptr);
+}
+
 void daal::services::daal_memmove_s(void * dest, size_t destSize, const void * src, size_t smax)
 {
     daal::internal::Service<>::serv_memmove_s(dest, destSize, src, smax);
@@ -100,6 +100,18 @@ void service_scalable_free(T * ptr)
     threaded_scalable_free(ptr);
 }
 
+template <typename T, CpuType cpu>
+T * service_arena_malloc(size_t size, size_t alignment = 64)
+{
+    return (T *)daal::services::internal::daal_arena_malloc(size * sizeof(T), alignment);
+}
+
+template <typename T, CpuType cpu>
+void service_arena_free(T * ptr)
+{
+    daal::services::internal::daal_arena_free(ptr);
+}
+
 template <typename T, CpuType cpu>
 T * service_memset(T * const ptr, const T value, const size_t num)
 {
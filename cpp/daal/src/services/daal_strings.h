@@ -70,6 +70,9 @@
     DECLARE_DAAL_STRING_CONST(cosineDistance)                    \
     DECLARE_DAAL_STRING_CONST(quantiles)                         \
     DECLARE_DAAL_STRING_CONST(quantileOrders)                    \
+    DECLARE_DAAL_STRING_CONST(sketchLevels)                      \
+    DECLARE_DAAL_STRING_CONST(sketchItems)                       \
+    DECLARE_DAAL_STRING_CONST(accuracy)                          \
     DECLARE_DAAL_STRING_CONST(covariance)                        \
     DECLARE_DAAL_STRING_CONST(correlation)                       \
     DECLARE_DAAL_STRING_CONST(mean)                              \
@@ -278,6 +281,8 @@
     DECLARE_DAAL_STRING_CONST(variableImportance)                \
     DECLARE_DAAL_STRING_CONST(gradientIdx)                       \
     DECLARE_DAAL_STRING_CONST(hessianIdx)                        \
+    DECLARE_DAAL_STRING_CONST(hessianVector)                     \
+    DECLARE_DAAL_STRING_CONST(hessianVectorProductIdx)           \
     DECLARE_DAAL_STRING_CONST(inputArgument)                     \
     DECLARE_DAAL_STRING_CONST(dependentVariables)                \
     DECLARE_DAAL_STRING_CONST(a)                                 \
@@ -320,6 +325,8 @@
     DECLARE_DAAL_STRING_CONST(minObservations)                   \
     DECLARE_DAAL_STRING_CONST(nBins)                             \
     DECLARE_DAAL_STRING_CONST(resultsToEvaluate)                 \
+    DECLARE_DAAL_STRING_CONST(shapContributions)                 \
+    DECLARE_DAAL_STRING_CONST(shapInteractions)                  \
     DECLARE_DAAL_STRING_CONST(coreIndices)                       \
     DECLARE_DAAL_STRING_CONST(coreObservations)                  \
     DECLARE_DAAL_STRING_CONST(blockIndex)                        \
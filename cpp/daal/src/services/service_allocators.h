@@ -95,6 +95,26 @@ struct ScalableCalloc
     static void deallocate(T * ptr) { service_scalable_free<T, cpu>(ptr); }
 };
 
+template <typename T, CpuType cpu>
+struct ArenaMalloc
+{
+    static T * allocate(size_t n) { return service_arena_malloc<T, cpu>(n); }
+    static void deallocate(T * ptr) { service_arena_free<T, cpu>(ptr); }
+};
+
+/* Returns the scratch memory cached by the arena of the calling thread
+ * to the system when the outermost scope on the thread ends */
+class ArenaScope
+{
+public:
+    ArenaScope() { daal::services::internal::daal_arena_enter_scope(); }
+    ~ArenaScope() { daal::services::internal::daal_arena_leave_scope(); }
+
+private:
+    ArenaScope(const ArenaScope &);
+    ArenaScope & operator=(const ArenaScope &);
+};
+
 /* CPU specific deleters */
 
 template <typename T, CpuType cpu>
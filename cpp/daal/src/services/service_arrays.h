@@ -116,6 +116,10 @@ using TArrayScalable = DynamicArray<T, ScalableMalloc<T, cpu>, ConstructionPolic
 template <typename T, CpuType cpu, typename ConstructionPolicy = DefaultConstructionPolicy<T, cpu> >
 using TArrayScalableCalloc = DynamicArray<T, ScalableCalloc<T, cpu>, ConstructionPolicy, cpu>;
 
+/* Scratch array that reuses the memory cached by the arena of the calling thread */
+template <typename T, CpuType cpu, typename ConstructionPolicy = DefaultConstructionPolicy<T, cpu> >
+using TArrayArena = DynamicArray<T, ArenaMalloc<T, cpu>, ConstructionPolicy, cpu>;
+
 template <typename T, size_t staticBufferSize, typename Allocator, typename ConstructionPolicy, CpuType cpu>
 class StaticallyBufferedDynamicArray
 {
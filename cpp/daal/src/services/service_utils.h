@@ -200,6 +200,30 @@ inline float infToBigValue(float arg)
     }
 }
 
+/* Checks if the argument is NaN. The bits are tested instead of self-comparison
+   as the latter can be optimized out under relaxed floating-point models */
+template <CpuType cpu>
+inline bool isNaN(double arg)
+{
+    union
+    {
+        double fp;
+        uint64_t bits;
+    } value = { arg };
+    return (value.bits & 0x7fffffffffffffffULL) > 0x7ff0000000000000ULL;
+}
+
+template <CpuType cpu>
+inline bool isNaN(float arg)
+{
+    union
+    {
+        float fp;
+        uint32_t bits;
+    } value = { arg };
+    return (value.bits & 0x7fffffffU) > 0x7f800000U;
+}
+
 template <CpuType cpu, typename T>
 inline const T & min(const T & a, const T & b)
 {
@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <vector>
+
+#include "daal/include/services/daal_memory.h"
+#include "daal/src/threading/threading.h"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace daal::test {
+
+/* Replaces the NUMA nodes of the system by unpinned ones for the lifetime of the object */
+class fake_numa_nodes {
+public:
+    explicit fake_numa_nodes(int node_count) {
+        threader_set_numa_node_count(node_count);
+    }
+    ~fake_numa_nodes() {
+        threader_set_numa_node_count(0);
+    }
+};
+
+TEST("threader_for_numa runs every iteration once", "[threading][numa]") {
+    const int node_count = GENERATE(2, 3);
+    const int n = GENERATE(2, 7, 1000);
+    CAPTURE(node_count, n);
+
+    fake_numa_nodes nodes{ node_count };
+    REQUIRE(threader_get_numa_node_count() == node_count);
+
+    std::vector<std::atomic<int>> counts(n);
+    threader_for_numa(n, n, true, [&](int i) {
+        counts[i]++;
+    });
+
+    for (int i = 0; i < n; i++) {
+        REQUIRE(counts[i].load() == 1);
+    }
+}
+
+TEST("static_threader_for_numa runs every iteration once with valid thread indices",
+     "[threading][numa]") {
+    const int node_count = GENERATE(2, 3);
+    const std::size_t n = GENERATE(2, 7, 1000);
+    CAPTURE(node_count, n);
+
+    fake_numa_nodes nodes{ node_count };
+
+    const std::size_t max_threads = threader_get_max_threads_number();
+    std::vector<std::atomic<int>> counts(n);
+    std::atomic<bool> valid_tids{ true };
+    static_threader_for_numa(n, true, [&](std::size_t i, std::size_t tid) {
+        counts[i]++;
+        if (tid >= max_threads) {
+            valid_tids = false;
+        }
+    });
+
+    REQUIRE(valid_tids.load());
+    for (std::size_t i = 0; i < n; i++) {
+        REQUIRE(counts[i].load() == 1);
+    }
+}
+
+TEST("only the memory placed on several NUMA nodes is NUMA-local", "[threading][numa]") {
+    const std::size_t size = 1 << 20;
+    {
+        fake_numa_nodes nodes{ 2 };
+
+        char* numa_ptr = static_cast<char*>(services::internal::daal_numa_malloc(size));
+        char* ptr = static_cast<char*>(services::daal_malloc(size));
+        REQUIRE(numa_ptr != nullptr);
+        REQUIRE(ptr != nullptr);
+
+        REQUIRE(services::internal::daal_is_numa_local(numa_ptr));
+        REQUIRE(services::internal::daal_is_numa_local(numa_ptr + size - 1));
+        REQUIRE_FALSE(services::internal::daal_is_numa_local(ptr));
+
+        services::internal::daal_numa_free(numa_ptr);
+        services::daal_free(ptr);
+        REQUIRE_FALSE(services::internal::daal_is_numa_local(numa_ptr));
+    }
+
+    fake_numa_nodes single_node{ 1 };
+    void* numa_ptr = services::internal::daal_numa_malloc(size);
+    REQUIRE(numa_ptr != nullptr);
+    REQUIRE_FALSE(services::internal::daal_is_numa_local(numa_ptr));
+    services::internal::daal_numa_free(numa_ptr);
+}
+
+TEST("any number of blocks placed on several NUMA nodes is NUMA-local", "[threading][numa]") {
+    const std::size_t size = 1 << 14;
+    const std::size_t block_count = 1000;
+    fake_numa_nodes nodes{ 2 };
+
+    std::vector<void*> blocks(block_count);
+    for (auto& block : blocks) {
+        block = services::internal::daal_numa_malloc(size);
+        REQUIRE(block != nullptr);
+    }
+    for (auto block : blocks) {
+        REQUIRE(services::internal::daal_is_numa_local(block));
+    }
+
+    for (auto block : blocks) {
+        services::internal::daal_numa_free(block);
+    }
+    for (auto block : blocks) {
+        REQUIRE_FALSE(services::internal::daal_is_numa_local(block));
+    }
+}
+
+} // namespace daal::test
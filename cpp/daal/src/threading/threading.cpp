@@ -27,6 +27,7 @@
 #if defined(__DO_TBB_LAYER__)
     #define TBB_PREVIEW_GLOBAL_CONTROL 1
     #define TBB_PREVIEW_TASK_ARENA     1
+    #define TBB_PREVIEW_LOCAL_OBSERVER 1
 
     #include <stdlib.h> // malloc and free
     #include <tbb/tbb.h>
@@ -34,8 +35,16 @@
     #include <tbb/scalable_allocator.h>
     #include <tbb/global_control.h>
     #include <tbb/task_arena.h>
+    #include <tbb/task_scheduler_observer.h>
+    #include <tbb/enumerable_thread_specific.h>
     #include "services/daal_atomic_int.h"
 
+    #if defined(__linux__)
+        #include <sched.h>
+        #include <pthread.h>
+        #include <stdio.h>
+    #endif
+
     #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
         #include <tbb/task.h>
     #endif
@@ -814,6 +823,349 @@ DAAL_EXPORT void _daal_wait_task_group(void * taskGroupPtr)
     ((tbb::task_group *)taskGroupPtr)->wait();
 }
 
+    #if defined(__linux__)
+/* Reads the list of indices like 0-3,8,10-11 from the sysfs file. Returns the number of indices read */
+static int readIndexList(const char * path, int * indices, int maxIndices)
+{
+    FILE * file = fopen(path, "r");
+    if (!file) return 0;
+
+    int nIndices = 0;
+    int first    = 0;
+    while (fscanf(file, "%d", &first) == 1)
+    {
+        int last      = first;
+        int separator = fgetc(file);
+        if (separator == '-')
+        {
+            if (fscanf(file, "%d", &last) != 1) break;
+            separator = fgetc(file);
+        }
+        for (int index = first; index <= last && nIndices < maxIndices; ++index) indices[nIndices++] = index;
+        if (separator != ',') break;
+    }
+    fclose(file);
+    return nIndices;
+}
+
+/* Adds the CPUs of the NUMA node to the set. Returns false if the node has no CPUs */
+static bool addNumaNodeCpus(int numaNode, cpu_set_t & cpuSet)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", numaNode);
+
+    int cpus[CPU_SETSIZE];
+    const int nCpus = readIndexList(path, cpus, CPU_SETSIZE);
+    for (int i = 0; i < nCpus; ++i)
+    {
+        if (cpus[i] < CPU_SETSIZE) CPU_SET(cpus[i], &cpuSet);
+    }
+    return nCpus > 0;
+}
+
+/* Pins the threads that join the arena to the set of CPUs and restores their affinity when they leave it */
+class ArenaPinner : public tbb::task_scheduler_observer
+{
+public:
+    ArenaPinner(tbb::task_arena & arena, const cpu_set_t & cpuSet) : tbb::task_scheduler_observer(arena), _cpuSet(cpuSet) { observe(true); }
+
+    ~ArenaPinner() { observe(false); }
+
+    void on_scheduler_entry(bool) DAAL_C11_OVERRIDE
+    {
+        ThreadAffinity & affinity = _savedAffinity.local();
+        affinity.isSaved          = !pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &affinity.cpuSet);
+        if (affinity.isSaved) pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &_cpuSet);
+    }
+
+    void on_scheduler_exit(bool) DAAL_C11_OVERRIDE
+    {
+        ThreadAffinity & affinity = _savedAffinity.local();
+        if (affinity.isSaved) pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &affinity.cpuSet);
+        affinity.isSaved = false;
+    }
+
+private:
+    struct ThreadAffinity
+    {
+        ThreadAffinity() : isSaved(false) {}
+        cpu_set_t cpuSet;
+        bool isSaved;
+    };
+
+    cpu_set_t _cpuSet;
+    tbb::enumerable_thread_specific<ThreadAffinity> _savedAffinity;
+};
+    #endif
+
+/* Task arena with a limited number of threads that are pinned to the requested CPUs */
+class PlacedArena
+{
+public:
+    PlacedArena(int maxThreads, const int * cpus, int nCpus, int numaNode)
+    {
+        int nPlacementCpus = 0;
+    #if defined(__linux__)
+        _pinner = nullptr;
+
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (int i = 0; i < nCpus; ++i)
+        {
+            if (cpus[i] >= 0 && cpus[i] < CPU_SETSIZE) CPU_SET(cpus[i], &cpuSet);
+        }
+
+        cpu_set_t nodeCpuSet;
+        CPU_ZERO(&nodeCpuSet);
+        if (numaNode >= 0 && addNumaNodeCpus(numaNode, nodeCpuSet))
+        {
+            if (nCpus > 0)
+            {
+                CPU_AND(&cpuSet, &cpuSet, &nodeCpuSet);
+            }
+            else
+            {
+                cpuSet = nodeCpuSet;
+            }
+        }
+        nPlacementCpus = CPU_COUNT(&cpuSet);
+    #endif
+
+        if (maxThreads > 0)
+        {
+            _arena.initialize(maxThreads);
+        }
+        else if (nPlacementCpus > 0)
+        {
+            _arena.initialize(nPlacementCpus);
+        }
+        else
+        {
+            _arena.initialize();
+        }
+
+    #if defined(__linux__)
+        /* The memory first touched by the pinned threads is placed on their NUMA node */
+        if (nPlacementCpus > 0) _pinner = new ArenaPinner(_arena, cpuSet);
+    #endif
+    }
+
+    ~PlacedArena()
+    {
+    #if defined(__linux__)
+        delete _pinner;
+    #endif
+    }
+
+    template <typename F>
+    void execute(const F & lambda)
+    {
+        _arena.execute([&]() {
+            const bool wasInPlacedArena = isInPlacedArena;
+            isInPlacedArena             = true;
+            lambda();
+            isInPlacedArena = wasInPlacedArena;
+        });
+    }
+
+    /* Set for the thread that runs the computations in a placed arena, so that they are not moved to other CPUs */
+    static thread_local bool isInPlacedArena;
+
+private:
+    tbb::task_arena _arena;
+    #if defined(__linux__)
+    ArenaPinner * _pinner;
+    #endif
+};
+
+thread_local bool PlacedArena::isInPlacedArena = false;
+
+/* Arenas pinned to the NUMA nodes that have CPUs */
+class NumaArenas
+{
+public:
+    static NumaArenas & get()
+    {
+        static NumaArenas numaArenas;
+        return numaArenas;
+    }
+
+    int getNumberOfNodes() const { return _nNodes; }
+
+    PlacedArena & getArena(int iNode) { return *_arenas[iNode]; }
+
+    ~NumaArenas() { clear(); }
+
+    /* Replaces the nodes of the system by nFakeNodes nodes with arenas that are not pinned, zero restores them */
+    void reset(int nFakeNodes)
+    {
+        clear();
+        if (nFakeNodes > 0)
+        {
+            _nNodes = nFakeNodes < maxNodes ? nFakeNodes : maxNodes;
+            for (int i = 0; i < _nNodes; ++i) _arenas[i] = new PlacedArena(0, nullptr, 0, -1);
+        }
+        else
+        {
+            detect();
+        }
+    }
+
+private:
+    NumaArenas() : _nNodes(1)
+    {
+        _arenas[0] = nullptr;
+        detect();
+    }
+
+    void detect()
+    {
+    #if defined(__linux__)
+        int nodes[maxNodes];
+        const int nOnlineNodes = readIndexList("/sys/devices/system/node/online", nodes, maxNodes);
+
+        int nNodes = 0;
+        for (int i = 0; i < nOnlineNodes; ++i)
+        {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            if (addNumaNodeCpus(nodes[i], cpuSet)) nodes[nNodes++] = nodes[i];
+        }
+
+        if (nNodes > 1)
+        {
+            for (int i = 0; i < nNodes; ++i) _arenas[i] = new PlacedArena(0, nullptr, 0, nodes[i]);
+            _nNodes = nNodes;
+        }
+    #endif
+    }
+
+    void clear()
+    {
+        for (int i = 0; i < _nNodes; ++i) delete _arenas[i];
+        _nNodes    = 1;
+        _arenas[0] = nullptr;
+    }
+
+    static const int maxNodes = 64;
+    int _nNodes;
+    PlacedArena * _arenas[maxNodes];
+};
+
+/* Returns true if the loop is split between the NUMA nodes */
+static bool isNumaSplitUseful(size_t n)
+{
+    const int nNodes = NumaArenas::get().getNumberOfNodes();
+    return nNodes > 1 && n >= size_t(nNodes) && !PlacedArena::isInPlacedArena && !_daal_is_in_parallel();
+}
+
+DAAL_EXPORT int _daal_threader_get_numa_node_count()
+{
+    return NumaArenas::get().getNumberOfNodes();
+}
+
+DAAL_EXPORT void _daal_threader_set_numa_node_count(int nNodes)
+{
+    NumaArenas::get().reset(nNodes);
+}
+
+DAAL_EXPORT void _daal_threader_for_numa(int n, int threads_request, const void * a, daal::functype func)
+{
+    if (n <= 0) return;
+    if (!isNumaSplitUseful(n))
+    {
+        _daal_threader_for(n, threads_request, a, func);
+        return;
+    }
+
+    NumaArenas & numaArenas = NumaArenas::get();
+    const int nNodes        = numaArenas.getNumberOfNodes();
+    tbb::parallel_for(
+        tbb::blocked_range<int>(0, nNodes, 1),
+        [&](tbb::blocked_range<int> r) {
+            const int iNode = r.begin();
+            size_t begin = 0, end = 0;
+            daal::threader_get_numa_range(n, iNode, nNodes, begin, end);
+
+            numaArenas.getArena(iNode).execute([&]() {
+                tbb::parallel_for(tbb::blocked_range<int>(int(begin), int(end), 1), [&](tbb::blocked_range<int> nodeRange) {
+                    for (int i = nodeRange.begin(); i < nodeRange.end(); i++)
+                    {
+                        func(i, a);
+                    }
+                });
+            });
+        },
+        tbb::simple_partitioner());
+}
+
+DAAL_EXPORT void _daal_static_threader_for_numa(size_t n, const void * a, daal::functype_static func)
+{
+    const size_t nthreads = _daal_threader_get_max_threads();
+    if (!isNumaSplitUseful(n) || nthreads < size_t(NumaArenas::get().getNumberOfNodes()))
+    {
+        _daal_static_threader_for(n, a, func);
+        return;
+    }
+
+    /* The thread indices are split between the nodes as the iterations, so that they stay below nthreads */
+    NumaArenas & numaArenas = NumaArenas::get();
+    const int nNodes        = numaArenas.getNumberOfNodes();
+    tbb::parallel_for(
+        tbb::blocked_range<int>(0, nNodes, 1),
+        [&](tbb::blocked_range<int> r) {
+            const int iNode = r.begin();
+            size_t begin = 0, end = 0, firstTid = 0, lastTid = 0;
+            daal::threader_get_numa_range(n, iNode, nNodes, begin, end);
+            daal::threader_get_numa_range(nthreads, iNode, nNodes, firstTid, lastTid);
+
+            const size_t nNodeThreads       = lastTid - firstTid;
+            const size_t nblocks_per_thread = (end - begin) / nNodeThreads + !!((end - begin) % nNodeThreads);
+
+            numaArenas.getArena(iNode).execute([&]() {
+                tbb::parallel_for(
+                    tbb::blocked_range<size_t>(0, nNodeThreads, 1),
+                    [&](tbb::blocked_range<size_t> threadRange) {
+                        /* The node may have fewer CPUs than thread indices, so a range may hold several of them */
+                        for (size_t iThread = threadRange.begin(); iThread < threadRange.end(); ++iThread)
+                        {
+                            const size_t blockBegin = begin + iThread * nblocks_per_thread;
+                            const size_t blockEnd   = end < blockBegin + nblocks_per_thread ? end : blockBegin + nblocks_per_thread;
+
+                            for (size_t i = blockBegin; i < blockEnd; ++i)
+                            {
+                                func(i, firstTid + iThread, a);
+                            }
+                        }
+                    },
+                    tbb::static_partitioner());
+            });
+        },
+        tbb::simple_partitioner());
+}
+
+DAAL_EXPORT void * _daal_new_arena(int maxThreads, const int * cpus, int nCpus, int numaNode)
+{
+    return new PlacedArena(maxThreads, cpus, nCpus, numaNode);
+}
+
+DAAL_EXPORT void _daal_del_arena(void * arenaPtr)
+{
+    delete (PlacedArena *)arenaPtr;
+}
+
+DAAL_EXPORT void _daal_execute_in_arena(void * arenaPtr, const void * a, daal::functype_arena func)
+{
+    if (arenaPtr)
+    {
+        ((PlacedArena *)arenaPtr)->execute([&]() { func(a); });
+    }
+    else
+    {
+        func(a);
+    }
+}
+
 #else
 DAAL_EXPORT void * _daal_get_ls_ptr(void * a, daal::tls_functype func)
 {
@@ -845,6 +1197,35 @@ DAAL_EXPORT void _daal_run_task_group(void * taskGroupPtr, daal::task * task) {}
 
 DAAL_EXPORT void _daal_wait_task_group(void * taskGroupPtr) {}
 
+DAAL_EXPORT void * _daal_new_arena(int maxThreads, const int * cpus, int nCpus, int numaNode)
+{
+    return nullptr;
+}
+
+DAAL_EXPORT void _daal_del_arena(void * arenaPtr) {}
+
+DAAL_EXPORT void _daal_execute_in_arena(void * arenaPtr, const void * a, daal::functype_arena func)
+{
+    func(a);
+}
+
+DAAL_EXPORT int _daal_threader_get_numa_node_count()
+{
+    return 1;
+}
+
+DAAL_EXPORT void _daal_threader_set_numa_node_count(int nNodes) {}
+
+DAAL_EXPORT void _daal_threader_for_numa(int n, int threads_request, const void * a, daal::functype func)
+{
+    _daal_threader_for(n, threads_request, a, func);
+}
+
+DAAL_EXPORT void _daal_static_threader_for_numa(size_t n, const void * a, daal::functype_static func)
+{
+    _daal_static_threader_for(n, a, func);
+}
+
 #endif
 
 namespace daal
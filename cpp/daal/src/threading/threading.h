@@ -47,6 +47,7 @@ typedef void (*functype2)(int i, int n, const void * a);
 typedef void * (*tls_functype)(const void * a);
 typedef void (*tls_reduce_functype)(void * p, const void * a);
 typedef void (*functype_break)(int i, bool & needBreak, const void * a);
+typedef void (*functype_arena)(const void * a);
 typedef int64_t (*loop_functype_int32_int64)(int32_t start_idx_reduce, int32_t end_idx_reduce, int64_t value_for_reduce, const void * a);
 typedef int64_t (*loop_functype_int32ptr_int64)(const int32_t * start_idx_reduce, const int32_t * end_idx_reduce, int64_t value_for_reduce,
                                                 const void * a);
@@ -67,6 +68,10 @@ extern "C"
     DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const void * a, daal::functype2 func);
     DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const void * a, daal::functype func);
     DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void * a, daal::functype_break func);
+    DAAL_EXPORT int _daal_threader_get_numa_node_count();
+    DAAL_EXPORT void _daal_threader_set_numa_node_count(int nNodes);
+    DAAL_EXPORT void _daal_threader_for_numa(int n, int threads_request, const void * a, daal::functype func);
+    DAAL_EXPORT void _daal_static_threader_for_numa(size_t n, const void * a, daal::functype_static func);
 
     DAAL_EXPORT int64_t _daal_parallel_reduce_int32_int64(int32_t n, int64_t init, const void * a, daal::loop_functype_int32_int64 loop_func,
                                                           const void * b, daal::reduction_functype_int64 reduction_func);
@@ -99,6 +104,10 @@ extern "C"
     DAAL_EXPORT void _daal_run_task_group(void * taskGroupPtr, daal::task * t);
     DAAL_EXPORT void _daal_wait_task_group(void * taskGroupPtr);
 
+    DAAL_EXPORT void * _daal_new_arena(int maxThreads, const int * cpus, int nCpus, int numaNode);
+    DAAL_EXPORT void _daal_del_arena(void * arenaPtr);
+    DAAL_EXPORT void _daal_execute_in_arena(void * arenaPtr, const void * a, daal::functype_arena func);
+
     DAAL_EXPORT void _daal_tbb_task_scheduler_free(void *& globalControl);
     DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void ** globalControl);
 
@@ -150,6 +159,27 @@ inline int threader_get_max_current_thread_index()
     return _daal_threader_get_current_thread_index();
 }
 
+/* Number of NUMA nodes the loops of threader_for_numa are split between */
+inline int threader_get_numa_node_count()
+{
+    return _daal_threader_get_numa_node_count();
+}
+
+/* Replaces the NUMA nodes of the system by nNodes nodes whose arenas are not pinned, so that the split loops
+   can be tested on any machine. Zero restores the nodes of the system. Must not be called concurrently with the loops */
+inline void threader_set_numa_node_count(int nNodes)
+{
+    _daal_threader_set_numa_node_count(nNodes);
+}
+
+/* Static affinity of the iterations of threader_for_numa and static_threader_for_numa to the NUMA nodes:
+   the node iNode of nNodes processes the contiguous range [begin, end) of the n iterations */
+inline void threader_get_numa_range(size_t n, size_t iNode, size_t nNodes, size_t & begin, size_t & end)
+{
+    begin = n * iNode / nNodes;
+    end   = n * (iNode + 1) / nNodes;
+}
+
 inline void * threaded_scalable_malloc(const size_t size, const size_t alignment)
 {
     return _threaded_scalable_malloc(size, alignment);
@@ -178,7 +208,10 @@ inline ThreaderEnvironment * threader_env()
 
 inline size_t threader_get_threads_number()
 {
-    return threader_env()->getNumberOfThreads();
+    /* Inside of a task arena the number of threads is limited by the arena */
+    const size_t nThreads   = threader_env()->getNumberOfThreads();
+    const int nArenaThreads = _daal_threader_get_max_threads();
+    return (nArenaThreads > 0 && size_t(nArenaThreads) < nThreads) ? size_t(nArenaThreads) : nThreads;
 }
 
 inline size_t setNumberOfThreads(const size_t numThreads, void ** globalControl)
@@ -254,6 +287,41 @@ inline void static_threader_for(size_t n, const F & lambda)
     _daal_static_threader_for(n, a, static_threader_func<F>);
 }
 
+/* Same as threader_for, but if bNumaSplit is set, the iterations are split between the NUMA nodes
+   as threader_get_numa_range tells, and each range is processed by the threads pinned to its node.
+   The split only pays off for the data placed on the nodes in the same way, see daal_is_numa_local */
+template <typename F>
+inline void threader_for_numa(int n, int threads_request, bool bNumaSplit, const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    if (bNumaSplit)
+    {
+        _daal_threader_for_numa(n, threads_request, a, threader_func<F>);
+    }
+    else
+    {
+        _daal_threader_for(n, threads_request, a, threader_func<F>);
+    }
+}
+
+/* Same as static_threader_for, but if bNumaSplit is set, the iterations are split between the NUMA nodes
+   as threader_get_numa_range tells */
+template <typename F>
+inline void static_threader_for_numa(size_t n, bool bNumaSplit, const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    if (bNumaSplit)
+    {
+        _daal_static_threader_for_numa(n, a, static_threader_func<F>);
+    }
+    else
+    {
+        _daal_static_threader_for(n, a, static_threader_func<F>);
+    }
+}
+
 template <typename F>
 inline void threader_for_blocked(int n, int threads_request, const F & lambda)
 {
@@ -278,6 +346,23 @@ inline void threader_for_break(int n, int threads_request, const F & lambda)
     _daal_threader_for_break(n, threads_request, a, threader_func_break<F>);
 }
 
+template <typename F>
+inline void threader_func_arena(const void * a)
+{
+    const F & lambda = *static_cast<const F *>(a);
+    lambda();
+}
+
+/* Runs the lambda in the task arena created by _daal_new_arena, so that the parallel
+   loops called from it use the threads of the arena only */
+template <typename F>
+inline void threader_execute_in_arena(void * arenaPtr, const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_execute_in_arena(arenaPtr, a, threader_func_arena<F>);
+}
+
 template <typename lambdaType>
 inline void * tls_func(const void * a)
 {
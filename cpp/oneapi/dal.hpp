@@ -42,6 +42,8 @@
 #include "oneapi/dal/io/load_graph.hpp"
 
 /* Algos */
+#include "oneapi/dal/algo/chebyshev_distance.hpp"
+#include "oneapi/dal/algo/cosine_distance.hpp"
 #include "oneapi/dal/algo/decision_forest.hpp"
 #include "oneapi/dal/algo/jaccard.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism.hpp"
@@ -49,6 +51,7 @@
 #include "oneapi/dal/algo/kmeans_init.hpp"
 #include "oneapi/dal/algo/knn.hpp"
 #include "oneapi/dal/algo/linear_kernel.hpp"
+#include "oneapi/dal/algo/minkowski_distance.hpp"
 #include "oneapi/dal/algo/pca.hpp"
 #include "oneapi/dal/algo/polynomial_kernel.hpp"
 #include "oneapi/dal/algo/sigmoid_kernel.hpp"
@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "oneapi/dal/algo/chebyshev_distance/compute.hpp"
+
+#include "oneapi/dal/test/engine/fixtures.hpp"
+#include "oneapi/dal/test/engine/math.hpp"
+
+namespace oneapi::dal::chebyshev_distance::test {
+
+namespace te = dal::test::engine;
+namespace la = te::linalg;
+
+template <typename TestType>
+class chebyshev_distance_batch_test
+        : public te::float_algo_fixture<std::tuple_element_t<0, TestType>> {
+public:
+    using Float = std::tuple_element_t<0, TestType>;
+    using Method = std::tuple_element_t<1, TestType>;
+
+    bool not_available_on_device() {
+        return this->get_policy().is_gpu();
+    }
+
+    auto get_descriptor() const {
+        return chebyshev_distance::descriptor<Float, Method>{};
+    }
+
+    void general_checks(const te::dataframe& x_data, const te::dataframe& y_data) {
+        const table x = x_data.get_table(this->get_policy(), this->get_homogen_table_id());
+        const table y = y_data.get_table(this->get_policy(), this->get_homogen_table_id());
+
+        INFO("create descriptor")
+        const auto chebyshev_distance_desc = get_descriptor();
+
+        INFO("run compute");
+        const auto compute_result = this->compute(chebyshev_distance_desc, x, y);
+        const auto result_values = compute_result.get_values();
+
+        INFO("check if result values table shape is expected")
+        REQUIRE(result_values.get_row_count() == x.get_row_count());
+        REQUIRE(result_values.get_column_count() == y.get_row_count());
+
+        INFO("check if there is no NaN in result values table")
+        REQUIRE(te::has_no_nans(result_values));
+
+        INFO("check if result values are expected")
+        const auto reference = compute_reference(x, y);
+        const double tol = te::get_tolerance<Float>(3e-4, 1e-9);
+        const double diff = te::abs_error(reference, result_values);
+        CHECK(diff < tol);
+    }
+
+    la::matrix<double> compute_reference(const table& x_data, const table& y_data) {
+        const auto x = la::matrix<double>::wrap(x_data);
+        const auto y = la::matrix<double>::wrap(y_data);
+        const std::int64_t column_count = x.get_column_count();
+
+        auto reference = la::matrix<double>::empty({ x.get_row_count(), y.get_row_count() });
+        for (std::int64_t i = 0; i < x.get_row_count(); i++) {
+            for (std::int64_t j = 0; j < y.get_row_count(); j++) {
+                double max_diff = 0.0;
+                for (std::int64_t k = 0; k < column_count; k++) {
+                    max_diff = std::max(max_diff, std::abs(x.get(i, k) - y.get(j, k)));
+                }
+                reference.set(i, j) = max_diff;
+            }
+        }
+        return reference;
+    }
+};
+
+using chebyshev_distance_types =
+    COMBINE_TYPES((float, double), (chebyshev_distance::method::dense));
+
+TEMPLATE_LIST_TEST_M(chebyshev_distance_batch_test,
+                     "chebyshev_distance common flow",
+                     "[chebyshev_distance][integration][batch]",
+                     chebyshev_distance_types) {
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(this->not_available_on_device());
+
+    const std::int64_t column_count = GENERATE(1, 50, 300);
+
+    const te::dataframe x_data =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 1, column_count }.fill_normal(0, 1, 7777),
+                           te::dataframe_builder{ 100, column_count }.fill_normal(0, 1, 7777),
+                           te::dataframe_builder{ 250, column_count }.fill_normal(0, 1, 7777));
+
+    const te::dataframe y_data =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 1, column_count }.fill_normal(0, 1, 8888),
+                           te::dataframe_builder{ 200, column_count }.fill_normal(0, 1, 8888),
+                           te::dataframe_builder{ 1000, column_count }.fill_normal(0, 1, 8888));
+
+    this->general_checks(x_data, y_data);
+}
+
+} // namespace oneapi::dal::chebyshev_distance::test
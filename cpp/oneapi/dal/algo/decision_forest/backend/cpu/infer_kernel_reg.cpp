@@ -41,6 +41,10 @@ template <typename Float, daal::CpuType Cpu>
 using reg_dense_predict_kernel_t =
     daal_df_reg_pred::internal::PredictKernel<Float, daal_df_reg_pred::defaultDense, Cpu>;
 
+template <typename Float, daal::CpuType Cpu>
+using reg_dense_predict_shap_kernel_t =
+    daal_df_reg_pred::internal::PredictShapKernel<Float, daal_df_reg_pred::defaultDense, Cpu>;
+
 static daal_df::regression::ModelPtr get_daal_model(const model_t& trained_model) {
     const model_interop* interop_model = dal::detail::get_impl(trained_model).get_interop();
     if (!interop_model) {
@@ -77,8 +81,34 @@ static result_t call_daal_kernel(const context_cpu& ctx,
         daal_model_ptr,
         daal_responses_res.get()));
 
-    return result_t{}.set_responses(
+    auto result = result_t{}.set_responses(
         interop::convert_from_daal_homogen_table<Float>(daal_responses_res));
+
+    const std::int64_t shap_column_count = data.get_column_count() + 1;
+    const auto compute_shap = [&](bool interactions) {
+        const std::int64_t column_count =
+            interactions ? shap_column_count * shap_column_count : shap_column_count;
+        const auto daal_shap_res =
+            interop::allocate_daal_homogen_table<Float>(row_count, column_count);
+        interop::status_to_exception(
+            interop::call_daal_kernel<Float, reg_dense_predict_shap_kernel_t>(
+                ctx,
+                daal::services::internal::hostApp(daal_input),
+                daal_data.get(),
+                daal_model_ptr,
+                daal_shap_res.get(),
+                interactions));
+        return interop::convert_from_daal_homogen_table<Float>(daal_shap_res);
+    };
+
+    if (check_mask_flag(desc.get_infer_mode(), infer_mode::shap_contributions)) {
+        result.set_shap_contributions(compute_shap(false));
+    }
+    if (check_mask_flag(desc.get_infer_mode(), infer_mode::shap_interactions)) {
+        result.set_shap_interactions(compute_shap(true));
+    }
+
+    return result;
 }
 
 template <typename Float>
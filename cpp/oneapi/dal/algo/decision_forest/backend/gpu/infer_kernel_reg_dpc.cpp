@@ -16,6 +16,7 @@
 
 #include "oneapi/dal/algo/decision_forest/backend/gpu/infer_kernel.hpp"
 #include "oneapi/dal/algo/decision_forest/backend/gpu/infer_kernel_impl.hpp"
+#include "oneapi/dal/exceptions.hpp"
 
 namespace oneapi::dal::decision_forest::backend {
 
@@ -30,6 +31,12 @@ static result_t call_daal_kernel(const context_gpu& ctx,
                                  const descriptor_t& desc,
                                  const model_t& trained_model,
                                  const table& data) {
+    if (check_mask_flag(desc.get_infer_mode(), infer_mode::shap_contributions) ||
+        check_mask_flag(desc.get_infer_mode(), infer_mode::shap_interactions)) {
+        throw unimplemented(
+            dal::detail::error_messages::decision_forest_shap_is_not_implemented_for_gpu());
+    }
+
     auto& queue = ctx.get_queue();
 
     infer_kernel_impl<Float, std::int32_t, task::regression> infer_impl(queue);
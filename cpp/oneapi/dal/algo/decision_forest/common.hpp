@@ -104,7 +104,14 @@ enum class infer_mode : std::uint64_t {
     /// Infer produces a $n \\times 1$  table with the predicted responses
     class_responses = class_labels,
     /// Infer produces $n \\times c$ table with the predicted class probabilities for each observation
-    class_probabilities = 0x00000002ULL
+    class_probabilities = 0x00000002ULL,
+    /// Infer produces $n \\times (p + 1)$ table with the SHAP feature contributions
+    /// for each observation, the last column contains the bias.
+    /// Used with :expr:`task::regression` only.
+    shap_contributions = 0x00000004ULL,
+    /// Infer produces $n \\times (p + 1)^2$ table with the SHAP feature interactions
+    /// for each observation. Used with :expr:`task::regression` only.
+    shap_interactions = 0x00000008ULL
 };
 
 /// Available voting modes for averaging trees predictions
@@ -172,6 +179,9 @@ template <typename T>
 using enable_if_classification_t =
     std::enable_if_t<std::is_same_v<std::decay_t<T>, task::classification>>;
 
+template <typename T>
+using enable_if_regression_t = std::enable_if_t<std::is_same_v<std::decay_t<T>, task::regression>>;
+
 template <typename Float>
 constexpr bool is_valid_float_v = dal::detail::is_one_of_v<Float, float, double>;
 
@@ -219,7 +229,7 @@ public:
         return get_class_count_impl();
     }
 
-    template <typename T = Task, typename = enable_if_classification_t<T>>
+    // Not restricted to classification: regression requests the SHAP values through the infer mode
     infer_mode get_infer_mode() const {
         return get_infer_mode_impl();
     }
@@ -286,6 +296,7 @@ using v1::model_impl;
 using v1::descriptor_base;
 
 using v1::enable_if_classification_t;
+using v1::enable_if_regression_t;
 using v1::is_valid_float_v;
 using v1::is_valid_method_v;
 using v1::is_valid_task_v;
@@ -533,13 +544,14 @@ public:
         return *this;
     }
 
-    template <typename T = Task, typename = detail::enable_if_classification_t<T>>
-    /// The infer mode. Used with :expr:`task::classification` only.
+    /// The infer mode. The class modes are used with :expr:`task::classification`,
+    /// the SHAP modes are used with :expr:`task::regression` to compute the SHAP values
+    /// in addition to the responses, so unlike the class count and the voting mode,
+    /// the infer mode is available for both tasks.
     infer_mode get_infer_mode() const {
         return base_t::get_infer_mode_impl();
     }
 
-    template <typename T = Task, typename = detail::enable_if_classification_t<T>>
     auto& set_infer_mode(infer_mode value) {
         base_t::set_infer_mode_impl(value);
         return *this;
@@ -34,6 +34,8 @@ class detail::v1::infer_result_impl : public base {
 public:
     table responses;
     table probabilities;
+    table shap_contributions;
+    table shap_interactions;
 };
 
 using detail::v1::infer_input_impl;
@@ -88,6 +90,26 @@ void infer_result<Task>::set_probabilities_impl(const table& value) {
     impl_->probabilities = value;
 }
 
+template <typename Task>
+const table& infer_result<Task>::get_shap_contributions_impl() const {
+    return impl_->shap_contributions;
+}
+
+template <typename Task>
+void infer_result<Task>::set_shap_contributions_impl(const table& value) {
+    impl_->shap_contributions = value;
+}
+
+template <typename Task>
+const table& infer_result<Task>::get_shap_interactions_impl() const {
+    return impl_->shap_interactions;
+}
+
+template <typename Task>
+void infer_result<Task>::set_shap_interactions_impl(const table& value) {
+    impl_->shap_interactions = value;
+}
+
 template class ONEDAL_EXPORT infer_input<task::classification>;
 template class ONEDAL_EXPORT infer_input<task::regression>;
 template class ONEDAL_EXPORT infer_result<task::classification>;
@@ -116,10 +116,40 @@ public:
         return *this;
     }
 
+    /// A $n \\times (p + 1)$ table with the SHAP feature contributions for each observation,
+    /// the last column contains the bias. Computed if :expr:`infer_mode::shap_contributions` is set.
+    template <typename T = Task, typename = detail::enable_if_regression_t<T>>
+    const table& get_shap_contributions() const {
+        return get_shap_contributions_impl();
+    }
+
+    template <typename T = Task, typename = detail::enable_if_regression_t<T>>
+    auto& set_shap_contributions(const table& value) {
+        set_shap_contributions_impl(value);
+        return *this;
+    }
+
+    /// A $n \\times (p + 1)^2$ table with the SHAP feature interactions for each observation.
+    /// Computed if :expr:`infer_mode::shap_interactions` is set.
+    template <typename T = Task, typename = detail::enable_if_regression_t<T>>
+    const table& get_shap_interactions() const {
+        return get_shap_interactions_impl();
+    }
+
+    template <typename T = Task, typename = detail::enable_if_regression_t<T>>
+    auto& set_shap_interactions(const table& value) {
+        set_shap_interactions_impl(value);
+        return *this;
+    }
+
 private:
     void set_responses_impl(const table& value);
     const table& get_probabilities_impl() const;
     void set_probabilities_impl(const table& value);
+    const table& get_shap_contributions_impl() const;
+    void set_shap_contributions_impl(const table& value);
+    const table& get_shap_interactions_impl() const;
+    void set_shap_interactions_impl(const table& value);
 
     dal::detail::pimpl<detail::infer_result_impl<Task>> impl_;
 };
@@ -253,6 +253,42 @@ public:
         }
     }
 
+    void check_shap_values(const te::dataframe& data, const df::infer_result<Task>& result) {
+        const std::int64_t row_count = data.get_row_count();
+        const std::int64_t shap_count = data.get_column_count();
+
+        INFO("check if SHAP values shapes are expected")
+        REQUIRE(result.get_shap_contributions().get_row_count() == row_count);
+        REQUIRE(result.get_shap_contributions().get_column_count() == shap_count);
+        REQUIRE(result.get_shap_interactions().get_row_count() == row_count);
+        REQUIRE(result.get_shap_interactions().get_column_count() == shap_count * shap_count);
+
+        const auto responses = dal::row_accessor<const Float>(result.get_responses()).pull();
+        const auto contributions =
+            dal::row_accessor<const Float>(result.get_shap_contributions()).pull();
+        const auto interactions =
+            dal::row_accessor<const Float>(result.get_shap_interactions()).pull();
+
+        const double tol = std::is_same_v<Float, float> ? 1e-4 : 1e-10;
+        for (std::int64_t i = 0; i < row_count; i++) {
+            INFO("check if contributions sum up to the response")
+            double contribution_sum = 0.0;
+            for (std::int64_t j = 0; j < shap_count; j++) {
+                contribution_sum += contributions[i * shap_count + j];
+            }
+            REQUIRE(std::abs(contribution_sum - responses[i]) < tol);
+
+            INFO("check if interactions sum up to the contributions")
+            for (std::int64_t j = 0; j < shap_count; j++) {
+                double interaction_sum = 0.0;
+                for (std::int64_t k = 0; k < shap_count; k++) {
+                    interaction_sum += interactions[(i * shap_count + j) * shap_count + k];
+                }
+                REQUIRE(std::abs(interaction_sum - contributions[i * shap_count + j]) < tol);
+            }
+        }
+    }
+
     void check_var_importance_matches_required(const df::descriptor<Float, Method, Task>& desc,
                                                const df::train_result<Task>& train_result,
                                                const te::dataframe& var_imp_data,
@@ -757,6 +793,25 @@ DF_BATCH_REG_TEST("df reg base check with non default params") {
     this->infer_base_checks(desc, data_test, this->get_homogen_table_id(), model, checker_list);
 }
 
+DF_BATCH_REG_TEST("df reg shap values") {
+    SKIP_IF(this->is_gpu());
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const auto [data, data_test, checker_list] = this->get_reg_dataframe_base();
+
+    auto desc = this->get_default_descriptor();
+    desc.set_tree_count(10);
+    desc.set_min_observations_in_leaf_node(2);
+    desc.set_infer_mode(infer_mode::shap_contributions | infer_mode::shap_interactions);
+
+    const auto train_result = this->train_base_checks(desc, data, this->get_homogen_table_id());
+    const auto model = train_result.get_model();
+    const auto infer_result =
+        this->infer_base_checks(desc, data_test, this->get_homogen_table_id(), model, checker_list);
+    this->check_shap_values(data_test, infer_result);
+}
+
 DF_BATCH_REG_TEST_NIGHTLY_EXT("df reg default flow") {
     SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
@@ -18,6 +18,7 @@
 #include <daal/src/algorithms/kmeans/kmeans_lloyd_kernel.h>
 
 #include "oneapi/dal/algo/kmeans/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/backend/memory.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
@@ -39,6 +40,14 @@ template <typename Float, daal::CpuType Cpu>
 using daal_kmeans_lloyd_dense_kernel_t =
     daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydDense, Float, Cpu>;
 
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_hamerly_dense_kernel_t =
+    daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::hamerlyDense, Float, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_lloyd_dense_partial_kernel_t =
+    daal_kmeans::internal::KMeansDistributedStep1Kernel<daal_kmeans::lloydDense, Float, Cpu>;
+
 template <typename Float, daal::CpuType Cpu>
 using daal_kmeans_init_plus_plus_dense_kernel_t =
     daal_kmeans_init::internal::KMeansInitKernel<daal_kmeans_init::plusPlusDense, Float, Cpu>;
@@ -83,7 +92,18 @@ static daal::data_management::NumericTablePtr get_initial_centroids(
     return daal_initial_centroids;
 }
 
-template <typename Float, typename Task>
+template <typename Float>
+static array<Float> get_cluster_counts(const array<int>& arr_responses, int64_t cluster_count) {
+    auto arr_counts = array<Float>::zeros(cluster_count);
+    Float* counts = arr_counts.get_mutable_data();
+    const int* responses = arr_responses.get_data();
+    for (int64_t i = 0; i < arr_responses.get_count(); i++) {
+        counts[responses[i]] += Float(1);
+    }
+    return arr_counts;
+}
+
+template <typename Float, template <typename, daal::CpuType> typename CpuKernel, typename Task>
 static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                            const descriptor_t& desc,
                                            const table& data,
@@ -125,31 +145,212 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                                        daal_objective_function_value.get(),
                                                        daal_iteration_count.get() };
 
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, CpuKernel>(ctx, input, output, &par));
+
+    return train_result<Task>()
+        .set_responses(
+            dal::detail::homogen_table_builder{}.reset(arr_responses, row_count, 1).build())
+        .set_iteration_count(static_cast<std::int64_t>(arr_iteration_count[0]))
+        .set_objective_function_value(static_cast<double>(arr_objective_function_value[0]))
+        .set_model(
+            model<Task>().set_centroids(dal::detail::homogen_table_builder{}
+                                            .reset(arr_centroids, cluster_count, column_count)
+                                            .build()))
+        .set_cluster_counts(dal::detail::homogen_table_builder{}
+                                .reset(get_cluster_counts<Float>(arr_responses, cluster_count),
+                                       cluster_count,
+                                       1)
+                                .build());
+}
+
+template <typename Float>
+static array<Float> copy_to_array(const table& data) {
+    const auto rows = row_accessor<const Float>(data).pull();
+    auto arr = array<Float>::empty(rows.get_count());
+    dal::backend::copy(arr.get_mutable_data(), rows.get_data(), rows.get_count());
+    return arr;
+}
+
+// Moves each centroid to the mean of the observations it was computed from and
+// the observations of the batch assigned to it, which is the update by Sculley
+// with the per-cluster learning rate. The batch is assigned to the centroids by
+// the same Lloyd pass that computes the partial results in distributed mode
+template <typename Float>
+static void update_centroids(const context_cpu& ctx,
+                             const daal_kmeans::Parameter& par,
+                             const daal::data_management::NumericTablePtr& daal_batch,
+                             array<Float>& arr_centroids,
+                             array<Float>& arr_counts,
+                             int64_t column_count) {
+    const int64_t cluster_count = arr_counts.get_count();
+
+    array<int> arr_batch_counts = array<int>::empty(cluster_count);
+    array<Float> arr_batch_sums = array<Float>::empty(cluster_count * column_count);
+    array<Float> arr_objective_function_value = array<Float>::empty(1);
+    array<Float> arr_candidate_distances = array<Float>::empty(cluster_count);
+    array<Float> arr_candidate_centroids = array<Float>::empty(cluster_count * column_count);
+
+    const auto daal_centroids =
+        interop::convert_to_daal_homogen_table(arr_centroids, cluster_count, column_count);
+    const auto daal_batch_counts =
+        interop::convert_to_daal_homogen_table(arr_batch_counts, cluster_count, 1);
+    const auto daal_batch_sums =
+        interop::convert_to_daal_homogen_table(arr_batch_sums, cluster_count, column_count);
+    const auto daal_objective_function_value =
+        interop::convert_to_daal_homogen_table(arr_objective_function_value, 1, 1);
+    const auto daal_candidate_distances =
+        interop::convert_to_daal_homogen_table(arr_candidate_distances, cluster_count, 1);
+    const auto daal_candidate_centroids =
+        interop::convert_to_daal_homogen_table(arr_candidate_centroids,
+                                               cluster_count,
+                                               column_count);
+
+    const size_t len_input = 2;
+    daal::data_management::NumericTable* input[len_input] = { daal_batch.get(),
+                                                              daal_centroids.get() };
+
+    const size_t len_output = 6;
+    daal::data_management::NumericTable* output[len_output] = {
+        daal_batch_counts.get(),
+        daal_batch_sums.get(),
+        daal_objective_function_value.get(),
+        daal_candidate_distances.get(),
+        daal_candidate_centroids.get(),
+        nullptr
+    };
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_partial_kernel_t>(ctx,
+                                                                                   len_input,
+                                                                                   input,
+                                                                                   len_output,
+                                                                                   output,
+                                                                                   &par));
+
+    Float* centroids = arr_centroids.get_mutable_data();
+    Float* counts = arr_counts.get_mutable_data();
+    const int* batch_counts = arr_batch_counts.get_data();
+    const Float* batch_sums = arr_batch_sums.get_data();
+    for (int64_t i = 0; i < cluster_count; i++) {
+        if (batch_counts[i] == 0) {
+            continue;
+        }
+        const Float batch_count = static_cast<Float>(batch_counts[i]);
+        counts[i] += batch_count;
+        const Float learning_rate = Float(1) / counts[i];
+        for (int64_t j = 0; j < column_count; j++) {
+            const int64_t index = i * column_count + j;
+            centroids[index] +=
+                learning_rate * (batch_sums[index] - batch_count * centroids[index]);
+        }
+    }
+}
+
+template <typename Float, typename Task>
+static train_result<Task> call_daal_kernel_incremental(const context_cpu& ctx,
+                                                       const descriptor_t& desc,
+                                                       const table& data,
+                                                       const table& initial_centroids,
+                                                       const table& initial_cluster_counts) {
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+    const int64_t cluster_count = desc.get_cluster_count();
+
+    const bool is_mini_batch = (desc.get_update_mode() == update_mode::mini_batch);
+    const int64_t batch_size =
+        is_mini_batch ? std::min(desc.get_mini_batch_size(), row_count) : row_count;
+    const int64_t batch_count = (row_count + batch_size - 1) / batch_size;
+    const int64_t iteration_count = is_mini_batch
+                                        ? desc.get_max_iteration_count()
+                                        : std::min(desc.get_max_iteration_count(), int64_t(1));
+
+    dal::detail::check_mul_overflow(cluster_count, column_count);
+    array<Float> arr_centroids = copy_to_array<Float>(initial_centroids);
+    array<Float> arr_counts = initial_cluster_counts.has_data()
+                                  ? copy_to_array<Float>(initial_cluster_counts)
+                                  : array<Float>::zeros(cluster_count);
+
+    daal_kmeans::Parameter par(dal::detail::integral_cast<std::size_t>(cluster_count), 0);
+    par.resultsToEvaluate = static_cast<DAAL_UINT64>(daal_kmeans::computeCentroids);
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    for (int64_t iter = 0; iter < iteration_count; iter++) {
+        if (batch_count == 1) {
+            update_centroids<Float>(ctx, par, daal_data, arr_centroids, arr_counts, column_count);
+            continue;
+        }
+        // Mini-batches are the consecutive blocks of rows, the data are passed over in cycle
+        const int64_t first_row = (iter % batch_count) * batch_size;
+        const int64_t last_row = std::min(first_row + batch_size, row_count);
+        auto arr_batch = row_accessor<const Float>(data).pull({ first_row, last_row });
+        const bool allow_copy = true;
+        const auto daal_batch = interop::convert_to_daal_homogen_table(arr_batch,
+                                                                       last_row - first_row,
+                                                                       column_count,
+                                                                       allow_copy);
+        update_centroids<Float>(ctx, par, daal_batch, arr_centroids, arr_counts, column_count);
+    }
+
+    // Responses and objective function are computed for the updated centroids
+    daal_kmeans::Parameter assign_par(dal::detail::integral_cast<std::size_t>(cluster_count), 0);
+    assign_par.resultsToEvaluate =
+        static_cast<DAAL_UINT64>(daal_kmeans::computeAssignments) |
+        static_cast<DAAL_UINT64>(daal_kmeans::computeExactObjectiveFunction);
+
+    array<int> arr_responses = array<int>::empty(row_count);
+    array<Float> arr_objective_function_value = array<Float>::empty(1);
+    array<int> arr_iteration_count = array<int>::empty(1);
+
+    const auto daal_centroids =
+        interop::convert_to_daal_homogen_table(arr_centroids, cluster_count, column_count);
+    const auto daal_responses = interop::convert_to_daal_homogen_table(arr_responses, row_count, 1);
+    const auto daal_objective_function_value =
+        interop::convert_to_daal_homogen_table(arr_objective_function_value, 1, 1);
+    const auto daal_iteration_count =
+        interop::convert_to_daal_homogen_table(arr_iteration_count, 1, 1);
+
+    daal::data_management::NumericTable* input[2] = { daal_data.get(), daal_centroids.get() };
+
+    daal::data_management::NumericTable* output[4] = { nullptr,
+                                                       daal_responses.get(),
+                                                       daal_objective_function_value.get(),
+                                                       daal_iteration_count.get() };
+
     interop::status_to_exception(
         interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_kernel_t>(ctx,
                                                                            input,
                                                                            output,
-                                                                           &par));
+                                                                           &assign_par));
 
     return train_result<Task>()
         .set_responses(
             dal::detail::homogen_table_builder{}.reset(arr_responses, row_count, 1).build())
-        .set_iteration_count(static_cast<std::int64_t>(arr_iteration_count[0]))
+        .set_iteration_count(iteration_count)
         .set_objective_function_value(static_cast<double>(arr_objective_function_value[0]))
         .set_model(
             model<Task>().set_centroids(dal::detail::homogen_table_builder{}
                                             .reset(arr_centroids, cluster_count, column_count)
-                                            .build()));
+                                            .build()))
+        .set_cluster_counts(
+            dal::detail::homogen_table_builder{}.reset(arr_counts, cluster_count, 1).build());
 }
 
-template <typename Float, typename Task>
+template <typename Float, template <typename, daal::CpuType> typename CpuKernel, typename Task>
 static train_result<Task> train(const context_cpu& ctx,
                                 const descriptor_t& desc,
                                 const train_input<Task>& input) {
-    return call_daal_kernel<Float, Task>(ctx,
-                                         desc,
-                                         input.get_data(),
-                                         input.get_initial_centroids());
+    if (desc.get_update_mode() != update_mode::batch) {
+        return call_daal_kernel_incremental<Float, Task>(ctx,
+                                                         desc,
+                                                         input.get_data(),
+                                                         input.get_initial_centroids(),
+                                                         input.get_initial_cluster_counts());
+    }
+    return call_daal_kernel<Float, CpuKernel, Task>(ctx,
+                                                    desc,
+                                                    input.get_data(),
+                                                    input.get_initial_centroids());
 }
 
 template <typename Float>
@@ -157,11 +358,24 @@ struct train_kernel_cpu<Float, method::lloyd_dense, task::clustering> {
     train_result<task::clustering> operator()(const context_cpu& ctx,
                                               const descriptor_t& desc,
                                               const train_input<task::clustering>& input) const {
-        return train<Float, task::clustering>(ctx, desc, input);
+        return train<Float, daal_kmeans_lloyd_dense_kernel_t, task::clustering>(ctx, desc, input);
+    }
+};
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::hamerly_dense, task::clustering> {
+    train_result<task::clustering> operator()(const context_cpu& ctx,
+                                              const descriptor_t& desc,
+                                              const train_input<task::clustering>& input) const {
+        return train<Float, daal_kmeans_hamerly_dense_kernel_t, task::clustering>(ctx,
+                                                                                  desc,
+                                                                                  input);
     }
 };
 
 template struct train_kernel_cpu<float, method::lloyd_dense, task::clustering>;
 template struct train_kernel_cpu<double, method::lloyd_dense, task::clustering>;
+template struct train_kernel_cpu<float, method::hamerly_dense, task::clustering>;
+template struct train_kernel_cpu<double, method::hamerly_dense, task::clustering>;
 
 } // namespace oneapi::dal::kmeans::backend
@@ -0,0 +1,38 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/kmeans/backend/gpu/train_kernel.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+using dal::backend::context_gpu;
+using descriptor_t = detail::descriptor_base<task::clustering>;
+
+template <typename Float>
+struct train_kernel_gpu<Float, method::hamerly_dense, task::clustering> {
+    train_result<task::clustering> operator()(const context_gpu& ctx,
+                                              const descriptor_t& params,
+                                              const train_input<task::clustering>& input) const {
+        throw unimplemented(
+            dal::detail::error_messages::kmeans_hamerly_dense_method_is_not_implemented_for_gpu());
+    }
+};
+
+template struct train_kernel_gpu<float, method::hamerly_dense, task::clustering>;
+template struct train_kernel_gpu<double, method::hamerly_dense, task::clustering>;
+
+} // namespace oneapi::dal::kmeans::backend
@@ -99,11 +99,29 @@ static pr::ndarray<Float, 2> get_initial_centroids(const dal::backend::context_g
     return pr::ndarray<Float, 2>::wrap(initial_centroids_ptr, { cluster_count, column_count });
 }
 
+template <typename Float>
+static dal::array<Float> get_cluster_counts(sycl::queue& queue,
+                                           const pr::ndarray<std::int32_t, 2>& arr_responses,
+                                           std::int64_t cluster_count) {
+    const auto host_responses = arr_responses.to_host(queue);
+    const std::int32_t* responses = host_responses.get_data();
+    auto arr_counts = dal::array<Float>::zeros(cluster_count);
+    Float* counts = arr_counts.get_mutable_data();
+    for (std::int64_t i = 0; i < host_responses.get_count(); i++) {
+        counts[responses[i]] += Float(1);
+    }
+    return arr_counts;
+}
+
 template <typename Float>
 struct train_kernel_gpu<Float, method::lloyd_dense, task::clustering> {
     train_result<task::clustering> operator()(const dal::backend::context_gpu& ctx,
                                               const descriptor_t& params,
                                               const train_input<task::clustering>& input) const {
+        if (params.get_update_mode() != update_mode::batch) {
+            throw unimplemented(
+                dal::detail::error_messages::kmeans_update_mode_is_not_implemented_for_gpu());
+        }
         auto& queue = ctx.get_queue();
 
         const auto data = input.get_data();
@@ -189,7 +207,11 @@ struct train_kernel_gpu<Float, method::lloyd_dense, task::clustering> {
             .set_responses(dal::homogen_table::wrap(arr_responses.flatten(queue), row_count, 1))
             .set_iteration_count(iter)
             .set_objective_function_value(arr_objective_function.to_host(queue).get_data()[0])
-            .set_model(model);
+            .set_model(model)
+            .set_cluster_counts(
+                homogen_table::wrap(get_cluster_counts<Float>(queue, arr_responses, cluster_count),
+                                    cluster_count,
+                                    1));
     }
 };
 
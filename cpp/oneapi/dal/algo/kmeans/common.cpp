@@ -27,6 +27,8 @@ public:
     std::int64_t cluster_count = 2;
     std::int64_t max_iteration_count = 100;
     double accuracy_threshold = 0;
+    update_mode mode = update_mode::batch;
+    std::int64_t mini_batch_size = 1024;
 };
 
 template <typename Task>
@@ -53,6 +55,16 @@ double descriptor_base<Task>::get_accuracy_threshold() const {
     return impl_->accuracy_threshold;
 }
 
+template <typename Task>
+update_mode descriptor_base<Task>::get_update_mode() const {
+    return impl_->mode;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_mini_batch_size() const {
+    return impl_->mini_batch_size;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_cluster_count_impl(std::int64_t value) {
     if (value <= 0) {
@@ -80,6 +92,19 @@ void descriptor_base<Task>::set_accuracy_threshold_impl(double value) {
     impl_->accuracy_threshold = value;
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_update_mode_impl(update_mode value) {
+    impl_->mode = value;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_mini_batch_size_impl(std::int64_t value) {
+    if (value <= 0) {
+        throw domain_error(dal::detail::error_messages::mini_batch_size_leq_zero());
+    }
+    impl_->mini_batch_size = value;
+}
+
 template class ONEDAL_EXPORT descriptor_base<task::clustering>;
 
 } // namespace v1
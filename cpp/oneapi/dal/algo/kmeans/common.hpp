@@ -42,16 +42,47 @@ namespace v1 {
 /// method.
 struct lloyd_dense {};
 
+/// Tag-type that denotes Lloyd's computational method accelerated with the
+/// distance bounds by Hamerly. Gives the same results as
+/// :expr:`method::lloyd_dense`, but skips the distance computations for the
+/// observations that provably keep their clusters, which makes the iterations
+/// close to convergence much faster. With the positive accuracy threshold the
+/// distances are computed for all the observations, so that the iterations
+/// stop at the same objective function value.
+struct hamerly_dense {};
+
 /// Alias tag-type for :ref:`Lloyd's <kmeans_t_math_lloyd>` computational
 /// method.
 using by_default = lloyd_dense;
 } // namespace v1
 
 using v1::lloyd_dense;
+using v1::hamerly_dense;
 using v1::by_default;
 
 } // namespace method
 
+namespace v1 {
+
+/// Available identifiers to specify how the training updates the centroids
+enum class update_mode {
+    /// Lloyd iterations over the whole input data, starting from the initial centroids
+    batch,
+
+    /// One update of the initial centroids with the whole input data. Each centroid is
+    /// moved to the mean of the observations it was computed from and the new observations
+    /// assigned to it, so the training can be continued on the next batch of data
+    incremental,
+
+    /// Mini-batch updates by Sculley with the per-cluster learning rate. Each iteration
+    /// updates the centroids with the next mini-batch of consecutive rows of the input data
+    mini_batch
+};
+
+} // namespace v1
+
+using v1::update_mode;
+
 namespace detail {
 namespace v1 {
 struct descriptor_tag {};
@@ -66,7 +97,8 @@ template <typename Float>
 constexpr bool is_valid_float_v = dal::detail::is_one_of_v<Float, float, double>;
 
 template <typename Method>
-constexpr bool is_valid_method_v = dal::detail::is_one_of_v<Method, method::lloyd_dense>;
+constexpr bool is_valid_method_v =
+    dal::detail::is_one_of_v<Method, method::lloyd_dense, method::hamerly_dense>;
 
 template <typename Task>
 constexpr bool is_valid_task_v = dal::detail::is_one_of_v<Task, task::clustering>;
@@ -86,11 +118,15 @@ public:
     std::int64_t get_cluster_count() const;
     std::int64_t get_max_iteration_count() const;
     double get_accuracy_threshold() const;
+    update_mode get_update_mode() const;
+    std::int64_t get_mini_batch_size() const;
 
 protected:
     void set_cluster_count_impl(std::int64_t);
     void set_max_iteration_count_impl(std::int64_t);
     void set_accuracy_threshold_impl(double);
+    void set_update_mode_impl(update_mode);
+    void set_mini_batch_size_impl(std::int64_t);
 
 private:
     dal::detail::pimpl<descriptor_impl<Task>> impl_;
@@ -115,7 +151,7 @@ namespace v1 {
 ///                intermediate computations. Can be :expr:`float` or
 ///                :expr:`double`.
 /// @tparam Method Tag-type that specifies an implementation of algorithm. Can
-///                be :expr:`method::lloyd_dense`.
+///                be :expr:`method::lloyd_dense` or :expr:`method::hamerly_dense`.
 /// @tparam Task   Tag-type that specifies the type of the problem to solve. Can
 ///                be :expr:`task::clustering`.
 template <typename Float = float,
@@ -173,6 +209,32 @@ public:
         base_t::set_accuracy_threshold_impl(value);
         return *this;
     }
+
+    /// The way the training updates the centroids. In the :expr:`update_mode::incremental`
+    /// and :expr:`update_mode::mini_batch` modes the training continues from
+    /// :expr:`train_input.initial_centroids` and :expr:`train_input.initial_cluster_counts`,
+    /// and the accuracy threshold is not used
+    /// @remark default = update_mode::batch
+    update_mode get_update_mode() const {
+        return base_t::get_update_mode();
+    }
+
+    auto& set_update_mode(update_mode value) {
+        base_t::set_update_mode_impl(value);
+        return *this;
+    }
+
+    /// The number of rows in a mini-batch. Used with :expr:`update_mode::mini_batch` only
+    /// @invariant :expr:`mini_batch_size > 0`
+    /// @remark default = 1024
+    std::int64_t get_mini_batch_size() const {
+        return base_t::get_mini_batch_size();
+    }
+
+    auto& set_mini_batch_size(std::int64_t value) {
+        base_t::set_mini_batch_size_impl(value);
+        return *this;
+    }
 };
 
 /// @tparam Task Tag-type that specifies type of the problem to solve. Can
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <cmath>
+
 #include "oneapi/dal/algo/kmeans/train_types.hpp"
 #include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
 
 namespace oneapi::dal::kmeans::detail {
 namespace v1 {
@@ -47,8 +50,13 @@ struct train_ops {
         if (input.get_data().get_row_count() > dal::detail::limits<std::int32_t>::max()) {
             throw domain_error(dal::detail::error_messages::row_count_gt_max_int32());
         }
-        if (params.get_cluster_count() > input.get_data().get_row_count()) {
-            throw invalid_argument(msg::cluster_count_exceeds_data_row_count());
+        if (params.get_update_mode() == update_mode::batch) {
+            if (params.get_cluster_count() > input.get_data().get_row_count()) {
+                throw invalid_argument(msg::cluster_count_exceeds_data_row_count());
+            }
+        }
+        else if (!input.get_initial_centroids().has_data()) {
+            throw invalid_argument(msg::input_initial_centroids_are_empty());
         }
         if (input.get_initial_centroids().has_data()) {
             if (input.get_initial_centroids().get_row_count() != params.get_cluster_count()) {
@@ -59,6 +67,23 @@ struct train_ops {
                 throw invalid_argument(msg::input_initial_centroids_cc_neq_input_data_cc());
             }
         }
+        if (input.get_initial_cluster_counts().has_data()) {
+            if (input.get_initial_cluster_counts().get_row_count() != params.get_cluster_count()) {
+                throw invalid_argument(
+                    msg::input_initial_cluster_counts_rc_neq_desc_cluster_count());
+            }
+            if (input.get_initial_cluster_counts().get_column_count() != 1) {
+                throw invalid_argument(msg::input_initial_cluster_counts_cc_neq_one());
+            }
+            const auto counts =
+                row_accessor<const float_t>(input.get_initial_cluster_counts()).pull();
+            for (std::int64_t i = 0; i < counts.get_count(); i++) {
+                if (!std::isfinite(counts[i]) || counts[i] < 0) {
+                    throw invalid_argument(
+                        msg::input_initial_cluster_counts_are_negative_or_non_finite());
+                }
+            }
+        }
     }
 
     void check_postconditions(const Descriptor& params,
@@ -73,6 +98,9 @@ struct train_ops {
         ONEDAL_ASSERT(result.get_model().get_centroids().get_column_count() ==
                       input.get_data().get_column_count());
         ONEDAL_ASSERT(result.get_responses().get_row_count() == input.get_data().get_row_count());
+        ONEDAL_ASSERT(result.get_cluster_counts().has_data());
+        ONEDAL_ASSERT(result.get_cluster_counts().get_row_count() == params.get_cluster_count());
+        ONEDAL_ASSERT(result.get_cluster_counts().get_column_count() == 1);
     }
 
     template <typename Context>
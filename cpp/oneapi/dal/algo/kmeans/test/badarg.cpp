@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <array>
+#include <limits>
 
 #include "oneapi/dal/algo/kmeans/infer.hpp"
 #include "oneapi/dal/algo/kmeans/train.hpp"
@@ -152,6 +153,18 @@ KMEANS_BADARG_TEST("throws if accuracy threshold is negative") {
     REQUIRE_THROWS_AS(this->get_descriptor().set_accuracy_threshold(-0.1), domain_error);
 }
 
+KMEANS_BADARG_TEST("accepts positive mini-batch size") {
+    REQUIRE_NOTHROW(this->get_descriptor().set_mini_batch_size(1));
+}
+
+KMEANS_BADARG_TEST("throws if mini-batch size is zero") {
+    REQUIRE_THROWS_AS(this->get_descriptor().set_mini_batch_size(0), domain_error);
+}
+
+KMEANS_BADARG_TEST("throws if mini-batch size is negative") {
+    REQUIRE_THROWS_AS(this->get_descriptor().set_mini_batch_size(-1), domain_error);
+}
+
 KMEANS_BADARG_TEST("throws if train data is empty") {
     const auto kmeans_desc = this->get_descriptor().set_cluster_count(2);
 
@@ -180,6 +193,49 @@ KMEANS_BADARG_TEST("throws if cluster count exceeds data row count") {
         invalid_argument);
 }
 
+KMEANS_BADARG_TEST("throws if initial centroids are empty in incremental mode") {
+    const auto kmeans_desc = this->get_descriptor()
+                                 .set_cluster_count(this->cluster_count)
+                                 .set_update_mode(update_mode::incremental);
+
+    REQUIRE_THROWS_AS(train(kmeans_desc, this->get_train_data()), invalid_argument);
+}
+
+KMEANS_BADARG_TEST("throws if initial cluster counts rows neq cluster count") {
+    const auto kmeans_desc = this->get_descriptor()
+                                 .set_cluster_count(this->cluster_count)
+                                 .set_update_mode(update_mode::incremental);
+    const auto input = train_input<>{ this->get_train_data(), this->get_initial_centroids() }
+                           .set_initial_cluster_counts(this->get_initial_centroids(1, 1));
+
+    REQUIRE_THROWS_AS(train(kmeans_desc, input), invalid_argument);
+}
+
+KMEANS_BADARG_TEST("throws if initial cluster counts columns neq one") {
+    const auto kmeans_desc = this->get_descriptor()
+                                 .set_cluster_count(this->cluster_count)
+                                 .set_update_mode(update_mode::incremental);
+    const auto input = train_input<>{ this->get_train_data(), this->get_initial_centroids() }
+                           .set_initial_cluster_counts(this->get_initial_centroids());
+
+    REQUIRE_THROWS_AS(train(kmeans_desc, input), invalid_argument);
+}
+
+KMEANS_BADARG_TEST("throws if initial cluster counts are negative or non-finite") {
+    const auto kmeans_desc = this->get_descriptor()
+                                 .set_cluster_count(this->cluster_count)
+                                 .set_update_mode(update_mode::incremental);
+    const float bad_count = GENERATE(-1.0f,
+                                     std::numeric_limits<float>::quiet_NaN(),
+                                     std::numeric_limits<float>::infinity());
+    const float initial_cluster_counts[] = { 2.0, bad_count };
+    const auto input = train_input<>{ this->get_train_data(), this->get_initial_centroids() }
+                           .set_initial_cluster_counts(
+                               homogen_table::wrap(initial_cluster_counts, this->cluster_count, 1));
+
+    REQUIRE_THROWS_AS(train(kmeans_desc, input), invalid_argument);
+}
+
 KMEANS_BADARG_TEST("throws if infer data is empty") {
     const auto kmeans_desc = this->get_descriptor().set_cluster_count(this->cluster_count);
     const auto model =
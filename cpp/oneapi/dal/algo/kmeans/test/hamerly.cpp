@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "oneapi/dal/algo/kmeans/train.hpp"
+
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+
+namespace oneapi::dal::kmeans::test {
+
+namespace te = dal::test::engine;
+
+template <typename Float>
+class kmeans_hamerly_test : public te::float_algo_fixture<Float> {
+public:
+    auto get_descriptor(std::int64_t cluster_count,
+                        std::int64_t max_iteration_count,
+                        double accuracy_threshold = 0.0) const {
+        return kmeans::descriptor<Float, kmeans::method::hamerly_dense>{}
+            .set_cluster_count(cluster_count)
+            .set_max_iteration_count(max_iteration_count)
+            .set_accuracy_threshold(accuracy_threshold);
+    }
+
+    auto get_lloyd_descriptor(std::int64_t cluster_count,
+                              std::int64_t max_iteration_count,
+                              double accuracy_threshold = 0.0) const {
+        return kmeans::descriptor<Float, kmeans::method::lloyd_dense>{}
+            .set_cluster_count(cluster_count)
+            .set_max_iteration_count(max_iteration_count)
+            .set_accuracy_threshold(accuracy_threshold);
+    }
+
+    bool is_gpu() {
+        return this->get_policy().is_gpu();
+    }
+
+    table get_first_rows(const table& data, std::int64_t row_count) {
+        const std::int64_t column_count = data.get_column_count();
+        const auto rows = row_accessor<const Float>(data).pull({ 0, row_count });
+        auto arr = array<Float>::empty(rows.get_count());
+        std::copy(rows.get_data(), rows.get_data() + rows.get_count(), arr.get_mutable_data());
+        return homogen_table::wrap(arr, row_count, column_count);
+    }
+
+    void check_same_results(const te::dataframe& data_fr,
+                            std::int64_t cluster_count,
+                            std::int64_t max_iteration_count,
+                            double accuracy_threshold = 0.0) {
+        const table data = data_fr.get_table(this->get_policy(), this->get_homogen_table_id());
+        const table initial_centroids = get_first_rows(data, cluster_count);
+
+        INFO("run training");
+        const auto lloyd_desc =
+            get_lloyd_descriptor(cluster_count, max_iteration_count, accuracy_threshold);
+        const auto lloyd_result = this->train(lloyd_desc, data, initial_centroids);
+        const auto desc = get_descriptor(cluster_count, max_iteration_count, accuracy_threshold);
+        const auto result = this->train(desc, data, initial_centroids);
+
+        INFO("check iteration count");
+        REQUIRE(result.get_iteration_count() == lloyd_result.get_iteration_count());
+
+        INFO("check responses");
+        const auto responses = row_accessor<const std::int32_t>(result.get_responses()).pull();
+        const auto lloyd_responses =
+            row_accessor<const std::int32_t>(lloyd_result.get_responses()).pull();
+        REQUIRE(responses.get_count() == lloyd_responses.get_count());
+        for (std::int64_t i = 0; i < responses.get_count(); i++) {
+            CAPTURE(i);
+            REQUIRE(responses[i] == lloyd_responses[i]);
+        }
+
+        const Float tol = std::numeric_limits<Float>::epsilon() * 100;
+
+        INFO("check centroids");
+        const auto centroids = row_accessor<const Float>(result.get_model().get_centroids()).pull();
+        const auto lloyd_centroids =
+            row_accessor<const Float>(lloyd_result.get_model().get_centroids()).pull();
+        REQUIRE(centroids.get_count() == lloyd_centroids.get_count());
+        for (std::int64_t i = 0; i < centroids.get_count(); i++) {
+            CAPTURE(i, centroids[i], lloyd_centroids[i]);
+            REQUIRE(std::abs(centroids[i] - lloyd_centroids[i]) <=
+                    tol * std::max(Float(1), std::abs(lloyd_centroids[i])));
+        }
+
+        INFO("check objective function");
+        const double objective = result.get_objective_function_value();
+        const double lloyd_objective = lloyd_result.get_objective_function_value();
+        REQUIRE(std::abs(objective - lloyd_objective) <=
+                tol * std::max(1.0, std::abs(lloyd_objective)));
+    }
+};
+
+TEMPLATE_TEST_M(kmeans_hamerly_test,
+                "kmeans hamerly dense gives the same results as lloyd dense",
+                "[kmeans][hamerly]",
+                float,
+                double) {
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(this->is_gpu());
+
+    const te::dataframe data =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 2000, 8 }.fill_normal(0, 1, 7777),
+                           te::dataframe_builder{ 500, 3 }.fill_uniform(-10, 10, 8888));
+    const std::int64_t cluster_count = GENERATE(1, 4, 20);
+
+    this->check_same_results(data, cluster_count, 30);
+}
+
+TEMPLATE_TEST_M(kmeans_hamerly_test,
+                "kmeans hamerly dense stops at the same iteration as lloyd dense",
+                "[kmeans][hamerly]",
+                float,
+                double) {
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(this->is_gpu());
+
+    const te::dataframe data =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 2000, 8 }.fill_normal(0, 1, 7777),
+                           te::dataframe_builder{ 500, 3 }.fill_uniform(-10, 10, 8888));
+    const std::int64_t cluster_count = GENERATE(4, 20);
+    const double accuracy_threshold = GENERATE(1e-3, 1e-1, 10.0);
+    CAPTURE(accuracy_threshold);
+
+    this->check_same_results(data, cluster_count, 100, accuracy_threshold);
+}
+
+TEMPLATE_TEST_M(kmeans_hamerly_test,
+                "kmeans hamerly dense is not implemented for GPU",
+                "[kmeans][hamerly]",
+                float,
+                double) {
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(!this->is_gpu());
+
+    const te::dataframe data =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 100, 3 }.fill_uniform(-10, 10, 8888));
+    const table x = data.get_table(this->get_policy(), this->get_homogen_table_id());
+    const auto desc = this->get_descriptor(4, 10);
+
+    REQUIRE_THROWS_AS(this->train(desc, x, this->get_first_rows(x, 4)), unimplemented);
+}
+
+} // namespace oneapi::dal::kmeans::test
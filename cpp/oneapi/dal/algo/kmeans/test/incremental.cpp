@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "oneapi/dal/algo/kmeans/train.hpp"
+
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+
+namespace oneapi::dal::kmeans::test {
+
+namespace te = dal::test::engine;
+
+template <typename TestType>
+class kmeans_incremental_test : public te::float_algo_fixture<std::tuple_element_t<0, TestType>> {
+public:
+    using Float = std::tuple_element_t<0, TestType>;
+    using Method = std::tuple_element_t<1, TestType>;
+
+    auto get_descriptor(std::int64_t cluster_count,
+                        std::int64_t max_iteration_count,
+                        update_mode mode) const {
+        return kmeans::descriptor<Float, Method>{}
+            .set_cluster_count(cluster_count)
+            .set_max_iteration_count(max_iteration_count)
+            .set_update_mode(mode);
+    }
+
+    bool is_gpu() {
+        return this->get_policy().is_gpu();
+    }
+
+    void check_table(const table& result, const Float* ref, std::int64_t ref_count) {
+        const auto rows = row_accessor<const Float>(result).pull();
+        REQUIRE(rows.get_count() == ref_count);
+        const Float tol = std::numeric_limits<Float>::epsilon() * 10;
+        for (std::int64_t i = 0; i < ref_count; i++) {
+            CAPTURE(i, rows[i], ref[i]);
+            REQUIRE(std::abs(rows[i] - ref[i]) <= tol * std::max(Float(1), std::abs(ref[i])));
+        }
+    }
+};
+
+using kmeans_types = COMBINE_TYPES((float, double), (kmeans::method::lloyd_dense));
+
+TEMPLATE_LIST_TEST_M(kmeans_incremental_test,
+                     "kmeans incremental update continues from prior centroids",
+                     "[kmeans][incremental]",
+                     kmeans_types) {
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(this->is_gpu());
+
+    using Float = std::tuple_element_t<0, TestType>;
+    Float data[] = { -3, -1, 3, 5 };
+    const auto x = homogen_table::wrap(data, 4, 1);
+
+    Float initial_centroids[] = { -1, 1 };
+    Float initial_cluster_counts[] = { 2, 2 };
+    const auto input = train_input<>{ x, homogen_table::wrap(initial_centroids, 2, 1) }
+                           .set_initial_cluster_counts(
+                               homogen_table::wrap(initial_cluster_counts, 2, 1));
+
+    const auto desc = this->get_descriptor(2, 10, update_mode::incremental);
+    const auto result = this->train(desc, input);
+
+    // Each centroid is the mean of the two prior observations and the new ones
+    Float ref_centroids[] = { -1.5, 2.5 };
+    Float ref_cluster_counts[] = { 4, 4 };
+    Float ref_responses[] = { 0, 0, 1, 1 };
+    this->check_table(result.get_model().get_centroids(), ref_centroids, 2);
+    this->check_table(result.get_cluster_counts(), ref_cluster_counts, 2);
+    this->check_table(result.get_responses(), ref_responses, 4);
+    REQUIRE(result.get_iteration_count() == 1);
+    REQUIRE(result.get_objective_function_value() == Approx(9.0));
+}
+
+TEMPLATE_LIST_TEST_M(kmeans_incremental_test,
+                     "kmeans mini-batch updates with zero prior counts",
+                     "[kmeans][incremental]",
+                     kmeans_types) {
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(this->is_gpu());
+
+    using Float = std::tuple_element_t<0, TestType>;
+    Float data[] = { -3, -1, 3, 5 };
+    const auto x = homogen_table::wrap(data, 4, 1);
+
+    Float initial_centroids[] = { -1, 1 };
+    const auto c_init = homogen_table::wrap(initial_centroids, 2, 1);
+
+    const auto desc =
+        this->get_descriptor(2, 2, update_mode::mini_batch).set_mini_batch_size(2);
+    const auto result = this->train(desc, x, c_init);
+
+    // The first mini-batch moves the first centroid, the second one moves the second centroid
+    Float ref_centroids[] = { -2, 4 };
+    Float ref_cluster_counts[] = { 2, 2 };
+    Float ref_responses[] = { 0, 0, 1, 1 };
+    this->check_table(result.get_model().get_centroids(), ref_centroids, 2);
+    this->check_table(result.get_cluster_counts(), ref_cluster_counts, 2);
+    this->check_table(result.get_responses(), ref_responses, 4);
+    REQUIRE(result.get_iteration_count() == 2);
+    REQUIRE(result.get_objective_function_value() == Approx(4.0));
+}
+
+TEMPLATE_LIST_TEST_M(kmeans_incremental_test,
+                     "kmeans batch training returns cluster counts",
+                     "[kmeans][incremental]",
+                     kmeans_types) {
+    SKIP_IF(this->not_float64_friendly());
+
+    using Float = std::tuple_element_t<0, TestType>;
+    Float data[] = { -3, -1, 3, 5, 4 };
+    const auto x = homogen_table::wrap(data, 5, 1);
+
+    Float initial_centroids[] = { -1, 1 };
+    const auto c_init = homogen_table::wrap(initial_centroids, 2, 1);
+
+    const auto desc = this->get_descriptor(2, 10, update_mode::batch);
+    const auto result = this->train(desc, x, c_init);
+
+    Float ref_cluster_counts[] = { 2, 3 };
+    this->check_table(result.get_cluster_counts(), ref_cluster_counts, 2);
+}
+
+} // namespace oneapi::dal::kmeans::test
@@ -30,6 +30,7 @@ public:
 
     table data;
     table initial_centroids;
+    table initial_cluster_counts;
 };
 
 template <typename Task>
@@ -39,6 +40,7 @@ public:
     table responses;
     std::int64_t iteration_count = 0;
     double objective_function_value = 0.0;
+    table cluster_counts;
 };
 
 using detail::v1::train_input_impl;
@@ -63,6 +65,11 @@ const table& train_input<Task>::get_initial_centroids() const {
     return impl_->initial_centroids;
 }
 
+template <typename Task>
+const table& train_input<Task>::get_initial_cluster_counts() const {
+    return impl_->initial_cluster_counts;
+}
+
 template <typename Task>
 void train_input<Task>::set_data_impl(const table& value) {
     impl_->data = value;
@@ -73,6 +80,11 @@ void train_input<Task>::set_initial_centroids_impl(const table& value) {
     impl_->initial_centroids = value;
 }
 
+template <typename Task>
+void train_input<Task>::set_initial_cluster_counts_impl(const table& value) {
+    impl_->initial_cluster_counts = value;
+}
+
 template <typename Task>
 train_result<Task>::train_result() : impl_(new train_result_impl<Task>{}) {}
 
@@ -96,6 +108,11 @@ double train_result<Task>::get_objective_function_value() const {
     return impl_->objective_function_value;
 }
 
+template <typename Task>
+const table& train_result<Task>::get_cluster_counts() const {
+    return impl_->cluster_counts;
+}
+
 template <typename Task>
 void train_result<Task>::set_model_impl(const model<Task>& value) {
     impl_->trained_model = value;
@@ -122,6 +139,11 @@ void train_result<Task>::set_objective_function_value_impl(double value) {
     impl_->objective_function_value = value;
 }
 
+template <typename Task>
+void train_result<Task>::set_cluster_counts_impl(const table& value) {
+    impl_->cluster_counts = value;
+}
+
 template class ONEDAL_EXPORT train_input<task::clustering>;
 template class ONEDAL_EXPORT train_result<task::clustering>;
 
@@ -69,9 +69,21 @@ public:
         return *this;
     }
 
+    /// A $k \\times 1$ table with the numbers of observations the initial centroids
+    /// were computed from. Used with :expr:`update_mode::incremental` and
+    /// :expr:`update_mode::mini_batch` only, the empty table means zero counts
+    /// @remark default = table{}
+    const table& get_initial_cluster_counts() const;
+
+    auto& set_initial_cluster_counts(const table& data) {
+        set_initial_cluster_counts_impl(data);
+        return *this;
+    }
+
 protected:
     void set_data_impl(const table& data);
     void set_initial_centroids_impl(const table& data);
+    void set_initial_cluster_counts_impl(const table& data);
 
 private:
     dal::detail::pimpl<detail::train_input_impl<Task>> impl_;
@@ -138,11 +150,23 @@ public:
         return *this;
     }
 
+    /// A $k \\times 1$ table with the numbers of observations the centroids of the
+    /// trained model are computed from. Can be passed as
+    /// :expr:`train_input.initial_cluster_counts` to continue the training
+    /// @remark default = table{}
+    const table& get_cluster_counts() const;
+
+    auto& set_cluster_counts(const table& value) {
+        set_cluster_counts_impl(value);
+        return *this;
+    }
+
 protected:
     void set_model_impl(const model<Task>&);
     void set_responses_impl(const table&);
     void set_iteration_count_impl(std::int64_t);
     void set_objective_function_value_impl(double);
+    void set_cluster_counts_impl(const table&);
 
 private:
     dal::detail::pimpl<detail::train_result_impl<Task>> impl_;
@@ -85,6 +85,10 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
 
         daal_parameter.resultsToCompute = original_daal_parameter.resultsToCompute;
         daal_parameter.resultsToEvaluate = original_daal_parameter.resultsToEvaluate;
+
+        // Responses of the neighbors are averaged while the neighbors are found,
+        // so the indices and the distances are not stored
+        daal_parameter.regression = std::is_same_v<Task, task::regression>;
     }
 
     auto distance_impl = detail::get_distance_impl(desc);
@@ -146,5 +150,7 @@ template struct infer_kernel_cpu<float, method::brute_force, task::classificatio
 template struct infer_kernel_cpu<double, method::brute_force, task::classification>;
 template struct infer_kernel_cpu<float, method::brute_force, task::search>;
 template struct infer_kernel_cpu<double, method::brute_force, task::search>;
+template struct infer_kernel_cpu<float, method::brute_force, task::regression>;
+template struct infer_kernel_cpu<double, method::brute_force, task::regression>;
 
 } // namespace oneapi::dal::knn::backend
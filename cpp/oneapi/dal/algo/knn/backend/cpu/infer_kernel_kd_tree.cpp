@@ -56,7 +56,7 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
 
     const std::int64_t dummy_seed = 777;
     const auto data_use_in_model = daal_knn::doNotUse;
-    daal_knn::Parameter daal_parameter(
+    daal_knn::prediction::internal::KernelParameter daal_parameter(
         dal::detail::integral_cast<std::size_t>(desc.get_class_count()),
         dal::detail::integral_cast<std::size_t>(desc.get_neighbor_count()),
         dal::detail::integral_cast<int>(dummy_seed),
@@ -81,6 +81,10 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
     else {
         arr_responses.reset(1 * row_count);
         daal_responses = interop::convert_to_daal_homogen_table(arr_responses, row_count, 1);
+
+        // Responses of the neighbors are averaged while the neighbors are found,
+        // so the indices and the distances are not stored
+        daal_parameter.regression = std::is_same_v<Task, task::regression>;
     }
 
     const auto daal_data = interop::convert_to_daal_table<Float>(data);
@@ -134,5 +138,7 @@ template struct infer_kernel_cpu<float, method::kd_tree, task::classification>;
 template struct infer_kernel_cpu<double, method::kd_tree, task::classification>;
 template struct infer_kernel_cpu<float, method::kd_tree, task::search>;
 template struct infer_kernel_cpu<double, method::kd_tree, task::search>;
+template struct infer_kernel_cpu<float, method::kd_tree, task::regression>;
+template struct infer_kernel_cpu<double, method::kd_tree, task::regression>;
 
 } // namespace oneapi::dal::knn::backend
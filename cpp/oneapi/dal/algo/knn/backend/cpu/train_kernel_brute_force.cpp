@@ -93,5 +93,7 @@ template struct train_kernel_cpu<float, method::brute_force, task::classificatio
 template struct train_kernel_cpu<double, method::brute_force, task::classification>;
 template struct train_kernel_cpu<float, method::brute_force, task::search>;
 template struct train_kernel_cpu<double, method::brute_force, task::search>;
+template struct train_kernel_cpu<float, method::brute_force, task::regression>;
+template struct train_kernel_cpu<double, method::brute_force, task::regression>;
 
 } // namespace oneapi::dal::knn::backend
@@ -103,5 +103,7 @@ template struct train_kernel_cpu<float, method::kd_tree, task::classification>;
 template struct train_kernel_cpu<double, method::kd_tree, task::classification>;
 template struct train_kernel_cpu<float, method::kd_tree, task::search>;
 template struct train_kernel_cpu<double, method::kd_tree, task::search>;
+template struct train_kernel_cpu<float, method::kd_tree, task::regression>;
+template struct train_kernel_cpu<double, method::kd_tree, task::regression>;
 
 } // namespace oneapi::dal::knn::backend
@@ -41,5 +41,7 @@ template struct infer_kernel_gpu<float, method::kd_tree, task::classification>;
 template struct infer_kernel_gpu<double, method::kd_tree, task::classification>;
 template struct infer_kernel_gpu<float, method::kd_tree, task::search>;
 template struct infer_kernel_gpu<double, method::kd_tree, task::search>;
+template struct infer_kernel_gpu<float, method::kd_tree, task::regression>;
+template struct infer_kernel_gpu<double, method::kd_tree, task::regression>;
 
 } // namespace oneapi::dal::knn::backend
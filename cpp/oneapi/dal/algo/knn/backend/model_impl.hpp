@@ -22,10 +22,11 @@
 
 namespace oneapi::dal::knn {
 
-#define KNN_SERIALIZABLE(Task, ClassificationId, SearchId)             \
-    ONEDAL_SERIALIZABLE_MAP2(Task,                                     \
-                             (task::classification, ClassificationId), \
-                             (task::search, SearchId))
+#define KNN_SERIALIZABLE(Task, ClassificationId, SearchId, RegressionId) \
+    ONEDAL_SERIALIZABLE_MAP3(Task,                                       \
+                             (task::classification, ClassificationId),   \
+                             (task::search, SearchId),                   \
+                             (task::regression, RegressionId))
 
 template <typename Task>
 class detail::v1::model_impl : public base {
@@ -44,7 +45,8 @@ template <typename Task>
 class brute_force_model_impl : public model_impl<Task>,
                                public KNN_SERIALIZABLE(Task,
                                                        knn_brute_force_classification_model_impl_id,
-                                                       knn_brute_force_search_model_impl_id) {
+                                                       knn_brute_force_search_model_impl_id,
+                                                       knn_brute_force_regression_model_impl_id) {
 public:
     brute_force_model_impl() = default;
 
@@ -81,7 +83,8 @@ template <typename Task>
 class kd_tree_model_impl : public model_impl<Task>,
                            public KNN_SERIALIZABLE(Task,
                                                    knn_kd_tree_classification_model_impl_id,
-                                                   knn_kd_tree_search_model_impl_id) {
+                                                   knn_kd_tree_search_model_impl_id,
+                                                   knn_kd_tree_regression_model_impl_id) {
 public:
     kd_tree_model_impl() : interop_(nullptr) {}
     kd_tree_model_impl(const kd_tree_model_impl&) = delete;
@@ -91,6 +91,7 @@ void descriptor_base<Task>::set_distance_impl(const detail::distance_ptr& distan
 
 template class ONEDAL_EXPORT descriptor_base<task::classification>;
 template class ONEDAL_EXPORT descriptor_base<task::search>;
+template class ONEDAL_EXPORT descriptor_base<task::regression>;
 
 } // namespace v1
 } // namespace detail
@@ -117,11 +118,14 @@ void model<Task>::deserialize(dal::detail::input_archive& ar) {
 
 template class ONEDAL_EXPORT model<task::classification>;
 template class ONEDAL_EXPORT model<task::search>;
+template class ONEDAL_EXPORT model<task::regression>;
 
 ONEDAL_REGISTER_SERIALIZABLE(backend::brute_force_model_impl<task::classification>)
 ONEDAL_REGISTER_SERIALIZABLE(backend::kd_tree_model_impl<task::classification>)
 ONEDAL_REGISTER_SERIALIZABLE(backend::brute_force_model_impl<task::search>)
 ONEDAL_REGISTER_SERIALIZABLE(backend::kd_tree_model_impl<task::search>)
+ONEDAL_REGISTER_SERIALIZABLE(backend::brute_force_model_impl<task::regression>)
+ONEDAL_REGISTER_SERIALIZABLE(backend::kd_tree_model_impl<task::regression>)
 ONEDAL_REGISTER_SERIALIZABLE(backend::model_interop)
 
 } // namespace v1
@@ -40,6 +40,13 @@ namespace v1 {
 /// Tag-type that parameterizes entities used for solving
 /// :capterm:`classification problem <classification>`.
 struct classification {};
+
+/// Tag-type that parameterizes entities used for solving
+/// :capterm:`regression problem <regression>`. The response is the average of
+/// the responses of the nearest neighbors weighted according to :expr:`voting_mode`.
+struct regression {};
+
+/// Tag-type that parameterizes entities used for solving the search problem
 struct search {};
 
 /// Alias tag-type for classification task.
@@ -47,6 +54,7 @@ using by_default = classification;
 } // namespace v1
 
 using v1::classification;
+using v1::regression;
 using v1::search;
 using v1::by_default;
 
@@ -89,7 +97,8 @@ constexpr bool is_valid_method_v =
     dal::detail::is_one_of_v<Method, method::kd_tree, method::brute_force>;
 
 template <typename Task>
-constexpr bool is_valid_task_v = dal::detail::is_one_of_v<Task, task::classification, task::search>;
+constexpr bool is_valid_task_v =
+    dal::detail::is_one_of_v<Task, task::classification, task::regression, task::search>;
 
 template <typename Distance>
 constexpr bool is_valid_distance_v =
@@ -105,6 +114,16 @@ template <typename T>
 using enable_if_classification_t =
     std::enable_if_t<std::is_same_v<std::decay_t<T>, task::classification>>;
 
+template <typename T>
+using enable_if_regression_t = std::enable_if_t<std::is_same_v<std::decay_t<T>, task::regression>>;
+
+template <typename T>
+using enable_if_not_classification_t =
+    std::enable_if_t<!std::is_same_v<std::decay_t<T>, task::classification>>;
+
+template <typename T>
+using enable_if_not_search_t = std::enable_if_t<!std::is_same_v<std::decay_t<T>, task::search>>;
+
 template <typename T>
 using enable_if_brute_force_t =
     std::enable_if_t<std::is_same_v<std::decay_t<T>, method::brute_force>>;
@@ -153,6 +172,9 @@ using v1::is_valid_task_v;
 using v1::is_valid_distance_v;
 using v1::enable_if_search_t;
 using v1::enable_if_classification_t;
+using v1::enable_if_regression_t;
+using v1::enable_if_not_classification_t;
+using v1::enable_if_not_search_t;
 using v1::enable_if_brute_force_t;
 
 } // namespace detail
@@ -165,7 +187,8 @@ namespace v1 {
 /// @tparam Method      Tag-type that specifies an implementation of algorithm. Can
 ///                     be :expr:`method::brute_force` or :expr:`method::kd_tree`.
 /// @tparam Task        Tag-type that specifies type of the problem to solve. Can
-///                     be :expr:`task::classification`.
+///                     be :expr:`task::classification`, :expr:`task::regression`
+///                     or :expr:`task::search`.
 /// @tparam Distance    The descriptor of the distance used for computations. Can be
 ///                     :expr:`minkowski_distance::descriptor` or
 ///                     :expr:`chebyshev_distance::descriptor`
@@ -209,10 +232,19 @@ public:
         set_neighbor_count(neighbor_count);
     }
 
+    /// Creates a new instance of the class with the given :literal:`neighbor_count`
+    /// property value.
+    /// Used with :expr:`task::regression` only.
+    template <typename T = Task, typename = detail::enable_if_regression_t<T>>
+    explicit descriptor(std::int64_t neighbor_count)
+            : base_t(std::make_shared<detail::distance<distance_t>>(distance_t{})) {
+        set_neighbor_count(neighbor_count);
+    }
+
     /// Creates a new instance of the class with the given :literal:`neighbor_count`
     /// and :literal:`distance` property values.
-    /// Used with :expr:`task::search` only.
-    template <typename T = Task, typename = detail::enable_if_search_t<T>>
+    /// Used with :expr:`task::search` and :expr:`task::regression` only.
+    template <typename T = Task, typename = detail::enable_if_not_classification_t<T>>
     explicit descriptor(std::int64_t neighbor_count, const distance_t& distance)
             : base_t(std::make_shared<detail::distance<distance_t>>(distance)) {
         set_neighbor_count(neighbor_count);
@@ -266,7 +298,8 @@ public:
 };
 
 /// @tparam Task Tag-type that specifies type of the problem to solve. Can
-///              be :expr:`task::classification`.
+///              be :expr:`task::classification`, :expr:`task::regression`
+///              or :expr:`task::search`.
 template <typename Task = task::by_default>
 class model : public base {
     static_assert(detail::is_valid_task_v<Task>);
@@ -102,6 +102,8 @@ template class ONEDAL_EXPORT infer_input<task::classification>;
 template class ONEDAL_EXPORT infer_result<task::classification>;
 template class ONEDAL_EXPORT infer_input<task::search>;
 template class ONEDAL_EXPORT infer_result<task::search>;
+template class ONEDAL_EXPORT infer_input<task::regression>;
+template class ONEDAL_EXPORT infer_result<task::regression>;
 
 } // namespace v1
 } // namespace oneapi::dal::knn
@@ -37,7 +37,8 @@ using v1::infer_result_impl;
 namespace v1 {
 
 /// @tparam Task Tag-type that specifies type of the problem to solve. Can
-///              be :expr:`task::classification`.
+///              be :expr:`task::classification`, :expr:`task::regression`
+///              or :expr:`task::search`.
 template <typename Task = task::by_default>
 class infer_input : public base {
     static_assert(detail::is_valid_task_v<Task>);
@@ -76,7 +77,8 @@ private:
 };
 
 /// @tparam Task Tag-type that specifies type of the problem to solve. Can
-///              be :expr:`task::classification`.
+///              be :expr:`task::classification`, :expr:`task::regression`
+///              or :expr:`task::search`.
 template <typename Task = task::by_default>
 class infer_result {
     static_assert(detail::is_valid_task_v<Task>);
@@ -102,7 +104,7 @@ public:
     /// @remark default = table{}
     const table& get_responses() const;
 
-    template <typename T = Task, typename = detail::enable_if_classification_t<T>>
+    template <typename T = Task, typename = detail::enable_if_not_search_t<T>>
     auto& set_responses(const table& value) {
         set_responses_impl(value);
         return *this;
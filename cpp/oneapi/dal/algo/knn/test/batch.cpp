@@ -68,6 +68,16 @@ public:
         return (this->get_policy().is_gpu() && is_kd_tree);
     }
 
+    bool regression_not_available_on_device() {
+        return this->get_policy().is_gpu();
+    }
+
+    auto get_regression_descriptor(std::int64_t override_neighbor_count,
+                                   knn::voting_mode override_voting_mode) const {
+        return knn::descriptor<Float, Method, knn::task::regression>(override_neighbor_count)
+            .set_voting_mode(override_voting_mode);
+    }
+
     Float classification(const table& train_data,
                          const table& train_responses,
                          const table& infer_data,
@@ -156,6 +166,54 @@ public:
         }
     }
 
+    void regression_check(const table& train_data,
+                          const table& train_responses,
+                          const table& infer_data,
+                          const std::int64_t n_neighbors,
+                          const knn::voting_mode mode) {
+        const auto knn_desc = this->get_regression_descriptor(n_neighbors, mode);
+
+        auto train_result = this->train(knn_desc, train_data, train_responses);
+        auto infer_result = this->infer(knn_desc, infer_data, train_result.get_model());
+        const auto responses = infer_result.get_responses();
+
+        INFO("check if data shape is expected")
+        REQUIRE(infer_data.get_row_count() == responses.get_row_count());
+        REQUIRE(responses.get_column_count() == 1);
+        REQUIRE(te::has_no_nans(responses));
+
+        const auto distances_matrix = distances(train_data, infer_data);
+        const auto indices_matrix = argsort(distances_matrix);
+        const auto train_responses_arr =
+            row_accessor<const Float>(train_responses).pull({ 0, -1 });
+        const auto responses_arr = row_accessor<const Float>(responses).pull({ 0, -1 });
+
+        for (std::int64_t j = 0; j < infer_data.get_row_count(); ++j) {
+            const auto dist_row = row_accessor<const Float>(distances_matrix).pull({ j, j + 1 });
+            const auto idcs_row =
+                row_accessor<const std::int32_t>(indices_matrix).pull({ j, j + 1 });
+
+            double response_sum = 0.0;
+            double weight_sum = 0.0;
+            for (std::int64_t i = 0; i < n_neighbors; ++i) {
+                const auto index = idcs_row[i];
+                const double weight = (mode == knn::voting_mode::uniform)
+                                          ? 1.0
+                                          : 1.0 / std::sqrt(double(dist_row[index]));
+                response_sum += weight * train_responses_arr[index];
+                weight_sum += weight;
+            }
+
+            const double expected = response_sum / weight_sum;
+            const double actual = responses_arr[j];
+            const double tolerance = 1e3 * std::numeric_limits<Float>::epsilon();
+            if (std::abs(expected - actual) > tolerance * std::max(1.0, std::abs(expected))) {
+                CAPTURE(j, expected, actual);
+                FAIL("Predicted response differs from the average of the neighbor responses");
+            }
+        }
+    }
+
     static auto naive_knn_search(const table& train_data, const table& infer_data) {
         const auto distances_matrix = distances(train_data, infer_data);
         const auto indices_matrix = argsort(distances_matrix);
@@ -341,6 +399,32 @@ KNN_SYNTHETIC_TEST("knn nearest points test random uniform 16390x20x5") {
     this->exact_nearest_indices_check(x_train_table, x_infer_table, infer_result);
 }
 
+KNN_SYNTHETIC_TEST("knn regression random uniform 513x301x7") {
+    SKIP_IF(this->regression_not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t train_row_count = 513;
+    constexpr std::int64_t infer_row_count = 301;
+    constexpr std::int64_t column_count = 7;
+    constexpr std::int64_t n_neighbors = 5;
+
+    const auto mode = GENERATE(knn::voting_mode::uniform, knn::voting_mode::distance);
+
+    CAPTURE(train_row_count, infer_row_count, column_count, n_neighbors, mode);
+
+    const auto train_dataframe = GENERATE_DATAFRAME(
+        te::dataframe_builder{ train_row_count, column_count }.fill_uniform(-0.2, 0.5));
+    const table x_train_table = train_dataframe.get_table(this->get_homogen_table_id());
+    const auto infer_dataframe = GENERATE_DATAFRAME(
+        te::dataframe_builder{ infer_row_count, column_count }.fill_uniform(-0.3, 1.));
+    const table x_infer_table = infer_dataframe.get_table(this->get_homogen_table_id());
+    const auto responses_dataframe =
+        GENERATE_DATAFRAME(te::dataframe_builder{ train_row_count, 1 }.fill_uniform(-10., 10.));
+    const table y_train_table = responses_dataframe.get_table(this->get_homogen_table_id());
+
+    this->regression_check(x_train_table, y_train_table, x_infer_table, n_neighbors, mode);
+}
+
 KNN_EXTERNAL_TEST("knn classification hepmass 50kx10k") {
     SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
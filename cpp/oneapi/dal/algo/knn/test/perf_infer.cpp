@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/algo/knn/train.hpp"
+#include "oneapi/dal/algo/knn/infer.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::knn::test {
+
+/// Measures the latency of the inference on small batches, where the time of
+/// the scratch allocations made for each query is comparable to the search itself
+class knn_infer_perf_test {
+public:
+    using float_t = float;
+
+    void train(std::int64_t row_count, std::int64_t column_count, std::int64_t class_count) {
+        column_count_ = column_count;
+        std::mt19937 rng(7777);
+        std::uniform_real_distribution<float_t> uniform(-1.0, 1.0);
+
+        x_train_.resize(row_count * column_count);
+        y_train_.resize(row_count);
+        for (auto& value : x_train_) {
+            value = uniform(rng);
+        }
+        for (std::int64_t i = 0; i < row_count; i++) {
+            y_train_[i] = float_t(i % class_count);
+        }
+
+        desc_ = desc_t(class_count, 5);
+        const auto x = homogen_table::wrap(x_train_.data(), row_count, column_count);
+        const auto y = homogen_table::wrap(y_train_.data(), row_count, 1);
+        model_ = dal::train(desc_, x, y).get_model();
+        train_row_count_ = row_count;
+    }
+
+    void run(std::int64_t batch_row_count) {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float_t> uniform(-1.0, 1.0);
+        std::vector<float_t> x_infer(batch_row_count * column_count_);
+        for (auto& value : x_infer) {
+            value = uniform(rng);
+        }
+        const auto x = homogen_table::wrap(x_infer.data(), batch_row_count, column_count_);
+
+        const auto name =
+            fmt::format("kd_tree infer: train_row_count {}, column_count {}, batch_row_count {}, "
+                        "thread_count {}",
+                        train_row_count_,
+                        column_count_,
+                        batch_row_count,
+                        dal::detail::threader_get_max_threads());
+
+        BENCHMARK(name.c_str()) {
+            return dal::infer(desc_, x, model_).get_responses().get_row_count();
+        };
+    }
+
+private:
+    using desc_t = knn::descriptor<float_t, knn::method::kd_tree>;
+
+    desc_t desc_{ 2, 1 };
+    knn::model<knn::task::classification> model_;
+    std::vector<float_t> x_train_;
+    std::vector<float_t> y_train_;
+    std::int64_t train_row_count_ = 0;
+    std::int64_t column_count_ = 0;
+};
+
+TEST_M(knn_infer_perf_test, "knn small batch inference latency", "[knn][weekly][perf]") {
+    const std::int64_t batch_row_count = GENERATE(1, 8, 64, 512);
+
+    this->train(20000, 16, 4);
+    this->run(batch_row_count);
+}
+
+} // namespace oneapi::dal::knn::test
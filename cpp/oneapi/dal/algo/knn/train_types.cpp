@@ -85,6 +85,8 @@ template class ONEDAL_EXPORT train_input<task::classification>;
 template class ONEDAL_EXPORT train_result<task::classification>;
 template class ONEDAL_EXPORT train_input<task::search>;
 template class ONEDAL_EXPORT train_result<task::search>;
+template class ONEDAL_EXPORT train_input<task::regression>;
+template class ONEDAL_EXPORT train_result<task::regression>;
 
 } // namespace v1
 } // namespace oneapi::dal::knn
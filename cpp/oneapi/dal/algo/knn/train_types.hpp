@@ -37,7 +37,8 @@ using v1::train_result_impl;
 namespace v1 {
 
 /// @tparam Task Tag-type that specifies type of the problem to solve. Can
-///              be :expr:`task::classification`.
+///              be :expr:`task::classification`, :expr:`task::regression`
+///              or :expr:`task::search`.
 template <typename Task = task::by_default>
 class train_input : public base {
     static_assert(detail::is_valid_task_v<Task>);
@@ -75,7 +76,7 @@ public:
     /// @remark default = table{}
     const table& get_responses() const;
 
-    template <typename T = Task, typename = detail::enable_if_classification_t<T>>
+    template <typename T = Task, typename = detail::enable_if_not_search_t<T>>
     auto& set_responses(const table& responses) {
         set_data_impl(responses);
         return *this;
@@ -90,7 +91,8 @@ private:
 };
 
 /// @tparam Task Tag-type that specifies type of the problem to solve. Can
-///              be :expr:`task::classification`.
+///              be :expr:`task::classification`, :expr:`task::regression`
+///              or :expr:`task::search`.
 template <typename Task = task::by_default>
 class train_result {
     static_assert(detail::is_valid_task_v<Task>);
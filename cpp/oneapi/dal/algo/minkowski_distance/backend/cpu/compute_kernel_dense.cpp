@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/minkowski_distance/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/backend/primitives/distance.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::minkowski_distance::backend {
+
+using dal::backend::context_cpu;
+using input_t = compute_input<task::compute>;
+using result_t = compute_result<task::compute>;
+using descriptor_t = detail::descriptor_base<task::compute>;
+
+namespace pr = dal::backend::primitives;
+
+template <typename Float>
+static result_t compute(const context_cpu& ctx, const descriptor_t& desc, const input_t& input) {
+    const auto& x = input.get_x();
+    const auto& y = input.get_y();
+
+    const std::int64_t row_count_x = x.get_row_count();
+    const std::int64_t row_count_y = y.get_row_count();
+    const std::int64_t column_count = x.get_column_count();
+
+    const auto arr_x = row_accessor<const Float>(x).pull();
+    const auto arr_y = row_accessor<const Float>(y).pull();
+    const auto x_nd = pr::ndarray<Float, 2>::wrap(arr_x, { row_count_x, column_count });
+    const auto y_nd = pr::ndarray<Float, 2>::wrap(arr_y, { row_count_y, column_count });
+
+    dal::detail::check_mul_overflow(row_count_x, row_count_y);
+    auto values_nd = pr::ndarray<Float, 2>::empty({ row_count_x, row_count_y });
+
+    pr::compute_distance(ctx, x_nd, y_nd, values_nd, pr::lp_metric<Float>(desc.get_degree()));
+
+    return result_t{}.set_values(
+        homogen_table::wrap(values_nd.flatten(), row_count_x, row_count_y));
+}
+
+template <typename Float>
+struct compute_kernel_cpu<Float, method::dense, task::compute> {
+    result_t operator()(const context_cpu& ctx,
+                        const descriptor_t& desc,
+                        const input_t& input) const {
+        return compute<Float>(ctx, desc, input);
+    }
+};
+
+template struct compute_kernel_cpu<float, method::dense, task::compute>;
+template struct compute_kernel_cpu<double, method::dense, task::compute>;
+
+} // namespace oneapi::dal::minkowski_distance::backend
@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "oneapi/dal/algo/minkowski_distance/compute.hpp"
+
+#include "oneapi/dal/test/engine/fixtures.hpp"
+#include "oneapi/dal/test/engine/math.hpp"
+
+namespace oneapi::dal::minkowski_distance::test {
+
+namespace te = dal::test::engine;
+namespace la = te::linalg;
+
+template <typename TestType>
+class minkowski_distance_batch_test
+        : public te::float_algo_fixture<std::tuple_element_t<0, TestType>> {
+public:
+    using Float = std::tuple_element_t<0, TestType>;
+    using Method = std::tuple_element_t<1, TestType>;
+
+    bool not_available_on_device() {
+        return this->get_policy().is_gpu();
+    }
+
+    auto get_descriptor(double degree) const {
+        return minkowski_distance::descriptor<Float, Method>{ degree };
+    }
+
+    void general_checks(const te::dataframe& x_data,
+                        const te::dataframe& y_data,
+                        double degree) {
+        CAPTURE(degree);
+        const table x = x_data.get_table(this->get_policy(), this->get_homogen_table_id());
+        const table y = y_data.get_table(this->get_policy(), this->get_homogen_table_id());
+
+        INFO("create descriptor")
+        const auto minkowski_distance_desc = get_descriptor(degree);
+
+        INFO("run compute");
+        const auto compute_result = this->compute(minkowski_distance_desc, x, y);
+        const auto result_values = compute_result.get_values();
+
+        INFO("check if result values table shape is expected")
+        REQUIRE(result_values.get_row_count() == x.get_row_count());
+        REQUIRE(result_values.get_column_count() == y.get_row_count());
+
+        INFO("check if there is no NaN in result values table")
+        REQUIRE(te::has_no_nans(result_values));
+
+        INFO("check if result values are expected")
+        const auto reference = compute_reference(degree, x, y);
+        const double tol = te::get_tolerance<Float>(3e-4, 1e-9);
+        const double diff = te::abs_error(reference, result_values);
+        CHECK(diff < tol);
+    }
+
+    la::matrix<double> compute_reference(double degree, const table& x_data, const table& y_data) {
+        const auto x = la::matrix<double>::wrap(x_data);
+        const auto y = la::matrix<double>::wrap(y_data);
+        const std::int64_t column_count = x.get_column_count();
+
+        auto reference = la::matrix<double>::empty({ x.get_row_count(), y.get_row_count() });
+        for (std::int64_t i = 0; i < x.get_row_count(); i++) {
+            for (std::int64_t j = 0; j < y.get_row_count(); j++) {
+                double sum = 0.0;
+                for (std::int64_t k = 0; k < column_count; k++) {
+                    sum += std::pow(std::abs(x.get(i, k) - y.get(j, k)), degree);
+                }
+                reference.set(i, j) = std::pow(sum, 1.0 / degree);
+            }
+        }
+        return reference;
+    }
+};
+
+using minkowski_distance_types =
+    COMBINE_TYPES((float, double), (minkowski_distance::method::dense));
+
+TEMPLATE_LIST_TEST_M(minkowski_distance_batch_test,
+                     "minkowski_distance common flow",
+                     "[minkowski_distance][integration][batch]",
+                     minkowski_distance_types) {
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(this->not_available_on_device());
+
+    const std::int64_t column_count = GENERATE(1, 50, 300);
+
+    const te::dataframe x_data =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 1, column_count }.fill_normal(0, 1, 7777),
+                           te::dataframe_builder{ 100, column_count }.fill_normal(0, 1, 7777),
+                           te::dataframe_builder{ 250, column_count }.fill_normal(0, 1, 7777));
+
+    const te::dataframe y_data =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 1, column_count }.fill_normal(0, 1, 8888),
+                           te::dataframe_builder{ 200, column_count }.fill_normal(0, 1, 8888),
+                           te::dataframe_builder{ 1000, column_count }.fill_normal(0, 1, 8888));
+
+    const double degree = GENERATE(1.0, 2.0, 3.5);
+
+    this->general_checks(x_data, y_data, degree);
+}
+
+} // namespace oneapi::dal::minkowski_distance::test
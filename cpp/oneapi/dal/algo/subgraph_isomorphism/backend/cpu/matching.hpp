@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/sorter.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/solution.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/stack.hpp"
@@ -39,17 +41,22 @@ public:
                     const edge_direction* pdirection,
                     sconsistent_conditions<Cpu> const* pcconditions,
                     kind isomorphism_kind,
+                    result_mode mode,
+                    match_stream<Cpu>* stream,
                     inner_alloc alloc);
     matching_engine(const matching_engine& _matching_engine,
                     stack<Cpu>& _local_stack,
                     inner_alloc alloc);
     virtual ~matching_engine();
 
-    void run_and_wait(global_stack<Cpu>& gstack,
-                      std::int64_t& busy_engine_count,
-                      std::int64_t& current_match_count,
-                      std::int64_t target_match_count,
-                      bool main_engine);
+    void run_and_wait(work_deque<Cpu>* deques,
+                      work_signal<Cpu>& signal,
+                      std::int64_t engine_count,
+                      std::int64_t engine_index,
+                      std::int64_t& pending_state_count,
+                      std::int64_t& idle_engine_count,
+                      std::int64_t& cumulative_match_count,
+                      std::int64_t target_match_count);
     solution<Cpu> get_solution();
     std::int64_t get_match_count() const;
 
@@ -87,10 +94,20 @@ public:
     solution<Cpu> engine_solutions;
 
     kind isomorphism_kind;
+    result_mode mode;
+
+    match_stream<Cpu>* stream;
+    std::int64_t* stream_buffer;
+    std::int64_t stream_buffer_count;
+    std::int64_t match_count;
 
     std::int64_t extract_candidates(bool check_solution);
     bool check_vertex_candidate(bool check_solution, std::int64_t candidate);
-    void set_not_busy(bool& is_busy_engine, std::int64_t& busy_engine_count);
+    bool acquire_state(work_deque<Cpu>* deques,
+                       std::int64_t engine_count,
+                       std::int64_t engine_index);
+    void set_idle(bool is_idle, bool& is_idle_engine, std::int64_t& idle_engine_count);
+    void flush_stream();
 };
 
 template <typename Cpu>
@@ -105,10 +122,18 @@ public:
                   sconsistent_conditions<Cpu> const* pcconditions,
                   float* ppattern_vertex_probability,
                   kind isomorphism_kind,
+                  result_mode mode,
+                  match_stream<Cpu>* stream,
                   inner_alloc alloc);
     virtual ~engine_bundle();
+
+    /// Runs the search and returns the matches if they are stored in the result mode
     solution<Cpu> run(std::int64_t max_match_count);
 
+    /// Returns the number of matches found by the last run, it can exceed
+    /// the maximum number of matches
+    std::int64_t get_match_count() const;
+
     inner_alloc allocator;
     const graph<Cpu>* pattern;
     const graph<Cpu>* target;
@@ -118,6 +143,9 @@ public:
     const sconsistent_conditions<Cpu>* pconsistent_conditions;
     const float* pattern_vertex_probability;
     kind isomorphism_kind;
+    result_mode mode;
+    match_stream<Cpu>* stream;
+    std::int64_t match_count;
 
     solution<Cpu> combine_solutions(matching_engine<Cpu>* engine_array,
                                     std::uint64_t array_size,
@@ -136,6 +164,12 @@ matching_engine<Cpu>::~matching_engine() {
     allocator.deallocate(temporary_list, temporary_list_size);
     temporary_list = nullptr;
     temporary_list_size = 0;
+
+    if (stream_buffer != nullptr) {
+        allocator.deallocate(stream_buffer, stream->get_batch_size() * solution_length);
+        stream_buffer = nullptr;
+    }
+    stream = nullptr;
 }
 
 template <typename Cpu>
@@ -146,13 +180,20 @@ matching_engine<Cpu>::matching_engine(const graph<Cpu>* ppattern,
                                       const edge_direction* pdirection,
                                       sconsistent_conditions<Cpu> const* pcconditions,
                                       kind isomor_kind,
+                                      result_mode mode,
+                                      match_stream<Cpu>* stream,
                                       inner_alloc alloc)
         : allocator(alloc),
           vertex_candidates(bit_vector<Cpu>::bit_vector_size(ptarget->get_vertex_count()), alloc),
           local_stack(alloc),
           hlocal_stack(alloc),
           engine_solutions(ppattern->get_vertex_count(), alloc),
-          isomorphism_kind(isomor_kind) {
+          isomorphism_kind(isomor_kind),
+          mode(mode),
+          stream(stream),
+          stream_buffer(nullptr),
+          stream_buffer_count(0),
+          match_count(0) {
     pattern = ppattern;
     target = ptarget;
     sorted_pattern_vertex = psorted_pattern_vertex;
@@ -172,7 +213,12 @@ matching_engine<Cpu>::matching_engine(const graph<Cpu>* ppattern,
         max_neighbours_size = max_degree;
     }
 
-    hlocal_stack.init(solution_length - 1, target_vertex_count);
+    // An engine runs on each thread, so the levels start from the size of the
+    // neighborhood instead of the whole target and grow on demand
+    const std::int64_t level_size = std::max<std::int64_t>(
+        std::min<std::int64_t>(target_vertex_count, max_neighbours_size + 1),
+        1);
+    hlocal_stack.init(solution_length - 1, level_size);
 
     if (target->bit_representation) {
         temporary_list = nullptr;
@@ -181,6 +227,12 @@ matching_engine<Cpu>::matching_engine(const graph<Cpu>* ppattern,
         temporary_list_size = max_neighbours_size;
         temporary_list = allocator.allocate<std::int64_t>(temporary_list_size);
     }
+
+    if (mode == result_mode::match_stream) {
+        ONEDAL_ASSERT(stream != nullptr);
+        stream_buffer =
+            allocator.allocate<std::int64_t>(stream->get_batch_size() * solution_length);
+    }
 }
 
 template <typename Cpu>
@@ -194,6 +246,8 @@ matching_engine<Cpu>::matching_engine(const matching_engine& _matching_engine,
                           _matching_engine.direction,
                           _matching_engine.pconsistent_conditions,
                           _matching_engine.isomorphism_kind,
+                          _matching_engine.mode,
+                          _matching_engine.stream,
                           alloc) {
     local_stack = std::move(_local_stack);
 }
@@ -267,6 +321,17 @@ bool matching_engine<Cpu>::check_vertex_candidate(bool check_solution, std::int6
     std::uint64_t solution_length_unsigned = solution_length;
     if (match_vertex(sorted_pattern_vertex[hlocal_stack.get_current_level()], candidate)) {
         if (check_solution && hlocal_stack.get_current_level() + 1 == solution_length_unsigned) {
+            if (mode == result_mode::match_count) {
+                return true;
+            }
+            if (mode == result_mode::match_stream) {
+                hlocal_stack.fill_solution(stream_buffer + stream_buffer_count * solution_length,
+                                           candidate);
+                if (++stream_buffer_count == stream->get_batch_size()) {
+                    flush_stream();
+                }
+                return true;
+            }
             std::int64_t* solution_core = allocator.allocate<std::int64_t>(solution_length);
             if (solution_core != nullptr) {
                 hlocal_stack.fill_solution(solution_core, candidate);
@@ -356,7 +421,15 @@ solution<Cpu> matching_engine<Cpu>::get_solution() {
 
 template <typename Cpu>
 std::int64_t matching_engine<Cpu>::get_match_count() const {
-    return engine_solutions.get_solution_count();
+    return match_count;
+}
+
+template <typename Cpu>
+void matching_engine<Cpu>::flush_stream() {
+    if (stream_buffer_count > 0) {
+        stream->flush(stream_buffer, stream_buffer_count);
+        stream_buffer_count = 0;
+    }
 }
 
 template <typename Cpu>
@@ -384,62 +457,102 @@ bool matching_engine<Cpu>::check_if_max_match_count_reached(std::int64_t& cumula
 }
 
 template <typename Cpu>
-void matching_engine<Cpu>::set_not_busy(bool& is_busy_engine, std::int64_t& busy_engine_count) {
-    if (is_busy_engine) {
-        is_busy_engine = false;
-        dal::detail::atomic_decrement(busy_engine_count);
+void matching_engine<Cpu>::set_idle(bool is_idle,
+                                    bool& is_idle_engine,
+                                    std::int64_t& idle_engine_count) {
+    if (is_idle != is_idle_engine) {
+        is_idle_engine = is_idle;
+        if (is_idle) {
+            dal::detail::atomic_increment(idle_engine_count);
+        }
+        else {
+            dal::detail::atomic_decrement(idle_engine_count);
+        }
     }
 }
 
 template <typename Cpu>
-void matching_engine<Cpu>::run_and_wait(global_stack<Cpu>& gstack,
-                                        std::int64_t& busy_engine_count,
-                                        std::int64_t& cumulative_match_count,
-                                        std::int64_t target_match_count,
-                                        bool main_engine) {
-    if (main_engine) {
-        first_states_generator(hlocal_stack);
+bool matching_engine<Cpu>::acquire_state(work_deque<Cpu>* deques,
+                                         std::int64_t engine_count,
+                                         std::int64_t engine_index) {
+    if (deques[engine_index].pop(hlocal_stack)) {
+        return true;
+    }
+    for (std::int64_t i = 1; i < engine_count; ++i) {
+        if (deques[(engine_index + i) % engine_count].steal(hlocal_stack)) {
+            return true;
+        }
     }
-    bool is_busy_engine = true;
-    std::int64_t current_match_count = 0;
+    return false;
+}
+
+/// Explores the states of the own deque and steals the states of the other engines
+/// once the own deque is drained. The number of pending states counts the states
+/// in the deques and the engines that explore a state, it reaches zero only when
+/// the whole search tree is explored. As the states are moved between the deques
+/// and the engines without changing the counter, an engine that has not started yet
+/// holds no work and the others never wait for it. The engine that finds no work
+/// blocks until a state is shared or another engine leaves the search.
+template <typename Cpu>
+void matching_engine<Cpu>::run_and_wait(work_deque<Cpu>* deques,
+                                        work_signal<Cpu>& signal,
+                                        std::int64_t engine_count,
+                                        std::int64_t engine_index,
+                                        std::int64_t& pending_state_count,
+                                        std::int64_t& idle_engine_count,
+                                        std::int64_t& cumulative_match_count,
+                                        std::int64_t target_match_count) {
+    bool is_idle_engine = false;
     ONEDAL_ASSERT(pattern != nullptr);
     for (;;) {
         if (target_match_count > 0 &&
             dal::detail::atomic_load(cumulative_match_count) >= target_match_count) {
-            set_not_busy(is_busy_engine, busy_engine_count);
+            break;
+        }
+        if (stream != nullptr && stream->is_stopped()) {
             break;
         }
         if (hlocal_stack.states_in_stack() > 0) {
-            while ((hlocal_stack.states_in_stack() > 5) && gstack.push(hlocal_stack))
-                ;
-            ONEDAL_ASSERT(hlocal_stack.states_in_stack() > 0);
+            // The state closest to the root is shared once some engine runs out of work
+            // and the previously shared states are already taken
+            if (dal::detail::atomic_load(idle_engine_count) > 0 &&
+                deques[engine_index].get_count() == 0) {
+                dal::detail::atomic_increment(pending_state_count);
+                if (deques[engine_index].push(hlocal_stack)) {
+                    signal.notify();
+                }
+                else {
+                    dal::detail::atomic_decrement(pending_state_count);
+                }
+            }
             const auto delta = state_exploration();
-            current_match_count += delta;
+            match_count += delta;
             if (target_match_count > 0 && check_if_max_match_count_reached(cumulative_match_count,
                                                                            delta,
                                                                            target_match_count)) {
-                set_not_busy(is_busy_engine, busy_engine_count);
                 break;
             }
+            if (hlocal_stack.states_in_stack() == 0) {
+                dal::detail::atomic_decrement(pending_state_count);
+            }
         }
         else {
-            gstack.pop(hlocal_stack);
-            if (hlocal_stack.empty()) {
-                set_not_busy(is_busy_engine, busy_engine_count);
-                if (target_match_count > 0 &&
-                    dal::detail::atomic_load(cumulative_match_count) >= target_match_count) {
-                    break;
-                }
-                if (dal::detail::atomic_load(busy_engine_count) == 0)
-                    break;
+            const std::int64_t epoch = signal.get_epoch();
+            if (acquire_state(deques, engine_count, engine_index)) {
+                set_idle(false, is_idle_engine, idle_engine_count);
+                continue;
             }
-            else if (!is_busy_engine) {
-                is_busy_engine = true;
-                dal::detail::atomic_increment(busy_engine_count);
+            set_idle(true, is_idle_engine, idle_engine_count);
+            if (dal::detail::atomic_load(pending_state_count) == 0) {
+                break;
             }
+            signal.wait(epoch);
         }
     }
-    return;
+    set_idle(false, is_idle_engine, idle_engine_count);
+    flush_stream();
+    // The engines that wait for the work check whether the search has ended
+    signal.notify();
 }
 
 template <typename Cpu>
@@ -451,6 +564,8 @@ engine_bundle<Cpu>::engine_bundle(const graph<Cpu>* ppattern,
                                   sconsistent_conditions<Cpu> const* pcconditions,
                                   float* ppattern_vertex_probability,
                                   kind isomor_kind,
+                                  result_mode mode,
+                                  match_stream<Cpu>* stream,
                                   inner_alloc alloc)
         : exploration_stack(alloc),
           allocator(alloc),
@@ -461,7 +576,10 @@ engine_bundle<Cpu>::engine_bundle(const graph<Cpu>* ppattern,
           direction(pdirection),
           pconsistent_conditions(pcconditions),
           pattern_vertex_probability(ppattern_vertex_probability),
-          isomorphism_kind(isomor_kind) {}
+          isomorphism_kind(isomor_kind),
+          mode(mode),
+          stream(stream),
+          match_count(0) {}
 
 template <typename Cpu>
 engine_bundle<Cpu>::~engine_bundle() {
@@ -484,14 +602,15 @@ solution<Cpu> engine_bundle<Cpu>::combine_solutions(matching_engine<Cpu>* engine
         std::uint64_t engine_max_match_count = 0;
         std::uint64_t total_combined_count = 0;
         for (std::uint64_t i = 0; i < array_size; i++) {
-            std::uint64_t match_count = engine_array[i].get_match_count();
+            std::uint64_t match_count = engine_array[i].engine_solutions.get_solution_count();
             if (match_count > engine_max_match_count) {
                 engine_max_match_count = match_count;
                 engine_max_index = i;
             }
         }
         if (engine_max_match_count != 0) {
-            total_combined_count += engine_array[engine_max_index].get_match_count();
+            total_combined_count +=
+                engine_array[engine_max_index].engine_solutions.get_solution_count();
             bundle_solutions.append(engine_array[engine_max_index].get_solution());
         }
         else
@@ -504,32 +623,25 @@ solution<Cpu> engine_bundle<Cpu>::combine_solutions(matching_engine<Cpu>* engine
     return bundle_solutions;
 }
 
+template <typename Cpu>
+std::int64_t engine_bundle<Cpu>::get_match_count() const {
+    return match_count;
+}
+
 template <typename Cpu>
 solution<Cpu> engine_bundle<Cpu>::run(std::int64_t max_match_count) {
     std::int64_t degree = pattern->get_vertex_degree(sorted_pattern_vertex[0]);
 
-    std::uint64_t first_states_count =
+    const std::int64_t first_states_count =
         pattern_vertex_probability[0] * target->get_vertex_count() + 1;
-    std::uint64_t max_threads_count = dal::detail::threader_get_max_threads();
-    std::uint64_t possible_first_states_count_per_thread = first_states_count / max_threads_count;
-    if (possible_first_states_count_per_thread < 1) {
-        possible_first_states_count_per_thread = 1;
-    }
-    else {
-        possible_first_states_count_per_thread +=
-            static_cast<bool>(first_states_count % max_threads_count);
-    }
+    const std::int64_t engine_count = dal::detail::threader_get_max_threads();
 
-    const std::uint64_t array_size =
-        (max_threads_count >= 64)
-            ? max_threads_count * 2 / 10
-            : (max_threads_count >= 24)
-                  ? max_threads_count * 4 / 10
-                  : (max_threads_count >= 8) ? 4 : (max_threads_count >= 4) ? 2 : 1;
-    auto engine_array_ptr = allocator.make_shared_memory<matching_engine<Cpu>>(array_size);
+    auto engine_array_ptr = allocator.make_shared_memory<matching_engine<Cpu>>(engine_count);
     matching_engine<Cpu>* engine_array = engine_array_ptr.get();
+    auto deque_array_ptr = allocator.make_shared_memory<work_deque<Cpu>>(engine_count);
+    work_deque<Cpu>* deque_array = deque_array_ptr.get();
 
-    for (std::uint64_t i = 0; i < array_size; ++i) {
+    for (std::int64_t i = 0; i < engine_count; ++i) {
         new (engine_array + i) matching_engine<Cpu>(pattern,
                                                     target,
                                                     sorted_pattern_vertex,
@@ -537,40 +649,51 @@ solution<Cpu> engine_bundle<Cpu>::run(std::int64_t max_match_count) {
                                                     direction,
                                                     pconsistent_conditions,
                                                     isomorphism_kind,
+                                                    mode,
+                                                    stream,
                                                     allocator);
+        new (deque_array + i) work_deque<Cpu>(pattern->get_vertex_count(), allocator);
+        deque_array[i].reserve(first_states_count / engine_count + 1);
     }
 
-    state<Cpu> null_state(allocator);
-    std::uint64_t task_counter = 0, index = 0;
+    // The first states are dealt round-robin, so the engines start with the even
+    // share of work and steal only to balance the subtrees of different size
+    std::int64_t pending_state_count = 0;
     for (std::int64_t i = 0; i < target->get_vertex_count(); ++i) {
         if (degree <= target->get_vertex_degree(i) &&
             pattern->get_vertex_attribute(sorted_pattern_vertex[0]) ==
                 target->get_vertex_attribute(i)) {
-            index = task_counter % array_size;
-            engine_array[index].push_into_stack(i);
-
-            if ((engine_array[index].hlocal_stack.states_in_stack() /
-                 possible_first_states_count_per_thread) > 0) {
-                task_counter++;
-            }
+            deque_array[pending_state_count % engine_count].push_first_state(i);
+            pending_state_count++;
         }
     }
 
-    global_stack<Cpu> gstack(pattern->get_vertex_count(), allocator);
-    std::int64_t busy_engine_count(array_size);
-    std::int64_t cumulative_match_count(0);
-    dal::detail::threader_for(array_size, array_size, [&](const int index) {
-        engine_array[index].run_and_wait(gstack,
-                                         busy_engine_count,
+    std::int64_t idle_engine_count = 0;
+    std::int64_t cumulative_match_count = 0;
+    work_signal<Cpu> signal;
+    dal::detail::threader_for(engine_count, engine_count, [&](const int index) {
+        engine_array[index].run_and_wait(deque_array,
+                                         signal,
+                                         engine_count,
+                                         index,
+                                         pending_state_count,
+                                         idle_engine_count,
                                          cumulative_match_count,
-                                         max_match_count,
-                                         false);
+                                         max_match_count);
     });
 
-    auto aggregated_solution = combine_solutions(engine_array, array_size, max_match_count);
+    match_count = 0;
+    for (std::int64_t i = 0; i < engine_count; i++) {
+        match_count += engine_array[i].get_match_count();
+    }
+
+    auto aggregated_solution = (mode == result_mode::vertex_match)
+                                   ? combine_solutions(engine_array, engine_count, max_match_count)
+                                   : solution<Cpu>(pattern->get_vertex_count(), allocator);
 
-    for (std::uint64_t i = 0; i < array_size; i++) {
+    for (std::int64_t i = 0; i < engine_count; i++) {
         engine_array[i].~matching_engine();
+        deque_array[i].~work_deque();
     }
     return aggregated_solution;
 }
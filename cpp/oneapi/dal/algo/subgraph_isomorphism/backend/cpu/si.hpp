@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/graph.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/solution.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/sorter.hpp"
@@ -30,10 +32,11 @@ using namespace oneapi::dal::preview::subgraph_isomorphism::backend;
 template <typename Cpu>
 oneapi::dal::homogen_table si(const graph<Cpu>& pattern,
                               const graph<Cpu>& target,
-                              kind isomorphism_kind,
-                              std::int64_t max_match_count,
-                              detail::byte_alloc_iface* alloc_ptr) {
+                              const detail::descriptor_base<task::compute>& desc,
+                              detail::byte_alloc_iface* alloc_ptr,
+                              std::int64_t& match_count) {
     inner_alloc local_allocator(alloc_ptr);
+    const std::int64_t max_match_count = desc.get_max_match_count();
 
     sorter<Cpu> sorter_graph(&target, local_allocator);
     std::int64_t pattern_vetrex_count = pattern.get_vertex_count();
@@ -64,6 +67,15 @@ oneapi::dal::homogen_table si(const graph<Cpu>& pattern,
                                             cconditions.get(),
                                             true);
 
+    std::unique_ptr<match_stream<Cpu>> stream;
+    if (desc.get_result_mode() == result_mode::match_stream) {
+        stream.reset(new match_stream<Cpu>(desc.get_match_callback(),
+                                           desc.get_match_batch_size(),
+                                           pattern_vetrex_count,
+                                           sorted_pattern_vertex_array,
+                                           max_match_count));
+    }
+
     engine_bundle<Cpu> harness(&pattern,
                                &target,
                                sorted_pattern_vertex_array,
@@ -71,22 +83,36 @@ oneapi::dal::homogen_table si(const graph<Cpu>& pattern,
                                direction.get(),
                                cconditions.get(),
                                pattern_vertex_probability.get(),
-                               isomorphism_kind,
+                               desc.get_kind(),
+                               desc.get_result_mode(),
+                               stream.get(),
                                local_allocator);
     const solution<Cpu> results = harness.run(max_match_count);
 
+    switch (desc.get_result_mode()) {
+        case result_mode::vertex_match: match_count = results.get_solution_count(); break;
+        case result_mode::match_stream: match_count = stream->get_match_count(); break;
+        default: match_count = harness.get_match_count(); break;
+    }
+    if (max_match_count != 0) {
+        match_count = std::min(match_count, max_match_count);
+    }
+
     for (std::int64_t i = 0; i < (pattern_vetrex_count - 1); i++) {
         cconditions_array[i].~sconsistent_conditions();
     }
     cconditions = nullptr;
 
+    if (stream) {
+        stream->rethrow_if_failed();
+    }
+
     return results.export_as_table(sorted_pattern_vertex_array, max_match_count);
 }
 
 template <typename Cpu>
 subgraph_isomorphism::graph_matching_result<task::compute> si_call_kernel(
-    const kind& si_kind,
-    std::int64_t max_match_count,
+    const detail::descriptor_base<task::compute>& desc,
     detail::byte_alloc_iface* alloc_ptr,
     const dal::preview::detail::topology<std::int32_t>& t_data,
     const dal::preview::detail::topology<std::int32_t>& p_data,
@@ -102,12 +128,12 @@ subgraph_isomorphism::graph_matching_result<task::compute> si_call_kernel(
         pattern.set_vertex_attribute(p_data._vertex_count, vv_p);
     }
 
+    std::int64_t match_count = 0;
     const oneapi::dal::homogen_table results =
-        si<Cpu>(pattern, target, si_kind, max_match_count, alloc_ptr);
+        si<Cpu>(pattern, target, desc, alloc_ptr, match_count);
 
-    const auto solution_count = results.get_row_count();
     return graph_matching_result<task::compute>().set_vertex_match(results).set_match_count(
-        (max_match_count == 0) ? solution_count : std::min(solution_count, max_match_count));
+        match_count);
 }
 
 } // namespace oneapi::dal::preview::subgraph_isomorphism::backend
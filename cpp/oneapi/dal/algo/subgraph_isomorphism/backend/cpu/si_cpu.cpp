@@ -18,15 +18,15 @@
 
 namespace oneapi::dal::preview::subgraph_isomorphism::backend {
 
-template oneapi::dal::homogen_table si<__CPU_TAG__>(const graph<__CPU_TAG__>& pattern,
-                                                    const graph<__CPU_TAG__>& target,
-                                                    kind isomorphism_kind,
-                                                    std::int64_t max_match_count,
-                                                    detail::byte_alloc_iface* alloc_ptr);
+template oneapi::dal::homogen_table si<__CPU_TAG__>(
+    const graph<__CPU_TAG__>& pattern,
+    const graph<__CPU_TAG__>& target,
+    const detail::descriptor_base<task::compute>& desc,
+    detail::byte_alloc_iface* alloc_ptr,
+    std::int64_t& match_count);
 
 template subgraph_isomorphism::graph_matching_result<task::compute> si_call_kernel<__CPU_TAG__>(
-    const kind& si_kind,
-    std::int64_t max_match_count,
+    const detail::descriptor_base<task::compute>& desc,
     detail::byte_alloc_iface* alloc_ptr,
     const dal::preview::detail::topology<std::int32_t>& t_data,
     const dal::preview::detail::topology<std::int32_t>& p_data,
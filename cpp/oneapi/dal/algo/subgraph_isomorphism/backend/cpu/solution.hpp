@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <exception>
+
+#include "oneapi/dal/algo/subgraph_isomorphism/common.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/inner_alloc.hpp"
 #include "oneapi/dal/table/column_accessor.hpp"
 #include "oneapi/dal/detail/threading.hpp"
@@ -68,6 +71,59 @@ public:
     void delete_data();
 };
 
+/// Passes the matches found by the engines to the user callback. The engines
+/// collect the matches into their own buffers of the batch size and flush
+/// the full buffers, so no match is stored longer than one batch.
+template <typename Cpu>
+class match_stream {
+public:
+    match_stream(const match_callback& callback,
+                 std::int64_t batch_size,
+                 std::int64_t solution_core_length,
+                 const std::int64_t* sorted_pattern_vertices,
+                 std::int64_t max_match_count);
+
+    match_stream(const match_stream&) = delete;
+    match_stream& operator=(const match_stream&) = delete;
+
+    std::int64_t get_batch_size() const {
+        return batch_size_;
+    }
+
+    /// The number of matches passed to the callback
+    std::int64_t get_match_count() const {
+        return match_count_;
+    }
+
+    /// Passes `count` matches with the vertices in the search order to the callback.
+    /// The matches beyond the maximum number of matches are dropped. The exception
+    /// thrown by the callback is stored and the matches that follow are dropped.
+    void flush(const std::int64_t* matches, std::int64_t count);
+
+    /// Whether the callback has thrown and the engines have to stop the search
+    bool is_stopped() const {
+        return dal::detail::atomic_load(const_cast<std::int64_t&>(stop_flag_)) != 0;
+    }
+
+    /// Rethrows the exception thrown by the callback in the calling thread
+    void rethrow_if_failed() const {
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+private:
+    dal::detail::mutex mutex_;
+    std::exception_ptr error_;
+    std::int64_t stop_flag_ = 0;
+    match_callback callback_;
+    std::int64_t batch_size_;
+    std::int64_t solution_core_length_;
+    dal::array<std::int64_t> mapping_;
+    std::int64_t max_match_count_;
+    std::int64_t match_count_ = 0;
+};
+
 template <typename Cpu>
 state<Cpu>::state(inner_alloc a) : allocator(a) {
     core = nullptr;
@@ -273,4 +329,60 @@ oneapi::dal::homogen_table solution<Cpu>::export_as_table(std::int64_t* sorted_p
         .reset(arr_solution, export_solution_count, solution_core_length)
         .build();
 }
+
+template <typename Cpu>
+match_stream<Cpu>::match_stream(const match_callback& callback,
+                                std::int64_t batch_size,
+                                std::int64_t solution_core_length,
+                                const std::int64_t* sorted_pattern_vertices,
+                                std::int64_t max_match_count)
+        : callback_(callback),
+          batch_size_(batch_size),
+          solution_core_length_(solution_core_length),
+          mapping_(dal::array<std::int64_t>::empty(solution_core_length)),
+          max_match_count_(max_match_count) {
+    const auto begin = sorted_pattern_vertices;
+    const auto end = &sorted_pattern_vertices[solution_core_length];
+    const auto mapping = mapping_.get_mutable_data();
+    for (std::int64_t j = 0; j < solution_core_length; ++j) {
+        const auto p = std::find(begin, end, j);
+        ONEDAL_ASSERT(p != end, "Index not found");
+        mapping[j] = p - begin;
+    }
+}
+
+template <typename Cpu>
+void match_stream<Cpu>::flush(const std::int64_t* matches, std::int64_t count) {
+    const dal::detail::scoped_lock lock(mutex_);
+    if (error_) {
+        return;
+    }
+    if (max_match_count_ != 0) {
+        count = min(count, max_match_count_ - match_count_);
+    }
+    if (count <= 0) {
+        return;
+    }
+
+    auto arr_batch = dal::array<int>::empty(solution_core_length_ * count);
+    const auto arr = arr_batch.get_mutable_data();
+    const auto mapping = mapping_.get_data();
+    for (std::int64_t i = 0; i < count; ++i) {
+        for (std::int64_t j = 0; j < solution_core_length_; ++j) {
+            arr[i * solution_core_length_ + j] = matches[i * solution_core_length_ + mapping[j]];
+        }
+    }
+
+    match_count_ += count;
+    try {
+        callback_(dal::detail::homogen_table_builder{}
+                      .reset(arr_batch, count, solution_core_length_)
+                      .build());
+    }
+    catch (...) {
+        // The exception cannot leave the thread of the engine
+        error_ = std::current_exception();
+        dal::detail::atomic_increment(stop_flag_);
+    }
+}
 } // namespace oneapi::dal::preview::subgraph_isomorphism::backend
@@ -22,5 +22,6 @@ namespace oneapi::dal::preview::subgraph_isomorphism::backend {
 
 template struct state<__CPU_TAG__>;
 template class solution<__CPU_TAG__>;
+template class match_stream<__CPU_TAG__>;
 
 } // namespace oneapi::dal::preview::subgraph_isomorphism::backend
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/inner_alloc.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/solution.hpp"
 #include "oneapi/dal/algo/subgraph_isomorphism/backend/cpu/compiler_adapt.hpp"
@@ -51,7 +54,7 @@ template <typename Cpu>
 class dfs_stack;
 
 template <typename Cpu>
-class global_stack;
+class work_deque;
 
 template <typename Cpu>
 class vertex_stack {
@@ -77,55 +80,117 @@ private:
     std::uint64_t* bottom_;
 
     friend class dfs_stack<Cpu>;
-    friend class global_stack<Cpu>;
+    friend class work_deque<Cpu>;
 };
 
 template <typename Cpu>
 class dfs_stack;
 
+/// Per-engine deque of the search states shared for work stealing. Each state
+/// is a partial match stored as a fixed-width record of `vertex_count` target
+/// vertices padded with the null vertex. The owner engine pushes and pops
+/// the states at the top, the other engines steal the oldest states at the
+/// bottom, which are the closest to the root of the search tree.
 template <typename Cpu>
-class global_stack {
+class work_deque {
 public:
-    global_stack(std::int64_t vertex_count, inner_alloc alloc)
+    work_deque(std::int64_t vertex_count, inner_alloc alloc)
             : allocator(alloc),
               vertex_count_(vertex_count) {}
 
-    global_stack(const global_stack&) = delete;
-    global_stack(global_stack&&) = delete;
+    work_deque(const work_deque&) = delete;
+    work_deque(work_deque&&) = delete;
 
-    ~global_stack() {
+    ~work_deque() {
         clear();
     }
 
-    global_stack& operator=(const global_stack&) = delete;
-    global_stack& operator=(global_stack&&) = delete;
+    work_deque& operator=(const work_deque&) = delete;
+    work_deque& operator=(work_deque&&) = delete;
+
+    /// Makes the deque able to hold `count` states without growing
+    void reserve(std::int64_t count);
 
+    /// Pushes the single-vertex state at the first level of the search
+    void push_first_state(std::uint64_t vertex_id);
+
+    /// Moves the not yet explored state closest to the root of the search tree
+    /// from the stack into the deque
+    ///
+    /// @return `false` if the stack has only the states on the current search path
     bool push(dfs_stack<Cpu>& s);
-    void pop(dfs_stack<Cpu>& s);
+
+    /// Moves the newest state into the empty stack
+    bool pop(dfs_stack<Cpu>& s);
+
+    /// Moves the oldest state into the empty stack. Called by the other engines
+    bool steal(dfs_stack<Cpu>& s);
+
+    /// Lock-free estimate of the number of states, used to skip the empty deques
+    std::int64_t get_count() const {
+        return dal::detail::atomic_load(const_cast<std::int64_t&>(count_));
+    }
 
 private:
     void internal_push(dfs_stack<Cpu>& s, std::uint64_t level);
+    void load(dfs_stack<Cpu>& s, const std::uint64_t* v) const;
     void clear();
-    void grow();
+    void grow(std::int64_t new_capacity);
 
     static constexpr std::uint64_t null_vertex() {
         return static_cast<std::uint64_t>(-1);
     }
 
     std::int64_t size() const {
-        return (bottom_ != nullptr && vertex_count_ != 0) ? (top_ - bottom_) / vertex_count_ : 0;
+        return (vertex_count_ != 0) ? (top_ - head_) / vertex_count_ : 0;
     }
 
     bool empty() const {
-        return (size() == 0);
+        return (head_ == top_);
     }
 
     dal::detail::mutex mutex_;
     inner_alloc allocator;
     std::int64_t vertex_count_;
     std::uint64_t* bottom_{ nullptr };
+    std::uint64_t* head_{ nullptr };
     std::uint64_t* top_{ nullptr };
     std::int64_t capacity_{ 0 };
+    std::int64_t count_{ 0 };
+};
+
+/// Blocks the idle engines until the work appears or the search ends. The epoch
+/// is read before the last attempt to acquire the work, and the engine waits only
+/// while no notification has been sent after that, so no notification is lost.
+template <typename Cpu>
+class work_signal {
+public:
+    std::int64_t get_epoch() {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return epoch_;
+    }
+
+    /// Wakes up the waiting engines, called when a state is shared or an engine
+    /// leaves the search
+    void notify() {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            ++epoch_;
+        }
+        condition_.notify_all();
+    }
+
+    void wait(std::int64_t epoch) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [&]() {
+            return epoch_ != epoch;
+        });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::int64_t epoch_ = 0;
 };
 
 template <typename Cpu>
@@ -170,7 +235,7 @@ protected:
 private:
     void delete_data();
 
-    friend class global_stack<Cpu>;
+    friend class work_deque<Cpu>;
 };
 
 template <typename Cpu>
@@ -398,82 +463,116 @@ void vertex_stack<Cpu>::increase_stack_size() {
 }
 
 template <typename Cpu>
-bool global_stack<Cpu>::push(dfs_stack<Cpu>& s) {
-    for (auto level = s.get_current_level_index(); level > 0; --level) {
+void work_deque<Cpu>::reserve(std::int64_t count) {
+    const dal::detail::scoped_lock lock(mutex_);
+    if (count > capacity_) {
+        grow(count);
+    }
+}
+
+template <typename Cpu>
+void work_deque<Cpu>::push_first_state(std::uint64_t vertex_id) {
+    const dal::detail::scoped_lock lock(mutex_);
+    if (top_ == bottom_ + capacity_ * vertex_count_) {
+        grow((head_ != bottom_) ? capacity_ : capacity_ * 2);
+    }
+
+    *(top_++) = vertex_id;
+    for (std::int64_t j = 1; j < vertex_count_; ++j) {
+        *(top_++) = null_vertex();
+    }
+    dal::detail::atomic_increment(count_);
+}
+
+template <typename Cpu>
+bool work_deque<Cpu>::push(dfs_stack<Cpu>& s) {
+    // States at the lower levels root larger subtrees, so they are shared first
+    for (std::uint64_t level = 0; level <= s.get_current_level_index(); ++level) {
         if (s.data_by_levels[level].size() > 1) {
             internal_push(s, level);
             return true;
         }
     }
+    return false;
+}
 
-    if (s.data_by_levels[0].size() > 1) {
-        internal_push(s, 0);
-        return true;
+template <typename Cpu>
+bool work_deque<Cpu>::pop(dfs_stack<Cpu>& s) {
+    ONEDAL_ASSERT(s.empty());
+    if (get_count() == 0) {
+        return false;
     }
 
-    return false;
+    const dal::detail::scoped_lock lock(mutex_);
+    if (empty()) {
+        return false;
+    }
+    top_ -= vertex_count_;
+    ONEDAL_ASSERT(top_ >= head_);
+    load(s, top_);
+    if (empty()) {
+        head_ = top_ = bottom_;
+    }
+    dal::detail::atomic_decrement(count_);
+    return true;
 }
 
 template <typename Cpu>
-void global_stack<Cpu>::pop(dfs_stack<Cpu>& s) {
+bool work_deque<Cpu>::steal(dfs_stack<Cpu>& s) {
     ONEDAL_ASSERT(s.empty());
+    if (get_count() == 0) {
+        return false;
+    }
+
     const dal::detail::scoped_lock lock(mutex_);
-    if (!empty()) {
-        // const auto& v = data_.top();
-        const auto v = top_ - vertex_count_;
-        ONEDAL_ASSERT(v >= bottom_);
-        for (std::int64_t i = 0; i < vertex_count_ && v[i] != null_vertex(); ++i) {
-            ONEDAL_ASSERT(i <= dal::detail::integral_cast<std::int64_t>(s.max_level_size));
-            s.push_into_current_level(v[i]);
-            if (i != vertex_count_ - 1 && v[i + 1] != null_vertex()) {
-                s.increase_core_level();
-            }
+    if (empty()) {
+        return false;
+    }
+    load(s, head_);
+    head_ += vertex_count_;
+    ONEDAL_ASSERT(head_ <= top_);
+    if (empty()) {
+        head_ = top_ = bottom_;
+    }
+    dal::detail::atomic_decrement(count_);
+    return true;
+}
+
+template <typename Cpu>
+void work_deque<Cpu>::load(dfs_stack<Cpu>& s, const std::uint64_t* v) const {
+    for (std::int64_t i = 0; i < vertex_count_ && v[i] != null_vertex(); ++i) {
+        ONEDAL_ASSERT(i <= dal::detail::integral_cast<std::int64_t>(s.max_level_size));
+        s.push_into_current_level(v[i]);
+        if (i != vertex_count_ - 1 && v[i + 1] != null_vertex()) {
+            s.increase_core_level();
         }
-        top_ = v;
     }
 }
 
 template <typename Cpu>
-void global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
+void work_deque<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
     ONEDAL_ASSERT(vertex_count_ >= 0);
-    // Collect state and push back
     {
-        const auto v = allocator.allocate<std::uint64_t>(level + 1);
+        const dal::detail::scoped_lock lock(mutex_);
+        if (top_ == bottom_ + capacity_ * vertex_count_) {
+            grow((head_ != bottom_) ? capacity_ : capacity_ * 2);
+        }
 
+        ONEDAL_ASSERT(top_ + vertex_count_ <= bottom_ + capacity_ * vertex_count_);
         for (std::uint64_t i = 0; i < level; ++i) {
             ONEDAL_ASSERT(i < s.max_level_size);
-            ONEDAL_ASSERT(s.data_by_levels[i].ptop != nullptr);
             ONEDAL_ASSERT(s.data_by_levels[i].ptop != s.data_by_levels[i].bottom_);
-            ONEDAL_ASSERT(s.data_by_levels[i].ptop >= s.data_by_levels[i].bottom_);
-            ONEDAL_ASSERT(s.data_by_levels[i].ptop <=
-                          s.data_by_levels[i].stack_data + s.data_by_levels[i].stack_size);
-            v[i] = s.data_by_levels[i].ptop[-1];
+            *(top_++) = s.data_by_levels[i].ptop[-1];
         }
 
         ONEDAL_ASSERT(level < s.max_level_size);
-        ONEDAL_ASSERT(s.data_by_levels[level].ptop != nullptr);
         ONEDAL_ASSERT(s.data_by_levels[level].bottom_ != nullptr);
         ONEDAL_ASSERT(s.data_by_levels[level].ptop != s.data_by_levels[level].bottom_);
-        ONEDAL_ASSERT(s.data_by_levels[level].ptop >= s.data_by_levels[level].bottom_);
-        ONEDAL_ASSERT(s.data_by_levels[level].ptop <=
-                      s.data_by_levels[level].stack_data + s.data_by_levels[level].stack_size);
-        v[level] = *(s.data_by_levels[level].bottom_);
-
-        const dal::detail::scoped_lock lock(mutex_);
-        if (size() >= capacity_) {
-            grow();
-        }
-
-        ONEDAL_ASSERT(top_ + vertex_count_ <= bottom_ + capacity_ * vertex_count_);
-        std::uint64_t j = 0;
-        for (; j <= level; ++j) {
-            *(top_++) = v[j];
-        }
-        for (; j < static_cast<std::uint64_t>(vertex_count_); ++j) {
+        *(top_++) = *(s.data_by_levels[level].bottom_);
+        for (std::uint64_t j = level + 1; j < static_cast<std::uint64_t>(vertex_count_); ++j) {
             *(top_++) = null_vertex();
         }
-
-        allocator.deallocate(v, level + 1);
+        dal::detail::atomic_increment(count_);
     }
 
     // Remove state
@@ -481,32 +580,35 @@ void global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
 }
 
 template <typename Cpu>
-void global_stack<Cpu>::clear() {
+void work_deque<Cpu>::clear() {
     if (bottom_ != nullptr) {
-        ONEDAL_ASSERT(top_ != nullptr);
         allocator.deallocate(bottom_,
                              (capacity_ * vertex_count_ > 0) ? capacity_ * vertex_count_ : 1);
         bottom_ = nullptr;
+        head_ = nullptr;
         top_ = nullptr;
         capacity_ = 0;
     }
 }
 
 template <typename Cpu>
-void global_stack<Cpu>::grow() {
-    const std::int64_t new_capacity = (capacity_ > 0) ? capacity_ * 2 : 1;
+void work_deque<Cpu>::grow(std::int64_t new_capacity) {
+    new_capacity = (new_capacity > size()) ? new_capacity : size() + 1;
     const auto new_bottom = allocator.allocate<uint64_t>(
         (new_capacity * vertex_count_ > 0) ? new_capacity * vertex_count_ : 1);
     const auto new_top = new_bottom + size() * vertex_count_;
 
+    // The stolen records at the bottom are dropped while copying, so the call
+    // with the same capacity compacts the deque
     ONEDAL_IVDEP
-    for (auto dest = new_bottom, src = bottom_; dest != new_top;) {
+    for (auto dest = new_bottom, src = head_; dest != new_top;) {
         *(dest++) = *(src++);
     }
 
     clear();
 
     bottom_ = new_bottom;
+    head_ = new_bottom;
     top_ = new_top;
     capacity_ = new_capacity;
 }
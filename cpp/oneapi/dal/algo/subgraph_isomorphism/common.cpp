@@ -24,6 +24,9 @@ public:
     bool semantic_match = false;
     std::int64_t max_match_count = 0;
     kind _kind = kind::induced;
+    result_mode mode = result_mode::vertex_match;
+    match_callback callback;
+    std::int64_t match_batch_size = 1024;
 };
 
 template <typename Task>
@@ -44,6 +47,21 @@ std::int64_t descriptor_base<Task>::get_max_match_count() const {
     return impl_->max_match_count;
 }
 
+template <typename Task>
+result_mode descriptor_base<Task>::get_result_mode() const {
+    return impl_->mode;
+}
+
+template <typename Task>
+const match_callback& descriptor_base<Task>::get_match_callback() const {
+    return impl_->callback;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_match_batch_size() const {
+    return impl_->match_batch_size;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_kind(kind kind) {
     impl_->_kind = kind;
@@ -59,6 +77,21 @@ void descriptor_base<Task>::set_max_match_count(std::int64_t max_match_count) {
     impl_->max_match_count = max_match_count;
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_result_mode(result_mode value) {
+    impl_->mode = value;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_match_callback(const match_callback& callback) {
+    impl_->callback = callback;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_match_batch_size(std::int64_t batch_size) {
+    impl_->match_batch_size = batch_size;
+}
+
 template class ONEDAL_EXPORT descriptor_base<task::compute>;
 
 } // namespace oneapi::dal::preview::subgraph_isomorphism::detail
@@ -15,6 +15,9 @@
 *******************************************************************************/
 
 #pragma once
+
+#include <functional>
+
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
 #include "oneapi/dal/table/common.hpp"
@@ -33,6 +36,23 @@ using by_default = fast;
 
 enum class kind { induced, non_induced };
 
+/// Available identifiers to specify the form in which the matches are returned
+enum class result_mode {
+    /// The result contains the table of matches and their number
+    vertex_match,
+    /// The result contains only the number of matches, the matches are not stored
+    match_count,
+    /// The matches are passed to the match callback in batches as they are found,
+    /// the result contains only the number of matches
+    match_stream
+};
+
+/// The callback that receives the batch of matches in the :expr:`result_mode::match_stream`
+/// mode. The batch is the table with a row per match, the $j$-th column contains
+/// the target vertex matched to the $j$-th pattern vertex. The callback is called
+/// from different threads, but never concurrently.
+using match_callback = std::function<void(const table& matches)>;
+
 namespace detail {
 struct descriptor_tag {};
 
@@ -68,10 +88,22 @@ public:
     /// Returns the maximum number of matches to search
     auto get_max_match_count() const -> std::int64_t;
 
+    /// Returns the form in which the matches are returned
+    auto get_result_mode() const -> subgraph_isomorphism::result_mode;
+
+    /// Returns the callback that receives the matches in the streaming mode
+    auto get_match_callback() const -> const match_callback&;
+
+    /// Returns the maximum number of matches passed to the callback at once
+    auto get_match_batch_size() const -> std::int64_t;
+
 protected:
     void set_kind(kind value);
     void set_semantic_match(bool semantic_match);
     void set_max_match_count(std::int64_t max_match_count);
+    void set_result_mode(subgraph_isomorphism::result_mode value);
+    void set_match_callback(const match_callback& callback);
+    void set_match_batch_size(std::int64_t batch_size);
 
     dal::detail::pimpl<descriptor_impl<Task>> impl_;
 };
@@ -141,6 +173,47 @@ public:
         return *this;
     }
 
+    /// Returns the form in which the matches are returned
+    subgraph_isomorphism::result_mode get_result_mode() const {
+        return base_t::get_result_mode();
+    }
+
+    /// Sets the form in which the matches are returned. In the
+    /// :expr:`result_mode::match_count` and :expr:`result_mode::match_stream` modes
+    /// the matches are not stored, so the memory does not depend on their number
+    ///
+    /// @param [in] value  The result mode
+    auto& set_result_mode(subgraph_isomorphism::result_mode value) {
+        base_t::set_result_mode(value);
+        return *this;
+    }
+
+    /// Returns the callback that receives the matches in the streaming mode
+    const match_callback& get_match_callback() const {
+        return base_t::get_match_callback();
+    }
+
+    /// Sets the callback that receives the matches in the :expr:`result_mode::match_stream` mode
+    ///
+    /// @param [in] callback  The match callback
+    auto& set_match_callback(const match_callback& callback) {
+        base_t::set_match_callback(callback);
+        return *this;
+    }
+
+    /// Returns the maximum number of matches passed to the callback at once
+    std::int64_t get_match_batch_size() const {
+        return base_t::get_match_batch_size();
+    }
+
+    /// Sets the maximum number of matches passed to the callback at once
+    ///
+    /// @param [in] batch_size  The batch size, shall be greater than zero
+    auto& set_match_batch_size(std::int64_t batch_size) {
+        base_t::set_match_batch_size(batch_size);
+        return *this;
+    }
+
     Allocator get_allocator() const {
         return _alloc;
     }
@@ -23,16 +23,14 @@ namespace oneapi::dal::preview::subgraph_isomorphism::detail {
 template <>
 ONEDAL_EXPORT subgraph_isomorphism::graph_matching_result<task::compute> call_kernel(
     const dal::detail::host_policy& policy,
-    const kind& si_kind,
-    std::int64_t max_match_count,
+    const descriptor_base<task::compute>& desc,
     byte_alloc_iface* alloc_ptr,
     const dal::preview::detail::topology<std::int32_t>& t_data,
     const dal::preview::detail::topology<std::int32_t>& p_data,
     std::int64_t* vv_t,
     std::int64_t* vv_p) {
     return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
-        return backend::si_call_kernel<decltype(cpu)>(si_kind,
-                                                      max_match_count,
+        return backend::si_call_kernel<decltype(cpu)>(desc,
                                                       alloc_ptr,
                                                       t_data,
                                                       p_data,
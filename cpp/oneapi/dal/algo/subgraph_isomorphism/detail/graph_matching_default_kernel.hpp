@@ -31,8 +31,7 @@ namespace oneapi::dal::preview::subgraph_isomorphism::detail {
 template <typename Task>
 subgraph_isomorphism::graph_matching_result<Task> call_kernel(
     const dal::detail::host_policy& ctx,
-    const kind& desc,
-    std::int64_t max_match_count,
+    const descriptor_base<Task>& desc,
     byte_alloc_iface* alloc_ptr,
     const dal::preview::detail::topology<std::int32_t>& t_data,
     const dal::preview::detail::topology<std::int32_t>& p_data,
@@ -81,8 +80,7 @@ struct call_subgraph_isomorphism_kernel_cpu {
             throw unimplemented(msg::subgraph_isomorphism_is_not_implemented_for_labeled_edges());
         }
         auto result = call_kernel<task::compute>(ctx,
-                                                 desc.get_kind(),
-                                                 desc.get_max_match_count(),
+                                                 desc,
                                                  alloc_ptr,
                                                  t_data,
                                                  p_data,
@@ -114,8 +112,7 @@ struct call_subgraph_isomorphism_kernel_cpu<Allocator,
         const dal::preview::detail::vertex_values<oneapi::dal::preview::empty_value>& vv_p,
         const dal::preview::detail::edge_values<oneapi::dal::preview::empty_value>& ev_p) {
         auto result = call_kernel<task::compute>(ctx,
-                                                 desc.get_kind(),
-                                                 desc.get_max_match_count(),
+                                                 desc,
                                                  alloc_ptr,
                                                  t_data,
                                                  p_data);
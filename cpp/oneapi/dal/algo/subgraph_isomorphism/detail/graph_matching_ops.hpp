@@ -84,6 +84,14 @@ struct graph_matching_ops {
         if (desc.get_max_match_count() < 0) {
             throw invalid_argument(msg::max_match_count_lt_zero());
         }
+        if (desc.get_result_mode() == result_mode::match_stream) {
+            if (!desc.get_match_callback()) {
+                throw invalid_argument(msg::match_callback_is_empty());
+            }
+            if (desc.get_match_batch_size() <= 0) {
+                throw invalid_argument(msg::match_batch_size_leq_zero());
+            }
+        }
     }
 
     template <typename Policy>
@@ -168,6 +168,23 @@ public:
         const auto result =
             dal::preview::graph_matching(subgraph_isomorphism_desc, target_graph, pattern_graph);
     }
+
+    template <typename TargetGraphType, typename PatternGraphType>
+    void check_match_stream(const dal::preview::subgraph_isomorphism::match_callback& callback,
+                            std::int64_t batch_size) {
+        const auto target_graph = create_graph<TargetGraphType>();
+        const auto pattern_graph = create_graph<PatternGraphType>();
+
+        std::allocator<char> alloc;
+        const auto subgraph_isomorphism_desc =
+            dal::preview::subgraph_isomorphism::descriptor<>(alloc)
+                .set_result_mode(dal::preview::subgraph_isomorphism::result_mode::match_stream)
+                .set_match_callback(callback)
+                .set_match_batch_size(batch_size);
+
+        const auto result =
+            dal::preview::graph_matching(subgraph_isomorphism_desc, target_graph, pattern_graph);
+    }
 };
 
 #define SUBGRAPH_ISOMORPHISM_BADARG_TEST(name) \
@@ -216,6 +233,22 @@ SUBGRAPH_ISOMORPHISM_BADARG_TEST("Throws if target graph is smaller than pattern
                       invalid_argument);
 }
 
+SUBGRAPH_ISOMORPHISM_BADARG_TEST("Throws if match callback is empty in streaming mode") {
+    REQUIRE_THROWS_AS(
+        (this->check_match_stream<double_triangle_target_type, double_triangle_target_type>(
+            nullptr,
+            16)),
+        invalid_argument);
+}
+
+SUBGRAPH_ISOMORPHISM_BADARG_TEST("Throws if match batch size is not positive") {
+    REQUIRE_THROWS_AS(
+        (this->check_match_stream<double_triangle_target_type, double_triangle_target_type>(
+            [](const table&) {},
+            0)),
+        invalid_argument);
+}
+
 // SUBGRAPH_ISOMORPHISM_BADARG_TEST("Throws if semantic match is true") {
 //     REQUIRE_THROWS_AS(
 //         (this->check_subgraph_isomorphism<double_triangle_target_type, double_triangle_target_type>(
@@ -0,0 +1,154 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/algo/subgraph_isomorphism/graph_matching.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::algo::subgraph_isomorphism::test {
+
+namespace si = dal::preview::subgraph_isomorphism;
+
+using graph_t = dal::preview::undirected_adjacency_vector_graph<std::int32_t>;
+using edge_list_t = std::vector<std::pair<std::int32_t, std::int32_t>>;
+
+class subgraph_isomorphism_perf_test {
+public:
+    /// Generates the target with power-law degree distribution by preferential
+    /// attachment: each new vertex is connected to `attachment_count` vertices chosen
+    /// with the probability proportional to their degree. The earliest vertices
+    /// become hubs, so the subtrees of the search differ by orders of magnitude.
+    void generate_target(std::int32_t vertex_count, std::int32_t attachment_count) {
+        std::mt19937 rng(7777);
+        edge_list_t edges;
+        std::vector<std::int32_t> endpoints = { 0, 1 };
+        edges.emplace_back(0, 1);
+        for (std::int32_t v = 2; v < vertex_count; v++) {
+            for (std::int32_t k = 0; k < attachment_count; k++) {
+                std::uniform_int_distribution<std::size_t> uniform(0, endpoints.size() - 1);
+                const std::int32_t u = endpoints[uniform(rng)];
+                edges.emplace_back(v, u);
+                endpoints.push_back(v);
+                endpoints.push_back(u);
+            }
+        }
+        target_ = create_graph(vertex_count, edges);
+        target_vertex_count_ = vertex_count;
+        target_edge_count_ = edges.size();
+    }
+
+    /// Limits the number of threads the search runs on, zero means no limit
+    void set_max_thread_count(std::int32_t max_thread_count) {
+        policy_.set_max_thread_count(max_thread_count);
+    }
+
+    void run(const std::string& pattern_name,
+             std::int32_t pattern_vertex_count,
+             const edge_list_t& pattern_edges,
+             si::kind kind) {
+        const auto pattern = create_graph(pattern_vertex_count, pattern_edges);
+        const auto desc = si::descriptor<>(std::allocator<char>{}).set_kind(kind);
+        const auto thread_count = dal::backend::execute_in_arena(policy_, []() {
+            return dal::detail::threader_get_max_threads();
+        });
+        const auto name =
+            fmt::format("{} {}, target vertex_count {}, edge_count {}, thread_count {}",
+                        kind == si::kind::induced ? "induced" : "non-induced",
+                        pattern_name,
+                        target_vertex_count_,
+                        target_edge_count_,
+                        thread_count);
+
+        // The search runs in the arena of the policy, so the engines are created
+        // for the threads of the arena only
+        BENCHMARK(name.c_str()) {
+            return dal::backend::execute_in_arena(policy_, [&]() {
+                return dal::preview::graph_matching(desc, target_, pattern).get_match_count();
+            });
+        };
+    }
+
+private:
+    static graph_t create_graph(std::int32_t vertex_count, const edge_list_t& edges) {
+        edge_list_t directed_edges;
+        directed_edges.reserve(edges.size() * 2);
+        for (const auto& [u, v] : edges) {
+            if (u != v) {
+                directed_edges.emplace_back(u, v);
+                directed_edges.emplace_back(v, u);
+            }
+        }
+        std::sort(directed_edges.begin(), directed_edges.end());
+        directed_edges.erase(std::unique(directed_edges.begin(), directed_edges.end()),
+                             directed_edges.end());
+
+        graph_t graph;
+        auto& graph_impl = oneapi::dal::detail::get_impl(graph);
+        auto& vertex_allocator = graph_impl._vertex_allocator;
+        auto& edge_allocator = graph_impl._edge_allocator;
+
+        using int32_traits_t =
+            std::allocator_traits<std::allocator<char>>::rebind_traits<std::int32_t>;
+        using int64_traits_t =
+            std::allocator_traits<std::allocator<char>>::rebind_traits<std::int64_t>;
+        const std::int64_t cols_count = directed_edges.size();
+        std::int32_t* degrees = int32_traits_t::allocate(vertex_allocator, vertex_count);
+        std::int32_t* cols = int32_traits_t::allocate(vertex_allocator, cols_count);
+        std::int64_t* rows = int64_traits_t::allocate(edge_allocator, vertex_count + 1);
+
+        std::fill(degrees, degrees + vertex_count, 0);
+        for (std::int64_t i = 0; i < cols_count; i++) {
+            degrees[directed_edges[i].first]++;
+            cols[i] = directed_edges[i].second;
+        }
+        rows[0] = 0;
+        for (std::int32_t i = 0; i < vertex_count; i++) {
+            rows[i + 1] = rows[i] + degrees[i];
+        }
+
+        graph_impl.set_topology(vertex_count, cols_count / 2, rows, cols, cols_count, degrees);
+        return graph;
+    }
+
+    dal::detail::host_policy policy_;
+    graph_t target_;
+    std::int64_t target_vertex_count_ = 0;
+    std::int64_t target_edge_count_ = 0;
+};
+
+TEST_M(subgraph_isomorphism_perf_test,
+       "subgraph isomorphism on power-law target",
+       "[subgraph_isomorphism][weekly][perf]") {
+    const std::int32_t vertex_count = GENERATE(10000, 100000);
+    const std::int32_t attachment_count = GENERATE(4, 16);
+    const auto kind = GENERATE(si::kind::induced, si::kind::non_induced);
+    const std::int32_t max_thread_count = GENERATE(1, 2, 4, 0);
+
+    this->set_max_thread_count(max_thread_count);
+    this->generate_target(vertex_count, attachment_count);
+    this->run("triangle", 3, { { 0, 1 }, { 1, 2 }, { 2, 0 } }, kind);
+    this->run("4-cycle", 4, { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 } }, kind);
+    this->run("paw", 4, { { 0, 1 }, { 1, 2 }, { 2, 0 }, { 2, 3 } }, kind);
+}
+
+} // namespace oneapi::dal::algo::subgraph_isomorphism::test
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <initializer_list>
+#include <stdexcept>
 
 #include "oneapi/dal/algo/subgraph_isomorphism/graph_matching.hpp"
 #include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
@@ -1873,6 +1874,80 @@ public:
             kind == isomorphism_kind::induced,
             is_vertex_labeled));
     }
+
+    template <typename TargetGraphType, typename PatternGraphType>
+    void check_result_modes(isomorphism_kind kind,
+                            std::int64_t max_match_count,
+                            std::int64_t batch_size,
+                            std::int64_t expected_match_count) {
+        using dal::preview::subgraph_isomorphism::result_mode;
+
+        const auto target_graph = create_graph<TargetGraphType>();
+        const auto pattern_graph = create_graph<PatternGraphType>();
+        auto desc = dal::preview::subgraph_isomorphism::descriptor<>(std::allocator<char>())
+                        .set_kind(kind)
+                        .set_max_match_count(max_match_count);
+
+        INFO("check match count mode")
+        desc.set_result_mode(result_mode::match_count);
+        const auto count_result = dal::preview::graph_matching(desc, target_graph, pattern_graph);
+        REQUIRE(count_result.get_match_count() == expected_match_count);
+        REQUIRE(!count_result.get_vertex_match().has_data());
+
+        INFO("check match stream mode")
+        // The callback is called from the worker threads, so the batches are checked afterwards
+        std::vector<table> batches;
+        desc.set_result_mode(result_mode::match_stream)
+            .set_match_batch_size(batch_size)
+            .set_match_callback([&](const table &matches) {
+                batches.push_back(matches);
+            });
+        const auto stream_result = dal::preview::graph_matching(desc, target_graph, pattern_graph);
+        REQUIRE(stream_result.get_match_count() == expected_match_count);
+        REQUIRE(!stream_result.get_vertex_match().has_data());
+
+        std::int64_t streamed_match_count = 0;
+        for (const auto &matches : batches) {
+            REQUIRE(matches.get_row_count() <= batch_size);
+            REQUIRE(check_isomorphism_result<TargetGraphType, PatternGraphType>(
+                matches,
+                kind == isomorphism_kind::induced,
+                false));
+            streamed_match_count += matches.get_row_count();
+        }
+        REQUIRE(streamed_match_count == expected_match_count);
+    }
+
+    template <typename TargetGraphType, typename PatternGraphType>
+    void check_throwing_callback(isomorphism_kind kind, std::int64_t expected_match_count) {
+        using dal::preview::subgraph_isomorphism::result_mode;
+
+        const auto target_graph = create_graph<TargetGraphType>();
+        const auto pattern_graph = create_graph<PatternGraphType>();
+
+        // The callbacks are serialized, and none is called after the first one throws
+        std::int64_t call_count = 0;
+        auto desc = dal::preview::subgraph_isomorphism::descriptor<>(std::allocator<char>())
+                        .set_kind(kind)
+                        .set_result_mode(result_mode::match_stream)
+                        .set_match_batch_size(1)
+                        .set_match_callback([&](const table &matches) {
+                            call_count++;
+                            throw std::runtime_error("exception from the match callback");
+                        });
+        REQUIRE_THROWS_AS(dal::preview::graph_matching(desc, target_graph, pattern_graph),
+                          std::runtime_error);
+        REQUIRE(call_count == 1);
+
+        INFO("check the search with the same descriptor after the exception")
+        std::int64_t streamed_match_count = 0;
+        desc.set_match_callback([&](const table &matches) {
+            streamed_match_count += matches.get_row_count();
+        });
+        const auto result = dal::preview::graph_matching(desc, target_graph, pattern_graph);
+        REQUIRE(result.get_match_count() == expected_match_count);
+        REQUIRE(streamed_match_count == expected_match_count);
+    }
 };
 
 #define SUBGRAPH_ISOMORPHISM_INDUCED_TEST(name) \
@@ -1896,6 +1971,30 @@ SUBGRAPH_ISOMORPHISM_INDUCED_TEST("Induced: Bit target representation, all match
                                                                        20);
 }
 
+SUBGRAPH_ISOMORPHISM_INDUCED_TEST("Induced: match count and match stream modes") {
+    this->check_result_modes<double_triangle_target_type, double_triangle_pattern_type>(
+        isomorphism_kind::induced,
+        0,
+        5,
+        12);
+    this->check_result_modes<double_triangle_target_type, double_triangle_pattern_type>(
+        isomorphism_kind::induced,
+        7,
+        5,
+        7);
+    this->check_result_modes<lolipop_10_15_type, path_16_type>(isomorphism_kind::induced,
+                                                               0,
+                                                               3,
+                                                               20);
+}
+
+SUBGRAPH_ISOMORPHISM_INDUCED_TEST("Induced: exception thrown by the match callback") {
+    this->check_throwing_callback<double_triangle_target_type, double_triangle_pattern_type>(
+        isomorphism_kind::induced,
+        12);
+    this->check_throwing_callback<lolipop_10_15_type, path_16_type>(isomorphism_kind::induced, 20);
+}
+
 // SUBGRAPH_ISOMORPHISM_INDUCED_TEST(
 //     "Induced: Bit target representation, single vertex pattern check") {
 //     this->check_subgraph_isomorphism<k_6_type, single_vertex_type>(false,
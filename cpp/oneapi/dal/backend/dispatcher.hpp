@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <exception>
+#include <optional>
+
 #include "oneapi/dal/detail/policy.hpp"
 #include "oneapi/dal/backend/common.hpp"
 #include "oneapi/dal/backend/dispatcher_cpu.hpp"
@@ -60,11 +63,49 @@ private:
     detail::cpu_extension cpu_extensions_;
 };
 
+/// Runs the operation in the task arena of the host policy and returns its result.
+/// The exceptions thrown by the operation are rethrown in the calling thread.
+template <typename Op>
+inline auto execute_in_arena(const detail::host_policy& ctx, Op&& op) {
+    using result_t = std::invoke_result_t<Op>;
+    std::exception_ptr error;
+    if constexpr (std::is_void_v<result_t>) {
+        ctx.execute([&]() {
+            try {
+                op();
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+        });
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    else {
+        std::optional<result_t> result;
+        ctx.execute([&]() {
+            try {
+                result.emplace(op());
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+        });
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return std::move(*result);
+    }
+}
+
 template <typename CpuKernel>
 struct kernel_dispatcher<CpuKernel> {
     template <typename... Args>
     auto operator()(const detail::host_policy& ctx, Args&&... args) const {
-        return CpuKernel()(context_cpu{ ctx }, std::forward<Args>(args)...);
+        return execute_in_arena(ctx, [&]() {
+            return CpuKernel()(context_cpu{ ctx }, std::forward<Args>(args)...);
+        });
     }
 };
 
@@ -125,6 +125,19 @@ inline daal::data_management::NumericTablePtr convert_to_daal_table(const homoge
     return copy_to_daal_homogen_table<Data>(table);
 }
 
+/// Columns without missing values are wrapped, otherwise the values are copied with
+/// the missing ones replaced by NaNs
+template <typename Data>
+inline daal::data_management::NumericTablePtr convert_to_daal_table(
+    const detail::columnar_table& table) {
+    for (std::int64_t i = 0; i < table.get_column_count(); i++) {
+        if (table.get_column_null_count(i) > 0) {
+            return copy_to_daal_homogen_table<Data>(table);
+        }
+    }
+    return host_soa_table_adapter::create(table);
+}
+
 template <typename T>
 inline auto convert_to_daal_csr_table(array<T>& data,
                                       array<std::int64_t>& column_indices,
@@ -235,6 +248,10 @@ inline daal::data_management::NumericTablePtr convert_to_daal_table(const table&
         const auto& csr = static_cast<const detail::csr_table&>(table);
         return convert_to_daal_table<Data>(csr);
     }
+    else if (table.get_kind() == detail::columnar_table::kind()) {
+        const auto& columnar = static_cast<const detail::columnar_table&>(table);
+        return convert_to_daal_table<Data>(columnar);
+    }
     else {
         return copy_to_daal_homogen_table<Data>(table);
     }
@@ -137,6 +137,23 @@ ONEDAL_EXPORT void _onedal_del_mutex(void *mutex_ptr) {
     _daal_del_mutex(mutex_ptr);
 }
 
+ONEDAL_EXPORT void *_onedal_new_arena(std::int32_t max_threads,
+                                      const std::int32_t *cpus,
+                                      std::int32_t cpu_count,
+                                      std::int32_t numa_node) {
+    return _daal_new_arena(max_threads, cpus, cpu_count, numa_node);
+}
+
+ONEDAL_EXPORT void _onedal_del_arena(void *arena_ptr) {
+    _daal_del_arena(arena_ptr);
+}
+
+ONEDAL_EXPORT void _onedal_execute_in_arena(void *arena_ptr,
+                                            const void *a,
+                                            oneapi::dal::preview::functype_arena func) {
+    _daal_execute_in_arena(arena_ptr, a, static_cast<daal::functype_arena>(func));
+}
+
 namespace oneapi::dal::detail {
 
 typedef std::pair<std::int32_t, size_t> pair_int32_t_size_t;
@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#if defined(_WIN32) || defined(_WIN64)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+
+#include "oneapi/dal/backend/mapped_file.hpp"
+
+namespace oneapi::dal::backend {
+
+#if defined(_WIN32) || defined(_WIN64)
+
+mapped_file::mapped_file(const std::string& file_name) {
+    HANDLE file = CreateFileA(file_name.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw invalid_argument(detail::error_messages::file_not_found());
+    }
+    file_handle_ = file;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        CloseHandle(file);
+        throw internal_error(detail::error_messages::failed_to_map_file());
+    }
+    size_ = static_cast<std::int64_t>(file_size.QuadPart);
+
+    if (size_ > 0) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr) {
+            CloseHandle(file);
+            throw internal_error(detail::error_messages::failed_to_map_file());
+        }
+        mapping_handle_ = mapping;
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            throw internal_error(detail::error_messages::failed_to_map_file());
+        }
+        data_ = static_cast<const char*>(view);
+    }
+}
+
+mapped_file::~mapped_file() {
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_) {
+        CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    }
+    if (file_handle_) {
+        CloseHandle(static_cast<HANDLE>(file_handle_));
+    }
+}
+
+#else
+
+mapped_file::mapped_file(const std::string& file_name) {
+    file_descriptor_ = open(file_name.c_str(), O_RDONLY);
+    if (file_descriptor_ < 0) {
+        throw invalid_argument(detail::error_messages::file_not_found());
+    }
+
+    struct stat file_stat;
+    if (fstat(file_descriptor_, &file_stat) != 0) {
+        close(file_descriptor_);
+        throw internal_error(detail::error_messages::failed_to_map_file());
+    }
+    size_ = static_cast<std::int64_t>(file_stat.st_size);
+
+    if (size_ > 0) {
+        void* view = mmap(nullptr,
+                          detail::integral_cast<std::size_t>(size_),
+                          PROT_READ,
+                          MAP_PRIVATE,
+                          file_descriptor_,
+                          0);
+        if (view == MAP_FAILED) {
+            close(file_descriptor_);
+            throw internal_error(detail::error_messages::failed_to_map_file());
+        }
+        // Chunks of the file are consumed by different threads,
+        // so ask the kernel to read ahead the whole range
+        madvise(view, detail::integral_cast<std::size_t>(size_), MADV_WILLNEED);
+        data_ = static_cast<const char*>(view);
+    }
+}
+
+mapped_file::~mapped_file() {
+    if (data_) {
+        munmap(const_cast<char*>(data_), static_cast<std::size_t>(size_));
+    }
+    if (file_descriptor_ >= 0) {
+        close(file_descriptor_);
+    }
+}
+
+#endif
+
+std::vector<const char*> split_by_lines(const char* begin,
+                                        const char* end,
+                                        std::int64_t max_chunk_count) {
+    ONEDAL_ASSERT(begin <= end);
+    ONEDAL_ASSERT(max_chunk_count > 0);
+
+    const std::int64_t size = end - begin;
+    const std::int64_t chunk_count = std::max<std::int64_t>(std::min(max_chunk_count, size), 1);
+    const std::int64_t chunk_size = size / chunk_count;
+
+    std::vector<const char*> bounds;
+    bounds.reserve(chunk_count + 1);
+    bounds.push_back(begin);
+
+    for (std::int64_t i = 1; i < chunk_count; i++) {
+        const char* candidate = std::max(begin + i * chunk_size, bounds.back());
+        const auto left = static_cast<std::size_t>(end - candidate);
+        const void* newline = left > 0 ? std::memchr(candidate, '\n', left) : nullptr;
+        if (!newline) {
+            break;
+        }
+        const char* next = static_cast<const char*>(newline) + 1;
+        if (next > bounds.back() && next < end) {
+            bounds.push_back(next);
+        }
+    }
+
+    bounds.push_back(end);
+    return bounds;
+}
+
+} // namespace oneapi::dal::backend
@@ -73,3 +73,73 @@ FUNC_TEMPLATE(fpk_lapack,
               SYEVD_C_DECLARGS,
               SYEVD_F_CALLARGS,
               SYEVD_C_CALLARGS)
+
+/* ================================== GEMM ================================== */
+#define GEMM_F_DECLARGS(Float) \
+    (const char* transa,       \
+     const char* transb,       \
+     const DAAL_INT* m,        \
+     const DAAL_INT* n,        \
+     const DAAL_INT* k,        \
+     const Float* alpha,       \
+     const Float* a,           \
+     const DAAL_INT* lda,      \
+     const Float* b,           \
+     const DAAL_INT* ldb,      \
+     const Float* beta,        \
+     Float* c,                 \
+     const DAAL_INT* ldc)
+
+#define GEMM_C_DECLARGS(Float) \
+    (char transa,              \
+     char transb,              \
+     std::int64_t m,           \
+     std::int64_t n,           \
+     std::int64_t k,           \
+     Float alpha,              \
+     const Float* a,           \
+     std::int64_t lda,         \
+     const Float* b,           \
+     std::int64_t ldb,         \
+     Float beta,               \
+     Float* c,                 \
+     std::int64_t ldc)
+
+#define GEMM_F_CALLARGS (transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc)
+
+#define GEMM_C_CALLARGS                 \
+    (&transa,                           \
+     &transb,                           \
+     reinterpret_cast<DAAL_INT*>(&m),   \
+     reinterpret_cast<DAAL_INT*>(&n),   \
+     reinterpret_cast<DAAL_INT*>(&k),   \
+     &alpha,                            \
+     a,                                 \
+     reinterpret_cast<DAAL_INT*>(&lda), \
+     b,                                 \
+     reinterpret_cast<DAAL_INT*>(&ldb), \
+     &beta,                             \
+     c,                                 \
+     reinterpret_cast<DAAL_INT*>(&ldc))
+
+// Sequential versions of GEMM have `x` prefix, so `FUNC_TEMPLATE` cannot be used
+FUNC(fpk_blas, xsgemm, GEMM_F_DECLARGS(float), GEMM_F_CALLARGS)
+FUNC(fpk_blas, xdgemm, GEMM_F_DECLARGS(double), GEMM_F_CALLARGS)
+
+namespace oneapi::dal::backend::micromkl {
+
+template <typename Cpu, typename Float>
+void gemm GEMM_C_DECLARGS(Float) {
+    static_assert(sizeof(std::int64_t) == sizeof(DAAL_INT));
+    if constexpr (std::is_same_v<Float, float>) {
+        fpk_blas_xsgemm<Cpu> GEMM_C_CALLARGS;
+    }
+    else {
+        fpk_blas_xdgemm<Cpu> GEMM_C_CALLARGS;
+    }
+}
+
+INSTANTIATE_FLOAT(gemm, float, GEMM_C_DECLARGS)
+INSTANTIATE_FLOAT(gemm, double, GEMM_C_DECLARGS)
+
+} // namespace oneapi::dal::backend::micromkl
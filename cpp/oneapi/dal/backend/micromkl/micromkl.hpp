@@ -33,4 +33,20 @@ void syevd(char jobz,
            std::int64_t liwork,
            std::int64_t& info);
 
+/// Sequential GEMM, it is called from the threads that process different blocks of the matrix
+template <typename Cpu, typename Float>
+void gemm(char transa,
+          char transb,
+          std::int64_t m,
+          std::int64_t n,
+          std::int64_t k,
+          Float alpha,
+          const Float* a,
+          std::int64_t lda,
+          const Float* b,
+          std::int64_t ldb,
+          Float beta,
+          Float* c,
+          std::int64_t ldc);
+
 } // namespace oneapi::dal::backend::micromkl
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/backend/primitives/distance/distance.hpp"
+#include "oneapi/dal/backend/primitives/distance/metrics.hpp"
+
+namespace oneapi::dal::backend::primitives {
+
+template <typename Float, typename Metric>
+void compute_distance(const context_cpu& ctx,
+                      const ndview<Float, 2>& inp1,
+                      const ndview<Float, 2>& inp2,
+                      ndview<Float, 2>& out,
+                      const Metric& metric) {
+    ONEDAL_ASSERT(inp1.get_dimension(1) == inp2.get_dimension(1));
+    ONEDAL_ASSERT(out.get_dimension(0) == inp1.get_dimension(0));
+    ONEDAL_ASSERT(out.get_dimension(1) == inp2.get_dimension(0));
+    ONEDAL_ASSERT(out.has_mutable_data());
+
+    dispatch_by_cpu(ctx, [&](auto cpu) {
+        compute_distance_cpu<decltype(cpu)>(inp1, inp2, out, metric);
+    });
+}
+
+#define INSTANTIATE(F, M)                                        \
+    template void compute_distance<F, M<F>>(const context_cpu&,  \
+                                            const ndview<F, 2>&, \
+                                            const ndview<F, 2>&, \
+                                            ndview<F, 2>&,       \
+                                            const M<F>&);
+
+#define INSTANTIATE_FLOAT(F)          \
+    INSTANTIATE(F, squared_l2_metric) \
+    INSTANTIATE(F, lp_metric)         \
+    INSTANTIATE(F, chebyshev_metric)  \
+    INSTANTIATE(F, cosine_metric)
+
+INSTANTIATE_FLOAT(float)
+INSTANTIATE_FLOAT(double)
+
+} // namespace oneapi::dal::backend::primitives
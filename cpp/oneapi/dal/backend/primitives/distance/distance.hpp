@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "oneapi/dal/backend/dispatcher.hpp"
 #include "oneapi/dal/backend/primitives/common.hpp"
 #include "oneapi/dal/backend/primitives/ndarray.hpp"
 
@@ -81,4 +82,27 @@ void check_inputs(const ndview<Float, 2>& inp1,
 
 #endif
 
+/// Do not use this.
+template <typename Cpu, typename Float, typename Metric>
+void compute_distance_cpu(const ndview<Float, 2>& inp1,
+                          const ndview<Float, 2>& inp2,
+                          ndview<Float, 2>& out,
+                          const Metric& metric);
+
+/// Computes the distances between the rows of `inp1` and the rows of `inp2` on host.
+/// Squared L2 and cosine distances are computed blockwise via GEMM, Minkowski and
+/// Chebyshev distances are computed by the kernels vectorized for the CPU of the context.
+///
+/// @param[in]  inp1   The input matrix of size [n x p]
+/// @param[in]  inp2   The input matrix of size [m x p]
+/// @param[out] out    The output matrix of size [n x m], $(i, j)$-th element of the matrix
+///                    is the distance between $i$-th row of `inp1` and $j$-th row of `inp2`
+/// @param[in]  metric The metric defined in metrics header
+template <typename Float, typename Metric>
+void compute_distance(const context_cpu& ctx,
+                      const ndview<Float, 2>& inp1,
+                      const ndview<Float, 2>& inp2,
+                      ndview<Float, 2>& out,
+                      const Metric& metric = Metric{});
+
 } // namespace oneapi::dal::backend::primitives
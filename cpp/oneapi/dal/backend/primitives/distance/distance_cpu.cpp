@@ -0,0 +1,372 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include "oneapi/dal/backend/micromkl/micromkl.hpp"
+#include "oneapi/dal/backend/primitives/distance/distance.hpp"
+#include "oneapi/dal/backend/primitives/distance/metrics.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::backend::primitives {
+
+/// The size of the output block computed by a single task via GEMM
+constexpr std::int64_t gemm_block_row_count = 128;
+constexpr std::int64_t gemm_block_col_count = 512;
+
+/// The size of the output block computed by a single task via element-wise kernels.
+/// The features are processed by chunks, so the transposed chunk of the second
+/// matrix and the block of accumulators fit into L2 cache
+constexpr std::int64_t block_row_count = 32;
+constexpr std::int64_t block_col_count = 256;
+constexpr std::int64_t block_feature_count = 64;
+
+template <typename Body>
+inline void for_each_block(std::int64_t row_count,
+                           std::int64_t col_count,
+                           std::int64_t block_rows,
+                           std::int64_t block_cols,
+                           Body&& body) {
+    const std::int64_t row_block_count = (row_count + block_rows - 1) / block_rows;
+    const std::int64_t col_block_count = (col_count + block_cols - 1) / block_cols;
+    const std::int32_t block_count = dal::detail::integral_cast<std::int32_t>(
+        dal::detail::check_mul_overflow(row_block_count, col_block_count));
+
+    // Consecutive blocks share the rows of the first matrix
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t row_first = (block / col_block_count) * block_rows;
+        const std::int64_t col_first = (block % col_block_count) * block_cols;
+        body(row_first,
+             std::min(row_first + block_rows, row_count),
+             col_first,
+             std::min(col_first + block_cols, col_count));
+    });
+}
+
+template <typename Float>
+inline ndarray<Float, 1> compute_squared_norms(const ndview<Float, 2>& inp) {
+    const std::int64_t row_count = inp.get_dimension(0);
+    const std::int64_t feature_count = inp.get_dimension(1);
+    const std::int64_t stride = inp.get_leading_stride();
+    const Float* inp_ptr = inp.get_data();
+
+    auto norms = ndarray<Float, 1>::empty(row_count);
+    Float* norms_ptr = norms.get_mutable_data();
+
+    dal::detail::threader_for_int64(row_count, [&](std::int64_t i) {
+        const Float* row = inp_ptr + i * stride;
+        Float sum = 0;
+        PRAGMA_VECTOR_ALWAYS
+        for (std::int64_t k = 0; k < feature_count; k++) {
+            sum += row[k] * row[k];
+        }
+        norms_ptr[i] = sum;
+    });
+
+    return norms;
+}
+
+/// Computes `alpha * inp1 * inp2^T` for the block of the output matrix. The output is
+/// row-major, so it is computed as column-major `alpha * inp2 * inp1^T` by BLAS
+template <typename Cpu, typename Float>
+inline void compute_inner_product_block(const ndview<Float, 2>& inp1,
+                                        const ndview<Float, 2>& inp2,
+                                        ndview<Float, 2>& out,
+                                        std::int64_t row_first,
+                                        std::int64_t row_last,
+                                        std::int64_t col_first,
+                                        std::int64_t col_last,
+                                        Float alpha) {
+    const std::int64_t inp1_stride = inp1.get_leading_stride();
+    const std::int64_t inp2_stride = inp2.get_leading_stride();
+    const std::int64_t out_stride = out.get_leading_stride();
+
+    micromkl::gemm<Cpu>('T',
+                        'N',
+                        col_last - col_first,
+                        row_last - row_first,
+                        inp1.get_dimension(1),
+                        alpha,
+                        inp2.get_data() + col_first * inp2_stride,
+                        inp2_stride,
+                        inp1.get_data() + row_first * inp1_stride,
+                        inp1_stride,
+                        Float(0),
+                        out.get_mutable_data() + row_first * out_stride + col_first,
+                        out_stride);
+}
+
+/// Squared L2 distance is computed as $\|x\|^2 + \|y\|^2 - 2 x^T y$
+template <typename Cpu, typename Float>
+void compute_squared_l2_distance(const ndview<Float, 2>& inp1,
+                                 const ndview<Float, 2>& inp2,
+                                 ndview<Float, 2>& out) {
+    const auto inp1_norms = compute_squared_norms(inp1);
+    const auto inp2_norms = compute_squared_norms(inp2);
+    const Float* inp1_norms_ptr = inp1_norms.get_data();
+    const Float* inp2_norms_ptr = inp2_norms.get_data();
+    const std::int64_t out_stride = out.get_leading_stride();
+    Float* out_ptr = out.get_mutable_data();
+
+    for_each_block(
+        inp1.get_dimension(0),
+        inp2.get_dimension(0),
+        gemm_block_row_count,
+        gemm_block_col_count,
+        [&](std::int64_t row_first,
+            std::int64_t row_last,
+            std::int64_t col_first,
+            std::int64_t col_last) {
+            compute_inner_product_block<Cpu>(inp1,
+                                             inp2,
+                                             out,
+                                             row_first,
+                                             row_last,
+                                             col_first,
+                                             col_last,
+                                             Float(-2));
+            for (std::int64_t i = row_first; i < row_last; i++) {
+                Float* out_row = out_ptr + i * out_stride;
+                const Float inp1_norm = inp1_norms_ptr[i];
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (std::int64_t j = col_first; j < col_last; j++) {
+                    // Rounding errors can make the distance slightly negative
+                    const Float value = out_row[j] + inp1_norm + inp2_norms_ptr[j];
+                    out_row[j] = (value > Float(0)) ? value : Float(0);
+                }
+            }
+        });
+}
+
+/// Cosine distance is computed as $1 - x^T y / (\|x\| \|y\|)$, the distance to the
+/// zero vector is one
+template <typename Cpu, typename Float>
+void compute_cosine_distance(const ndview<Float, 2>& inp1,
+                             const ndview<Float, 2>& inp2,
+                             ndview<Float, 2>& out) {
+    auto inp1_inv_norms = compute_squared_norms(inp1);
+    auto inp2_inv_norms = compute_squared_norms(inp2);
+    for (auto* norms : { &inp1_inv_norms, &inp2_inv_norms }) {
+        Float* norms_ptr = norms->get_mutable_data();
+        const std::int64_t count = norms->get_count();
+        for (std::int64_t i = 0; i < count; i++) {
+            norms_ptr[i] = (norms_ptr[i] > Float(0)) ? Float(1) / std::sqrt(norms_ptr[i]) : 0;
+        }
+    }
+    const Float* inp1_inv_norms_ptr = inp1_inv_norms.get_data();
+    const Float* inp2_inv_norms_ptr = inp2_inv_norms.get_data();
+    const std::int64_t out_stride = out.get_leading_stride();
+    Float* out_ptr = out.get_mutable_data();
+
+    for_each_block(
+        inp1.get_dimension(0),
+        inp2.get_dimension(0),
+        gemm_block_row_count,
+        gemm_block_col_count,
+        [&](std::int64_t row_first,
+            std::int64_t row_last,
+            std::int64_t col_first,
+            std::int64_t col_last) {
+            compute_inner_product_block<Cpu>(inp1,
+                                             inp2,
+                                             out,
+                                             row_first,
+                                             row_last,
+                                             col_first,
+                                             col_last,
+                                             Float(1));
+            for (std::int64_t i = row_first; i < row_last; i++) {
+                Float* out_row = out_ptr + i * out_stride;
+                const Float inp1_inv_norm = inp1_inv_norms_ptr[i];
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (std::int64_t j = col_first; j < col_last; j++) {
+                    out_row[j] = Float(1) - out_row[j] * inp1_inv_norm * inp2_inv_norms_ptr[j];
+                }
+            }
+        });
+}
+
+template <typename Float>
+struct manhattan_op {
+    Float accumulate(Float acc, Float diff) const {
+        return acc + diff;
+    }
+    Float finalize(Float acc) const {
+        return acc;
+    }
+};
+
+template <typename Float>
+struct chebyshev_op {
+    Float accumulate(Float acc, Float diff) const {
+        return (acc > diff) ? acc : diff;
+    }
+    Float finalize(Float acc) const {
+        return acc;
+    }
+};
+
+template <typename Float>
+struct euclidean_op {
+    Float accumulate(Float acc, Float diff) const {
+        return acc + diff * diff;
+    }
+    Float finalize(Float acc) const {
+        return std::sqrt(acc);
+    }
+};
+
+template <typename Float>
+struct minkowski_op {
+    Float accumulate(Float acc, Float diff) const {
+        return acc + std::pow(diff, p);
+    }
+    Float finalize(Float acc) const {
+        return std::pow(acc, Float(1) / p);
+    }
+    Float p;
+};
+
+/// Computes the distance that is a reduction of the element-wise absolute
+/// differences. The block of the second matrix is transposed, so the innermost
+/// loop runs over the contiguous rows of the block and is vectorized without
+/// reordering the reduction
+template <typename Float, typename Op>
+void compute_elementwise_distance(const ndview<Float, 2>& inp1,
+                                  const ndview<Float, 2>& inp2,
+                                  ndview<Float, 2>& out,
+                                  const Op& op) {
+    const std::int64_t feature_count = inp1.get_dimension(1);
+    const std::int64_t inp1_stride = inp1.get_leading_stride();
+    const std::int64_t inp2_stride = inp2.get_leading_stride();
+    const std::int64_t out_stride = out.get_leading_stride();
+    const Float* inp1_ptr = inp1.get_data();
+    const Float* inp2_ptr = inp2.get_data();
+    Float* out_ptr = out.get_mutable_data();
+
+    for_each_block(
+        inp1.get_dimension(0),
+        inp2.get_dimension(0),
+        block_row_count,
+        block_col_count,
+        [&](std::int64_t row_first,
+            std::int64_t row_last,
+            std::int64_t col_first,
+            std::int64_t col_last) {
+            const std::int64_t row_count = row_last - row_first;
+            const std::int64_t col_count = col_last - col_first;
+
+            auto acc = ndarray<Float, 1>::empty(block_row_count * block_col_count);
+            auto inp2_block = ndarray<Float, 1>::empty(block_feature_count * block_col_count);
+            Float* acc_ptr = acc.get_mutable_data();
+            Float* inp2_block_ptr = inp2_block.get_mutable_data();
+            std::fill(acc_ptr, acc_ptr + row_count * block_col_count, Float(0));
+
+            for (std::int64_t f_first = 0; f_first < feature_count;
+                 f_first += block_feature_count) {
+                const std::int64_t f_count =
+                    std::min(block_feature_count, feature_count - f_first);
+
+                for (std::int64_t j = 0; j < col_count; j++) {
+                    const Float* inp2_row = inp2_ptr + (col_first + j) * inp2_stride + f_first;
+                    for (std::int64_t f = 0; f < f_count; f++) {
+                        inp2_block_ptr[f * block_col_count + j] = inp2_row[f];
+                    }
+                }
+
+                for (std::int64_t i = 0; i < row_count; i++) {
+                    const Float* inp1_row = inp1_ptr + (row_first + i) * inp1_stride + f_first;
+                    Float* acc_row = acc_ptr + i * block_col_count;
+                    for (std::int64_t f = 0; f < f_count; f++) {
+                        const Float value = inp1_row[f];
+                        const Float* inp2_block_row = inp2_block_ptr + f * block_col_count;
+                        PRAGMA_IVDEP
+                        PRAGMA_VECTOR_ALWAYS
+                        for (std::int64_t j = 0; j < col_count; j++) {
+                            acc_row[j] =
+                                op.accumulate(acc_row[j], std::abs(value - inp2_block_row[j]));
+                        }
+                    }
+                }
+            }
+
+            for (std::int64_t i = 0; i < row_count; i++) {
+                const Float* acc_row = acc_ptr + i * block_col_count;
+                Float* out_row = out_ptr + (row_first + i) * out_stride + col_first;
+                for (std::int64_t j = 0; j < col_count; j++) {
+                    out_row[j] = op.finalize(acc_row[j]);
+                }
+            }
+        });
+}
+
+template <typename Cpu, typename Float>
+void compute_lp_distance(const ndview<Float, 2>& inp1,
+                         const ndview<Float, 2>& inp2,
+                         ndview<Float, 2>& out,
+                         Float p) {
+    if (p == Float(1)) {
+        compute_elementwise_distance(inp1, inp2, out, manhattan_op<Float>{});
+    }
+    else if (p == Float(2)) {
+        // The differences are accumulated directly, as the GEMM-based squared L2
+        // distance loses precision for the close rows with large norms
+        compute_elementwise_distance(inp1, inp2, out, euclidean_op<Float>{});
+    }
+    else {
+        compute_elementwise_distance(inp1, inp2, out, minkowski_op<Float>{ p });
+    }
+}
+
+template <typename Cpu, typename Float, typename Metric>
+void compute_distance_cpu(const ndview<Float, 2>& inp1,
+                          const ndview<Float, 2>& inp2,
+                          ndview<Float, 2>& out,
+                          const Metric& metric) {
+    if constexpr (std::is_same_v<Metric, squared_l2_metric<Float>>) {
+        compute_squared_l2_distance<Cpu>(inp1, inp2, out);
+    }
+    else if constexpr (std::is_same_v<Metric, cosine_metric<Float>>) {
+        compute_cosine_distance<Cpu>(inp1, inp2, out);
+    }
+    else if constexpr (std::is_same_v<Metric, chebyshev_metric<Float>>) {
+        compute_elementwise_distance(inp1, inp2, out, chebyshev_op<Float>{});
+    }
+    else {
+        static_assert(std::is_same_v<Metric, lp_metric<Float>>, "Unsupported metric");
+        compute_lp_distance<Cpu>(inp1, inp2, out, metric.get_p());
+    }
+}
+
+#define INSTANTIATE(Cpu, F, M)                                            \
+    template void compute_distance_cpu<Cpu, F, M<F>>(const ndview<F, 2>&, \
+                                                     const ndview<F, 2>&, \
+                                                     ndview<F, 2>&,       \
+                                                     const M<F>&);
+
+#define INSTANTIATE_FLOAT(Cpu, F)          \
+    INSTANTIATE(Cpu, F, squared_l2_metric) \
+    INSTANTIATE(Cpu, F, lp_metric)         \
+    INSTANTIATE(Cpu, F, chebyshev_metric)  \
+    INSTANTIATE(Cpu, F, cosine_metric)
+
+INSTANTIATE_FLOAT(__CPU_TAG__, float)
+INSTANTIATE_FLOAT(__CPU_TAG__, double)
+
+} // namespace oneapi::dal::backend::primitives
@@ -16,14 +16,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "oneapi/dal/backend/primitives/distance/distance.hpp"
 
 namespace oneapi::dal::backend::primitives {
 
-#ifdef ONEDAL_DATA_PARALLEL
-
 struct distance_metric_tag;
 
 template <typename Float>
@@ -74,6 +73,41 @@ public:
     }
 };
 
-#endif
+template <typename Float>
+struct chebyshev_metric : public metric_base<Float> {
+public:
+    chebyshev_metric() {}
+    template <typename InputIt1, typename InputIt2>
+    Float operator()(InputIt1 first1, InputIt1 last1, InputIt2 first2) const {
+        Float acc = 0;
+        auto it1 = first1;
+        auto it2 = first2;
+        for (; it1 != last1; ++it1, ++it2) {
+            acc = std::max<Float>(acc, std::abs(*it1 - *it2));
+        }
+        return acc;
+    }
+};
+
+template <typename Float>
+struct cosine_metric : public metric_base<Float> {
+public:
+    cosine_metric() {}
+    template <typename InputIt1, typename InputIt2>
+    Float operator()(InputIt1 first1, InputIt1 last1, InputIt2 first2) const {
+        Float ip = 0;
+        Float norm1 = 0;
+        Float norm2 = 0;
+        auto it1 = first1;
+        auto it2 = first2;
+        for (; it1 != last1; ++it1, ++it2) {
+            ip += (*it1) * (*it2);
+            norm1 += (*it1) * (*it1);
+            norm2 += (*it2) * (*it2);
+        }
+        const Float norm = std::sqrt(norm1 * norm2);
+        return (norm > 0) ? Float(1) - ip / norm : Float(1);
+    }
+};
 
 } // namespace oneapi::dal::backend::primitives
@@ -0,0 +1,168 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+
+#include "oneapi/dal/backend/primitives/distance/distance.hpp"
+#include "oneapi/dal/backend/primitives/distance/metrics.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::backend::primitives::test {
+
+using distance_types = std::tuple<float, double>;
+
+template <typename Float>
+class host_distance_test {
+public:
+    void generate() {
+        row_count1_ = GENERATE(1, 37, 200);
+        row_count2_ = GENERATE(1, 130, 700);
+        feature_count_ = GENERATE(1, 5, 70, 300);
+        CAPTURE(row_count1_, row_count2_, feature_count_);
+
+        inp1_ = generate_matrix(row_count1_, 7777);
+        inp2_ = generate_matrix(row_count2_, 8888);
+
+        // The zero row is the special case for the cosine distance
+        if (row_count1_ > 1) {
+            Float* row = inp1_.get_mutable_data() + feature_count_;
+            std::fill(row, row + feature_count_, Float(0));
+        }
+    }
+
+    /// The rows of the second matrix are close to the rows of the first one,
+    /// and all the rows have large norms
+    void generate_close_rows() {
+        row_count1_ = 40;
+        row_count2_ = 300;
+        feature_count_ = GENERATE(3, 100);
+        CAPTURE(feature_count_);
+
+        inp1_ = generate_matrix(row_count1_, 7777);
+        inp2_ = generate_matrix(row_count2_, 8888);
+        Float* inp1_data = inp1_.get_mutable_data();
+        Float* inp2_data = inp2_.get_mutable_data();
+        for (std::int64_t i = 0; i < inp1_.get_count(); i++) {
+            inp1_data[i] += Float(1e4);
+        }
+        for (std::int64_t j = 0; j < row_count2_; j++) {
+            const Float* row1 = inp1_data + (j % row_count1_) * feature_count_;
+            Float* row2 = inp2_data + j * feature_count_;
+            for (std::int64_t k = 0; k < feature_count_; k++) {
+                row2[k] = row1[k] + Float(1e-2) * row2[k];
+            }
+        }
+    }
+
+    template <typename Metric>
+    void test_distance(const Metric& metric = Metric{}) {
+        auto out = ndarray<Float, 2>::empty({ row_count1_, row_count2_ });
+        compute_distance(context_cpu{}, inp1_, inp2_, out, metric);
+
+        const Float tol = std::is_same_v<Float, float> ? 1e-3 : 1e-10;
+        for (std::int64_t i = 0; i < row_count1_; i++) {
+            const Float* row1 = inp1_.get_data() + i * feature_count_;
+            for (std::int64_t j = 0; j < row_count2_; j++) {
+                const Float* row2 = inp2_.get_data() + j * feature_count_;
+                const Float expected = metric(row1, row1 + feature_count_, row2);
+                const Float actual = out.get_data()[i * row_count2_ + j];
+                CAPTURE(i, j, expected, actual);
+                REQUIRE(std::abs(expected - actual) <= tol * std::max(Float(1), expected));
+            }
+        }
+    }
+
+    template <typename Metric>
+    void test_close_rows_distance(const Metric& metric) {
+        auto out = ndarray<Float, 2>::empty({ row_count1_, row_count2_ });
+        compute_distance(context_cpu{}, inp1_, inp2_, out, metric);
+
+        const Float tol = std::is_same_v<Float, float> ? 1e-4 : 1e-10;
+        for (std::int64_t i = 0; i < row_count1_; i++) {
+            const Float* row1 = inp1_.get_data() + i * feature_count_;
+            for (std::int64_t j = 0; j < row_count2_; j++) {
+                const Float* row2 = inp2_.get_data() + j * feature_count_;
+                const Float expected = metric(row1, row1 + feature_count_, row2);
+                const Float actual = out.get_data()[i * row_count2_ + j];
+                CAPTURE(i, j, expected, actual);
+                REQUIRE(std::abs(expected - actual) <= tol * expected);
+            }
+        }
+    }
+
+private:
+    ndarray<Float, 2> generate_matrix(std::int64_t row_count, std::int32_t seed) {
+        auto matrix = ndarray<Float, 2>::empty({ row_count, feature_count_ });
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<Float> uniform(-1, 1);
+        Float* data = matrix.get_mutable_data();
+        for (std::int64_t i = 0; i < matrix.get_count(); i++) {
+            data[i] = uniform(rng);
+        }
+        return matrix;
+    }
+
+    std::int64_t row_count1_;
+    std::int64_t row_count2_;
+    std::int64_t feature_count_;
+    ndarray<Float, 2> inp1_;
+    ndarray<Float, 2> inp2_;
+};
+
+TEMPLATE_LIST_TEST_M(host_distance_test,
+                     "squared L2 distance on host",
+                     "[distance][host]",
+                     distance_types) {
+    this->generate();
+    this->template test_distance<squared_l2_metric<TestType>>();
+}
+
+TEMPLATE_LIST_TEST_M(host_distance_test,
+                     "minkowski distance on host",
+                     "[distance][host]",
+                     distance_types) {
+    const TestType p = GENERATE(1.0, 2.0, 3.5);
+    this->generate();
+    this->test_distance(lp_metric<TestType>{ p });
+}
+
+TEMPLATE_LIST_TEST_M(host_distance_test,
+                     "minkowski distance of close rows with large norms on host",
+                     "[distance][host]",
+                     distance_types) {
+    const TestType p = GENERATE(1.0, 2.0, 3.5);
+    this->generate_close_rows();
+    this->test_close_rows_distance(lp_metric<TestType>{ p });
+}
+
+TEMPLATE_LIST_TEST_M(host_distance_test,
+                     "chebyshev distance on host",
+                     "[distance][host]",
+                     distance_types) {
+    this->generate();
+    this->template test_distance<chebyshev_metric<TestType>>();
+}
+
+TEMPLATE_LIST_TEST_M(host_distance_test,
+                     "cosine distance on host",
+                     "[distance][host]",
+                     distance_types) {
+    this->generate();
+    this->template test_distance<cosine_metric<TestType>>();
+}
+
+} // namespace oneapi::dal::backend::primitives::test
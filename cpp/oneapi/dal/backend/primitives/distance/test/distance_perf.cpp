@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/backend/primitives/distance/distance.hpp"
+#include "oneapi/dal/backend/primitives/distance/metrics.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::backend::primitives::test {
+
+using distance_types = std::tuple<float, double>;
+
+template <typename Float>
+class host_distance_perf_test {
+public:
+    void generate() {
+        row_count1_ = GENERATE(1024, 8192);
+        row_count2_ = GENERATE(1024, 8192);
+        feature_count_ = GENERATE(4, 32, 256, 1024);
+        inp1_ = ndarray<Float, 2>::empty({ row_count1_, feature_count_ });
+        inp2_ = ndarray<Float, 2>::empty({ row_count2_, feature_count_ });
+        inp1_.fill(Float(0.1));
+        inp2_.fill(Float(10));
+        out_ = ndarray<Float, 2>::empty({ row_count1_, row_count2_ });
+    }
+
+    template <typename Metric>
+    void run(const std::string& metric_name, const Metric& metric = Metric{}) {
+        const auto name = fmt::format("Host {} distance: {} x {}, feature_count {}, {}",
+                                      metric_name,
+                                      row_count1_,
+                                      row_count2_,
+                                      feature_count_,
+                                      std::is_same_v<Float, float> ? "float" : "double");
+
+        // BENCHMARK is working with lambdas so the following
+        // code is a workaround for binding issues
+        const ndview<Float, 2>& inp1 = inp1_;
+        const ndview<Float, 2>& inp2 = inp2_;
+        ndview<Float, 2>& out = out_;
+        const context_cpu ctx;
+
+        BENCHMARK(name.c_str()) {
+            compute_distance(ctx, inp1, inp2, out, metric);
+        };
+    }
+
+private:
+    std::int64_t row_count1_;
+    std::int64_t row_count2_;
+    std::int64_t feature_count_;
+    ndarray<Float, 2> inp1_;
+    ndarray<Float, 2> inp2_;
+    ndarray<Float, 2> out_;
+};
+
+TEMPLATE_LIST_TEST_M(host_distance_perf_test,
+                     "host distance perf test",
+                     "[distance][host][weekly][perf]",
+                     distance_types) {
+    this->generate();
+    this->template run<squared_l2_metric<TestType>>("squared L2");
+    this->template run<cosine_metric<TestType>>("cosine");
+    this->template run<chebyshev_metric<TestType>>("chebyshev");
+    this->run("minkowski p=1", lp_metric<TestType>{ 1.0 });
+    this->run("minkowski p=3", lp_metric<TestType>{ 3.0 });
+}
+
+} // namespace oneapi::dal::backend::primitives::test
@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "oneapi/dal/backend/primitives/selection/kselect_by_rows.hpp"
+#include "oneapi/dal/detail/common.hpp"
+
+namespace oneapi::dal::backend::primitives {
+
+template <typename Float>
+void kselect_by_rows_merge(const context_cpu& ctx,
+                           const ndview<Float, 2>& block,
+                           std::int64_t column_offset,
+                           ndview<Float, 2>& selection,
+                           ndview<std::int32_t, 2>& column_indices) {
+    ONEDAL_ASSERT(block.get_dimension(0) == selection.get_dimension(0));
+    ONEDAL_ASSERT(selection.get_shape() == column_indices.get_shape());
+    ONEDAL_ASSERT(selection.has_mutable_data());
+    ONEDAL_ASSERT(column_indices.has_mutable_data());
+    ONEDAL_ASSERT(column_offset >= 0);
+    ONEDAL_ASSERT(column_offset + block.get_dimension(1) <=
+                  dal::detail::limits<std::int32_t>::max());
+
+    dispatch_by_cpu(ctx, [&](auto cpu) {
+        kselect_by_rows_merge_cpu<decltype(cpu)>(block, column_offset, selection, column_indices);
+    });
+}
+
+template <typename Float>
+void kselect_by_rows_host(const context_cpu& ctx,
+                          const ndview<Float, 2>& data,
+                          std::int64_t k,
+                          ndview<Float, 2>& selection,
+                          ndview<std::int32_t, 2>& column_indices) {
+    ONEDAL_ASSERT(k > 0);
+    ONEDAL_ASSERT(k <= data.get_dimension(1));
+    ONEDAL_ASSERT(selection.get_dimension(1) == k);
+    ONEDAL_ASSERT(column_indices.get_dimension(1) == k);
+
+    const std::int64_t row_count = data.get_dimension(0);
+    const std::int64_t selection_stride = selection.get_leading_stride();
+    const std::int64_t indices_stride = column_indices.get_leading_stride();
+    Float* selection_ptr = selection.get_mutable_data();
+    std::int32_t* indices_ptr = column_indices.get_mutable_data();
+    for (std::int64_t i = 0; i < row_count; i++) {
+        std::fill_n(selection_ptr + i * selection_stride, k, dal::detail::limits<Float>::max());
+        std::fill_n(indices_ptr + i * indices_stride, k, -1);
+    }
+
+    kselect_by_rows_merge(ctx, data, 0, selection, column_indices);
+}
+
+#define INSTANTIATE(F)                                                \
+    template void kselect_by_rows_merge<F>(const context_cpu&,        \
+                                           const ndview<F, 2>&,       \
+                                           std::int64_t,              \
+                                           ndview<F, 2>&,             \
+                                           ndview<std::int32_t, 2>&); \
+    template void kselect_by_rows_host<F>(const context_cpu&,         \
+                                          const ndview<F, 2>&,        \
+                                          std::int64_t,               \
+                                          ndview<F, 2>&,              \
+                                          ndview<std::int32_t, 2>&);
+
+INSTANTIATE(float)
+INSTANTIATE(double)
+
+} // namespace oneapi::dal::backend::primitives
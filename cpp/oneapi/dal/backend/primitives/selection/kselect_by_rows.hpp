@@ -18,6 +18,7 @@
 
 #include <type_traits>
 
+#include "oneapi/dal/backend/dispatcher.hpp"
 #include "oneapi/dal/backend/primitives/selection/kselect_by_rows_base.hpp"
 
 namespace oneapi::dal::backend::primitives {
@@ -78,4 +79,48 @@ private:
 
 #endif
 
+/// Do not use this.
+template <typename Cpu, typename Float>
+void kselect_by_rows_merge_cpu(const ndview<Float, 2>& block,
+                               std::int64_t column_offset,
+                               ndview<Float, 2>& selection,
+                               ndview<std::int32_t, 2>& column_indices);
+
+/// Merges the block of columns of a matrix into the K-selection computed on host for
+/// the preceding blocks, so the selection can be fused with the computation of the
+/// matrix by blocks. Before the first block `selection` shall be filled with the
+/// maximal value of `Float` and `column_indices` with -1. The index -1 marks an
+/// empty slot that is filled by any value, including infinity. Selected values in
+/// each row are sorted in ascending order. If the blocks are merged in the order of
+/// columns, equal values are ordered by the column index.
+///
+/// @param[in]     ctx             The CPU context
+/// @param[in]     block           The [n x m] block of columns of the matrix
+/// @param[in]     column_offset   The index of the first column of the block in the matrix
+/// @param[in,out] selection       The [n x k] matrix of selected values
+/// @param[in,out] column_indices  The [n x k] matrix of indices of selected values
+template <typename Float>
+void kselect_by_rows_merge(const context_cpu& ctx,
+                           const ndview<Float, 2>& block,
+                           std::int64_t column_offset,
+                           ndview<Float, 2>& selection,
+                           ndview<std::int32_t, 2>& column_indices);
+
+/// Performs K-selection on each row of a matrix on host. It is the host counterpart
+/// of `kselect_by_rows`, see `kselect_by_rows_merge` for the ordering of the result.
+/// Small `k` is selected by vectorized filtering against the current K-th value and
+/// insertion, large `k` is selected by buffered quickselect.
+///
+/// @param[in]  ctx             The CPU context
+/// @param[in]  data            The [n x m] matrix to be processed
+/// @param[in]  k               The number of minimal values to be selected in each row
+/// @param[out] selection       The [n x k] matrix of selected values
+/// @param[out] column_indices  The [n x k] matrix of indices of selected values
+template <typename Float>
+void kselect_by_rows_host(const context_cpu& ctx,
+                          const ndview<Float, 2>& data,
+                          std::int64_t k,
+                          ndview<Float, 2>& selection,
+                          ndview<std::int32_t, 2>& column_indices);
+
 } // namespace oneapi::dal::backend::primitives
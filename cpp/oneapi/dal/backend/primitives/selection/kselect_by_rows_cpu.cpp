@@ -0,0 +1,243 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/backend/primitives/selection/kselect_by_rows.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::backend::primitives {
+
+/// The largest K for which the selection is kept sorted by insertion
+constexpr std::int64_t max_insertion_k = 32;
+
+/// The number of values compared with the K-th value at once
+constexpr std::int64_t filter_chunk_size = 16;
+
+/// The number of rows processed by a single task
+constexpr std::int64_t row_block_size = 16;
+
+template <typename Float>
+struct selected_value {
+    Float value;
+    std::int32_t index;
+};
+
+template <typename Float>
+inline bool operator<(const selected_value<Float>& lhs, const selected_value<Float>& rhs) {
+    return lhs.value < rhs.value || (lhs.value == rhs.value && lhs.index < rhs.index);
+}
+
+/// Checks whether the chunk has a value less than the threshold. The chunk size
+/// is a compile-time constant, so the loop is vectorized without a remainder
+template <typename Float>
+inline bool has_less(const Float* values, Float threshold) {
+    std::int32_t count = 0;
+    PRAGMA_VECTOR_ALWAYS
+    for (std::int64_t j = 0; j < filter_chunk_size; j++) {
+        count += std::int32_t(values[j] < threshold);
+    }
+    return count > 0;
+}
+
+/// Calls `body(j)` for each column `j` of the row with the value less than the
+/// threshold, the body may decrease the threshold. Most of the chunks of a long
+/// row have no such values, so they are skipped by a single vectorized check
+template <typename Float, typename Body>
+inline void for_each_candidate(const Float* row,
+                               std::int64_t column_count,
+                               const Float& threshold,
+                               Body&& body) {
+    std::int64_t first = 0;
+    for (; first + filter_chunk_size <= column_count; first += filter_chunk_size) {
+        if (has_less(row + first, threshold)) {
+            for (std::int64_t j = first; j < first + filter_chunk_size; j++) {
+                if (row[j] < threshold) {
+                    body(j);
+                }
+            }
+        }
+    }
+    for (std::int64_t j = first; j < column_count; j++) {
+        if (row[j] < threshold) {
+            body(j);
+        }
+    }
+}
+
+/// Returns the number of filled slots of the selection. The empty slots have the
+/// index -1 and follow the filled ones
+inline std::int64_t get_filled_count(const std::int32_t* indices, std::int64_t k) {
+    std::int64_t count = 0;
+    while (count < k && indices[count] >= 0) {
+        count++;
+    }
+    return count;
+}
+
+/// Inserts the value into the sorted selection at the position not greater than
+/// `last`, the value at `last` is dropped
+template <typename Float>
+inline void insert_sorted(Float value,
+                          std::int32_t index,
+                          std::int64_t last,
+                          Float* values,
+                          std::int32_t* indices) {
+    std::int64_t pos = last;
+    for (; pos > 0 && value < values[pos - 1]; pos--) {
+        values[pos] = values[pos - 1];
+        indices[pos] = indices[pos - 1];
+    }
+    values[pos] = value;
+    indices[pos] = index;
+}
+
+/// Merges the row into the sorted selection by insertion. The empty slots are
+/// filled by the first columns unconditionally, so the values that are not less
+/// than the initial maximal value, like infinity, are selected as well
+template <typename Float>
+void merge_row_by_insertion(const Float* row,
+                            std::int64_t column_count,
+                            std::int64_t column_offset,
+                            std::int64_t k,
+                            Float* values,
+                            std::int32_t* indices) {
+    std::int64_t filled = get_filled_count(indices, k);
+    std::int64_t first = 0;
+    for (; filled < k && first < column_count; first++, filled++) {
+        insert_sorted(row[first], std::int32_t(column_offset + first), filled, values, indices);
+    }
+    if (filled < k) {
+        return;
+    }
+
+    Float threshold = values[k - 1];
+    for_each_candidate(row + first, column_count - first, threshold, [&](std::int64_t j) {
+        insert_sorted(row[first + j],
+                      std::int32_t(column_offset + first + j),
+                      k - 1,
+                      values,
+                      indices);
+        threshold = values[k - 1];
+    });
+}
+
+/// Merges the row into the sorted selection by quickselect. The empty slots are
+/// filled by the first columns unconditionally, then the candidates less than the
+/// current K-th value are appended to the buffer of size 2K, once it is full the
+/// K minimal candidates are moved to its beginning by `nth_element`
+template <typename Float>
+void merge_row_by_quickselect(const Float* row,
+                              std::int64_t column_count,
+                              std::int64_t column_offset,
+                              std::int64_t k,
+                              Float* values,
+                              std::int32_t* indices,
+                              selected_value<Float>* buffer) {
+    const std::int64_t capacity = 2 * k;
+
+    std::int64_t size = get_filled_count(indices, k);
+    for (std::int64_t i = 0; i < size; i++) {
+        buffer[i] = { values[i], indices[i] };
+    }
+    std::int64_t first = 0;
+    for (; size < k && first < column_count; first++) {
+        buffer[size++] = { row[first], std::int32_t(column_offset + first) };
+    }
+
+    if (size == k) {
+        Float threshold = std::max_element(buffer, buffer + k)->value;
+        for_each_candidate(row + first, column_count - first, threshold, [&](std::int64_t j) {
+            buffer[size++] = { row[first + j], std::int32_t(column_offset + first + j) };
+            if (size == capacity) {
+                std::nth_element(buffer, buffer + k - 1, buffer + size);
+                size = k;
+                threshold = buffer[k - 1].value;
+            }
+        });
+    }
+
+    // It is notably faster than `partial_sort` that is based on heap
+    if (size > k) {
+        std::nth_element(buffer, buffer + k - 1, buffer + size);
+        size = k;
+    }
+    std::sort(buffer, buffer + size);
+    for (std::int64_t i = 0; i < size; i++) {
+        values[i] = buffer[i].value;
+        indices[i] = buffer[i].index;
+    }
+}
+
+template <typename Cpu, typename Float>
+void kselect_by_rows_merge_cpu(const ndview<Float, 2>& block,
+                               std::int64_t column_offset,
+                               ndview<Float, 2>& selection,
+                               ndview<std::int32_t, 2>& column_indices) {
+    const std::int64_t row_count = block.get_dimension(0);
+    const std::int64_t column_count = block.get_dimension(1);
+    const std::int64_t k = selection.get_dimension(1);
+    const std::int64_t block_stride = block.get_leading_stride();
+    const std::int64_t selection_stride = selection.get_leading_stride();
+    const std::int64_t indices_stride = column_indices.get_leading_stride();
+
+    const Float* block_ptr = block.get_data();
+    Float* selection_ptr = selection.get_mutable_data();
+    std::int32_t* indices_ptr = column_indices.get_mutable_data();
+
+    const std::int32_t row_block_count =
+        dal::detail::integral_cast<std::int32_t>((row_count + row_block_size - 1) / row_block_size);
+    dal::detail::threader_for(row_block_count, row_block_count, [&](std::int32_t row_block) {
+        const std::int64_t first_row = row_block * row_block_size;
+        const std::int64_t last_row = std::min(first_row + row_block_size, row_count);
+
+        if (k <= max_insertion_k) {
+            for (std::int64_t i = first_row; i < last_row; i++) {
+                merge_row_by_insertion(block_ptr + i * block_stride,
+                                       column_count,
+                                       column_offset,
+                                       k,
+                                       selection_ptr + i * selection_stride,
+                                       indices_ptr + i * indices_stride);
+            }
+        }
+        else {
+            std::vector<selected_value<Float>> buffer(2 * k);
+            for (std::int64_t i = first_row; i < last_row; i++) {
+                merge_row_by_quickselect(block_ptr + i * block_stride,
+                                         column_count,
+                                         column_offset,
+                                         k,
+                                         selection_ptr + i * selection_stride,
+                                         indices_ptr + i * indices_stride,
+                                         buffer.data());
+            }
+        }
+    });
+}
+
+#define INSTANTIATE(Cpu, F)                                                    \
+    template void kselect_by_rows_merge_cpu<Cpu, F>(const ndview<F, 2>&,       \
+                                                    std::int64_t,              \
+                                                    ndview<F, 2>&,             \
+                                                    ndview<std::int32_t, 2>&);
+
+INSTANTIATE(__CPU_TAG__, float)
+INSTANTIATE(__CPU_TAG__, double)
+
+} // namespace oneapi::dal::backend::primitives
@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/backend/primitives/selection/kselect_by_rows.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::backend::primitives::test {
+
+using selection_types = std::tuple<float, double>;
+
+template <typename Float>
+class host_selection_test {
+public:
+    void generate(std::int64_t row_count, std::int64_t col_count, std::int32_t value_range) {
+        row_count_ = row_count;
+        col_count_ = col_count;
+        data_ = ndarray<Float, 2>::empty({ row_count, col_count });
+
+        // Small value range produces a lot of equal values
+        std::mt19937 rng(7777);
+        std::uniform_int_distribution<std::int32_t> uniform(0, value_range);
+        Float* data_ptr = data_.get_mutable_data();
+        for (std::int64_t i = 0; i < data_.get_count(); i++) {
+            data_ptr[i] = Float(uniform(rng)) / Float(value_range);
+        }
+    }
+
+    void generate_infinite(std::int64_t row_count, std::int64_t col_count) {
+        row_count_ = row_count;
+        col_count_ = col_count;
+        data_ = ndarray<Float, 2>::empty({ row_count, col_count });
+
+        // Most of the values are not less than the initial value of the selection,
+        // the first row has no finite values at all
+        const Float max = dal::detail::limits<Float>::max();
+        const Float inf = std::numeric_limits<Float>::infinity();
+        std::mt19937 rng(7777);
+        std::uniform_int_distribution<std::int32_t> uniform(0, 9);
+        Float* data_ptr = data_.get_mutable_data();
+        for (std::int64_t i = 0; i < data_.get_count(); i++) {
+            const std::int32_t kind = (i < col_count) ? 9 : uniform(rng);
+            data_ptr[i] = (kind == 0) ? Float(0.5) : (kind < 5) ? max : inf;
+        }
+    }
+
+    void check_selection(std::int64_t k, std::int64_t block_size) {
+        CAPTURE(row_count_, col_count_, k, block_size);
+
+        auto selection = ndarray<Float, 2>::empty({ row_count_, k });
+        auto indices = ndarray<std::int32_t, 2>::empty({ row_count_, k });
+        if (block_size >= col_count_) {
+            kselect_by_rows_host(context_cpu{}, data_, k, selection, indices);
+        }
+        else {
+            selection.fill(dal::detail::limits<Float>::max());
+            indices.fill(-1);
+            for (std::int64_t first = 0; first < col_count_; first += block_size) {
+                const std::int64_t count = std::min(block_size, col_count_ - first);
+                const auto block = ndview<Float, 2>::wrap(data_.get_data() + first,
+                                                          { row_count_, count },
+                                                          { col_count_, 1 });
+                kselect_by_rows_merge(context_cpu{}, block, first, selection, indices);
+            }
+        }
+
+        for (std::int64_t i = 0; i < row_count_; i++) {
+            const auto expected = get_expected(i, k);
+            for (std::int64_t j = 0; j < k; j++) {
+                CAPTURE(i, j);
+                REQUIRE(selection.get_data()[i * k + j] == expected[j].first);
+                REQUIRE(indices.get_data()[i * k + j] == expected[j].second);
+            }
+        }
+    }
+
+private:
+    std::vector<std::pair<Float, std::int32_t>> get_expected(std::int64_t row, std::int64_t k) {
+        std::vector<std::pair<Float, std::int32_t>> values(col_count_);
+        const Float* row_ptr = data_.get_data() + row * col_count_;
+        for (std::int64_t j = 0; j < col_count_; j++) {
+            values[j] = { row_ptr[j], std::int32_t(j) };
+        }
+        std::sort(values.begin(), values.end());
+        values.resize(k);
+        return values;
+    }
+
+    std::int64_t row_count_;
+    std::int64_t col_count_;
+    ndarray<Float, 2> data_;
+};
+
+TEMPLATE_LIST_TEST_M(host_selection_test,
+                     "host selection with small k",
+                     "[selection][host]",
+                     selection_types) {
+    const std::int64_t col_count = GENERATE(32, 1000, 5000);
+    const std::int32_t value_range = GENERATE(3, 1000000);
+    this->generate(33, col_count, value_range);
+
+    const std::int64_t k = GENERATE(1, 5, 16, 32);
+    const std::int64_t block_size = GENERATE(7, 512, 100000);
+    this->check_selection(k, block_size);
+}
+
+TEMPLATE_LIST_TEST_M(host_selection_test,
+                     "host selection with large k",
+                     "[selection][host]",
+                     selection_types) {
+    const std::int64_t col_count = GENERATE(2000, 10000);
+    const std::int32_t value_range = GENERATE(3, 1000000);
+    this->generate(19, col_count, value_range);
+
+    const std::int64_t k = GENERATE(33, 100, 1000);
+    const std::int64_t block_size = GENERATE(7, 512, 100000);
+    this->check_selection(k, block_size);
+}
+
+TEMPLATE_LIST_TEST_M(host_selection_test,
+                     "host selection of maximal and infinite values",
+                     "[selection][host]",
+                     selection_types) {
+    const std::int64_t col_count = GENERATE(40, 3000);
+    this->generate_infinite(17, col_count);
+
+    const std::int64_t k = GENERATE(1, 5, 32, 33);
+    const std::int64_t block_size = GENERATE(7, 512, 100000);
+    this->check_selection(k, block_size);
+}
+
+} // namespace oneapi::dal::backend::primitives::test
@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <queue>
+#include <random>
+
+#include "oneapi/dal/backend/primitives/selection/kselect_by_rows.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::backend::primitives::test {
+
+using selection_types = std::tuple<float, double>;
+
+template <typename Float>
+class host_selection_perf_test {
+public:
+    void generate(std::int64_t row_count, std::int64_t col_count) {
+        data_ = ndarray<Float, 2>::empty({ row_count, col_count });
+        std::mt19937 rng(7777);
+        std::uniform_real_distribution<Float> uniform(0, 1);
+        Float* data_ptr = data_.get_mutable_data();
+        for (std::int64_t i = 0; i < data_.get_count(); i++) {
+            data_ptr[i] = uniform(rng);
+        }
+    }
+
+    void run(std::int64_t k) {
+        const std::int64_t row_count = data_.get_dimension(0);
+        const std::int64_t col_count = data_.get_dimension(1);
+        const auto desc = fmt::format("k {}, row_count {}, col_count {}, {}",
+                                      k,
+                                      row_count,
+                                      col_count,
+                                      std::is_same_v<Float, float> ? "float" : "double");
+
+        auto selection = ndarray<Float, 2>::empty({ row_count, k });
+        auto indices = ndarray<std::int32_t, 2>::empty({ row_count, k });
+
+        // BENCHMARK is working with lambdas so the following
+        // code is a workaround for binding issues
+        const ndview<Float, 2>& data = data_;
+        ndview<Float, 2>& selection_view = selection;
+        ndview<std::int32_t, 2>& indices_view = indices;
+        const context_cpu ctx;
+
+        BENCHMARK(fmt::format("Host selection: {}", desc).c_str()) {
+            kselect_by_rows_host(ctx, data, k, selection_view, indices_view);
+        };
+
+        BENCHMARK(fmt::format("Heap per row selection: {}", desc).c_str()) {
+            const Float* data_ptr = data.get_data();
+            for (std::int64_t i = 0; i < row_count; i++) {
+                std::priority_queue<std::pair<Float, std::int32_t>> heap;
+                for (std::int64_t j = 0; j < col_count; j++) {
+                    const Float value = data_ptr[i * col_count + j];
+                    if (std::int64_t(heap.size()) < k) {
+                        heap.push({ value, std::int32_t(j) });
+                    }
+                    else if (value < heap.top().first) {
+                        heap.pop();
+                        heap.push({ value, std::int32_t(j) });
+                    }
+                }
+            }
+        };
+    }
+
+private:
+    ndarray<Float, 2> data_;
+};
+
+TEMPLATE_LIST_TEST_M(host_selection_perf_test,
+                     "host selection perf test",
+                     "[selection][host][weekly][perf]",
+                     selection_types) {
+    const std::int64_t col_count = GENERATE(10000, 100000);
+    this->generate(1024, col_count);
+
+    const std::int64_t k = GENERATE(1, 16, 100, 1000);
+    this->run(k);
+}
+
+} // namespace oneapi::dal::backend::primitives::test
@@ -176,6 +176,8 @@ public:
     ID(5010200000, knn_model_interop_id);
     ID(5010300000, knn_brute_force_search_model_impl_id);
     ID(5010400000, knn_kd_tree_search_model_impl_id);
+    ID(5010500000, knn_brute_force_regression_model_impl_id);
+    ID(5010600000, knn_kd_tree_regression_model_impl_id);
 };
 
 #undef ID
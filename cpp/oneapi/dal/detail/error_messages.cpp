@@ -49,6 +49,10 @@ MSG(unsupported_usm_alloc, "Requested USM alloc type is not supported")
 MSG(page_size_leq_zero, "Page size is lower than or equal to zero")
 MSG(invalid_key, "Cannot find the given key")
 MSG(capacity_leq_zero, "Capacity is lower than or equal to zero")
+MSG(capacity_exceeded, "Number of elements exceeds the reserved capacity")
+MSG(cpu_index_lt_zero, "CPU index is lower than zero")
+MSG(max_thread_count_lt_zero, "Max thread count is lower than zero")
+MSG(numa_node_lt_zero, "NUMA node is lower than zero")
 
 /* Primitives */
 MSG(invalid_number_of_elements_to_process, "Invalid number of elements to process")
@@ -92,6 +96,12 @@ MSG(column_indices_gt_max_value, "Column indices are larger than the maximum acc
 MSG(zero_based_indexing_is_not_supported, "Zero-based indexing is not supported for csr table")
 MSG(object_does_not_provide_read_access_to_csr,
     "Given object does not provide read access to the block of csr format")
+MSG(column_rc_does_not_match_table_rc,
+    "Row count of the column does not match row count of the table")
+MSG(validity_offset_lt_zero, "Offset in the validity bitmap is lower than zero")
+MSG(validity_bitmap_is_too_small, "Validity bitmap does not contain a bit for each row")
+MSG(missing_values_cannot_be_represented_in_integer_block,
+    "Column contains missing values that cannot be represented in integer data block")
 
 /* Ranges */
 MSG(invalid_range_of_rows, "Invalid range of rows")
@@ -105,7 +115,14 @@ MSG(negative_vertex_id, "Negative vertex ID")
 MSG(unimplemented_sorting_procedure, "Unimplemented sorting procedure")
 
 /* IO */
+MSG(failed_to_map_file, "Failed to map the file into memory")
+MSG(failed_to_write_file, "Failed to open the file for writing or to write it")
 MSG(file_not_found, "File not found")
+MSG(invalid_binary_edge_list_file,
+    "Binary edge list file is corrupted or its types do not match the edge list type")
+MSG(invalid_edge_list_file, "Edge list file is not a sequence of valid edges")
+MSG(invalid_graph_snapshot_file,
+    "Graph snapshot file is corrupted or its types do not match the graph type")
 
 /* Serialization */
 MSG(object_is_not_serializable, "Object is not serializable")
@@ -143,6 +160,12 @@ MSG(input_initial_centroids_cc_neq_input_data_cc,
     "Input initial centroids column count is not equal to input data column count")
 MSG(input_initial_centroids_rc_neq_desc_cluster_count,
     "Input initial centroids row count is not equal to descriptor cluster count")
+MSG(input_initial_cluster_counts_are_negative_or_non_finite,
+    "Input initial cluster counts contain negative or non-finite values")
+MSG(input_initial_cluster_counts_cc_neq_one,
+    "Input initial cluster counts column count is not equal to one")
+MSG(input_initial_cluster_counts_rc_neq_desc_cluster_count,
+    "Input initial cluster counts row count is not equal to descriptor cluster count")
 MSG(input_model_centroids_are_empty, "Input model centroids are empty")
 MSG(input_model_centroids_cc_neq_input_data_cc,
     "Input model centroids column count is not equal to input data column count")
@@ -152,12 +175,19 @@ MSG(kmeans_init_parallel_plus_dense_method_is_not_implemented_for_gpu,
     "K-Means init++ parallel dense method is not implemented for GPU")
 MSG(kmeans_init_plus_plus_dense_method_is_not_implemented_for_gpu,
     "K-Means init++ dense method is not implemented for GPU")
+MSG(kmeans_update_mode_is_not_implemented_for_gpu,
+    "K-Means incremental and mini-batch update modes are not implemented for GPU")
+MSG(kmeans_hamerly_dense_method_is_not_implemented_for_gpu,
+    "K-Means Hamerly dense method is not implemented for GPU")
+MSG(mini_batch_size_leq_zero, "Mini-batch size is lower than or equal to zero")
 MSG(objective_function_value_lt_zero, "Objective function value is lower than zero")
 
 /* k-NN */
 MSG(knn_kd_tree_method_is_not_implemented_for_gpu,
     "k-NN k-d tree method is not implemented for GPU")
 MSG(knn_search_task_is_not_implemented_for_gpu, "k-NN search task is not implemented for GPU")
+MSG(knn_regression_task_is_not_implemented_for_gpu,
+    "k-NN regression task is not implemented for GPU")
 MSG(neighbor_count_lt_one, "Neighbor count lower than one")
 MSG(unknown_distance_type,
     "Custom distances for k-NN is not supported, use one of the predefined distances instead.")
@@ -185,6 +215,8 @@ MSG(subgraph_isomorphism_is_not_implemented_for_labeled_edges,
 MSG(incorrect_index_is_returned, "Internal error: incorrect index is returned")
 MSG(invalid_vertex_edge_attributes, "Internal error: invalid vertex/edge attributes")
 MSG(target_graph_is_smaller_than_pattern_graph, "Target graph is smaller than pattern graph")
+MSG(match_callback_is_empty, "Match callback is required to stream the matches")
+MSG(match_batch_size_leq_zero, "Match batch size is lower than or equal to zero")
 
 /* PCA */
 MSG(component_count_lt_zero, "Component count is lower than zero")
@@ -227,6 +259,9 @@ MSG(nu_svm_thunder_method_is_not_implemented_for_gpu,
     "nuSVM Thunder method is not implemented for GPU")
 MSG(polynomial_kernel_is_not_implemented_for_gpu, "Polynomial kernel is not implemented for GPU")
 MSG(sigmoid_kernel_is_not_implemented_for_gpu, "Sigmoid kernel is not implemented for GPU")
+MSG(chebyshev_distance_is_not_implemented_for_gpu, "Chebyshev distance is not implemented for GPU")
+MSG(cosine_distance_is_not_implemented_for_gpu, "Cosine distance is not implemented for GPU")
+MSG(minkowski_distance_is_not_implemented_for_gpu, "Minkowski distance is not implemented for GPU")
 MSG(sigma_leq_zero, "Sigma lower than or equal to zero")
 MSG(svm_multiclass_not_implemented_for_gpu,
     "SVM with multiclass support is not implemented for GPU")
@@ -256,6 +291,8 @@ MSG(decision_forest_train_dense_method_is_not_implemented_for_gpu,
     "Decision forest train dense method is not implemented for GPU")
 MSG(decision_forest_train_hist_method_is_not_implemented_for_cpu,
     "Decision forest train hist method is not implemented for CPU")
+MSG(decision_forest_shap_is_not_implemented_for_gpu,
+    "Decision forest SHAP values computation is not implemented for GPU")
 MSG(input_model_is_not_initialized, "Input model is not initialized")
 MSG(invalid_number_of_trees, "Invalid number of trees in model")
 MSG(invalid_number_of_classes, "Invalid number of classes")
@@ -83,6 +83,10 @@ public:
     MSG(page_size_leq_zero);
     MSG(invalid_key);
     MSG(capacity_leq_zero);
+    MSG(capacity_exceeded);
+    MSG(cpu_index_lt_zero);
+    MSG(max_thread_count_lt_zero);
+    MSG(numa_node_lt_zero);
 
     /* Primitives */
     MSG(invalid_number_of_elements_to_process);
@@ -117,6 +121,10 @@ public:
     MSG(column_indices_gt_max_value);
     MSG(zero_based_indexing_is_not_supported);
     MSG(object_does_not_provide_read_access_to_csr);
+    MSG(column_rc_does_not_match_table_rc);
+    MSG(validity_offset_lt_zero);
+    MSG(validity_bitmap_is_too_small);
+    MSG(missing_values_cannot_be_represented_in_integer_block);
 
     /* Ranges */
     MSG(invalid_range_of_rows);
@@ -129,7 +137,12 @@ public:
     MSG(unimplemented_sorting_procedure);
 
     /* I/O */
+    MSG(failed_to_map_file);
+    MSG(failed_to_write_file);
     MSG(file_not_found);
+    MSG(invalid_binary_edge_list_file);
+    MSG(invalid_edge_list_file);
+    MSG(invalid_graph_snapshot_file);
 
     /* Serialization */
     MSG(object_is_not_serializable);
@@ -155,6 +168,7 @@ public:
     MSG(bootstrap_is_incompatible_with_variable_importance_mode);
     MSG(decision_forest_train_dense_method_is_not_implemented_for_gpu);
     MSG(decision_forest_train_hist_method_is_not_implemented_for_cpu);
+    MSG(decision_forest_shap_is_not_implemented_for_gpu);
     MSG(invalid_number_of_trees);
     MSG(invalid_number_of_classes);
     MSG(input_model_is_not_initialized);
@@ -177,6 +191,8 @@ public:
     MSG(incorrect_index_is_returned);
     MSG(invalid_vertex_edge_attributes);
     MSG(target_graph_is_smaller_than_pattern_graph);
+    MSG(match_callback_is_empty);
+    MSG(match_batch_size_leq_zero);
 
     /* K-Means and K-Means Init */
     MSG(cluster_count_leq_zero);
@@ -186,16 +202,23 @@ public:
     MSG(input_initial_centroids_are_empty);
     MSG(input_initial_centroids_cc_neq_input_data_cc);
     MSG(input_initial_centroids_rc_neq_desc_cluster_count);
+    MSG(input_initial_cluster_counts_are_negative_or_non_finite);
+    MSG(input_initial_cluster_counts_cc_neq_one);
+    MSG(input_initial_cluster_counts_rc_neq_desc_cluster_count);
     MSG(input_model_centroids_are_empty);
     MSG(input_model_centroids_cc_neq_input_data_cc);
     MSG(input_model_centroids_rc_neq_desc_cluster_count);
     MSG(kmeans_init_parallel_plus_dense_method_is_not_implemented_for_gpu);
     MSG(kmeans_init_plus_plus_dense_method_is_not_implemented_for_gpu);
+    MSG(kmeans_update_mode_is_not_implemented_for_gpu);
+    MSG(kmeans_hamerly_dense_method_is_not_implemented_for_gpu);
+    MSG(mini_batch_size_leq_zero);
     MSG(objective_function_value_lt_zero);
 
     /* k-NN */
     MSG(knn_kd_tree_method_is_not_implemented_for_gpu);
     MSG(knn_search_task_is_not_implemented_for_gpu);
+    MSG(knn_regression_task_is_not_implemented_for_gpu);
     MSG(neighbor_count_lt_one);
     MSG(unknown_distance_type);
     MSG(distance_is_not_supported_for_gpu);
@@ -241,6 +264,9 @@ public:
     MSG(nu_svm_thunder_method_is_not_implemented_for_gpu);
     MSG(polynomial_kernel_is_not_implemented_for_gpu);
     MSG(sigmoid_kernel_is_not_implemented_for_gpu);
+    MSG(chebyshev_distance_is_not_implemented_for_gpu);
+    MSG(cosine_distance_is_not_implemented_for_gpu);
+    MSG(minkowski_distance_is_not_implemented_for_gpu);
     MSG(sigma_leq_zero);
     MSG(svm_multiclass_not_implemented_for_gpu);
     MSG(svm_nu_classification_task_is_not_implemented_for_gpu);
@@ -16,123 +16,251 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+
 #include "oneapi/dal/detail/common.hpp"
 
 namespace oneapi::dal::detail {
 
-template <typename Key, typename Value>
-class hash_map_entry {
+/// Open-addressing hash map with linear probing. Entries are stored in a single
+/// contiguous array, so no allocation happens per inserted key. Each slot has
+/// a control byte that is either empty, busy (being written by concurrent insert)
+/// or contains 7 bits of the key hash, so most of the probes do not compare keys.
+/// The number of slots is a power of two and is doubled once the load factor
+/// exceeds 3/4. Keys cannot be removed from the map.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class hash_map {
 public:
-    hash_map_entry(const Key& key, const Value& value) : next_(nullptr), key_(key), value_(value) {}
+    struct entry_t {
+        Key key;
+        Value value;
+    };
 
-    hash_map_entry* get_next() const {
-        return next_;
+    /// Creates the map that can hold `capacity` keys without growing
+    explicit hash_map(std::int64_t capacity) {
+        if (capacity <= 0) {
+            throw invalid_argument{ error_messages::capacity_leq_zero() };
+        }
+        allocate(get_slot_count(capacity));
     }
 
-    const Key& get_key() const {
-        return key_;
+    ~hash_map() {
+        destroy_entries();
     }
 
-    const Value& get_value() const {
-        return value_;
+    hash_map(const hash_map&) = delete;
+    hash_map& operator=(const hash_map&) = delete;
+
+    std::int64_t get_count() const {
+        return count_.load(std::memory_order_relaxed);
     }
 
-    void make_next(const Key& key, const Value& value) {
-        next_ = new hash_map_entry{ key, value };
+    /// The number of keys the map can hold without growing
+    std::int64_t get_capacity() const {
+        return get_max_count(slot_count_);
     }
 
-    void update(const Key& key, const Value& value) {
-        key_ = key;
-        value_ = value;
+    bool has(const Key& key) const {
+        return find_slot(key, get_hash(key)) >= 0;
     }
 
-private:
-    hash_map_entry* next_;
-    Key key_;
-    Value value_;
-};
+    Value get(const Key& key) const {
+        const std::int64_t slot = find_slot(key, get_hash(key));
+        if (slot < 0) {
+            throw invalid_argument{ error_messages::invalid_key() };
+        }
+        return entries_[slot].value;
+    }
 
-template <typename Key, typename Value>
-class hash_map {
-public:
-    using entry_t = hash_map_entry<Key, Value>;
-    using entry_ptr = entry_t*;
+    /// Returns the pointer to the value of the key or `nullptr` if there is no such key
+    const Value* find(const Key& key) const {
+        const std::int64_t slot = find_slot(key, get_hash(key));
+        return (slot < 0) ? nullptr : &entries_[slot].value;
+    }
 
-    explicit hash_map(std::int64_t capacity) : entries_(nullptr), capacity_(capacity) {
-        if (capacity <= 0) {
-            throw invalid_argument{ error_messages::capacity_leq_zero() };
+    Value* find(const Key& key) {
+        const std::int64_t slot = find_slot(key, get_hash(key));
+        return (slot < 0) ? nullptr : &entries_[slot].value;
+    }
+
+    /// Inserts the key or replaces the value of the existing key. Grows the map if needed
+    void set(const Key& key, const Value& value) {
+        const std::uint64_t hash = get_hash(key);
+        const std::int64_t slot = find_slot(key, hash);
+        if (slot >= 0) {
+            entries_[slot].value = value;
+            return;
         }
 
-        entries_ = new entry_ptr[capacity_];
-        for (std::int64_t i = 0; i < capacity_; i++) {
-            entries_[i] = nullptr;
+        if (get_count() >= get_capacity()) {
+            rehash(slot_count_ * 2);
         }
+        emplace_unique(hash, entry_t{ key, value });
+        count_.fetch_add(1, std::memory_order_relaxed);
     }
 
-    ~hash_map() {
-        delete[] entries_;
-        entries_ = nullptr;
-        capacity_ = 0;
+    /// Makes the map able to hold `count` keys without growing
+    void reserve(std::int64_t count) {
+        if (count > get_capacity()) {
+            rehash(get_slot_count(count));
+        }
     }
 
-    hash_map(const hash_map&) = delete;
-    hash_map& operator=(const hash_map&) = delete;
+    /// Inserts the key if it is not in the map yet. Can be called from several
+    /// threads at once, but not simultaneously with any other method. The map
+    /// does not grow in this mode, so the capacity shall be reserved in advance.
+    ///
+    /// @return `true` if the key is inserted, `false` if it is already in the map
+    bool insert_concurrent(const Key& key, const Value& value) {
+        const std::uint64_t hash = get_hash(key);
+        const std::uint8_t tag = get_tag(hash);
+        for (std::uint64_t slot = hash & mask_;; slot = (slot + 1) & mask_) {
+            std::uint8_t control = controls_[slot].load(std::memory_order_acquire);
+            if (control == empty_control) {
+                if (count_.fetch_add(1, std::memory_order_relaxed) >= get_capacity()) {
+                    count_.fetch_sub(1, std::memory_order_relaxed);
+                    throw out_of_range{ error_messages::capacity_exceeded() };
+                }
+                if (controls_[slot].compare_exchange_strong(control,
+                                                            busy_control,
+                                                            std::memory_order_acquire)) {
+                    new (&entries_[slot]) entry_t{ key, value };
+                    controls_[slot].store(tag, std::memory_order_release);
+                    return true;
+                }
+                // Another thread has taken the slot, so it is checked for the same key
+                count_.fetch_sub(1, std::memory_order_relaxed);
+            }
 
-    bool has(const Key& key) const {
-        return find_entry(key) != nullptr;
-    }
+            // The slot is being written by another thread, its key is unknown yet
+            while (control == busy_control) {
+                control = controls_[slot].load(std::memory_order_acquire);
+            }
 
-    Value get(const Key& key) const {
-        const entry_ptr entry = find_entry(key);
-        if (!entry) {
-            throw invalid_argument{ error_messages::invalid_key() };
+            if (control == tag && entries_[slot].key == key) {
+                return false;
+            }
         }
-        return entry->get_value();
     }
 
-    void set(const Key& key, const Value& value) {
-        replace_or_insert(key, value);
+    /// Calls `op(key, value)` for each key in the map in unspecified order
+    template <typename Op>
+    void for_each(Op&& op) const {
+        for (std::int64_t slot = 0; slot < slot_count_; slot++) {
+            if (is_full(controls_[slot].load(std::memory_order_relaxed))) {
+                op(entries_[slot].key, entries_[slot].value);
+            }
+        }
     }
 
 private:
-    std::int64_t get_index(const Key& key) const {
-        return std::hash<Key>{}(key) % capacity_;
+    using control_t = std::atomic<std::uint8_t>;
+    using storage_t = std::aligned_storage_t<sizeof(entry_t), alignof(entry_t)>;
+
+    static constexpr std::uint8_t empty_control = 0x00;
+    static constexpr std::uint8_t busy_control = 0x01;
+    static constexpr std::uint8_t full_control = 0x80;
+    static constexpr std::int64_t min_slot_count = 8;
+
+    static bool is_full(std::uint8_t control) {
+        return (control & full_control) != 0;
     }
 
-    entry_ptr find_entry(const Key& key) const {
-        entry_ptr current = entries_[get_index(key)];
-        while (current) {
-            if (current->get_key() == key) {
-                return current;
-            }
-            current = current->get_next();
+    static std::int64_t get_max_count(std::int64_t slot_count) {
+        return slot_count - slot_count / 4;
+    }
+
+    static std::int64_t get_slot_count(std::int64_t count) {
+        std::int64_t slot_count = min_slot_count;
+        while (get_max_count(slot_count) < count) {
+            slot_count = check_mul_overflow<std::int64_t>(slot_count, 2);
         }
-        return current;
+        return slot_count;
     }
 
-    void replace_or_insert(const Key& key, const Value& value) {
-        const std::int64_t index = get_index(key);
+    /// Mixes the bits of the user-provided hash, as `std::hash` of integers
+    /// is often an identity that clusters under the power-of-two mask
+    static std::uint64_t get_hash(const Key& key) {
+        std::uint64_t hash = static_cast<std::uint64_t>(Hash{}(key));
+        hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+        return hash ^ (hash >> 31);
+    }
 
-        entry_ptr current = entries_[index];
-        if (!current) {
-            entries_[index] = new entry_t{ key, value };
-            return;
+    static std::uint8_t get_tag(std::uint64_t hash) {
+        return full_control | static_cast<std::uint8_t>(hash >> 57);
+    }
+
+    void allocate(std::int64_t slot_count) {
+        controls_.reset(new control_t[slot_count]);
+        storage_.reset(new storage_t[slot_count]);
+        entries_ = reinterpret_cast<entry_t*>(storage_.get());
+        slot_count_ = slot_count;
+        mask_ = std::uint64_t(slot_count - 1);
+        for (std::int64_t slot = 0; slot < slot_count; slot++) {
+            controls_[slot].store(empty_control, std::memory_order_relaxed);
+        }
+    }
+
+    void destroy_entries() {
+        if constexpr (!std::is_trivially_destructible_v<entry_t>) {
+            for (std::int64_t slot = 0; slot < slot_count_; slot++) {
+                if (is_full(controls_[slot].load(std::memory_order_relaxed))) {
+                    entries_[slot].~entry_t();
+                }
+            }
         }
+    }
 
-        for (;;) {
-            if (current->get_key() == key) {
-                return current->update(key, value);
+    std::int64_t find_slot(const Key& key, std::uint64_t hash) const {
+        const std::uint8_t tag = get_tag(hash);
+        for (std::uint64_t slot = hash & mask_;; slot = (slot + 1) & mask_) {
+            const std::uint8_t control = controls_[slot].load(std::memory_order_acquire);
+            if (control == empty_control) {
+                return -1;
+            }
+            if (control == tag && entries_[slot].key == key) {
+                return std::int64_t(slot);
             }
-            if (!current->get_next()) {
-                return current->make_next(key, value);
+        }
+    }
+
+    /// Places the entry with the key that is known to be absent into the first empty slot
+    void emplace_unique(std::uint64_t hash, entry_t&& entry) {
+        std::uint64_t slot = hash & mask_;
+        while (controls_[slot].load(std::memory_order_relaxed) != empty_control) {
+            slot = (slot + 1) & mask_;
+        }
+        new (&entries_[slot]) entry_t{ std::move(entry) };
+        controls_[slot].store(get_tag(hash), std::memory_order_relaxed);
+    }
+
+    void rehash(std::int64_t slot_count) {
+        auto old_controls = std::move(controls_);
+        auto old_storage = std::move(storage_);
+        entry_t* old_entries = entries_;
+        const std::int64_t old_slot_count = slot_count_;
+
+        allocate(slot_count);
+        for (std::int64_t slot = 0; slot < old_slot_count; slot++) {
+            if (is_full(old_controls[slot].load(std::memory_order_relaxed))) {
+                entry_t& entry = old_entries[slot];
+                emplace_unique(get_hash(entry.key), std::move(entry));
+                entry.~entry_t();
             }
-            current = current->get_next();
         }
     }
 
-    entry_ptr* entries_;
-    std::int64_t capacity_;
+    std::unique_ptr<control_t[]> controls_;
+    std::unique_ptr<storage_t[]> storage_;
+    entry_t* entries_ = nullptr;
+    std::int64_t slot_count_ = 0;
+    std::uint64_t mask_ = 0;
+    std::atomic<std::int64_t> count_{ 0 };
 };
 
 } // namespace oneapi::dal::detail
@@ -41,6 +41,34 @@ void free(const default_host_policy&, void* pointer) {
     daal::services::daal_free(pointer);
 }
 
+void* scratch_malloc(const default_host_policy&, std::size_t size) {
+    return alloc_impl(daal::services::internal::daal_arena_malloc,
+                      size,
+                      daal::DAAL_MALLOC_DEFAULT_ALIGNMENT);
+}
+
+void scratch_free(const default_host_policy&, void* pointer) {
+    daal::services::internal::daal_arena_free(pointer);
+}
+
+void enter_scratch_scope(const default_host_policy&) {
+    daal::services::internal::daal_arena_enter_scope();
+}
+
+void leave_scratch_scope(const default_host_policy&) {
+    daal::services::internal::daal_arena_leave_scope();
+}
+
+void* numa_local_malloc(const default_host_policy&, std::size_t size) {
+    return alloc_impl(daal::services::internal::daal_numa_malloc,
+                      size,
+                      daal::DAAL_MALLOC_DEFAULT_ALIGNMENT);
+}
+
+void numa_local_free(const default_host_policy&, void* pointer) {
+    daal::services::internal::daal_numa_free(pointer);
+}
+
 void memset(const default_host_policy&, void* dest, std::int32_t value, std::int64_t size) {
     ONEDAL_ASSERT(dest != nullptr);
     std::memset(dest, value, detail::integral_cast<std::size_t>(size));
@@ -27,6 +27,12 @@ namespace v1 {
 ONEDAL_EXPORT void* malloc(const default_host_policy&, std::size_t size);
 ONEDAL_EXPORT void* calloc(const default_host_policy&, std::size_t size);
 ONEDAL_EXPORT void free(const default_host_policy&, void* pointer);
+ONEDAL_EXPORT void* scratch_malloc(const default_host_policy&, std::size_t size);
+ONEDAL_EXPORT void scratch_free(const default_host_policy&, void* pointer);
+ONEDAL_EXPORT void enter_scratch_scope(const default_host_policy&);
+ONEDAL_EXPORT void leave_scratch_scope(const default_host_policy&);
+ONEDAL_EXPORT void* numa_local_malloc(const default_host_policy&, std::size_t size);
+ONEDAL_EXPORT void numa_local_free(const default_host_policy&, void* pointer);
 ONEDAL_EXPORT void memset(const default_host_policy&,
                           void* dest,
                           std::int32_t value,
@@ -56,6 +62,22 @@ inline void free(const default_host_policy& policy, T* pointer) {
     free(policy, reinterpret_cast<void*>(const_cast<mutable_t*>(pointer)));
 }
 
+/// Allocates scratch memory from the arena of the calling thread. The memory must be
+/// deallocated with `scratch_free`, the freed blocks are reused by the next allocations
+/// of the thread
+template <typename T>
+inline T* scratch_malloc(const default_host_policy& policy, std::int64_t count) {
+    ONEDAL_ASSERT_MUL_OVERFLOW(std::size_t, sizeof(T), count);
+    const std::size_t bytes_count = sizeof(T) * count;
+    return static_cast<T*>(scratch_malloc(policy, bytes_count));
+}
+
+template <typename T>
+inline void scratch_free(const default_host_policy& policy, T* pointer) {
+    using mutable_t = std::remove_const_t<T>;
+    scratch_free(policy, reinterpret_cast<void*>(const_cast<mutable_t*>(pointer)));
+}
+
 template <typename T>
 inline void fill(const default_host_policy& policy, T* dest, std::int64_t count, const T& value) {
     ONEDAL_ASSERT(dest != nullptr);
@@ -77,6 +99,33 @@ public:
     }
 };
 
+template <typename T>
+class host_scratch_allocator {
+public:
+    T* allocate(std::int64_t n) const {
+        return scratch_malloc<T>(default_host_policy{}, n);
+    }
+    void deallocate(T* p, std::int64_t n) const {
+        scratch_free(default_host_policy{}, p);
+    }
+};
+
+/// The scratch memory cached by the arena of the calling thread is returned
+/// to the system when the outermost scope on the thread ends. The arenas of the
+/// other threads return their memory on their next scratch allocation or deallocation
+class scratch_scope {
+public:
+    scratch_scope() {
+        enter_scratch_scope(default_host_policy{});
+    }
+    ~scratch_scope() {
+        leave_scratch_scope(default_host_policy{});
+    }
+
+    scratch_scope(const scratch_scope&) = delete;
+    scratch_scope& operator=(const scratch_scope&) = delete;
+};
+
 } // namespace v1
 
 using v1::malloc;
@@ -86,5 +135,11 @@ using v1::fill;
 using v1::memset;
 using v1::memcpy;
 using v1::host_allocator;
+using v1::scratch_malloc;
+using v1::scratch_free;
+using v1::host_scratch_allocator;
+using v1::scratch_scope;
+using v1::numa_local_malloc;
+using v1::numa_local_free;
 
 } // namespace oneapi::dal::detail
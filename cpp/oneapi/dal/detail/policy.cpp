@@ -14,7 +14,11 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <memory>
+#include <mutex>
+
 #include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
 
 namespace oneapi::dal::detail {
@@ -22,7 +26,38 @@ namespace v1 {
 
 class host_policy_impl : public base {
 public:
+    bool has_placement() const {
+        return max_thread_count > 0 || !cpu_set.empty() || numa_node >= 0;
+    }
+
+    /// The arena is created on the first computations with the policy
+    /// and is shared by all the computations that follow. The caller keeps
+    /// the returned pointer, so the arena is destroyed only when the last
+    /// computation in it ends, even if the policy is changed meanwhile
+    std::shared_ptr<void> get_arena() {
+        std::lock_guard<std::mutex> lock(arena_mutex);
+        if (!arena && has_placement()) {
+            const auto cpu_count = static_cast<std::int32_t>(cpu_set.size());
+            void* const arena_ptr =
+                _onedal_new_arena(max_thread_count, cpu_set.data(), cpu_count, numa_node);
+            arena = std::shared_ptr<void>(arena_ptr, _onedal_del_arena);
+        }
+        return arena;
+    }
+
+    void reset_arena() {
+        std::lock_guard<std::mutex> lock(arena_mutex);
+        arena.reset();
+    }
+
     cpu_extension cpu_extensions_mask = backend::detect_top_cpu_extension();
+    std::int32_t max_thread_count = 0;
+    std::vector<std::int32_t> cpu_set;
+    std::int32_t numa_node = -1;
+
+private:
+    std::mutex arena_mutex;
+    std::shared_ptr<void> arena;
 };
 
 host_policy::host_policy() : impl_(new host_policy_impl()) {}
@@ -35,6 +70,49 @@ cpu_extension host_policy::get_enabled_cpu_extensions() const noexcept {
     return impl_->cpu_extensions_mask;
 }
 
+std::int32_t host_policy::get_max_thread_count() const noexcept {
+    return impl_->max_thread_count;
+}
+
+const std::vector<std::int32_t>& host_policy::get_cpu_set() const noexcept {
+    return impl_->cpu_set;
+}
+
+std::int32_t host_policy::get_numa_node() const noexcept {
+    return impl_->numa_node;
+}
+
+void host_policy::set_max_thread_count_impl(std::int32_t value) {
+    if (value < 0) {
+        throw invalid_argument{ error_messages::max_thread_count_lt_zero() };
+    }
+    impl_->reset_arena();
+    impl_->max_thread_count = value;
+}
+
+void host_policy::set_cpu_set_impl(const std::vector<std::int32_t>& value) {
+    for (const std::int32_t cpu : value) {
+        if (cpu < 0) {
+            throw invalid_argument{ error_messages::cpu_index_lt_zero() };
+        }
+    }
+    impl_->reset_arena();
+    impl_->cpu_set = value;
+}
+
+void host_policy::set_numa_node_impl(std::int32_t value) {
+    if (value < 0) {
+        throw invalid_argument{ error_messages::numa_node_lt_zero() };
+    }
+    impl_->reset_arena();
+    impl_->numa_node = value;
+}
+
+void host_policy::execute_impl(const void* op, void (*func)(const void*)) const {
+    const auto arena = impl_->get_arena();
+    _onedal_execute_in_arena(arena.get(), op, func);
+}
+
 #ifdef ONEDAL_DATA_PARALLEL
 void data_parallel_policy::init_impl(const sycl::queue& queue) {
     this->impl_ = nullptr; // reserved for future use
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <type_traits>
+#include <vector>
 #ifdef ONEDAL_DATA_PARALLEL
 #include <CL/sycl.hpp>
 #endif
@@ -52,13 +53,54 @@ public:
 
     cpu_extension get_enabled_cpu_extensions() const noexcept;
 
+    /// The maximum number of threads the computations run on.
+    /// Zero means that the number of threads is not limited by the policy.
+    std::int32_t get_max_thread_count() const noexcept;
+
+    /// The indices of the CPUs the threads of the computations are pinned to.
+    /// Empty means that the threads are not pinned by the policy.
+    const std::vector<std::int32_t>& get_cpu_set() const noexcept;
+
+    /// The NUMA node the threads of the computations are pinned to.
+    /// Negative means that the NUMA node is not selected by the policy.
+    std::int32_t get_numa_node() const noexcept;
+
     auto& set_enabled_cpu_extensions(const cpu_extension& extensions) {
         set_enabled_cpu_extensions_impl(extensions);
         return *this;
     }
 
+    auto& set_max_thread_count(std::int32_t value) {
+        set_max_thread_count_impl(value);
+        return *this;
+    }
+
+    auto& set_cpu_set(const std::vector<std::int32_t>& value) {
+        set_cpu_set_impl(value);
+        return *this;
+    }
+
+    auto& set_numa_node(std::int32_t value) {
+        set_numa_node_impl(value);
+        return *this;
+    }
+
+    /// Runs the operation in the task arena that matches the thread count, the CPU set
+    /// and the NUMA node of the policy, so that the parallel loops called from the
+    /// operation use the threads of the arena only
+    template <typename Op>
+    void execute(const Op& op) const {
+        execute_impl(static_cast<const void*>(&op), [](const void* a) {
+            (*static_cast<const Op*>(a))();
+        });
+    }
+
 private:
     void set_enabled_cpu_extensions_impl(const cpu_extension& extensions) noexcept;
+    void set_max_thread_count_impl(std::int32_t value);
+    void set_cpu_set_impl(const std::vector<std::int32_t>& value);
+    void set_numa_node_impl(std::int32_t value);
+    void execute_impl(const void* op, void (*func)(const void*)) const;
 
     pimpl<host_policy_impl> impl_;
 };
@@ -31,6 +31,7 @@ typedef void (*functype_int64)(std::int64_t i, const void *a);
 typedef void (*functype_int32ptr)(const std::int32_t *i, const void *a);
 typedef void *(*tls_functype)(const void *a);
 typedef void (*tls_reduce_functype)(void *p, const void *a);
+typedef void (*functype_arena)(const void *a);
 
 typedef std::int64_t (*loop_functype_int32_int64)(std::int32_t start_idx,
                                                   std::int32_t end_idx,
@@ -112,6 +113,15 @@ ONEDAL_EXPORT void *_onedal_new_mutex();
 ONEDAL_EXPORT void _onedal_lock_mutex(void *mutex_ptr);
 ONEDAL_EXPORT void _onedal_unlock_mutex(void *mutex_ptr);
 ONEDAL_EXPORT void _onedal_del_mutex(void *mutex_ptr);
+
+ONEDAL_EXPORT void *_onedal_new_arena(std::int32_t max_threads,
+                                      const std::int32_t *cpus,
+                                      std::int32_t cpu_count,
+                                      std::int32_t numa_node);
+ONEDAL_EXPORT void _onedal_del_arena(void *arena_ptr);
+ONEDAL_EXPORT void _onedal_execute_in_arena(void *arena_ptr,
+                                            const void *a,
+                                            oneapi::dal::preview::functype_arena func);
 }
 
 namespace oneapi::dal::detail {
@@ -141,6 +151,12 @@ inline void threader_func_int32ptr(const std::int32_t *i, const void *a) {
     lambda(i);
 }
 
+template <typename F>
+inline void threader_func_arena(const void *a) {
+    const F &lambda = *static_cast<const F *>(a);
+    lambda();
+}
+
 template <typename F>
 inline ONEDAL_EXPORT void threader_for(std::int32_t n,
                                        std::int32_t threads_request,
@@ -175,6 +191,13 @@ inline ONEDAL_EXPORT void threader_for_int32ptr(const std::int32_t *begin,
     _onedal_threader_for_int32ptr(begin, end, a, threader_func_int32ptr<F>);
 }
 
+template <typename F>
+inline ONEDAL_EXPORT void threader_execute_in_arena(void *arena_ptr, const F &lambda) {
+    const void *a = static_cast<const void *>(&lambda);
+
+    _onedal_execute_in_arena(arena_ptr, a, threader_func_arena<F>);
+}
+
 template <typename F>
 inline std::int64_t parallel_reduce_loop_int32_int64(std::int32_t start_idx,
                                                      std::int32_t end_idx,
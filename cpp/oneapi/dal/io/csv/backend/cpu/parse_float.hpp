@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace oneapi::dal::csv::backend {
+
+inline bool is_blank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+inline bool is_digit(char c) {
+    return static_cast<unsigned char>(c - '0') < 10;
+}
+
+/// Parses the token `[begin, end)` with `strtod`. It is a slow path used for
+/// the numbers that cannot be converted exactly by `parse_float`, e.g.
+/// `inf`, `nan` or values with large exponent
+inline bool parse_float_slow(const char* begin, const char* end, double& value) {
+    constexpr std::int64_t max_token_length = 127;
+    char token[max_token_length + 1];
+
+    const std::int64_t length = end - begin;
+    if (length <= 0 || length > max_token_length) {
+        return false;
+    }
+    std::memcpy(token, begin, static_cast<std::size_t>(length));
+    token[length] = '\0';
+
+    char* token_end = nullptr;
+    value = std::strtod(token, &token_end);
+    return token_end == token + length;
+}
+
+/// Parses the floating-point number at the beginning of `[it, end)` and skips
+/// leading and trailing blanks. On success `it` points to the first character
+/// after the number. Returns `false` if the range does not start with a number.
+/// The `delimiter` terminates non-numeric tokens such as `nan` or `inf`.
+template <typename Float>
+inline bool parse_float(const char*& it, const char* end, char delimiter, Float& result) {
+    // Powers of ten that are exactly representable in double
+    constexpr double pow10[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                 1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    constexpr std::int32_t max_exact_pow10 = 22;
+    constexpr std::uint64_t max_exact_mantissa = std::uint64_t(1) << 53;
+    constexpr std::int32_t max_mantissa_digits = 19;
+
+    const char* p = it;
+    while (p < end && is_blank(*p)) {
+        ++p;
+    }
+    const char* token_begin = p;
+
+    bool is_negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        is_negative = (*p == '-');
+        ++p;
+    }
+
+    std::uint64_t mantissa = 0;
+    std::int32_t mantissa_digits = 0;
+    std::int32_t exponent = 0;
+    bool has_digits = false;
+    bool is_exact = true;
+
+    for (; p < end && is_digit(*p); ++p) {
+        has_digits = true;
+        if (mantissa_digits < max_mantissa_digits) {
+            mantissa = mantissa * 10 + std::uint64_t(*p - '0');
+            mantissa_digits += std::int32_t(mantissa > 0);
+        }
+        else {
+            ++exponent;
+            is_exact = false;
+        }
+    }
+
+    if (p < end && *p == '.') {
+        for (++p; p < end && is_digit(*p); ++p) {
+            has_digits = true;
+            if (mantissa_digits < max_mantissa_digits) {
+                mantissa = mantissa * 10 + std::uint64_t(*p - '0');
+                mantissa_digits += std::int32_t(mantissa > 0);
+                --exponent;
+            }
+            else {
+                is_exact = false;
+            }
+        }
+    }
+
+    if (has_digits && p < end && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool is_negative_exponent = false;
+        if (q < end && (*q == '-' || *q == '+')) {
+            is_negative_exponent = (*q == '-');
+            ++q;
+        }
+        if (q < end && is_digit(*q)) {
+            std::int32_t explicit_exponent = 0;
+            for (; q < end && is_digit(*q); ++q) {
+                if (explicit_exponent < 100000) {
+                    explicit_exponent = explicit_exponent * 10 + std::int32_t(*q - '0');
+                }
+            }
+            exponent += is_negative_exponent ? -explicit_exponent : explicit_exponent;
+            p = q;
+        }
+    }
+
+    double value = 0.0;
+    if (has_digits && is_exact && mantissa <= max_exact_mantissa &&
+        exponent >= -max_exact_pow10 && exponent <= max_exact_pow10) {
+        value = double(mantissa);
+        value = (exponent < 0) ? value / pow10[-exponent] : value * pow10[exponent];
+        value = is_negative ? -value : value;
+    }
+    else {
+        const char* token_end = p;
+        if (!has_digits) {
+            while (token_end < end && !is_blank(*token_end) && *token_end != delimiter) {
+                ++token_end;
+            }
+        }
+        if (!parse_float_slow(token_begin, token_end, value)) {
+            return false;
+        }
+        p = token_end;
+    }
+
+    while (p < end && is_blank(*p)) {
+        ++p;
+    }
+
+    it = p;
+    result = static_cast<Float>(value);
+    return true;
+}
+
+} // namespace oneapi::dal::csv::backend
@@ -23,21 +23,100 @@
 
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <vector>
+
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/backend/mapped_file.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/io/csv/backend/cpu/parse_float.hpp"
 #include "oneapi/dal/io/csv/backend/cpu/read_kernel.hpp"
-#include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/table/homogen.hpp"
 
 namespace oneapi::dal::csv::backend {
 
 namespace interop = dal::backend::interop;
 namespace daal_dm = daal::data_management;
 
-template <>
-table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
-                                         const detail::data_source_base& ds,
-                                         const read_args<table>& args) const {
+using data_t = DAAL_DATA_TYPE;
+
+/// The minimal number of bytes processed by a single task
+constexpr std::int64_t min_chunk_size = 1 << 20;
+
+/// Returns the end of the line starting at `begin` (position of `\n` or `end`)
+inline const char* find_line_end(const char* begin, const char* end) {
+    const void* newline = std::memchr(begin, '\n', static_cast<std::size_t>(end - begin));
+    return newline ? static_cast<const char*>(newline) : end;
+}
+
+/// Strips the trailing carriage return, so files with CRLF line endings are supported
+inline const char* trim_line_end(const char* begin, const char* line_end) {
+    return (line_end > begin && line_end[-1] == '\r') ? line_end - 1 : line_end;
+}
+
+inline std::int64_t count_rows(const char* begin, const char* end) {
+    std::int64_t row_count = 0;
+    for (const char* line = begin; line < end;) {
+        const char* line_end = find_line_end(line, end);
+        row_count += std::int64_t(trim_line_end(line, line_end) != line);
+        line = line_end + 1;
+    }
+    return row_count;
+}
+
+inline std::int64_t count_columns(const char* begin, const char* end, char delimiter) {
+    for (const char* line = begin; line < end;) {
+        const char* line_end = find_line_end(line, end);
+        const char* row_end = trim_line_end(line, line_end);
+        if (row_end != line) {
+            return std::count(line, row_end, delimiter) + 1;
+        }
+        line = line_end + 1;
+    }
+    return 0;
+}
+
+/// Parses non-empty lines of the chunk `[begin, end)` into `rows`.
+/// Returns `false` if the chunk contains a field that is not a number or
+/// a row with number of fields different from `column_count`
+inline bool parse_rows(const char* begin,
+                       const char* end,
+                       char delimiter,
+                       std::int64_t column_count,
+                       data_t* rows) {
+    for (const char* line = begin; line < end;) {
+        const char* line_end = find_line_end(line, end);
+        const char* row_end = trim_line_end(line, line_end);
+        if (row_end != line) {
+            const char* it = line;
+            for (std::int64_t j = 0; j < column_count; j++) {
+                if (!parse_float(it, row_end, delimiter, rows[j])) {
+                    return false;
+                }
+                if (j + 1 < column_count) {
+                    if (it == row_end || *it != delimiter) {
+                        return false;
+                    }
+                    ++it;
+                }
+                else if (it != row_end) {
+                    return false;
+                }
+            }
+            rows += column_count;
+        }
+        line = line_end + 1;
+    }
+    return true;
+}
+
+/// Reads the file through legacy DAAL data source. It is used for the files
+/// that contain non-numeric (categorical) features
+static table read_via_daal_data_source(const detail::data_source_base& ds) {
     daal_dm::CsvDataSourceOptions csv_options(daal_dm::operator|(
         daal_dm::operator|(daal_dm::CsvDataSourceOptions::allocateNumericTable,
                            daal_dm::CsvDataSourceOptions::createDictionaryFromContext),
@@ -52,8 +131,68 @@ table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
     daal_data_source.loadDataBlock();
     interop::status_to_exception(daal_data_source.status());
 
-    return oneapi::dal::backend::interop::convert_from_daal_homogen_table<DAAL_DATA_TYPE>(
+    return oneapi::dal::backend::interop::convert_from_daal_homogen_table<data_t>(
         daal_data_source.getNumericTable());
 }
 
+template <>
+table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
+                                         const detail::data_source_base& ds,
+                                         const read_args<table>& args) const {
+    const dal::backend::mapped_file file{ ds.get_file_name() };
+    const char delimiter = ds.get_delimiter();
+
+    const char* begin = file.get_data();
+    const char* end = begin + file.get_size();
+    if (ds.get_parse_header() && begin < end) {
+        begin = std::min(find_line_end(begin, end) + 1, end);
+    }
+
+    const std::int64_t column_count = count_columns(begin, end, delimiter);
+    if (column_count == 0) {
+        return table{};
+    }
+
+    // Several chunks per thread to balance the rows of different length
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    const std::int64_t max_chunk_count =
+        std::max<std::int64_t>(std::min(file.get_size() / min_chunk_size, 4 * thread_count), 1);
+    const auto bounds = dal::backend::split_by_lines(begin, end, max_chunk_count);
+    const std::int32_t chunk_count = dal::detail::integral_cast<std::int32_t>(bounds.size() - 1);
+
+    std::vector<std::int64_t> row_offsets(chunk_count + 1, 0);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        row_offsets[i + 1] = count_rows(bounds[i], bounds[i + 1]);
+    });
+    for (std::int32_t i = 0; i < chunk_count; i++) {
+        row_offsets[i + 1] = dal::detail::check_sum_overflow(row_offsets[i], row_offsets[i + 1]);
+    }
+
+    const std::int64_t row_count = row_offsets[chunk_count];
+    const std::int64_t element_count =
+        dal::detail::check_mul_overflow(row_count, column_count);
+    auto data = array<data_t>::empty(element_count);
+    data_t* data_ptr = data.get_mutable_data();
+
+    std::atomic<bool> is_numeric{ true };
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        if (!is_numeric.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (!parse_rows(bounds[i],
+                        bounds[i + 1],
+                        delimiter,
+                        column_count,
+                        data_ptr + row_offsets[i] * column_count)) {
+            is_numeric.store(false, std::memory_order_relaxed);
+        }
+    });
+
+    if (!is_numeric) {
+        return read_via_daal_data_source(ds);
+    }
+
+    return homogen_table::wrap(data, row_count, column_count);
+}
+
 } // namespace oneapi::dal::csv::backend
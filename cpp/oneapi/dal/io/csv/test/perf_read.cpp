@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef ONEDAL_DATA_CONVERSION
+
+#define ONEDAL_DATA_CONVERSION
+#include "daal/include/data_management/data_source/csv_feature_manager.h"
+#include "daal/include/data_management/data_source/file_data_source.h"
+#undef ONEDAL_DATA_CONVERSION
+
+#endif
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::csv::test {
+
+namespace daal_dm = daal::data_management;
+
+class csv_perf_test {
+public:
+    ~csv_perf_test() {
+        std::remove(file_name_.c_str());
+    }
+
+    void generate(std::int64_t row_count, std::int64_t column_count) {
+        std::ofstream file(file_name_);
+        std::mt19937 rng(7777);
+        std::uniform_real_distribution<float> uniform(-100.0f, 100.0f);
+        for (std::int64_t i = 0; i < row_count; i++) {
+            for (std::int64_t j = 0; j < column_count; j++) {
+                file << uniform(rng) << ((j + 1 < column_count) ? ',' : '\n');
+            }
+        }
+    }
+
+    void run_read(std::int64_t row_count, std::int64_t column_count) {
+        const auto name = fmt::format("Parallel CSV read: row_count {}, column_count {}",
+                                      row_count,
+                                      column_count);
+        BENCHMARK(name.c_str()) {
+            return read<table>(data_source{ file_name_ });
+        };
+    }
+
+    void run_legacy_read(std::int64_t row_count, std::int64_t column_count) {
+        const auto name = fmt::format("DAAL FileDataSource read: row_count {}, column_count {}",
+                                      row_count,
+                                      column_count);
+        BENCHMARK(name.c_str()) {
+            daal_dm::FileDataSource<daal_dm::CSVFeatureManager> data_source(
+                file_name_.c_str(),
+                daal_dm::DataSource::doAllocateNumericTable,
+                daal_dm::DataSource::doDictionaryFromContext);
+            data_source.loadDataBlock();
+            return data_source.getNumericTable();
+        };
+    }
+
+private:
+    std::string file_name_ = "csv_perf_test.csv";
+};
+
+TEST_M(csv_perf_test, "csv read perf test", "[csv][read][weekly][perf]") {
+    const std::int64_t row_count = GENERATE(100000, 1000000);
+    const std::int64_t column_count = GENERATE(10, 100);
+
+    this->generate(row_count, column_count);
+    this->run_read(row_count, column_count);
+    this->run_legacy_read(row_count, column_count);
+}
+
+} // namespace oneapi::dal::csv::test
@@ -0,0 +1,108 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::csv::test {
+
+class csv_file {
+public:
+    csv_file(const std::string& name, const std::string& content) : name_(name) {
+        std::ofstream file(name_, std::ios::binary);
+        file << content;
+    }
+
+    ~csv_file() {
+        std::remove(name_.c_str());
+    }
+
+    const std::string& get_name() const {
+        return name_;
+    }
+
+private:
+    std::string name_;
+};
+
+void check_table(const table& t,
+                 std::int64_t row_count,
+                 std::int64_t column_count,
+                 const std::vector<float>& expected) {
+    REQUIRE(t.get_row_count() == row_count);
+    REQUIRE(t.get_column_count() == column_count);
+
+    const auto rows = row_accessor<const float>(t).pull({ 0, -1 });
+    REQUIRE(rows.get_count() == row_count * column_count);
+    for (std::int64_t i = 0; i < rows.get_count(); i++) {
+        CAPTURE(i);
+        REQUIRE(rows[i] == Approx(expected[i]));
+    }
+}
+
+TEST("can read numeric csv file", "[csv][read]") {
+    const csv_file file{ "csv_read_numeric.csv", "1.5,2,-3\n4e2,+5.25, 6 \n-7.125,.5,9\n" };
+
+    const auto t = read<table>(data_source{ file.get_name() });
+
+    check_table(t, 3, 3, { 1.5f, 2.0f, -3.0f, 400.0f, 5.25f, 6.0f, -7.125f, 0.5f, 9.0f });
+}
+
+TEST("can read csv file with header and CRLF line endings", "[csv][read]") {
+    const csv_file file{ "csv_read_header.csv", "a,b\r\n1,2\r\n3,4\r\n\r\n" };
+
+    const auto t = read<table>(data_source{ file.get_name() }.set_parse_header(true));
+
+    check_table(t, 2, 2, { 1.0f, 2.0f, 3.0f, 4.0f });
+}
+
+TEST("can read csv file with custom delimiter and without trailing newline", "[csv][read]") {
+    const csv_file file{ "csv_read_delimiter.csv", "1;2;3\n4;5;6" };
+
+    const auto t = read<table>(data_source{ file.get_name() }.set_delimiter(';'));
+
+    check_table(t, 2, 3, { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f });
+}
+
+TEST("can read large csv file split into several chunks", "[csv][read]") {
+    const std::int64_t row_count = 200000;
+    const std::int64_t column_count = 4;
+
+    std::string content;
+    std::vector<float> expected;
+    for (std::int64_t i = 0; i < row_count; i++) {
+        for (std::int64_t j = 0; j < column_count; j++) {
+            const float value = float(i % 1000) * 0.25f - float(j);
+            content += fmt::format("{}{}", value, (j + 1 < column_count) ? "," : "\n");
+            expected.push_back(value);
+        }
+    }
+    const csv_file file{ "csv_read_large.csv", content };
+
+    const auto t = read<table>(data_source{ file.get_name() });
+
+    check_table(t, row_count, column_count, expected);
+}
+
+TEST("throws if csv file does not exist", "[csv][read]") {
+    REQUIRE_THROWS_AS(read<table>(data_source{ "csv_read_missing_file.csv" }), invalid_argument);
+}
+
+} // namespace oneapi::dal::csv::test
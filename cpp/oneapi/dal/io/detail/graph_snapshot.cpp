@@ -0,0 +1,32 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "oneapi/dal/backend/mapped_file.hpp"
+#include "oneapi/dal/io/detail/graph_snapshot.hpp"
+
+namespace oneapi::dal::preview::load_graph::detail {
+
+dal::array<dal::byte_t> map_graph_snapshot(const std::string &name) {
+    const auto file = std::make_shared<dal::backend::mapped_file>(name);
+    const auto data = reinterpret_cast<const dal::byte_t *>(file->get_data());
+
+    // The deleter owns the mapping, so the memory is unmapped together with the last array
+    return dal::array<dal::byte_t>{ data, file->get_size(), [file](const dal::byte_t *) {} };
+}
+
+} // namespace oneapi::dal::preview::load_graph::detail
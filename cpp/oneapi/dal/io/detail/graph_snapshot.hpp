@@ -0,0 +1,320 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/graph/common.hpp"
+#include "oneapi/dal/graph/directed_adjacency_vector_graph.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+
+namespace oneapi::dal::preview::load_graph::detail {
+
+/// Signature of the graph snapshot file
+constexpr char graph_snapshot_magic[8] = { 'O', 'N', 'E', 'D', 'A', 'L', 'G', 'S' };
+
+/// Version of the graph snapshot file format
+constexpr std::int32_t graph_snapshot_version = 1;
+
+/// Alignment of the arrays in the graph snapshot file
+constexpr std::int64_t graph_snapshot_alignment = 64;
+
+/// Header of the graph snapshot file. The header is followed by the CSR arrays
+/// of the graph topology: `vertex_count + 1` edge offsets, `neighbor_count`
+/// neighbors, `vertex_count` degrees, optional `vertex_count + 1` vertex-sized
+/// edge offsets and optional `neighbor_count` edge values. Each array starts
+/// at the offset from the beginning of the file that is a multiple of
+/// `graph_snapshot_alignment`, the offset of the missing array is zero.
+/// All values are stored in the native byte order.
+struct graph_snapshot_header {
+    char magic[8];
+    std::int32_t version;
+    std::int32_t is_directed;
+    std::int32_t vertex_size;
+    std::int32_t edge_size;
+    std::int32_t edge_value_size;
+    std::int32_t edge_value_is_floating_point;
+    std::int64_t vertex_count;
+    std::int64_t edge_count;
+    std::int64_t neighbor_count;
+    std::int64_t rows_offset;
+    std::int64_t cols_offset;
+    std::int64_t degrees_offset;
+    std::int64_t rows_vertex_offset;
+    std::int64_t edge_values_offset;
+};
+
+/// Maps the whole file into memory and returns the array that keeps the file mapped
+/// while the array or any array that shares ownership with it exists
+ONEDAL_EXPORT dal::array<dal::byte_t> map_graph_snapshot(const std::string &name);
+
+template <typename EdgeValue>
+constexpr std::int32_t get_edge_value_size() {
+    return std::is_same_v<EdgeValue, empty_value> ? 0 : std::int32_t(sizeof(EdgeValue));
+}
+
+inline std::int64_t align_snapshot_offset(std::int64_t offset) {
+    return (offset + graph_snapshot_alignment - 1) / graph_snapshot_alignment *
+           graph_snapshot_alignment;
+}
+
+template <typename T>
+inline void write_snapshot_array(std::ofstream &file,
+                                 std::int64_t &offset,
+                                 std::int64_t &array_offset,
+                                 const T *data,
+                                 std::int64_t count) {
+    const std::int64_t aligned_offset = align_snapshot_offset(offset);
+    const char padding[graph_snapshot_alignment] = {};
+    file.write(padding, aligned_offset - offset);
+    file.write(reinterpret_cast<const char *>(data), sizeof(T) * count);
+    array_offset = aligned_offset;
+    offset = aligned_offset + std::int64_t(sizeof(T)) * count;
+}
+
+template <typename Graph>
+void save_snapshot_impl(const Graph &graph, const std::string &name) {
+    using vertex_t = typename graph_traits<Graph>::vertex_type;
+    using edge_t = typename graph_traits<Graph>::edge_type;
+    using edge_value_t = typename graph_traits<Graph>::edge_user_value_type;
+
+    const auto &graph_impl = oneapi::dal::detail::get_impl(graph);
+    const auto topology = graph_impl.get_topology();
+    const auto edge_values = graph_impl.get_edge_values();
+
+    graph_snapshot_header header = {};
+    std::memcpy(header.magic, graph_snapshot_magic, sizeof(graph_snapshot_magic));
+    header.version = graph_snapshot_version;
+    header.is_directed = std::int32_t(is_directed<Graph>);
+    header.vertex_size = sizeof(vertex_t);
+    header.edge_size = sizeof(edge_t);
+    header.edge_value_size = get_edge_value_size<edge_value_t>();
+    header.edge_value_is_floating_point = std::int32_t(std::is_floating_point_v<edge_value_t>);
+    header.vertex_count = topology.get_vertex_count();
+    header.edge_count = topology.get_edge_count();
+    header.neighbor_count = topology._cols.get_count();
+
+    std::ofstream file(name, std::ios::binary);
+    if (!file.is_open()) {
+        throw invalid_argument(dal::detail::error_messages::failed_to_write_file());
+    }
+
+    // The header is written twice: at first to reserve the space, then with the array offsets
+    std::int64_t offset = sizeof(header);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    if (header.vertex_count > 0) {
+        write_snapshot_array(file,
+                             offset,
+                             header.rows_offset,
+                             topology._rows.get_data(),
+                             header.vertex_count + 1);
+        write_snapshot_array(file,
+                             offset,
+                             header.cols_offset,
+                             topology._cols.get_data(),
+                             header.neighbor_count);
+        write_snapshot_array(file,
+                             offset,
+                             header.degrees_offset,
+                             topology._degrees.get_data(),
+                             header.vertex_count);
+        if (topology._rows_vertex.get_count() == header.vertex_count + 1) {
+            write_snapshot_array(file,
+                                 offset,
+                                 header.rows_vertex_offset,
+                                 topology._rows_vertex.get_data(),
+                                 header.vertex_count + 1);
+        }
+        if constexpr (get_edge_value_size<edge_value_t>() > 0) {
+            if (edge_values.get_count() == header.neighbor_count) {
+                write_snapshot_array(file,
+                                     offset,
+                                     header.edge_values_offset,
+                                     edge_values.get_data(),
+                                     header.neighbor_count);
+            }
+        }
+    }
+
+    file.seekp(0);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.close();
+    if (!file) {
+        throw invalid_argument(dal::detail::error_messages::failed_to_write_file());
+    }
+}
+
+inline bool is_valid_snapshot_array(const graph_snapshot_header &header,
+                                    std::int64_t file_size,
+                                    std::int64_t array_offset,
+                                    std::int64_t element_size,
+                                    std::int64_t count) {
+    return array_offset >= std::int64_t(sizeof(header)) &&
+           array_offset % graph_snapshot_alignment == 0 && array_offset <= file_size &&
+           count <= (file_size - array_offset) / element_size;
+}
+
+template <typename T>
+inline dal::array<T> get_snapshot_array(const dal::array<dal::byte_t> &file,
+                                        std::int64_t array_offset,
+                                        std::int64_t count) {
+    const auto data = reinterpret_cast<const T *>(file.get_data() + array_offset);
+    return dal::array<T>{ file, data, count };
+}
+
+/// Checks that the CSR arrays describe the graph with `vertex_count` vertices:
+/// the edge offsets start from zero, do not decrease and end at `neighbor_count`,
+/// the degrees are the differences of the offsets and the neighbors are valid vertices
+template <typename Edge, typename Vertex>
+inline bool is_valid_snapshot_topology(const Edge *rows,
+                                       const Vertex *cols,
+                                       const Vertex *degrees,
+                                       std::int64_t vertex_count,
+                                       std::int64_t neighbor_count) {
+    if (std::int64_t(rows[0]) != 0 || std::int64_t(rows[vertex_count]) != neighbor_count) {
+        return false;
+    }
+    for (std::int64_t u = 0; u < vertex_count; ++u) {
+        const std::int64_t begin = rows[u];
+        const std::int64_t end = rows[u + 1];
+        if (end < begin || std::int64_t(degrees[u]) != end - begin) {
+            return false;
+        }
+    }
+    for (std::int64_t i = 0; i < neighbor_count; ++i) {
+        const std::int64_t v = cols[i];
+        if (v < 0 || v >= vertex_count) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Graph>
+Graph load_snapshot_impl(const std::string &name, bool validate) {
+    using vertex_t = typename graph_traits<Graph>::vertex_type;
+    using edge_t = typename graph_traits<Graph>::edge_type;
+    using edge_value_t = typename graph_traits<Graph>::edge_user_value_type;
+    using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
+
+    const auto file = map_graph_snapshot(name);
+    const std::int64_t file_size = file.get_count();
+
+    graph_snapshot_header header;
+    if (file_size < std::int64_t(sizeof(header))) {
+        throw invalid_argument(dal::detail::error_messages::invalid_graph_snapshot_file());
+    }
+    std::memcpy(&header, file.get_data(), sizeof(header));
+
+    const std::int64_t vertex_count = header.vertex_count;
+    const std::int64_t neighbor_count = header.neighbor_count;
+    const bool has_edge_values = header.edge_values_offset != 0;
+
+    bool is_valid =
+        std::memcmp(header.magic, graph_snapshot_magic, sizeof(graph_snapshot_magic)) == 0 &&
+        header.version == graph_snapshot_version &&
+        bool(header.is_directed) == is_directed<Graph> &&
+        header.vertex_size == sizeof(vertex_t) && header.edge_size == sizeof(edge_t) &&
+        header.edge_value_size == get_edge_value_size<edge_value_t>() &&
+        bool(header.edge_value_is_floating_point) == std::is_floating_point_v<edge_value_t> &&
+        vertex_count >= 0 && vertex_count < dal::detail::limits<std::int64_t>::max() &&
+        neighbor_count >= 0 && header.edge_count >= 0;
+
+    if (is_valid && vertex_count > 0) {
+        is_valid = is_valid_snapshot_array(header,
+                                           file_size,
+                                           header.rows_offset,
+                                           sizeof(edge_t),
+                                           vertex_count + 1) &&
+                   is_valid_snapshot_array(header,
+                                           file_size,
+                                           header.cols_offset,
+                                           sizeof(vertex_t),
+                                           neighbor_count) &&
+                   is_valid_snapshot_array(header,
+                                           file_size,
+                                           header.degrees_offset,
+                                           sizeof(vertex_t),
+                                           vertex_count);
+        if (is_valid && header.rows_vertex_offset != 0) {
+            is_valid = is_valid_snapshot_array(header,
+                                               file_size,
+                                               header.rows_vertex_offset,
+                                               sizeof(vertex_edge_t),
+                                               vertex_count + 1);
+        }
+        if (is_valid && has_edge_values) {
+            is_valid = header.edge_value_size > 0 &&
+                       is_valid_snapshot_array(header,
+                                               file_size,
+                                               header.edge_values_offset,
+                                               header.edge_value_size,
+                                               neighbor_count);
+        }
+    }
+
+    if (!is_valid) {
+        throw invalid_argument(dal::detail::error_messages::invalid_graph_snapshot_file());
+    }
+
+    Graph graph;
+    if (vertex_count == 0) {
+        return graph;
+    }
+
+    auto &graph_impl = oneapi::dal::detail::get_impl(graph);
+    const auto rows = get_snapshot_array<edge_t>(file, header.rows_offset, vertex_count + 1);
+    const auto cols = get_snapshot_array<vertex_t>(file, header.cols_offset, neighbor_count);
+    const auto degrees = get_snapshot_array<vertex_t>(file, header.degrees_offset, vertex_count);
+    if (validate && !is_valid_snapshot_topology(rows.get_data(),
+                                                cols.get_data(),
+                                                degrees.get_data(),
+                                                vertex_count,
+                                                neighbor_count)) {
+        throw invalid_argument(dal::detail::error_messages::invalid_graph_snapshot_file());
+    }
+    graph_impl.set_topology(vertex_count, header.edge_count, rows, cols, degrees);
+
+    if (header.rows_vertex_offset != 0) {
+        const auto rows_vertex =
+            get_snapshot_array<vertex_edge_t>(file, header.rows_vertex_offset, vertex_count + 1);
+        if (validate) {
+            for (std::int64_t u = 0; u <= vertex_count; ++u) {
+                if (std::int64_t(rows_vertex[u]) != std::int64_t(rows[u])) {
+                    throw invalid_argument(
+                        dal::detail::error_messages::invalid_graph_snapshot_file());
+                }
+            }
+        }
+        graph_impl.get_topology()._rows_vertex = rows_vertex;
+    }
+
+    if constexpr (get_edge_value_size<edge_value_t>() > 0) {
+        if (has_edge_values) {
+            graph_impl.get_edge_values() =
+                get_snapshot_array<edge_value_t>(file, header.edge_values_offset, neighbor_count);
+        }
+    }
+
+    return graph;
+}
+
+} // namespace oneapi::dal::preview::load_graph::detail
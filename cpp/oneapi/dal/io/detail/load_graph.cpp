@@ -14,12 +14,390 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+#include <cstring>
+#include <vector>
+
 #include "oneapi/dal/io/detail/load_graph.hpp"
 #include "oneapi/dal/io/backend/cpu/load_graph.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/backend/mapped_file.hpp"
 
 namespace oneapi::dal::preview::load_graph::detail {
 
+template <typename Edge>
+using edge_container = preview::detail::edge_list_container<Edge, std::allocator<char>>;
+
+/// The minimal number of bytes processed by a single task
+constexpr std::int64_t min_chunk_size = 1 << 20;
+
+inline bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+}
+
+inline const char *skip_spaces(const char *it, const char *end) {
+    while (it < end && is_space(*it)) {
+        ++it;
+    }
+    return it;
+}
+
+inline const char *find_token_end(const char *it, const char *end) {
+    while (it < end && !is_space(*it)) {
+        ++it;
+    }
+    return it;
+}
+
+template <typename Integer>
+inline bool parse_value(const char *begin, const char *end, Integer &value) {
+    static_assert(std::is_integral_v<Integer> && std::is_signed_v<Integer>);
+
+    const bool is_negative = (*begin == '-');
+    if (*begin == '-' || *begin == '+') {
+        ++begin;
+    }
+    if (begin == end) {
+        return false;
+    }
+
+    // The magnitude of the lowest value is greater by one than the one of the highest value
+    const std::uint64_t max_magnitude =
+        std::uint64_t(dal::detail::limits<Integer>::max()) + std::uint64_t(is_negative);
+    std::uint64_t magnitude = 0;
+    for (; begin < end; ++begin) {
+        const std::uint64_t digit = static_cast<unsigned char>(*begin - '0');
+        if (digit >= 10 || magnitude > (max_magnitude - digit) / 10) {
+            return false;
+        }
+        magnitude = magnitude * 10 + digit;
+    }
+    value = (is_negative && magnitude > 0) ? Integer(-Integer(magnitude - 1) - 1)
+                                           : Integer(magnitude);
+    return true;
+}
+
+inline bool parse_value(const char *begin, const char *end, double &value) {
+    constexpr std::int64_t max_token_length = 63;
+    char token[max_token_length + 1];
+
+    const std::int64_t length = end - begin;
+    if (length > max_token_length) {
+        return false;
+    }
+    std::memcpy(token, begin, static_cast<std::size_t>(length));
+    token[length] = '\0';
+
+    char *parsed_end = nullptr;
+    value = daal_string_to_double(token, &parsed_end);
+    return parsed_end == token + length;
+}
+
+inline bool parse_value(const char *begin, const char *end, float &value) {
+    double wide_value;
+    if (!parse_value(begin, end, wide_value) ||
+        std::abs(wide_value) > double(dal::detail::limits<float>::max())) {
+        return false;
+    }
+    value = static_cast<float>(wide_value);
+    return true;
+}
+
+enum class parse_status { ok, invalid_value, negative_vertex };
+
+template <typename Value>
+inline parse_status parse_weight(const char *begin, const char *end, Value &value) {
+    return parse_value(begin, end, value) ? parse_status::ok : parse_status::invalid_value;
+}
+
+inline parse_status parse_vertex(const char *begin, const char *end, std::int32_t &vertex) {
+    if (!parse_value(begin, end, vertex)) {
+        return parse_status::invalid_value;
+    }
+    return (vertex < 0) ? parse_status::negative_vertex : parse_status::ok;
+}
+
+inline bool read_vertex(const char *record, std::int32_t vertex_size, std::int32_t &vertex) {
+    if (vertex_size == sizeof(std::int32_t)) {
+        std::memcpy(&vertex, record, sizeof(std::int32_t));
+        return vertex >= 0;
+    }
+    std::int64_t wide_vertex;
+    std::memcpy(&wide_vertex, record, sizeof(std::int64_t));
+    vertex = static_cast<std::int32_t>(wide_vertex);
+    return wide_vertex >= 0 && wide_vertex <= dal::detail::limits<std::int32_t>::max();
+}
+
+template <typename Edge>
+struct edge_traits;
+
+template <>
+struct edge_traits<std::pair<std::int32_t, std::int32_t>> {
+    using edge_t = std::pair<std::int32_t, std::int32_t>;
+
+    static constexpr std::int64_t value_count = 2;
+    static constexpr std::int32_t weight_size = 0;
+    static constexpr bool weight_is_floating_point = false;
+
+    /// Parses the value of the edge with the index `value_index` from the token
+    static parse_status parse(const char *begin,
+                              const char *end,
+                              std::int64_t value_index,
+                              edge_t &edge) {
+        return parse_vertex(begin, end, value_index == 0 ? edge.first : edge.second);
+    }
+
+    static bool read(const char *record, std::int32_t vertex_size, edge_t &edge) {
+        return read_vertex(record, vertex_size, edge.first) &&
+               read_vertex(record + vertex_size, vertex_size, edge.second);
+    }
+
+    static void write(char *record, const edge_t &edge) {
+        std::memcpy(record, &edge.first, sizeof(std::int32_t));
+        std::memcpy(record + sizeof(std::int32_t), &edge.second, sizeof(std::int32_t));
+    }
+};
+
+template <typename Weight>
+struct edge_traits<std::tuple<std::int32_t, std::int32_t, Weight>> {
+    using edge_t = std::tuple<std::int32_t, std::int32_t, Weight>;
+
+    static constexpr std::int64_t value_count = 3;
+    static constexpr std::int32_t weight_size = sizeof(Weight);
+    static constexpr bool weight_is_floating_point = std::is_floating_point_v<Weight>;
+
+    static parse_status parse(const char *begin,
+                              const char *end,
+                              std::int64_t value_index,
+                              edge_t &edge) {
+        switch (value_index) {
+            case 0: return parse_vertex(begin, end, std::get<0>(edge));
+            case 1: return parse_vertex(begin, end, std::get<1>(edge));
+            default: return parse_weight(begin, end, std::get<2>(edge));
+        }
+    }
+
+    static bool read(const char *record, std::int32_t vertex_size, edge_t &edge) {
+        std::memcpy(&std::get<2>(edge), record + 2 * vertex_size, sizeof(Weight));
+        return read_vertex(record, vertex_size, std::get<0>(edge)) &&
+               read_vertex(record + vertex_size, vertex_size, std::get<1>(edge));
+    }
+
+    static void write(char *record, const edge_t &edge) {
+        std::memcpy(record, &std::get<0>(edge), sizeof(std::int32_t));
+        std::memcpy(record + sizeof(std::int32_t), &std::get<1>(edge), sizeof(std::int32_t));
+        std::memcpy(record + 2 * sizeof(std::int32_t), &std::get<2>(edge), sizeof(Weight));
+    }
+};
+
+inline std::int32_t get_task_count(std::int64_t byte_count) {
+    // Several tasks per thread to balance the lines of different length
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    return static_cast<std::int32_t>(
+        std::max<std::int64_t>(std::min(byte_count / min_chunk_size, 4 * thread_count), 1));
+}
+
+/// The values of the edges are separated by any whitespace, so an edge might start
+/// in one chunk and end in the next one. The tokens of each chunk are counted first,
+/// then the token with the global index `t` is parsed into the value `t % value_count`
+/// of the edge `t / value_count`. The chunks write different values of such an edge.
+template <typename Edge>
+void load_text_edge_list(const char *begin,
+                         const char *end,
+                         edge_container<Edge> &elist) {
+    using traits_t = edge_traits<Edge>;
+
+    const auto bounds = dal::backend::split_by_lines(begin, end, get_task_count(end - begin));
+    const std::int32_t chunk_count = static_cast<std::int32_t>(bounds.size() - 1);
+
+    std::vector<std::int64_t> token_offsets(chunk_count + 1, 0);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        std::int64_t token_count = 0;
+        for (const char *it = skip_spaces(bounds[i], bounds[i + 1]); it < bounds[i + 1];
+             it = skip_spaces(find_token_end(it, bounds[i + 1]), bounds[i + 1])) {
+            ++token_count;
+        }
+        token_offsets[i + 1] = token_count;
+    });
+    for (std::int32_t i = 0; i < chunk_count; i++) {
+        token_offsets[i + 1] += token_offsets[i];
+    }
+
+    const std::int64_t token_count = token_offsets[chunk_count];
+    if (token_count % traits_t::value_count != 0) {
+        throw invalid_argument(dal::detail::error_messages::invalid_edge_list_file());
+    }
+
+    const std::int64_t edge_count = token_count / traits_t::value_count;
+    elist.reserve(edge_count);
+    elist.resize(edge_count);
+    Edge *edges = elist.get_mutable_data();
+
+    std::atomic<bool> is_valid{ true };
+    std::atomic<bool> has_negative_vertex{ false };
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        std::int64_t token_index = token_offsets[i];
+        for (const char *it = skip_spaces(bounds[i], bounds[i + 1]); it < bounds[i + 1];
+             ++token_index) {
+            const char *token_end = find_token_end(it, bounds[i + 1]);
+            const parse_status status = traits_t::parse(it,
+                                                        token_end,
+                                                        token_index % traits_t::value_count,
+                                                        edges[token_index / traits_t::value_count]);
+            if (status == parse_status::invalid_value) {
+                is_valid.store(false, std::memory_order_relaxed);
+                return;
+            }
+            if (status == parse_status::negative_vertex) {
+                has_negative_vertex.store(true, std::memory_order_relaxed);
+                return;
+            }
+            it = skip_spaces(token_end, bounds[i + 1]);
+        }
+    });
+
+    if (!is_valid) {
+        throw invalid_argument(dal::detail::error_messages::invalid_edge_list_file());
+    }
+    if (has_negative_vertex) {
+        throw invalid_argument(dal::detail::error_messages::negative_vertex_id());
+    }
+}
+
+inline bool is_binary_edge_list(const dal::backend::mapped_file &file) {
+    return file.get_size() >= std::int64_t(sizeof(binary_edge_list_header)) &&
+           std::memcmp(file.get_data(), binary_edge_list_magic, sizeof(binary_edge_list_magic)) ==
+               0;
+}
+
+template <typename Edge>
+void load_binary_edge_list(const char *data,
+                           std::int64_t size,
+                           edge_container<Edge> &elist) {
+    using traits_t = edge_traits<Edge>;
+
+    binary_edge_list_header header;
+    std::memcpy(&header, data, sizeof(header));
+
+    const bool is_valid_vertex_size = header.vertex_size == sizeof(std::int32_t) ||
+                                      header.vertex_size == sizeof(std::int64_t);
+    const bool is_valid_header =
+        header.version == binary_edge_list_version && is_valid_vertex_size &&
+        header.weight_size == traits_t::weight_size &&
+        bool(header.weight_is_floating_point) == traits_t::weight_is_floating_point &&
+        header.edge_count >= 0;
+    if (!is_valid_header) {
+        throw invalid_argument(dal::detail::error_messages::invalid_binary_edge_list_file());
+    }
+
+    const std::int64_t record_size = 2 * header.vertex_size + header.weight_size;
+    const std::int64_t records_size =
+        dal::detail::check_mul_overflow(header.edge_count, record_size);
+    if (size - std::int64_t(sizeof(header)) < records_size) {
+        throw invalid_argument(dal::detail::error_messages::invalid_binary_edge_list_file());
+    }
+
+    const std::int64_t edge_count = header.edge_count;
+    elist.reserve(edge_count);
+    elist.resize(edge_count);
+    Edge *edges = elist.get_mutable_data();
+    const char *records = data + sizeof(header);
+
+    const std::int32_t block_count = get_task_count(records_size);
+    const std::int64_t block_size = edge_count / block_count + 1;
+
+    std::atomic<bool> is_valid{ true };
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const std::int64_t first = std::min(b * block_size, edge_count);
+        const std::int64_t last = std::min(first + block_size, edge_count);
+        for (std::int64_t i = first; i < last; i++) {
+            if (!traits_t::read(records + i * record_size, header.vertex_size, edges[i])) {
+                is_valid.store(false, std::memory_order_relaxed);
+                return;
+            }
+        }
+    });
+
+    if (!is_valid) {
+        throw invalid_argument(dal::detail::error_messages::invalid_binary_edge_list_file());
+    }
+}
+
+template <typename Edge>
+void load_edge_list_impl(const std::string &name,
+                         edge_container<Edge> &elist) {
+    const dal::backend::mapped_file file{ name };
+    if (is_binary_edge_list(file)) {
+        load_binary_edge_list(file.get_data(), file.get_size(), elist);
+    }
+    else {
+        load_text_edge_list(file.get_data(), file.get_data() + file.get_size(), elist);
+    }
+}
+
+template <typename Edge>
+void save_binary_edge_list_impl(const std::string &name,
+                                const edge_container<Edge> &elist) {
+    using traits_t = edge_traits<Edge>;
+
+    binary_edge_list_header header;
+    std::memcpy(header.magic, binary_edge_list_magic, sizeof(binary_edge_list_magic));
+    header.version = binary_edge_list_version;
+    header.vertex_size = sizeof(std::int32_t);
+    header.weight_size = traits_t::weight_size;
+    header.weight_is_floating_point = std::int32_t(traits_t::weight_is_floating_point);
+    header.edge_count = elist.size();
+
+    std::ofstream file(name, std::ios::binary);
+    if (!file.is_open()) {
+        throw invalid_argument(dal::detail::error_messages::failed_to_write_file());
+    }
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    constexpr std::int64_t block_edge_count = 1 << 16;
+    const std::int64_t record_size = 2 * sizeof(std::int32_t) + traits_t::weight_size;
+    std::vector<char> block(block_edge_count * record_size);
+    for (std::int64_t first = 0; first < elist.size() && file; first += block_edge_count) {
+        const std::int64_t last = std::min(first + block_edge_count, elist.size());
+        for (std::int64_t i = first; i < last; i++) {
+            traits_t::write(block.data() + (i - first) * record_size, elist[i]);
+        }
+        file.write(block.data(), (last - first) * record_size);
+    }
+
+    file.close();
+    if (!file) {
+        throw invalid_argument(dal::detail::error_messages::failed_to_write_file());
+    }
+}
+
+template <typename EdgeList>
+void load_edge_list(const std::string &name, EdgeList &elist) {
+    load_edge_list_impl(name, elist);
+}
+
+template <typename EdgeList>
+void save_binary_edge_list(const std::string &name, const EdgeList &elist) {
+    save_binary_edge_list_impl(name, elist);
+}
+
+#define INSTANTIATE(EdgeList)                                                                 \
+    template ONEDAL_EXPORT void load_edge_list(const std::string &, EdgeList &);              \
+    template ONEDAL_EXPORT void save_binary_edge_list(const std::string &, const EdgeList &);
+
+#define INSTANTIATE_WEIGHTED(Weight)                                                        \
+    template ONEDAL_EXPORT void load_edge_list(const std::string &,                         \
+                                               weighted_edge_list<std::int32_t, Weight> &); \
+    template ONEDAL_EXPORT void save_binary_edge_list(                                      \
+        const std::string &,                                                                \
+        const weighted_edge_list<std::int32_t, Weight> &);
+
+INSTANTIATE(edge_list<std::int32_t>)
+INSTANTIATE_WEIGHTED(std::int32_t)
+INSTANTIATE_WEIGHTED(std::int64_t)
+INSTANTIATE_WEIGHTED(float)
+INSTANTIATE_WEIGHTED(double)
+
 template <>
 ONEDAL_EXPORT std::int64_t compute_prefix_sum(const std::int32_t *degrees,
                                               std::int64_t degrees_count,
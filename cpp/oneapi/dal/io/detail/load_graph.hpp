@@ -32,45 +32,40 @@
 
 namespace oneapi::dal::preview::load_graph::detail {
 
-template <typename EdgeList>
-inline void load_edge_list(const std::string &name, EdgeList &elist);
-
-template <>
-inline void load_edge_list(const std::string &name, edge_list<std::int32_t> &elist) {
-    std::ifstream file(name);
-    if (!file.is_open()) {
-        throw invalid_argument(dal::detail::error_messages::file_not_found());
-    }
-
-    elist.reserve(1024);
-    char source_vertex[32], destination_vertex[32];
-    while (file >> source_vertex >> destination_vertex) {
-        auto edge = std::make_pair(daal_string_to_int(&source_vertex[0], 0),
-                                   daal_string_to_int(&destination_vertex[0], 0));
-        elist.push_back(edge);
-    }
-
-    file.close();
-}
+/// Signature of the binary edge list file
+constexpr char binary_edge_list_magic[8] = { 'O', 'N', 'E', 'D', 'A', 'L', 'E', 'L' };
+
+/// Version of the binary edge list file format
+constexpr std::int32_t binary_edge_list_version = 1;
+
+/// Header of the binary edge list file. The header is followed by `edge_count`
+/// records without padding. Each record contains the source and the destination
+/// vertex indices of `vertex_size` bytes (4 or 8) and, if `weight_size` is not zero,
+/// the edge weight of `weight_size` bytes. The weight is a floating-point number if
+/// `weight_is_floating_point` is not zero, otherwise it is a signed integer.
+/// All values are stored in the native byte order.
+struct binary_edge_list_header {
+    char magic[8];
+    std::int32_t version;
+    std::int32_t vertex_size;
+    std::int32_t weight_size;
+    std::int32_t weight_is_floating_point;
+    std::int64_t edge_count;
+};
 
-template <typename Vertex, typename Weight>
-inline void load_edge_list(const std::string &name, weighted_edge_list<Vertex, Weight> &elist) {
-    std::ifstream file(name);
-    if (!file.is_open()) {
-        throw invalid_argument(dal::detail::error_messages::file_not_found());
-    }
+/// Loads the edge list from the file. The file is either the text file or the binary
+/// edge list file started by `binary_edge_list_header`. The text file is a sequence of
+/// the source vertex, the destination vertex and, for the weighted edge lists, the weight
+/// of each edge separated by any whitespace. Vertex indices must be non-negative.
+/// The text file is memory-mapped and parsed in parallel by line-aligned chunks.
+/// Instantiated for `edge_list<std::int32_t>` and for `weighted_edge_list` with
+/// `std::int32_t` vertices and `std::int32_t`, `std::int64_t`, `float` or `double` weights.
+template <typename EdgeList>
+void load_edge_list(const std::string &name, EdgeList &elist);
 
-    elist.reserve(1024);
-    char source_vertex[32], destination_vertex[32], edge_value[64];
-    while (file >> source_vertex >> destination_vertex >> edge_value) {
-        auto edge =
-            std::tuple<Vertex, Vertex, Weight>(daal_string_to<Vertex>(&source_vertex[0], 0),
-                                               daal_string_to<Vertex>(&destination_vertex[0], 0),
-                                               daal_string_to<Weight>(&edge_value[0], 0));
-        elist.push_back(edge);
-    }
-    file.close();
-}
+/// Saves the edge list to the binary edge list file
+template <typename EdgeList>
+void save_binary_edge_list(const std::string &name, const EdgeList &elist);
 
 template <typename EdgeList>
 std::int64_t get_vertex_count_from_edge_list(const EdgeList &edges) {
@@ -0,0 +1,53 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @file
+/// Contains the definition of the binary graph snapshot functionality
+
+#pragma once
+
+#include "oneapi/dal/io/detail/graph_snapshot.hpp"
+
+namespace oneapi::dal::preview::load_graph {
+
+/// Saves the topology and the edge values of the graph into the binary file
+/// in the CSR format, so the graph can be loaded with `load_snapshot` without parsing
+///
+/// @tparam Graph Type of the graph
+/// @param [in] graph The graph object
+/// @param [in] name  The name of the file
+template <typename Graph>
+void save_snapshot(const Graph &graph, const std::string &name) {
+    detail::save_snapshot_impl(graph, name);
+}
+
+/// Returns the graph object that refers to the binary file created by `save_snapshot`.
+/// The file is mapped into memory and the graph arrays point to the mapped memory
+/// directly without copying. The file is unmapped when the graph is destroyed
+///
+/// @tparam Graph Type of the graph, must match the type of the saved graph
+/// @param [in] name     The name of the file
+/// @param [in] validate If true, the CSR arrays from the file are checked in
+///                      O(vertex_count + neighbor_count) time before the graph is created.
+///                      The check can be skipped for trusted files only
+///
+/// @return The graph object with the topology and the edge values from the file
+template <typename Graph>
+Graph load_snapshot(const std::string &name, bool validate = true) {
+    return detail::load_snapshot_impl<Graph>(name, validate);
+}
+
+} // namespace oneapi::dal::preview::load_graph
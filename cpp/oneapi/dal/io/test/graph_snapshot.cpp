@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "oneapi/dal/graph/service_functions.hpp"
+#include "oneapi/dal/io/graph_snapshot.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::preview::load_graph::test {
+
+class snapshot_file {
+public:
+    snapshot_file(const std::string& name, const std::string& content = "") : name_(name) {
+        if (!content.empty()) {
+            std::ofstream file(name_, std::ios::binary);
+            file << content;
+        }
+    }
+
+    ~snapshot_file() {
+        std::remove(name_.c_str());
+    }
+
+    const std::string& get_name() const {
+        return name_;
+    }
+
+private:
+    std::string name_;
+};
+
+using undirected_graph_t = undirected_adjacency_vector_graph<>;
+using directed_graph_t = directed_adjacency_vector_graph<empty_value, double>;
+
+/// Overwrites the element of the snapshot array that starts at the given
+/// offset in the header
+template <typename T>
+void corrupt_snapshot(const std::string& name,
+                      std::int64_t detail::graph_snapshot_header::*array_offset,
+                      std::int64_t index,
+                      T value) {
+    std::string content;
+    {
+        std::ifstream file(name, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    detail::graph_snapshot_header header;
+    REQUIRE(content.size() >= sizeof(header));
+    std::memcpy(&header, content.data(), sizeof(header));
+
+    const std::int64_t position = header.*array_offset + index * std::int64_t(sizeof(T));
+    REQUIRE(position + std::int64_t(sizeof(T)) <= std::int64_t(content.size()));
+    std::memcpy(&content[position], &value, sizeof(T));
+
+    std::ofstream file(name, std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+TEST("can save and load undirected graph snapshot", "[load_graph][snapshot]") {
+    const snapshot_file text_file{ "graph_snapshot_undirected.txt", "0 1\n1 2\n2 0\n2 3\n" };
+    const snapshot_file binary_file{ "graph_snapshot_undirected.bin" };
+
+    const auto graph = load(descriptor<>{}, graph_csv_data_source{ text_file.get_name() });
+    save_snapshot(graph, binary_file.get_name());
+    const auto snapshot = load_snapshot<undirected_graph_t>(binary_file.get_name());
+
+    REQUIRE(get_vertex_count(snapshot) == get_vertex_count(graph));
+    REQUIRE(get_edge_count(snapshot) == get_edge_count(graph));
+    for (std::int32_t u = 0; u < get_vertex_count(graph); u++) {
+        CAPTURE(u);
+        REQUIRE(get_vertex_degree(snapshot, u) == get_vertex_degree(graph, u));
+
+        const auto [begin, end] = get_vertex_neighbors(graph, u);
+        const auto [snapshot_begin, snapshot_end] = get_vertex_neighbors(snapshot, u);
+        REQUIRE(std::equal(begin, end, snapshot_begin, snapshot_end));
+    }
+}
+
+TEST("can save and load directed weighted graph snapshot", "[load_graph][snapshot]") {
+    const snapshot_file text_file{ "graph_snapshot_directed.txt", "0 1 0.5\n1 2 1.5\n2 0 -2\n" };
+    const snapshot_file binary_file{ "graph_snapshot_directed.bin" };
+
+    using descriptor_t = descriptor<weighted_edge_list<std::int32_t, double>, directed_graph_t>;
+    const auto graph = load(descriptor_t{}, graph_csv_data_source{ text_file.get_name() });
+    save_snapshot(graph, binary_file.get_name());
+    const auto snapshot = load_snapshot<directed_graph_t>(binary_file.get_name());
+
+    REQUIRE(get_vertex_count(snapshot) == 3);
+    REQUIRE(get_edge_count(snapshot) == 3);
+    REQUIRE(get_edge_value(snapshot, 0, 1) == 0.5);
+    REQUIRE(get_edge_value(snapshot, 1, 2) == 1.5);
+    REQUIRE(get_edge_value(snapshot, 2, 0) == -2.0);
+}
+
+TEST("snapshot graph stays valid after the file is removed", "[load_graph][snapshot]") {
+    const snapshot_file text_file{ "graph_snapshot_removed.txt", "0 1\n1 2\n" };
+    const std::string binary_file_name = "graph_snapshot_removed.bin";
+
+    const auto graph = load(descriptor<>{}, graph_csv_data_source{ text_file.get_name() });
+    save_snapshot(graph, binary_file_name);
+    const auto snapshot = load_snapshot<undirected_graph_t>(binary_file_name);
+    std::remove(binary_file_name.c_str());
+
+    REQUIRE(get_vertex_count(snapshot) == 3);
+    REQUIRE(get_vertex_degree(snapshot, 1) == 2);
+}
+
+TEST("throws if snapshot graph type does not match", "[load_graph][snapshot]") {
+    const snapshot_file text_file{ "graph_snapshot_mismatch.txt", "0 1\n1 2\n" };
+    const snapshot_file binary_file{ "graph_snapshot_mismatch.bin" };
+
+    const auto graph = load(descriptor<>{}, graph_csv_data_source{ text_file.get_name() });
+    save_snapshot(graph, binary_file.get_name());
+
+    REQUIRE_THROWS_AS(load_snapshot<directed_graph_t>(binary_file.get_name()), invalid_argument);
+}
+
+TEST("throws if snapshot file is corrupted", "[load_graph][snapshot]") {
+    const snapshot_file file{ "graph_snapshot_corrupted.bin", "0 1\n1 2\n" };
+
+    REQUIRE_THROWS_AS(load_snapshot<undirected_graph_t>(file.get_name()), invalid_argument);
+}
+
+TEST("throws if snapshot edge offsets are corrupted", "[load_graph][snapshot]") {
+    using edge_t = typename graph_traits<undirected_graph_t>::edge_type;
+
+    const snapshot_file text_file{ "graph_snapshot_bad_rows.txt", "0 1\n1 2\n2 0\n2 3\n" };
+    const snapshot_file binary_file{ "graph_snapshot_bad_rows.bin" };
+
+    const auto graph = load(descriptor<>{}, graph_csv_data_source{ text_file.get_name() });
+    save_snapshot(graph, binary_file.get_name());
+
+    // The offsets of vertex 2 go backwards and exceed the number of neighbors
+    corrupt_snapshot(binary_file.get_name(),
+                     &detail::graph_snapshot_header::rows_offset,
+                     2,
+                     edge_t(1000));
+
+    REQUIRE_THROWS_AS(load_snapshot<undirected_graph_t>(binary_file.get_name()),
+                      invalid_argument);
+}
+
+TEST("throws if snapshot neighbor is out of range", "[load_graph][snapshot]") {
+    using vertex_t = typename graph_traits<undirected_graph_t>::vertex_type;
+
+    const snapshot_file text_file{ "graph_snapshot_bad_cols.txt", "0 1\n1 2\n2 0\n2 3\n" };
+    const snapshot_file binary_file{ "graph_snapshot_bad_cols.bin" };
+
+    const auto graph = load(descriptor<>{}, graph_csv_data_source{ text_file.get_name() });
+    save_snapshot(graph, binary_file.get_name());
+
+    corrupt_snapshot(binary_file.get_name(),
+                     &detail::graph_snapshot_header::cols_offset,
+                     0,
+                     vertex_t(4));
+
+    REQUIRE_THROWS_AS(load_snapshot<undirected_graph_t>(binary_file.get_name()),
+                      invalid_argument);
+}
+
+TEST("throws if snapshot file cannot be written", "[load_graph][snapshot]") {
+    const snapshot_file text_file{ "graph_snapshot_unwritable.txt", "0 1\n1 2\n" };
+
+    const auto graph = load(descriptor<>{}, graph_csv_data_source{ text_file.get_name() });
+
+    REQUIRE_THROWS_AS(save_snapshot(graph, "graph_snapshot_missing_directory/graph.bin"),
+                      invalid_argument);
+}
+
+} // namespace oneapi::dal::preview::load_graph::test
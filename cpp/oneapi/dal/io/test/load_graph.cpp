@@ -0,0 +1,223 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "oneapi/dal/graph/service_functions.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::preview::load_graph::test {
+
+class graph_file {
+public:
+    graph_file(const std::string& name, const std::string& content = "") : name_(name) {
+        if (!content.empty()) {
+            std::ofstream file(name_, std::ios::binary);
+            file << content;
+        }
+    }
+
+    ~graph_file() {
+        std::remove(name_.c_str());
+    }
+
+    const std::string& get_name() const {
+        return name_;
+    }
+
+private:
+    std::string name_;
+};
+
+TEST("can load edge list from text file", "[load_graph][edge_list]") {
+    const graph_file file{ "load_graph_text.txt", "0 1\n1 2\r\n\n  2\t3  \n3 0" };
+
+    edge_list<std::int32_t> edges;
+    detail::load_edge_list(file.get_name(), edges);
+
+    const std::vector<std::pair<std::int32_t, std::int32_t>> expected = {
+        { 0, 1 },
+        { 1, 2 },
+        { 2, 3 },
+        { 3, 0 },
+    };
+    REQUIRE(edges.size() == std::int64_t(expected.size()));
+    for (std::int64_t i = 0; i < edges.size(); i++) {
+        CAPTURE(i);
+        REQUIRE(edges[i] == expected[i]);
+    }
+}
+
+TEST("can load large edge list split into several chunks", "[load_graph][edge_list]") {
+    const std::int32_t edge_count = 1 << 20;
+
+    std::string content;
+    for (std::int32_t i = 0; i < edge_count; i++) {
+        content += fmt::format("{} {}\n", i, (i * 7) % edge_count);
+    }
+    const graph_file file{ "load_graph_large.txt", content };
+
+    edge_list<std::int32_t> edges;
+    detail::load_edge_list(file.get_name(), edges);
+
+    REQUIRE(edges.size() == edge_count);
+    for (std::int32_t i = 0; i < edge_count; i++) {
+        REQUIRE(edges[i].first == i);
+        REQUIRE(edges[i].second == (i * 7) % edge_count);
+    }
+}
+
+TEST("can load weighted edge list from text file", "[load_graph][edge_list]") {
+    const graph_file file{ "load_graph_weighted.txt", "0 1 0.5\n1 2 1e3\n" };
+
+    weighted_edge_list<std::int32_t, double> edges;
+    detail::load_edge_list(file.get_name(), edges);
+
+    REQUIRE(edges.size() == 2);
+    REQUIRE(edges[0] == std::make_tuple(0, 1, 0.5));
+    REQUIRE(edges[1] == std::make_tuple(1, 2, 1000.0));
+}
+
+TEST("can load edge list with edges separated by any whitespace", "[load_graph][edge_list]") {
+    const graph_file file{ "load_graph_whitespace.txt", "0 1 1 2\n2\n3 3 0" };
+
+    edge_list<std::int32_t> edges;
+    detail::load_edge_list(file.get_name(), edges);
+
+    const std::vector<std::pair<std::int32_t, std::int32_t>> expected = {
+        { 0, 1 },
+        { 1, 2 },
+        { 2, 3 },
+        { 3, 0 },
+    };
+    REQUIRE(edges.size() == std::int64_t(expected.size()));
+    for (std::int64_t i = 0; i < edges.size(); i++) {
+        CAPTURE(i);
+        REQUIRE(edges[i] == expected[i]);
+    }
+}
+
+TEMPLATE_TEST("can load weighted edge list with different weight types",
+              "[load_graph][edge_list]",
+              std::int32_t,
+              std::int64_t,
+              float,
+              double) {
+    using weight_t = TestType;
+    const graph_file file{ "load_graph_weight_types.txt", "0 1 -2\n1 2 3\n" };
+
+    weighted_edge_list<std::int32_t, weight_t> edges;
+    detail::load_edge_list(file.get_name(), edges);
+
+    REQUIRE(edges.size() == 2);
+    REQUIRE(edges[0] == std::make_tuple(0, 1, weight_t(-2)));
+    REQUIRE(edges[1] == std::make_tuple(1, 2, weight_t(3)));
+}
+
+TEST("throws if text edge list contains negative vertex", "[load_graph][edge_list]") {
+    const graph_file file{ "load_graph_negative.txt", "0 1\n-1 2\n" };
+
+    edge_list<std::int32_t> edges;
+    REQUIRE_THROWS_AS(detail::load_edge_list(file.get_name(), edges), invalid_argument);
+}
+
+TEST("throws if text edge list has incomplete edge", "[load_graph][edge_list]") {
+    const graph_file file{ "load_graph_incomplete.txt", "0 1\n1 2\n3\n" };
+
+    edge_list<std::int32_t> edges;
+    REQUIRE_THROWS_AS(detail::load_edge_list(file.get_name(), edges), invalid_argument);
+}
+
+TEST("throws if text edge list contains invalid line", "[load_graph][edge_list]") {
+    const graph_file file{ "load_graph_invalid.txt", "0 1\n1 x\n" };
+
+    edge_list<std::int32_t> edges;
+    REQUIRE_THROWS_AS(detail::load_edge_list(file.get_name(), edges), invalid_argument);
+}
+
+TEST("can save and load binary edge list", "[load_graph][edge_list][binary]") {
+    const graph_file text_file{ "load_graph_source.txt", "0 1\n1 2\n2 3\n3 0\n" };
+    const graph_file binary_file{ "load_graph_binary.bin" };
+
+    edge_list<std::int32_t> text_edges;
+    detail::load_edge_list(text_file.get_name(), text_edges);
+    detail::save_binary_edge_list(binary_file.get_name(), text_edges);
+
+    edge_list<std::int32_t> binary_edges;
+    detail::load_edge_list(binary_file.get_name(), binary_edges);
+
+    REQUIRE(binary_edges.size() == text_edges.size());
+    for (std::int64_t i = 0; i < text_edges.size(); i++) {
+        REQUIRE(binary_edges[i] == text_edges[i]);
+    }
+}
+
+TEST("can load binary edge list with 64-bit vertex indices", "[load_graph][edge_list][binary]") {
+    const graph_file file{ "load_graph_binary64.bin" };
+    {
+        detail::binary_edge_list_header header;
+        std::memcpy(header.magic, detail::binary_edge_list_magic, sizeof(header.magic));
+        header.version = detail::binary_edge_list_version;
+        header.vertex_size = sizeof(std::int64_t);
+        header.weight_size = 0;
+        header.weight_is_floating_point = 0;
+        header.edge_count = 2;
+
+        const std::int64_t records[] = { 0, 1, 1, 2 };
+        std::ofstream stream(file.get_name(), std::ios::binary);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(reinterpret_cast<const char*>(records), sizeof(records));
+    }
+
+    edge_list<std::int32_t> edges;
+    detail::load_edge_list(file.get_name(), edges);
+
+    REQUIRE(edges.size() == 2);
+    REQUIRE(edges[0] == std::make_pair(0, 1));
+    REQUIRE(edges[1] == std::make_pair(1, 2));
+}
+
+TEST("throws if binary edge list weight type does not match", "[load_graph][edge_list][binary]") {
+    const graph_file text_file{ "load_graph_weighted_source.txt", "0 1 0.5\n" };
+    const graph_file binary_file{ "load_graph_weighted_binary.bin" };
+
+    weighted_edge_list<std::int32_t, double> edges;
+    detail::load_edge_list(text_file.get_name(), edges);
+    detail::save_binary_edge_list(binary_file.get_name(), edges);
+
+    weighted_edge_list<std::int32_t, std::int32_t> int_edges;
+    REQUIRE_THROWS_AS(detail::load_edge_list(binary_file.get_name(), int_edges),
+                      invalid_argument);
+}
+
+TEST("can build graph from binary edge list", "[load_graph][binary]") {
+    const graph_file text_file{ "load_graph_graph.txt", "0 1\n1 2\n2 0\n" };
+    const graph_file binary_file{ "load_graph_graph.bin" };
+
+    edge_list<std::int32_t> edges;
+    detail::load_edge_list(text_file.get_name(), edges);
+    detail::save_binary_edge_list(binary_file.get_name(), edges);
+
+    const auto graph = load(descriptor<>{}, graph_csv_data_source{ binary_file.get_name() });
+
+    REQUIRE(get_vertex_count(graph) == 3);
+    REQUIRE(get_edge_count(graph) == 3);
+}
+
+} // namespace oneapi::dal::preview::load_graph::test
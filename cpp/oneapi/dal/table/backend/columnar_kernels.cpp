@@ -0,0 +1,293 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <bitset>
+#include <cstring>
+#include <limits>
+
+#include "oneapi/dal/table/backend/columnar_kernels.hpp"
+#include "oneapi/dal/table/backend/homogen_kernels.hpp"
+#include "oneapi/dal/table/backend/convert.hpp"
+#include "oneapi/dal/detail/array_utils.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::backend {
+
+/// The number of rows gathered from all the columns at once, so the part of
+/// the row-major block being written stays in cache while the columns are read
+constexpr std::int64_t columnar_row_block_size = 512;
+
+ONEDAL_FORCEINLINE bool is_valid_bit(const byte_t* validity, std::int64_t index) {
+    return (validity[index >> 3] >> (index & 7)) & 1;
+}
+
+std::int64_t count_null_bits(const byte_t* validity, std::int64_t offset, std::int64_t count) {
+    ONEDAL_ASSERT(validity);
+    ONEDAL_ASSERT(offset >= 0);
+    ONEDAL_ASSERT(count >= 0);
+
+    std::int64_t valid_count = 0;
+    std::int64_t i = 0;
+    for (; i < count && ((offset + i) & 7) != 0; i++) {
+        valid_count += is_valid_bit(validity, offset + i);
+    }
+
+    // The bits are counted by 64-bit words once the offset is aligned to bytes
+    constexpr std::int64_t word_bit_count = 64;
+    const byte_t* bytes = validity + ((offset + i) >> 3);
+    for (; i + word_bit_count <= count; i += word_bit_count) {
+        std::uint64_t word;
+        std::memcpy(&word, bytes, sizeof(word));
+        valid_count += std::int64_t(std::bitset<word_bit_count>(word).count());
+        bytes += sizeof(word);
+    }
+
+    for (; i < count; i++) {
+        valid_count += is_valid_bit(validity, offset + i);
+    }
+    return count - valid_count;
+}
+
+ONEDAL_FORCEINLINE void check_block_row_range(const range& rows, std::int64_t origin_row_count) {
+    const std::int64_t range_row_count = rows.get_element_count(origin_row_count);
+    detail::check_sum_overflow(rows.start_idx, range_row_count);
+    if (rows.start_idx + range_row_count > origin_row_count) {
+        throw range_error{ detail::error_messages::invalid_range_of_rows() };
+    }
+}
+
+template <typename BlockData>
+static void check_missing_values(const columnar_column& column,
+                                 std::int64_t row_offset,
+                                 std::int64_t row_count) {
+    if constexpr (std::is_integral_v<BlockData>) {
+        if (column.null_count > 0 &&
+            count_null_bits(column.validity.get_data(),
+                            column.validity_offset + row_offset,
+                            row_count) > 0) {
+            throw domain_error{
+                detail::error_messages::missing_values_cannot_be_represented_in_integer_block()
+            };
+        }
+    }
+}
+
+/// Converts `row_count` values of the column starting from `row_offset` and writes
+/// them with the `dst_stride`. Missing values are replaced by quiet NaNs
+template <typename BlockData>
+static void pull_column_host(const columnar_column& column,
+                             std::int64_t row_offset,
+                             std::int64_t row_count,
+                             BlockData* dst,
+                             std::int64_t dst_stride) {
+    const std::int64_t dtype_size = detail::get_data_type_size(column.dtype);
+    convert_vector(detail::default_host_policy{},
+                   column.data.get_data() + row_offset * dtype_size,
+                   dst,
+                   column.dtype,
+                   detail::make_data_type<BlockData>(),
+                   1,
+                   dst_stride,
+                   row_count);
+
+    if constexpr (!std::is_integral_v<BlockData>) {
+        if (column.null_count > 0) {
+            constexpr BlockData missing_value = std::numeric_limits<BlockData>::quiet_NaN();
+            const byte_t* validity = column.validity.get_data();
+            const std::int64_t bit_offset = column.validity_offset + row_offset;
+            for (std::int64_t i = 0; i < row_count; i++) {
+                if (!is_valid_bit(validity, bit_offset + i)) {
+                    dst[i * dst_stride] = missing_value;
+                }
+            }
+        }
+    }
+}
+
+template <typename BlockData>
+static void pull_rows_host(const std::vector<columnar_column>& columns,
+                           std::int64_t row_offset,
+                           std::int64_t row_count,
+                           BlockData* dst) {
+    const std::int64_t column_count = std::int64_t(columns.size());
+    const std::int64_t row_block_count =
+        (row_count + columnar_row_block_size - 1) / columnar_row_block_size;
+
+    const auto pull_row_block = [&](std::int64_t block_index) {
+        const std::int64_t first_row = block_index * columnar_row_block_size;
+        const std::int64_t block_row_count =
+            std::min(columnar_row_block_size, row_count - first_row);
+        BlockData* block_dst = dst + first_row * column_count;
+        for (std::int64_t j = 0; j < column_count; j++) {
+            pull_column_host(columns[j],
+                             row_offset + first_row,
+                             block_row_count,
+                             block_dst + j,
+                             column_count);
+        }
+    };
+
+    if (row_block_count == 1) {
+        pull_row_block(0);
+    }
+    else {
+        detail::threader_for_int64(row_block_count, pull_row_block);
+    }
+}
+
+/// Allocates the host block if the existing one cannot be reused
+template <typename BlockData>
+static BlockData* reset_host_block(array<BlockData>& block_data, std::int64_t element_count) {
+    const bool block_has_enough_space = (block_data.get_count() >= element_count);
+    const bool block_is_on_host = (get_alloc_kind(block_data) == alloc_kind::host);
+    if (!block_has_enough_space || !block_data.has_mutable_data() || !block_is_on_host) {
+        block_data.reset(element_count);
+    }
+    return block_data.get_mutable_data();
+}
+
+/// Copies the block gathered on host into the memory of the requested kind
+template <typename Policy, typename BlockData>
+static void copy_host_block(const Policy& policy,
+                            const array<BlockData>& host_block,
+                            std::int64_t row_count,
+                            std::int64_t column_count,
+                            array<BlockData>& block_data,
+                            alloc_kind requested_alloc_kind) {
+    const homogen_info host_info{ row_count,
+                                  column_count,
+                                  detail::make_data_type<BlockData>(),
+                                  data_layout::row_major };
+    homogen_pull_rows(policy,
+                      host_info,
+                      detail::reinterpret_array_cast<byte_t>(host_block),
+                      block_data,
+                      range{ 0, -1 },
+                      requested_alloc_kind);
+}
+
+template <typename Policy, typename BlockData>
+void columnar_pull_rows(const Policy& policy,
+                        std::int64_t row_count,
+                        const std::vector<columnar_column>& columns,
+                        array<BlockData>& block_data,
+                        const range& rows_range,
+                        alloc_kind requested_alloc_kind) {
+    check_block_row_range(rows_range, row_count);
+
+    const std::int64_t column_count = std::int64_t(columns.size());
+    ONEDAL_ASSERT(column_count > 0);
+
+    // The rows of the single-column table are the column itself
+    if (column_count == 1) {
+        columnar_pull_column(policy,
+                             row_count,
+                             columns[0],
+                             block_data,
+                             rows_range,
+                             requested_alloc_kind);
+        return;
+    }
+
+    const std::int64_t row_offset = rows_range.start_idx;
+    const std::int64_t block_row_count = rows_range.get_element_count(row_count);
+    const std::int64_t element_count =
+        detail::check_mul_overflow(block_row_count, column_count);
+
+    for (const auto& column : columns) {
+        check_missing_values<BlockData>(column, row_offset, block_row_count);
+    }
+
+    if constexpr (std::is_same_v<Policy, detail::default_host_policy>) {
+        BlockData* dst = reset_host_block(block_data, element_count);
+        pull_rows_host(columns, row_offset, block_row_count, dst);
+    }
+    else {
+        auto host_block = array<BlockData>::empty(element_count);
+        pull_rows_host(columns, row_offset, block_row_count, host_block.get_mutable_data());
+        copy_host_block(policy,
+                        host_block,
+                        block_row_count,
+                        column_count,
+                        block_data,
+                        requested_alloc_kind);
+    }
+}
+
+template <typename Policy, typename BlockData>
+void columnar_pull_column(const Policy& policy,
+                          std::int64_t row_count,
+                          const columnar_column& column,
+                          array<BlockData>& block_data,
+                          const range& rows_range,
+                          alloc_kind requested_alloc_kind) {
+    check_block_row_range(rows_range, row_count);
+
+    // The column without missing values is a single-column homogen table, so the block
+    // refers to the column data if no conversion is needed
+    if (column.null_count == 0) {
+        const homogen_info column_info{ row_count, 1, column.dtype, data_layout::row_major };
+        homogen_pull_rows(policy,
+                          column_info,
+                          column.data,
+                          block_data,
+                          rows_range,
+                          requested_alloc_kind);
+        return;
+    }
+
+    const std::int64_t row_offset = rows_range.start_idx;
+    const std::int64_t block_row_count = rows_range.get_element_count(row_count);
+    check_missing_values<BlockData>(column, row_offset, block_row_count);
+
+    if constexpr (std::is_same_v<Policy, detail::default_host_policy>) {
+        BlockData* dst = reset_host_block(block_data, block_row_count);
+        pull_column_host(column, row_offset, block_row_count, dst, 1);
+    }
+    else {
+        auto host_block = array<BlockData>::empty(block_row_count);
+        pull_column_host(column, row_offset, block_row_count, host_block.get_mutable_data(), 1);
+        copy_host_block(policy, host_block, block_row_count, 1, block_data, requested_alloc_kind);
+    }
+}
+
+#define INSTANTIATE(Policy, BlockData)                                            \
+    template void columnar_pull_rows(const Policy& policy,                        \
+                                     std::int64_t row_count,                      \
+                                     const std::vector<columnar_column>& columns, \
+                                     array<BlockData>& block_data,                \
+                                     const range& rows_range,                     \
+                                     alloc_kind requested_alloc_kind);            \
+    template void columnar_pull_column(const Policy& policy,                      \
+                                       std::int64_t row_count,                    \
+                                       const columnar_column& column,             \
+                                       array<BlockData>& block_data,              \
+                                       const range& rows_range,                   \
+                                       alloc_kind requested_alloc_kind);
+
+#ifdef ONEDAL_DATA_PARALLEL
+#define INSTANTIATE_ALL_POLICIES(Data)              \
+    INSTANTIATE(detail::default_host_policy, Data)  \
+    INSTANTIATE(detail::data_parallel_policy, Data)
+#else
+#define INSTANTIATE_ALL_POLICIES(Data) INSTANTIATE(detail::default_host_policy, Data)
+#endif
+
+INSTANTIATE_ALL_POLICIES(float)
+INSTANTIATE_ALL_POLICIES(double)
+INSTANTIATE_ALL_POLICIES(std::int32_t)
+
+} // namespace oneapi::dal::backend
@@ -0,0 +1,56 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "oneapi/dal/table/backend/common_kernels.hpp"
+
+namespace oneapi::dal::backend {
+
+/// Column of the columnar table. The validity bitmap follows the Apache Arrow
+/// convention: the value `i` is present if the bit `validity_offset + i` of the
+/// bitmap is set, bits are numbered from the least significant one in each byte.
+/// The empty bitmap means that all the values are present.
+struct columnar_column {
+    array<byte_t> data;
+    array<byte_t> validity;
+    data_type dtype = data_type::float32;
+    std::int64_t validity_offset = 0;
+    std::int64_t null_count = 0;
+};
+
+/// Returns the number of unset bits in the range `[offset, offset + count)` of the bitmap
+std::int64_t count_null_bits(const byte_t* validity, std::int64_t offset, std::int64_t count);
+
+template <typename Policy, typename BlockData>
+void columnar_pull_rows(const Policy& policy,
+                        std::int64_t row_count,
+                        const std::vector<columnar_column>& columns,
+                        array<BlockData>& block_data,
+                        const range& rows_range,
+                        alloc_kind requested_alloc_kind);
+
+template <typename Policy, typename BlockData>
+void columnar_pull_column(const Policy& policy,
+                          std::int64_t row_count,
+                          const columnar_column& column,
+                          array<BlockData>& block_data,
+                          const range& rows_range,
+                          alloc_kind requested_alloc_kind);
+
+} // namespace oneapi::dal::backend
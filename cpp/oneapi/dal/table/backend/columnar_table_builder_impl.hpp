@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/table/backend/columnar_table_impl.hpp"
+
+namespace oneapi::dal::backend {
+
+class columnar_table_builder_impl : public detail::columnar_table_builder_iface {
+public:
+    columnar_table_builder_impl() : row_count_(0) {}
+
+    void add_column(const array<byte_t>& data,
+                    data_type dtype,
+                    std::int64_t row_count,
+                    const array<byte_t>& validity,
+                    std::int64_t validity_offset) override {
+        using error_msg = dal::detail::error_messages;
+
+        if (dtype != data_type::float32 && dtype != data_type::float64 &&
+            dtype != data_type::int32) {
+            throw dal::invalid_argument(error_msg::unsupported_data_type());
+        }
+
+        if (row_count <= 0) {
+            throw dal::domain_error(error_msg::rc_leq_zero());
+        }
+
+        if (!columns_.empty() && row_count != row_count_) {
+            throw dal::domain_error(error_msg::column_rc_does_not_match_table_rc());
+        }
+
+        const std::int64_t dtype_size = detail::get_data_type_size(dtype);
+        if (data.get_count() != detail::check_mul_overflow(row_count, dtype_size)) {
+            throw dal::range_error(error_msg::invalid_data_block_size());
+        }
+
+        columnar_column column;
+        column.data = data;
+        column.dtype = dtype;
+
+        if (validity.get_count() > 0) {
+            if (validity_offset < 0) {
+                throw dal::domain_error(error_msg::validity_offset_lt_zero());
+            }
+
+            const std::int64_t bit_count = detail::check_sum_overflow(validity_offset, row_count);
+            if (validity.get_count() < bit_count / 8 + std::int64_t(bit_count % 8 != 0)) {
+                throw dal::range_error(error_msg::validity_bitmap_is_too_small());
+            }
+
+            // The bitmap is not needed if all the values are present
+            const std::int64_t null_count =
+                count_null_bits(validity.get_data(), validity_offset, row_count);
+            if (null_count > 0) {
+                column.validity = validity;
+                column.validity_offset = validity_offset;
+                column.null_count = null_count;
+            }
+        }
+
+        columns_.push_back(column);
+        row_count_ = row_count;
+    }
+
+    detail::columnar_table_iface* build_columnar() override {
+        auto new_table = new columnar_table_impl{ row_count_, columns_ };
+        columns_.clear();
+        row_count_ = 0;
+        return new_table;
+    }
+
+private:
+    std::vector<columnar_column> columns_;
+    std::int64_t row_count_;
+};
+
+} // namespace oneapi::dal::backend
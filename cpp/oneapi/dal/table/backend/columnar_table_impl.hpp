@@ -0,0 +1,169 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/table/backend/common_kernels.hpp"
+#include "oneapi/dal/table/backend/columnar_kernels.hpp"
+
+namespace oneapi::dal::backend {
+
+class columnar_table_impl : public detail::columnar_table_template<columnar_table_impl> {
+public:
+    columnar_table_impl() : row_count_(0) {}
+
+    columnar_table_impl(std::int64_t row_count, const std::vector<columnar_column>& columns)
+            : meta_(create_columnar_metadata(columns)),
+              columns_(columns),
+              row_count_(row_count) {
+        using error_msg = dal::detail::error_messages;
+
+        if (row_count <= 0) {
+            throw dal::domain_error(error_msg::rc_leq_zero());
+        }
+
+        if (columns.empty()) {
+            throw dal::domain_error(error_msg::cc_leq_zero());
+        }
+    }
+
+    // Needs to be overriden for backward compatibility. Should be remove in oneDAL 2022.1.
+    detail::access_iface_host& get_access_iface_host() const override {
+        using msg = detail::error_messages;
+        throw dal::internal_error{ msg::object_does_not_provide_access_to_rows_or_columns() };
+    }
+
+#ifdef ONEDAL_DATA_PARALLEL
+    // Needs to be overriden for backward compatibility. Should be remove in oneDAL 2022.1.
+    detail::access_iface_dpc& get_access_iface_dpc() const override {
+        using msg = detail::error_messages;
+        throw dal::internal_error{ msg::object_does_not_provide_access_to_rows_or_columns() };
+    }
+#endif
+
+    std::int64_t get_column_count() const override {
+        return std::int64_t(columns_.size());
+    }
+
+    std::int64_t get_row_count() const override {
+        return row_count_;
+    }
+
+    const table_metadata& get_metadata() const override {
+        return meta_;
+    }
+
+    std::int64_t get_kind() const override {
+        return 20;
+    }
+
+    /// Each column is stored contiguously, so the table is treated as column-major
+    data_layout get_data_layout() const override {
+        return data_layout::column_major;
+    }
+
+    array<byte_t> get_column_data(std::int64_t column_index) const override {
+        return get_column(column_index).data;
+    }
+
+    array<byte_t> get_column_validity(std::int64_t column_index) const override {
+        return get_column(column_index).validity;
+    }
+
+    std::int64_t get_column_validity_offset(std::int64_t column_index) const override {
+        return get_column(column_index).validity_offset;
+    }
+
+    std::int64_t get_column_null_count(std::int64_t column_index) const override {
+        return get_column(column_index).null_count;
+    }
+
+    template <typename T>
+    void pull_rows_template(const detail::default_host_policy& policy,
+                            array<T>& block,
+                            const range& rows) const {
+        columnar_pull_rows(policy, row_count_, columns_, block, rows, alloc_kind::host);
+    }
+
+    template <typename T>
+    void pull_column_template(const detail::default_host_policy& policy,
+                              array<T>& block,
+                              std::int64_t column_index,
+                              const range& rows) const {
+        columnar_pull_column(policy,
+                             row_count_,
+                             get_column(column_index),
+                             block,
+                             rows,
+                             alloc_kind::host);
+    }
+
+#ifdef ONEDAL_DATA_PARALLEL
+    template <typename T>
+    void pull_rows_template(const detail::data_parallel_policy& policy,
+                            array<T>& block,
+                            const range& rows,
+                            sycl::usm::alloc alloc) const {
+        columnar_pull_rows(policy, row_count_, columns_, block, rows, alloc_kind_from_sycl(alloc));
+    }
+#endif
+
+#ifdef ONEDAL_DATA_PARALLEL
+    template <typename T>
+    void pull_column_template(const detail::data_parallel_policy& policy,
+                              array<T>& block,
+                              std::int64_t column_index,
+                              const range& rows,
+                              sycl::usm::alloc alloc) const {
+        columnar_pull_column(policy,
+                             row_count_,
+                             get_column(column_index),
+                             block,
+                             rows,
+                             alloc_kind_from_sycl(alloc));
+    }
+#endif
+
+private:
+    static table_metadata create_columnar_metadata(const std::vector<columnar_column>& columns) {
+        const std::int64_t column_count = std::int64_t(columns.size());
+        auto dtypes = array<data_type>::empty(column_count);
+        auto ftypes = array<feature_type>::empty(column_count);
+        data_type* dtypes_ptr = dtypes.get_mutable_data();
+        feature_type* ftypes_ptr = ftypes.get_mutable_data();
+        for (std::int64_t i = 0; i < column_count; i++) {
+            const data_type dtype = columns[i].dtype;
+            dtypes_ptr[i] = dtype;
+            ftypes_ptr[i] =
+                detail::is_floating_point(dtype) ? feature_type::ratio : feature_type::ordinal;
+        }
+        return table_metadata{ dtypes, ftypes };
+    }
+
+    const columnar_column& get_column(std::int64_t column_index) const {
+        if (column_index < 0 || column_index >= get_column_count()) {
+            throw range_error{ detail::error_messages::column_index_out_of_range() };
+        }
+        return columns_[column_index];
+    }
+
+    table_metadata meta_;
+    std::vector<columnar_column> columns_;
+    std::int64_t row_count_;
+};
+
+} // namespace oneapi::dal::backend
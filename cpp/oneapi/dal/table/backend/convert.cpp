@@ -20,6 +20,7 @@
 #include "oneapi/dal/backend/dispatcher.hpp"
 #include "oneapi/dal/backend/transfer.hpp"
 #include "oneapi/dal/backend/interop/data_conversion.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 
 namespace oneapi::dal::backend {
 
@@ -83,6 +84,207 @@ void convert_vector(const detail::default_host_policy& policy,
     }
 }
 
+/// The size of the square tile transposed at once. The tile of 4-byte values
+/// takes 16 cache lines, so both the source and the destination rows of the tile
+/// stay in L1 cache
+template <typename Src, typename Dst>
+constexpr std::int64_t transpose_tile_size = (std::max(sizeof(Src), sizeof(Dst)) > 4) ? 8 : 16;
+
+/// The size of the square block of tiles processed by a single task
+constexpr std::int64_t transpose_block_size = 256;
+
+/// The matrices with fewer elements are transposed without threading
+constexpr std::int64_t transpose_min_parallel_element_count = 1 << 16;
+
+template <typename Src, typename Dst>
+static void transpose_convert_block(const Src* src,
+                                    Dst* dst,
+                                    std::int64_t row_count,
+                                    std::int64_t column_count,
+                                    std::int64_t src_row_stride,
+                                    std::int64_t dst_row_stride) {
+    constexpr std::int64_t tile = transpose_tile_size<Src, Dst>;
+
+    for (std::int64_t i0 = 0; i0 < row_count; i0 += tile) {
+        for (std::int64_t j0 = 0; j0 < column_count; j0 += tile) {
+            const Src* src_tile = src + i0 * src_row_stride + j0;
+            Dst* dst_tile = dst + j0 * dst_row_stride + i0;
+
+            if (i0 + tile <= row_count && j0 + tile <= column_count) {
+                // The trip counts are known at compile time, so the tile is
+                // unrolled and transposed in registers
+                for (std::int64_t j = 0; j < tile; j++) {
+                    PRAGMA_VECTOR_ALWAYS
+                    for (std::int64_t i = 0; i < tile; i++) {
+                        dst_tile[j * dst_row_stride + i] =
+                            static_cast<Dst>(src_tile[i * src_row_stride + j]);
+                    }
+                }
+            }
+            else {
+                const std::int64_t tile_rows = std::min(tile, row_count - i0);
+                const std::int64_t tile_cols = std::min(tile, column_count - j0);
+                for (std::int64_t j = 0; j < tile_cols; j++) {
+                    for (std::int64_t i = 0; i < tile_rows; i++) {
+                        dst_tile[j * dst_row_stride + i] =
+                            static_cast<Dst>(src_tile[i * src_row_stride + j]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <typename Src, typename Dst>
+static void transpose_convert(const Src* src,
+                              Dst* dst,
+                              std::int64_t row_count,
+                              std::int64_t column_count,
+                              std::int64_t src_row_stride,
+                              std::int64_t dst_row_stride) {
+    const std::int64_t row_block_count =
+        (row_count + transpose_block_size - 1) / transpose_block_size;
+    const std::int64_t column_block_count =
+        (column_count + transpose_block_size - 1) / transpose_block_size;
+    const std::int64_t block_count =
+        dal::detail::check_mul_overflow(row_block_count, column_block_count);
+
+    const auto process_block = [&](std::int64_t block) {
+        const std::int64_t i0 = (block / column_block_count) * transpose_block_size;
+        const std::int64_t j0 = (block % column_block_count) * transpose_block_size;
+        transpose_convert_block(src + i0 * src_row_stride + j0,
+                                dst + j0 * dst_row_stride + i0,
+                                std::min(transpose_block_size, row_count - i0),
+                                std::min(transpose_block_size, column_count - j0),
+                                src_row_stride,
+                                dst_row_stride);
+    };
+
+    if (row_count * column_count < transpose_min_parallel_element_count) {
+        for (std::int64_t block = 0; block < block_count; block++) {
+            process_block(block);
+        }
+    }
+    else {
+        dal::detail::threader_for_int64(block_count, process_block);
+    }
+}
+
+template <typename Src>
+static void transpose_convert(const Src* src,
+                              void* dst,
+                              data_type dst_type,
+                              std::int64_t row_count,
+                              std::int64_t column_count,
+                              std::int64_t src_row_stride,
+                              std::int64_t dst_row_stride) {
+    switch (dst_type) {
+        case data_type::float32:
+            transpose_convert(src,
+                              static_cast<float*>(dst),
+                              row_count,
+                              column_count,
+                              src_row_stride,
+                              dst_row_stride);
+            break;
+        case data_type::float64:
+            transpose_convert(src,
+                              static_cast<double*>(dst),
+                              row_count,
+                              column_count,
+                              src_row_stride,
+                              dst_row_stride);
+            break;
+        case data_type::int32:
+            transpose_convert(src,
+                              static_cast<std::int32_t*>(dst),
+                              row_count,
+                              column_count,
+                              src_row_stride,
+                              dst_row_stride);
+            break;
+        default: ONEDAL_ASSERT(!"Unsupported data type");
+    }
+}
+
+static bool is_transpose_supported(data_type type) {
+    return type == data_type::float32 || type == data_type::float64 || type == data_type::int32;
+}
+
+void transpose_convert(const detail::default_host_policy& policy,
+                       const void* src,
+                       void* dst,
+                       data_type src_type,
+                       data_type dst_type,
+                       std::int64_t row_count,
+                       std::int64_t column_count,
+                       std::int64_t src_row_stride,
+                       std::int64_t dst_row_stride) {
+    ONEDAL_ASSERT(row_count >= 0);
+    ONEDAL_ASSERT(column_count >= 0);
+    ONEDAL_ASSERT(src_row_stride >= column_count);
+    ONEDAL_ASSERT(dst_row_stride >= row_count);
+
+    if (row_count == 0 || column_count == 0) {
+        return;
+    }
+
+    if (row_count == 1) {
+        convert_vector(policy, src, dst, src_type, dst_type, 1, dst_row_stride, column_count);
+        return;
+    }
+
+    // The column does not benefit from tiling, other types are converted
+    // column by column by the generic strided conversion
+    if (column_count == 1 || !is_transpose_supported(src_type) ||
+        !is_transpose_supported(dst_type)) {
+        const std::int64_t src_element_size = dal::detail::get_data_type_size(src_type);
+        const std::int64_t dst_element_size = dal::detail::get_data_type_size(dst_type);
+        for (std::int64_t j = 0; j < column_count; j++) {
+            convert_vector(policy,
+                           static_cast<const byte_t*>(src) + j * src_element_size,
+                           static_cast<byte_t*>(dst) + j * dst_row_stride * dst_element_size,
+                           src_type,
+                           dst_type,
+                           src_row_stride,
+                           1,
+                           row_count);
+        }
+        return;
+    }
+
+    switch (src_type) {
+        case data_type::float32:
+            transpose_convert(static_cast<const float*>(src),
+                              dst,
+                              dst_type,
+                              row_count,
+                              column_count,
+                              src_row_stride,
+                              dst_row_stride);
+            break;
+        case data_type::float64:
+            transpose_convert(static_cast<const double*>(src),
+                              dst,
+                              dst_type,
+                              row_count,
+                              column_count,
+                              src_row_stride,
+                              dst_row_stride);
+            break;
+        case data_type::int32:
+            transpose_convert(static_cast<const std::int32_t*>(src),
+                              dst,
+                              dst_type,
+                              row_count,
+                              column_count,
+                              src_row_stride,
+                              dst_row_stride);
+            break;
+        default: ONEDAL_ASSERT(!"Unsupported data type");
+    }
+}
+
 #ifdef ONEDAL_DATA_PARALLEL
 
 template <typename Src, typename Dst>
@@ -37,6 +37,21 @@ void convert_vector(const detail::default_host_policy& policy,
                     std::int64_t dst_stride,
                     std::int64_t element_count);
 
+/// Converts the [row_count x column_count] row-major matrix `src` of `src_type`
+/// and writes its transpose to the [column_count x row_count] row-major matrix
+/// `dst` of `dst_type`. Row strides of the matrices are given in elements.
+/// The matrix is processed by cache-sized tiles in parallel, so it is the way
+/// to change the layout of the data, e.g. for column-major tables.
+void transpose_convert(const detail::default_host_policy& policy,
+                       const void* src,
+                       void* dst,
+                       data_type src_type,
+                       data_type dst_type,
+                       std::int64_t row_count,
+                       std::int64_t column_count,
+                       std::int64_t src_row_stride,
+                       std::int64_t dst_row_stride);
+
 #ifdef ONEDAL_DATA_PARALLEL
 
 void convert_vector(const detail::data_parallel_policy& policy,
@@ -192,15 +192,29 @@ static void pull_column_major_impl(const Policy& policy,
     auto src_data = origin_data.get_data() + origin_offset * origin_dtype_size;
     auto dst_data = block_data.get_mutable_data();
 
-    for (std::int64_t i = 0; i < block_info.get_row_count(); i++) {
-        backend::convert_vector(policy,
-                                src_data + i * origin_dtype_size,
-                                dst_data + i * block_info.get_column_count(),
-                                origin_info.get_data_type(),
-                                block_dtype,
-                                origin_info.get_row_count(),
-                                1,
-                                block_info.get_column_count());
+    if constexpr (std::is_same_v<Policy, detail::default_host_policy>) {
+        // Columns of the origin are the rows of the matrix transposed into the block
+        backend::transpose_convert(policy,
+                                   src_data,
+                                   dst_data,
+                                   origin_info.get_data_type(),
+                                   block_dtype,
+                                   block_info.get_column_count(),
+                                   block_info.get_row_count(),
+                                   origin_info.get_row_count(),
+                                   block_info.get_column_count());
+    }
+    else {
+        for (std::int64_t i = 0; i < block_info.get_row_count(); i++) {
+            backend::convert_vector(policy,
+                                    src_data + i * origin_dtype_size,
+                                    dst_data + i * block_info.get_column_count(),
+                                    origin_info.get_data_type(),
+                                    block_dtype,
+                                    origin_info.get_row_count(),
+                                    1,
+                                    block_info.get_column_count());
+        }
     }
 }
 
@@ -306,15 +320,29 @@ static void push_column_major_impl(const Policy& policy,
     auto src_data = block_data.get_data();
     auto dst_data = origin_data.get_mutable_data() + origin_offset * origin_dtype_size;
 
-    for (std::int64_t row_idx = 0; row_idx < block_info.get_row_count(); row_idx++) {
-        backend::convert_vector(policy,
-                                src_data + row_idx * block_info.get_column_count(),
-                                dst_data + row_idx * origin_dtype_size,
-                                block_dtype,
-                                origin_info.get_data_type(),
-                                1,
-                                origin_info.get_row_count(),
-                                block_info.get_column_count());
+    if constexpr (std::is_same_v<Policy, detail::default_host_policy>) {
+        // Rows of the block are transposed into the columns of the origin
+        backend::transpose_convert(policy,
+                                   src_data,
+                                   dst_data,
+                                   block_dtype,
+                                   origin_info.get_data_type(),
+                                   block_info.get_row_count(),
+                                   block_info.get_column_count(),
+                                   block_info.get_column_count(),
+                                   origin_info.get_row_count());
+    }
+    else {
+        for (std::int64_t row_idx = 0; row_idx < block_info.get_row_count(); row_idx++) {
+            backend::convert_vector(policy,
+                                    src_data + row_idx * block_info.get_column_count(),
+                                    dst_data + row_idx * origin_dtype_size,
+                                    block_dtype,
+                                    origin_info.get_data_type(),
+                                    1,
+                                    origin_info.get_row_count(),
+                                    block_info.get_column_count());
+        }
     }
 }
 
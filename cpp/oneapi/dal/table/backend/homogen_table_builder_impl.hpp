@@ -76,6 +76,25 @@ public:
         column_count_ = column_count;
     }
 
+    void allocate_numa_local(std::int64_t row_count, std::int64_t column_count) override {
+        if (row_count <= 0) {
+            throw dal::domain_error(dal::detail::error_messages::rc_leq_zero());
+        }
+
+        if (column_count <= 0) {
+            throw dal::domain_error(dal::detail::error_messages::cc_leq_zero());
+        }
+
+        const std::int64_t data_size = get_data_size(row_count, column_count, dtype_);
+        const auto data = static_cast<byte_t*>(
+            detail::numa_local_malloc(detail::default_host_policy{}, data_size));
+        data_.reset(data, data_size, [](byte_t* ptr) {
+            detail::numa_local_free(detail::default_host_policy{}, ptr);
+        });
+        row_count_ = row_count;
+        column_count_ = column_count;
+    }
+
     void set_layout(data_layout layout) override {
         layout_ = layout;
     }
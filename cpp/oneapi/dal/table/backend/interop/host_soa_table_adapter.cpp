@@ -29,6 +29,13 @@ auto host_soa_table_adapter::create(const homogen_table& table) -> ptr_t {
     return result;
 }
 
+auto host_soa_table_adapter::create(const detail::columnar_table& table) -> ptr_t {
+    status_t internal_stat;
+    auto result = ptr_t{ new host_soa_table_adapter(table, internal_stat) };
+    status_to_exception(internal_stat);
+    return result;
+}
+
 // TODO: change 'equal' flags across this constructor after implemeting the method
 // of features equality defining for table_metadata class.
 template <typename Data>
@@ -75,6 +82,68 @@ host_soa_table_adapter::host_soa_table_adapter(const homogen_table& table,
                                         *this->getDictionarySharedPtr());
 }
 
+static daal_dm::DictionaryIface::FeaturesEqual get_features_equal(const table_metadata& meta) {
+    for (std::int64_t i = 1; i < meta.get_feature_count(); i++) {
+        if (meta.get_data_type(i) != meta.get_data_type(0)) {
+            return daal_dm::DictionaryIface::notEqual;
+        }
+    }
+    return daal_dm::DictionaryIface::equal;
+}
+
+host_soa_table_adapter::host_soa_table_adapter(const detail::columnar_table& table,
+                                               status_t& stat)
+        : base(dal::detail::integral_cast<std::size_t>(table.get_column_count()),
+               dal::detail::integral_cast<std::size_t>(table.get_row_count()),
+               get_features_equal(table.get_metadata())),
+          original_table_(table) {
+    if (!stat.ok()) {
+        return;
+    }
+    else if (!table.has_data()) {
+        stat.add(daal::services::ErrorIncorrectParameter);
+        return;
+    }
+
+    const auto& meta = table.get_metadata();
+    const std::int64_t column_count = table.get_column_count();
+
+    for (std::int64_t i = 0; i < column_count; i++) {
+        if (table.get_column_null_count(i) > 0) {
+            stat.add(daal::services::ErrorMethodNotImplemented);
+            return;
+        }
+
+        // The following const_cast is safe only when this class is used for read-only
+        // operations. Use on write leads to undefined behaviour.
+        const auto data = const_cast<void*>(table.get_column_data(i));
+        const std::size_t index = dal::detail::integral_cast<std::size_t>(i);
+
+        switch (meta.get_data_type(i)) {
+            case data_type::float32:
+                stat |= base::setArray(static_cast<float*>(data), index);
+                break;
+            case data_type::float64:
+                stat |= base::setArray(static_cast<double*>(data), index);
+                break;
+            case data_type::int32:
+                stat |= base::setArray(static_cast<std::int32_t*>(data), index);
+                break;
+            default: stat.add(daal::services::ErrorDataTypeNotSupported);
+        }
+
+        if (!stat.ok()) {
+            return;
+        }
+    }
+
+    this->_memStatus = daal_dm::NumericTableIface::userAllocated;
+    this->_layout = daal_dm::NumericTableIface::soa;
+
+    convert_feature_information_to_daal(original_table_.get_metadata(),
+                                        *this->getDictionarySharedPtr());
+}
+
 auto host_soa_table_adapter::getBlockOfRows(std::size_t vector_idx,
                                             std::size_t vector_num,
                                             rw_mode_t rwflag,
@@ -197,7 +266,7 @@ auto host_soa_table_adapter::deserializeImpl(const daal_dm::OutputDataArchive* a
 
 void host_soa_table_adapter::freeDataMemoryImpl() {
     base::freeDataMemoryImpl();
-    original_table_ = homogen_table{};
+    original_table_ = table{};
 }
 
 template <typename BlockData>
@@ -19,6 +19,7 @@
 #include <daal/include/data_management/data/soa_numeric_table.h>
 
 #include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/detail/columnar.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/daal_object_owner.hpp"
 #include "oneapi/dal/table/backend/interop/block_info.hpp"
@@ -41,10 +42,16 @@ public:
     template <typename Data>
     static ptr_t create(const homogen_table& table);
 
+    /// Wraps the columns of the table without copying. The table shall not contain
+    /// missing values, as there is no way to mark them in the DAAL table
+    static ptr_t create(const detail::columnar_table& table);
+
 private:
     template <typename Data>
     explicit host_soa_table_adapter(const homogen_table& table, status_t& stat, Data dummy);
 
+    explicit host_soa_table_adapter(const detail::columnar_table& table, status_t& stat);
+
     status_t getBlockOfRows(std::size_t vector_idx,
                             std::size_t vector_num,
                             rw_mode_t rwflag,
@@ -114,7 +121,7 @@ private:
     bool check_row_indexes_in_range(const block_info& info) const;
     bool check_column_index_in_range(const block_info& info) const;
 
-    homogen_table original_table_;
+    table original_table_;
 };
 
 } // namespace oneapi::dal::backend::interop
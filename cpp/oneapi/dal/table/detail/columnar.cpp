@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/detail/columnar.hpp"
+#include "oneapi/dal/table/backend/columnar_table_builder_impl.hpp"
+
+namespace oneapi::dal::detail {
+namespace v1 {
+
+std::int64_t columnar_table::kind() {
+    return 20;
+}
+
+columnar_table::columnar_table() : columnar_table(new backend::columnar_table_impl{}) {}
+
+const void* columnar_table::get_column_data(std::int64_t column_index) const {
+    const auto& impl = detail::cast_impl<detail::columnar_table_iface>(*this);
+    return impl.get_column_data(column_index).get_data();
+}
+
+const byte_t* columnar_table::get_column_validity(std::int64_t column_index) const {
+    const auto& impl = detail::cast_impl<detail::columnar_table_iface>(*this);
+    return impl.get_column_validity(column_index).get_data();
+}
+
+std::int64_t columnar_table::get_column_validity_offset(std::int64_t column_index) const {
+    const auto& impl = detail::cast_impl<detail::columnar_table_iface>(*this);
+    return impl.get_column_validity_offset(column_index);
+}
+
+std::int64_t columnar_table::get_column_null_count(std::int64_t column_index) const {
+    const auto& impl = detail::cast_impl<detail::columnar_table_iface>(*this);
+    return impl.get_column_null_count(column_index);
+}
+
+columnar_table_builder::columnar_table_builder()
+        : impl_(new backend::columnar_table_builder_impl{}) {}
+
+columnar_table columnar_table_builder::build() {
+    return columnar_table{ impl_->build_columnar() };
+}
+
+void columnar_table_builder::add_column_impl(const dal::array<byte_t>& data,
+                                             data_type dtype,
+                                             std::int64_t row_count,
+                                             const dal::array<byte_t>& validity,
+                                             std::int64_t validity_offset) {
+    impl_->add_column(data, dtype, row_count, validity, validity_offset);
+}
+
+} // namespace v1
+} // namespace oneapi::dal::detail
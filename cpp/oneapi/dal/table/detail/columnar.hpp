@@ -0,0 +1,130 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/detail/array_utils.hpp"
+
+namespace oneapi::dal::detail {
+namespace v1 {
+
+/// Table that keeps each column in a separate buffer, for example, the columns
+/// of the Apache Arrow record batch. The buffers are not copied, and each
+/// column can have its own data type and optional validity bitmap. The values
+/// marked as missing in the bitmap are pulled as quiet NaNs.
+class ONEDAL_EXPORT columnar_table : public table {
+    friend detail::pimpl_accessor;
+    friend class columnar_table_builder;
+
+public:
+    /// Returns the unique id of ``columnar_table`` class.
+    static std::int64_t kind();
+
+    /// Creates a new ``columnar_table`` instance with zero number of rows and columns.
+    columnar_table();
+
+    /// The unique id of the columnar table type.
+    std::int64_t get_kind() const {
+        return kind();
+    }
+
+    /// Returns the data of the column cast to the :literal:`Data` type. No checks are
+    /// performed that this type is the actual type of the column.
+    template <typename Data>
+    const Data* get_column_data(std::int64_t column_index) const {
+        return reinterpret_cast<const Data*>(this->get_column_data(column_index));
+    }
+
+    /// The pointer to the data of the column.
+    const void* get_column_data(std::int64_t column_index) const;
+
+    /// The pointer to the validity bitmap of the column or ``nullptr`` if all
+    /// the values in the column are present.
+    const byte_t* get_column_validity(std::int64_t column_index) const;
+
+    /// The index of the bit in the validity bitmap that corresponds to the first
+    /// value of the column.
+    std::int64_t get_column_validity_offset(std::int64_t column_index) const;
+
+    /// The number of missing values in the column.
+    std::int64_t get_column_null_count(std::int64_t column_index) const;
+
+private:
+    explicit columnar_table(detail::columnar_table_iface* impl) : table(impl) {}
+};
+
+class ONEDAL_EXPORT columnar_table_builder {
+    friend detail::pimpl_accessor;
+
+public:
+    columnar_table_builder();
+
+    /// Appends the column without missing values to the table.
+    ///
+    /// @tparam Data The type of the column elements, should be :expr:`float`,
+    ///              :expr:`double` or :expr:`std::int32_t`.
+    /// @param data  The values of the column, one per row.
+    template <typename Data>
+    auto& add_column(const dal::array<Data>& data) {
+        add_column_impl(detail::reinterpret_array_cast<byte_t>(data),
+                        detail::make_data_type<Data>(),
+                        data.get_count(),
+                        dal::array<byte_t>{},
+                        0);
+        return *this;
+    }
+
+    /// Appends the column with the validity bitmap to the table.
+    ///
+    /// @tparam Data            The type of the column elements, should be :expr:`float`,
+    ///                         :expr:`double` or :expr:`std::int32_t`.
+    /// @param data             The values of the column, one per row.
+    /// @param validity         The bitmap in the Apache Arrow format: the value
+    ///                         is present if its bit is set, bits are numbered from
+    ///                         the least significant one in each byte.
+    /// @param validity_offset  The index of the bit that corresponds to the first value.
+    template <typename Data>
+    auto& add_column(const dal::array<Data>& data,
+                     const dal::array<byte_t>& validity,
+                     std::int64_t validity_offset = 0) {
+        add_column_impl(detail::reinterpret_array_cast<byte_t>(data),
+                        detail::make_data_type<Data>(),
+                        data.get_count(),
+                        validity,
+                        validity_offset);
+        return *this;
+    }
+
+    /// Creates the table from the added columns and resets the builder.
+    columnar_table build();
+
+private:
+    void add_column_impl(const dal::array<byte_t>& data,
+                         data_type dtype,
+                         std::int64_t row_count,
+                         const dal::array<byte_t>& validity,
+                         std::int64_t validity_offset);
+
+    pimpl<columnar_table_builder_iface> impl_;
+};
+
+} // namespace v1
+
+using v1::columnar_table;
+using v1::columnar_table_builder;
+
+} // namespace oneapi::dal::detail
@@ -87,6 +87,14 @@ public:
         return *this;
     }
 
+    /// Allocates the data so that its row blocks are placed on the NUMA nodes of
+    /// the threads that process them. The data is deallocated as the data
+    /// allocated with `allocate`
+    auto& allocate_numa_local(std::int64_t row_count, std::int64_t column_count) {
+        get_impl().allocate_numa_local(row_count, column_count);
+        return *this;
+    }
+
     template <typename Data>
     auto& copy_data(const Data* data, std::int64_t row_count, std::int64_t column_count) {
         get_impl().copy_data(data, row_count, column_count);
@@ -64,6 +64,14 @@ public:
     virtual dal::array<std::int64_t> get_row_indices() const = 0;
 };
 
+class columnar_table_iface : public table_iface {
+public:
+    virtual dal::array<byte_t> get_column_data(std::int64_t column_index) const = 0;
+    virtual dal::array<byte_t> get_column_validity(std::int64_t column_index) const = 0;
+    virtual std::int64_t get_column_validity_offset(std::int64_t column_index) const = 0;
+    virtual std::int64_t get_column_null_count(std::int64_t column_index) const = 0;
+};
+
 class table_builder_iface {
 public:
     virtual ~table_builder_iface() = default;
@@ -106,6 +114,25 @@ public:
                            std::int64_t row_count,
                            std::int64_t column_count) = 0;
 #endif
+
+    /// Appended to the end of the interface to keep the layout of the vtable.
+    /// The builders that can't place the rows on the NUMA nodes allocate them as usual
+    virtual void allocate_numa_local(std::int64_t row_count, //
+                                     std::int64_t column_count) {
+        allocate(row_count, column_count);
+    }
+};
+
+class columnar_table_builder_iface {
+public:
+    virtual ~columnar_table_builder_iface() = default;
+    virtual columnar_table_iface* build_columnar() = 0;
+
+    virtual void add_column(const dal::array<byte_t>& data,
+                            data_type dtype,
+                            std::int64_t row_count,
+                            const dal::array<byte_t>& validity,
+                            std::int64_t validity_offset) = 0;
 };
 
 /// Generic table template is expected to implement all access interfaces to the table.
@@ -167,6 +194,25 @@ public:
     }
 };
 
+/// Columnar table template must implement row and column accessor, but not CSR.
+template <typename Derived>
+class columnar_table_template : public columnar_table_iface,
+                                public pull_rows_template<Derived>,
+                                public pull_column_template<Derived> {
+public:
+    pull_rows_iface* get_pull_rows_iface() override {
+        return this;
+    }
+
+    pull_column_iface* get_pull_column_iface() override {
+        return this;
+    }
+
+    pull_csr_block_iface* get_pull_csr_block_iface() override {
+        return nullptr;
+    }
+};
+
 /// Homogen builder template must implement the same set of accessor as homogen table
 /// template but also provide interfaces for write.
 template <typename Derived>
@@ -201,6 +247,9 @@ using v1::homogen_table_iface;
 using v1::homogen_table_template;
 using v1::csr_table_iface;
 using v1::csr_table_template;
+using v1::columnar_table_iface;
+using v1::columnar_table_template;
+using v1::columnar_table_builder_iface;
 using v1::table_builder_iface;
 using v1::homogen_table_builder_iface;
 using v1::homogen_table_builder_template;
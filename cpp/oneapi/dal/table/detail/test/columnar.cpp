@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "oneapi/dal/table/detail/columnar.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/column_accessor.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::detail {
+
+class columnar_test {
+public:
+    columnar_test() {
+        float_data_ = array<float>::empty(row_count_);
+        double_data_ = array<double>::empty(row_count_);
+        int_data_ = array<std::int32_t>::empty(row_count_);
+        for (std::int64_t i = 0; i < row_count_; i++) {
+            float_data_.get_mutable_data()[i] = float(i) * 0.5f;
+            double_data_.get_mutable_data()[i] = -double(i);
+            int_data_.get_mutable_data()[i] = std::int32_t(i * 3);
+        }
+
+        // Every 7th value of the double column is missing
+        validity_ = array<byte_t>::full((row_count_ + validity_offset_ + 7) / 8, byte_t(0));
+        for (std::int64_t i = 0; i < row_count_; i++) {
+            if (!is_missing(i)) {
+                const std::int64_t bit = i + validity_offset_;
+                validity_.get_mutable_data()[bit / 8] |= byte_t(1 << (bit % 8));
+            }
+        }
+    }
+
+    columnar_table build_table() const {
+        return columnar_table_builder{}
+            .add_column(float_data_)
+            .add_column(double_data_, validity_, validity_offset_)
+            .add_column(int_data_)
+            .build();
+    }
+
+    static bool is_missing(std::int64_t row) {
+        return row % 7 == 0;
+    }
+
+    template <typename T>
+    void check_rows(const array<T>& rows, const range& r) const {
+        const std::int64_t count = r.get_element_count(row_count_);
+        REQUIRE(rows.get_count() == count * 3);
+        for (std::int64_t i = 0; i < count; i++) {
+            const std::int64_t row = r.start_idx + i;
+            REQUIRE(rows[i * 3] == T(float_data_[row]));
+            if (is_missing(row)) {
+                REQUIRE(std::isnan(rows[i * 3 + 1]));
+            }
+            else {
+                REQUIRE(rows[i * 3 + 1] == T(double_data_[row]));
+            }
+            REQUIRE(rows[i * 3 + 2] == T(int_data_[row]));
+        }
+    }
+
+protected:
+    static constexpr std::int64_t row_count_ = 1500;
+    static constexpr std::int64_t validity_offset_ = 3;
+
+    array<float> float_data_;
+    array<double> double_data_;
+    array<std::int32_t> int_data_;
+    array<byte_t> validity_;
+};
+
+TEST_M(columnar_test, "can create columnar table") {
+    const auto t = build_table();
+
+    REQUIRE(t.get_kind() == columnar_table::kind());
+    REQUIRE(t.get_row_count() == row_count_);
+    REQUIRE(t.get_column_count() == 3);
+    REQUIRE(t.get_data_layout() == data_layout::column_major);
+    REQUIRE(t.get_metadata().get_data_type(0) == data_type::float32);
+    REQUIRE(t.get_metadata().get_data_type(1) == data_type::float64);
+    REQUIRE(t.get_metadata().get_data_type(2) == data_type::int32);
+
+    REQUIRE(t.get_column_data<float>(0) == float_data_.get_data());
+    REQUIRE(t.get_column_validity(0) == nullptr);
+    REQUIRE(t.get_column_null_count(0) == 0);
+    REQUIRE(t.get_column_validity(1) == validity_.get_data());
+    REQUIRE(t.get_column_validity_offset(1) == validity_offset_);
+    REQUIRE(t.get_column_null_count(1) == (row_count_ + 6) / 7);
+}
+
+TEST_M(columnar_test, "column accessor refers to the column without conversion") {
+    const auto t = build_table();
+
+    const auto column = column_accessor<const float>{ t }.pull(0, { 10, 20 });
+
+    REQUIRE(column.get_data() == float_data_.get_data() + 10);
+    REQUIRE(column.get_count() == 10);
+}
+
+TEST_M(columnar_test, "column accessor converts the column and marks missing values") {
+    const auto t = build_table();
+
+    const auto column = column_accessor<const float>{ t }.pull(1, { 5, 40 });
+
+    REQUIRE(column.get_count() == 35);
+    for (std::int64_t i = 0; i < column.get_count(); i++) {
+        if (is_missing(5 + i)) {
+            REQUIRE(std::isnan(column[i]));
+        }
+        else {
+            REQUIRE(column[i] == float(double_data_[5 + i]));
+        }
+    }
+}
+
+TEST_M(columnar_test, "row accessor gathers the columns") {
+    const auto t = build_table();
+    const range r = GENERATE(range{ 0, -1 }, range{ 1, 2 }, range{ 100, 1100 });
+
+    check_rows(row_accessor<const float>{ t }.pull(r), r);
+    check_rows(row_accessor<const double>{ t }.pull(r), r);
+}
+
+TEST_M(columnar_test, "integer block cannot contain missing values") {
+    const auto t = build_table();
+
+    REQUIRE_THROWS_AS(row_accessor<const std::int32_t>{ t }.pull(), domain_error);
+    REQUIRE_NOTHROW(row_accessor<const std::int32_t>{ t }.pull({ 1, 7 }));
+}
+
+TEST_M(columnar_test, "builder throws on invalid columns") {
+    REQUIRE_THROWS_AS(columnar_table_builder{}.add_column(float_data_).add_column(
+                          array<float>::zeros(row_count_ - 1)),
+                      domain_error);
+    REQUIRE_THROWS_AS(columnar_table_builder{}.add_column(float_data_,
+                                                          array<byte_t>::full(10, byte_t(0))),
+                      range_error);
+    REQUIRE_THROWS_AS(columnar_table_builder{}.add_column(float_data_, validity_, -1),
+                      domain_error);
+    REQUIRE_THROWS_AS(columnar_table_builder{}.build(), domain_error);
+}
+
+} // namespace oneapi::dal::detail
@@ -343,4 +343,78 @@ TEST_M(convert_test, "device2host convert types of the different sizes", "[devic
 }
 #endif
 
+template <typename Src, typename Dst>
+void test_host_transpose_conversion(std::int64_t row_count,
+                                    std::int64_t column_count,
+                                    std::int64_t src_row_stride,
+                                    std::int64_t dst_row_stride) {
+    auto src = la::matrix<Src>::zeros({ row_count, src_row_stride });
+    auto dst = la::matrix<Dst>::zeros({ column_count, dst_row_stride });
+
+    Src* src_data = src.get_mutable_data();
+    for (std::int64_t i = 0; i < row_count * src_row_stride; i++) {
+        src_data[i] = Src(i % 1000) - Src(500);
+    }
+
+    transpose_convert(dal::detail::default_host_policy{},
+                      src.get_data(),
+                      dst.get_mutable_data(),
+                      dal::detail::make_data_type<Src>(),
+                      dal::detail::make_data_type<Dst>(),
+                      row_count,
+                      column_count,
+                      src_row_stride,
+                      dst_row_stride);
+
+    const Dst* dst_data = dst.get_data();
+    for (std::int64_t j = 0; j < column_count; j++) {
+        for (std::int64_t i = 0; i < dst_row_stride; i++) {
+            const Dst expected = (i < row_count) ? Dst(src_data[i * src_row_stride + j]) : Dst(0);
+            REQUIRE(dst_data[j * dst_row_stride + i] == expected);
+        }
+    }
+}
+
+TEST("host transpose convert", "[host2host][transpose]") {
+    using shape_t = std::array<std::int64_t, 4>;
+    const shape_t shape = GENERATE(shape_t{ 1, 1, 1, 1 },
+                                   shape_t{ 1, 37, 40, 3 },
+                                   shape_t{ 37, 1, 3, 40 },
+                                   shape_t{ 16, 16, 16, 16 },
+                                   shape_t{ 17, 33, 35, 20 },
+                                   shape_t{ 300, 257, 257, 301 });
+    const auto [row_count, column_count, src_row_stride, dst_row_stride] = shape;
+
+    SECTION(fmt::format("{}x{}, strides {} -> {}",
+                        row_count,
+                        column_count,
+                        src_row_stride,
+                        dst_row_stride)) {
+        SECTION("float -> float") {
+            test_host_transpose_conversion<float, float>(row_count,
+                                                         column_count,
+                                                         src_row_stride,
+                                                         dst_row_stride);
+        }
+        SECTION("double -> float") {
+            test_host_transpose_conversion<double, float>(row_count,
+                                                          column_count,
+                                                          src_row_stride,
+                                                          dst_row_stride);
+        }
+        SECTION("std::int32_t -> double") {
+            test_host_transpose_conversion<std::int32_t, double>(row_count,
+                                                                 column_count,
+                                                                 src_row_stride,
+                                                                 dst_row_stride);
+        }
+        SECTION("double -> double") {
+            test_host_transpose_conversion<double, double>(row_count,
+                                                           column_count,
+                                                           src_row_stride,
+                                                           dst_row_stride);
+        }
+    }
+}
+
 } // namespace oneapi::dal::backend::test
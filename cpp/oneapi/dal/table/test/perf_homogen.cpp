@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::test {
+
+class homogen_perf_test {
+public:
+    template <typename Origin, typename Block>
+    void run_pull(std::int64_t row_count, std::int64_t column_count) {
+        auto data = array<Origin>::empty(row_count * column_count);
+        fill(data);
+        const auto t =
+            homogen_table::wrap(data, row_count, column_count, data_layout::column_major);
+        row_accessor<const Block> acc{ t };
+
+        const auto name = get_name<Origin, Block>("pull", row_count, column_count);
+        BENCHMARK(name.c_str()) {
+            return acc.pull({ 0, -1 });
+        };
+        report_throughput<Origin, Block>(name, row_count, column_count, [&]() {
+            acc.pull({ 0, -1 });
+        });
+    }
+
+    template <typename Origin, typename Block>
+    void run_push(std::int64_t row_count, std::int64_t column_count) {
+        auto data = array<Origin>::zeros(row_count * column_count);
+        dal::detail::homogen_table_builder b;
+        b.reset(data, row_count, column_count).set_layout(data_layout::column_major);
+        row_accessor<Block> acc{ b };
+
+        auto rows = array<Block>::empty(row_count * column_count);
+        fill(rows);
+
+        const auto name = get_name<Origin, Block>("push", row_count, column_count);
+        BENCHMARK(name.c_str()) {
+            acc.push(rows, { 0, -1 });
+        };
+        report_throughput<Origin, Block>(name, row_count, column_count, [&]() {
+            acc.push(rows, { 0, -1 });
+        });
+    }
+
+private:
+    template <typename T>
+    static void fill(array<T>& data) {
+        T* ptr = data.get_mutable_data();
+        for (std::int64_t i = 0; i < data.get_count(); i++) {
+            ptr[i] = T(i % 1000);
+        }
+    }
+
+    template <typename Origin, typename Block>
+    static std::string get_name(const char* op,
+                                std::int64_t row_count,
+                                std::int64_t column_count) {
+        return fmt::format("Column-major {} {} -> {}: row_count {}, column_count {}",
+                           op,
+                           sizeof(Origin),
+                           sizeof(Block),
+                           row_count,
+                           column_count);
+    }
+
+    /// Prints the best of several runs as the number of bytes read and written per second
+    template <typename Origin, typename Block, typename Op>
+    static void report_throughput(const std::string& name,
+                                  std::int64_t row_count,
+                                  std::int64_t column_count,
+                                  Op&& op) {
+        constexpr std::int64_t run_count = 10;
+        double best_time = std::numeric_limits<double>::max();
+        for (std::int64_t i = 0; i < run_count; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            op();
+            const auto end = std::chrono::steady_clock::now();
+            best_time = std::min(best_time, std::chrono::duration<double>(end - start).count());
+        }
+        const double byte_count =
+            double(row_count * column_count) * double(sizeof(Origin) + sizeof(Block));
+        fmt::print("{}: {:.2f} GB/s\n", name, byte_count / best_time * 1e-9);
+    }
+};
+
+TEST_M(homogen_perf_test, "column-major pull perf test", "[homogen][pull][weekly][perf]") {
+    const std::int64_t row_count = GENERATE(100000, 1000000);
+    const std::int64_t column_count = GENERATE(10, 100);
+
+    this->run_pull<float, float>(row_count, column_count);
+    this->run_pull<double, float>(row_count, column_count);
+    this->run_pull<std::int32_t, float>(row_count, column_count);
+    this->run_pull<double, double>(row_count, column_count);
+}
+
+TEST_M(homogen_perf_test, "column-major push perf test", "[homogen][push][weekly][perf]") {
+    const std::int64_t row_count = GENERATE(100000, 1000000);
+    const std::int64_t column_count = GENERATE(10, 100);
+
+    this->run_push<float, float>(row_count, column_count);
+    this->run_push<float, double>(row_count, column_count);
+    this->run_push<double, double>(row_count, column_count);
+}
+
+} // namespace oneapi::dal::test
@@ -37,3 +37,33 @@ TEST("SOA adapter is used") {
 
     REQUIRE(dynamic_cast<backend::interop::host_soa_table_adapter*>(dt.get()) != nullptr);
 }
+
+TEST("SOA adapter is used for columnar table without missing values") {
+    float float_data[] = { 1.f, 2.f, 3.f };
+    double double_data[] = { 4.0, 5.0, 6.0 };
+
+    const auto t = detail::columnar_table_builder{}
+                       .add_column(array<float>::wrap(float_data, 3))
+                       .add_column(array<double>::wrap(double_data, 3))
+                       .build();
+    auto dt = backend::interop::convert_to_daal_table<float>(table{ t });
+
+    REQUIRE(dynamic_cast<backend::interop::host_soa_table_adapter*>(dt.get()) != nullptr);
+
+    daal::data_management::BlockDescriptor<float> block;
+    dt->getBlockOfColumnValues(1, 0, 3, daal::data_management::readOnly, block);
+    REQUIRE(block.getBlockPtr()[2] == 6.f);
+    dt->releaseBlockOfColumnValues(block);
+}
+
+TEST("Columnar table with missing values is copied") {
+    float data[] = { 1.f, 2.f, 3.f };
+    byte_t validity[] = { 0x5 };
+
+    const auto t = detail::columnar_table_builder{}
+                       .add_column(array<float>::wrap(data, 3), array<byte_t>::wrap(validity, 1))
+                       .build();
+    auto dt = backend::interop::convert_to_daal_table<float>(table{ t });
+
+    REQUIRE(dynamic_cast<backend::interop::host_soa_table_adapter*>(dt.get()) == nullptr);
+}
@@ -70,3 +70,29 @@ TEST("can construct table") {
 
     REQUIRE(t.get_data<float>() == data);
 }
+
+TEST("can allocate NUMA-local table") {
+    constexpr std::int64_t row_count = 1000;
+    constexpr std::int64_t column_count = 3;
+
+    auto builder = detail::homogen_table_builder{};
+    builder.set_data_type(data_type::float32).allocate_numa_local(row_count, column_count);
+    {
+        row_accessor<float> acc{ builder };
+        auto rows = acc.pull();
+        float* rows_data = rows.need_mutable_data().get_mutable_data();
+        for (std::int64_t i = 0; i < rows.get_count(); i++) {
+            rows_data[i] = float(i);
+        }
+        acc.push(rows);
+    }
+    homogen_table t = builder.build();
+
+    REQUIRE(t.get_row_count() == row_count);
+    REQUIRE(t.get_column_count() == column_count);
+
+    const float* data = t.get_data<float>();
+    for (std::int64_t i = 0; i < row_count * column_count; i++) {
+        REQUIRE(data[i] == float(i));
+    }
+}
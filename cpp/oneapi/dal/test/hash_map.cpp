@@ -17,6 +17,7 @@
 #include <string>
 #include "oneapi/dal/test/engine/common.hpp"
 #include "oneapi/dal/detail/hash_map.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 
 namespace oneapi::dal::test {
 
@@ -94,4 +95,93 @@ TEST("can insert duplicated keys", "[insert_duplicates]") {
     REQUIRE(map.get("key") == "value_2");
 }
 
+TEST("hash_map grows when number of keys exceeds capacity", "[insert_unique]") {
+    const std::int64_t count = 100000;
+    detail::hash_map<std::int64_t, std::int64_t> map{ 1 };
+
+    for (std::int64_t i = 0; i < count; i++) {
+        map.set(i * 4, i);
+    }
+
+    REQUIRE(map.get_count() == count);
+    REQUIRE(map.get_capacity() >= count);
+    for (std::int64_t i = 0; i < count; i++) {
+        CAPTURE(i);
+        REQUIRE(map.get(i * 4) == i);
+        REQUIRE_FALSE(map.has(i * 4 + 1));
+    }
+}
+
+TEST("hash_map find returns nullptr for missing key", "[find]") {
+    test_hash_map_t map{ 10 };
+    map.set("key", "value");
+
+    REQUIRE(map.find("missing") == nullptr);
+    REQUIRE(*map.find("key") == "value");
+    REQUIRE_THROWS_AS(map.get("missing"), invalid_argument);
+}
+
+TEST("hash_map reserve keeps inserted keys", "[reserve]") {
+    test_hash_map_t map{ 4 };
+    for (std::int64_t i = 0; i < 4; i++) {
+        map.set(fmt::format("key_{}", i), fmt::format("value_{}", i));
+    }
+
+    map.reserve(1000);
+
+    REQUIRE(map.get_capacity() >= 1000);
+    REQUIRE(map.get_count() == 4);
+    for (std::int64_t i = 0; i < 4; i++) {
+        REQUIRE(map.get(fmt::format("key_{}", i)) == fmt::format("value_{}", i));
+    }
+}
+
+TEST("hash_map for_each visits each key once", "[for_each]") {
+    const std::int64_t count = 1000;
+    detail::hash_map<std::int32_t, std::int32_t> map{ 16 };
+    for (std::int32_t i = 0; i < count; i++) {
+        map.set(i, -i);
+    }
+
+    std::vector<std::int32_t> visited(count, 0);
+    map.for_each([&](std::int32_t key, std::int32_t value) {
+        REQUIRE(value == -key);
+        visited[key]++;
+    });
+
+    for (std::int64_t i = 0; i < count; i++) {
+        REQUIRE(visited[i] == 1);
+    }
+}
+
+TEST("can insert keys to hash_map concurrently", "[insert_concurrent]") {
+    const std::int32_t count = 100000;
+    const std::int32_t unique_count = count / 4;
+    detail::hash_map<std::int32_t, std::int32_t> map{ unique_count };
+
+    std::atomic<std::int32_t> inserted_count{ 0 };
+    detail::threader_for(count, count, [&](std::int32_t i) {
+        if (map.insert_concurrent(i % unique_count, i % unique_count + 1)) {
+            inserted_count++;
+        }
+    });
+
+    REQUIRE(inserted_count == unique_count);
+    REQUIRE(map.get_count() == unique_count);
+    for (std::int32_t i = 0; i < unique_count; i++) {
+        CAPTURE(i);
+        REQUIRE(map.get(i) == i + 1);
+    }
+}
+
+TEST("hash_map concurrent insert throws if capacity is exceeded", "[insert_concurrent]") {
+    detail::hash_map<std::int32_t, std::int32_t> map{ 8 };
+    for (std::int32_t i = 0; i < map.get_capacity(); i++) {
+        REQUIRE(map.insert_concurrent(i, i));
+    }
+
+    REQUIRE_FALSE(map.insert_concurrent(0, 0));
+    REQUIRE_THROWS_AS(map.insert_concurrent(-1, 0), out_of_range);
+}
+
 } // namespace oneapi::dal::test
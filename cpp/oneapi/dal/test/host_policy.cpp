@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::test {
+
+TEST("host_policy does not limit threads by default", "[policy]") {
+    const detail::host_policy policy;
+    REQUIRE(policy.get_max_thread_count() == 0);
+    REQUIRE(policy.get_cpu_set().empty());
+    REQUIRE(policy.get_numa_node() < 0);
+}
+
+TEST("host_policy keeps placement settings", "[policy]") {
+    detail::host_policy policy;
+    policy.set_max_thread_count(2).set_cpu_set({ 0, 1 }).set_numa_node(0);
+
+    REQUIRE(policy.get_max_thread_count() == 2);
+    REQUIRE(policy.get_cpu_set() == std::vector<std::int32_t>{ 0, 1 });
+    REQUIRE(policy.get_numa_node() == 0);
+}
+
+TEST("host_policy throws on invalid placement settings", "[policy]") {
+    detail::host_policy policy;
+    REQUIRE_THROWS_AS(policy.set_max_thread_count(-1), invalid_argument);
+    REQUIRE_THROWS_AS(policy.set_cpu_set({ 0, -1 }), invalid_argument);
+    REQUIRE_THROWS_AS(policy.set_numa_node(-1), invalid_argument);
+}
+
+TEST("parallel loops run on not more threads than the policy allows", "[policy]") {
+    detail::host_policy policy;
+    policy.set_max_thread_count(1);
+
+    std::int32_t max_threads = 0;
+    std::atomic<std::int32_t> iteration_count = 0;
+    policy.execute([&]() {
+        max_threads = detail::threader_get_max_threads();
+        detail::threader_for(1000, 1000, [&](std::int32_t i) {
+            iteration_count++;
+        });
+    });
+
+    REQUIRE(max_threads == 1);
+    REQUIRE(iteration_count == 1000);
+}
+
+TEST("host_policy can be changed while a computation runs in its arena", "[policy]") {
+    detail::host_policy policy;
+    policy.set_max_thread_count(1);
+
+    std::int32_t max_threads = 0;
+    std::atomic<std::int32_t> iteration_count = 0;
+    policy.execute([&]() {
+        // Resets the arena the computation runs in
+        policy.set_max_thread_count(2);
+        max_threads = detail::threader_get_max_threads();
+        detail::threader_for(1000, 1000, [&](std::int32_t i) {
+            iteration_count++;
+        });
+    });
+
+    REQUIRE(max_threads == 1);
+    REQUIRE(iteration_count == 1000);
+
+    policy.execute([&]() {
+        max_threads = detail::threader_get_max_threads();
+    });
+    REQUIRE(max_threads <= 2);
+}
+
+TEST("exceptions thrown in the arena are rethrown to the caller", "[policy]") {
+    detail::host_policy policy;
+    policy.set_max_thread_count(2);
+
+    const auto throwing_op = []() -> std::int32_t {
+        throw invalid_argument{ "exception from the arena" };
+    };
+    REQUIRE_THROWS_AS(backend::execute_in_arena(policy, throwing_op), invalid_argument);
+
+    const auto result = backend::execute_in_arena(policy, []() {
+        return std::int32_t(42);
+    });
+    REQUIRE(result == 42);
+}
+
+} // namespace oneapi::dal::test
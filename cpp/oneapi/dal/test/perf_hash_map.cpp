@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/detail/hash_map.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::test {
+
+/// Chained hash map with fixed number of buckets and allocation per entry.
+/// It is the previous implementation of `detail::hash_map` kept as a baseline
+template <typename Key, typename Value>
+class chained_hash_map {
+public:
+    explicit chained_hash_map(std::int64_t capacity) : buckets_(capacity, nullptr) {}
+
+    ~chained_hash_map() {
+        for (entry* current : buckets_) {
+            while (current) {
+                entry* next = current->next;
+                delete current;
+                current = next;
+            }
+        }
+    }
+
+    bool has(const Key& key) const {
+        for (entry* current = buckets_[get_index(key)]; current; current = current->next) {
+            if (current->key == key) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void set(const Key& key, const Value& value) {
+        entry*& head = buckets_[get_index(key)];
+        for (entry* current = head; current; current = current->next) {
+            if (current->key == key) {
+                current->value = value;
+                return;
+            }
+        }
+        head = new entry{ head, key, value };
+    }
+
+private:
+    struct entry {
+        entry* next;
+        Key key;
+        Value value;
+    };
+
+    std::int64_t get_index(const Key& key) const {
+        return std::hash<Key>{}(key) % buckets_.size();
+    }
+
+    std::vector<entry*> buckets_;
+};
+
+class hash_map_perf_test {
+public:
+    using key_t = std::int64_t;
+    using value_t = std::int64_t;
+
+    void generate(std::int64_t key_count) {
+        std::mt19937_64 rng(7777);
+        std::uniform_int_distribution<key_t> uniform(0, key_count * 4);
+        keys_.resize(key_count);
+        for (auto& key : keys_) {
+            key = uniform(rng);
+        }
+    }
+
+    template <typename Map>
+    std::int64_t insert_and_lookup(Map& map) const {
+        for (const key_t key : keys_) {
+            map.set(key, key);
+        }
+        std::int64_t found_count = 0;
+        for (const key_t key : keys_) {
+            found_count += std::int64_t(map.has(key + 1));
+        }
+        return found_count;
+    }
+
+    void run_flat_hash_map() const {
+        BENCHMARK(get_name("flat hash_map").c_str()) {
+            // Small initial capacity to include the cost of growing
+            detail::hash_map<key_t, value_t> map{ 16 };
+            return insert_and_lookup(map);
+        };
+    }
+
+    void run_concurrent_flat_hash_map() const {
+        BENCHMARK(get_name("flat hash_map, concurrent insert").c_str()) {
+            const std::int32_t key_count = detail::integral_cast<std::int32_t>(keys_.size());
+            detail::hash_map<key_t, value_t> map{ key_count };
+            detail::threader_for(key_count, key_count, [&](std::int32_t i) {
+                map.insert_concurrent(keys_[i], keys_[i]);
+            });
+            return map.get_count();
+        };
+    }
+
+    void run_chained_hash_map() const {
+        BENCHMARK(get_name("chained hash_map").c_str()) {
+            // The number of buckets is fixed, as the chained map is never rehashed
+            chained_hash_map<key_t, value_t> map{ 1024 };
+            return insert_and_lookup(map);
+        };
+    }
+
+    void run_unordered_map() const {
+        BENCHMARK(get_name("std::unordered_map").c_str()) {
+            std::unordered_map<key_t, value_t> map;
+            std::int64_t found_count = 0;
+            for (const key_t key : keys_) {
+                map[key] = key;
+            }
+            for (const key_t key : keys_) {
+                found_count += std::int64_t(map.count(key + 1));
+            }
+            return found_count;
+        };
+    }
+
+private:
+    std::string get_name(const std::string& map_name) const {
+        return fmt::format("{}: key_count {}", map_name, keys_.size());
+    }
+
+    std::vector<key_t> keys_;
+};
+
+TEST_M(hash_map_perf_test, "hash_map perf test", "[hash_map][weekly][perf]") {
+    const std::int64_t key_count = GENERATE(1000, 100000, 1000000);
+
+    this->generate(key_count);
+    this->run_flat_hash_map();
+    this->run_concurrent_flat_hash_map();
+    this->run_chained_hash_map();
+    this->run_unordered_map();
+}
+
+} // namespace oneapi::dal::test
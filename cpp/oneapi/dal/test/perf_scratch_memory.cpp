@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/detail/memory.hpp"
+
+namespace oneapi::dal::test {
+
+/// Compares the scratch arena with the default host allocation on the pattern of
+/// the small-batch inference: a few buffers of different sizes allocated and
+/// freed on each iteration
+class scratch_memory_perf_test {
+public:
+    void generate(std::int64_t buffer_size) {
+        sizes_ = { buffer_size, buffer_size / 2 + 1, buffer_size * 2, 16 };
+    }
+
+    void run_default_malloc() const {
+        BENCHMARK(get_name("detail::malloc").c_str()) {
+            return allocate_and_free(
+                [](std::int64_t count) {
+                    return detail::malloc<float>(detail::default_host_policy{}, count);
+                },
+                [](float* ptr) {
+                    detail::free(detail::default_host_policy{}, ptr);
+                });
+        };
+    }
+
+    void run_scratch_malloc() const {
+        BENCHMARK(get_name("detail::scratch_malloc").c_str()) {
+            return allocate_and_free(
+                [](std::int64_t count) {
+                    return detail::scratch_malloc<float>(detail::default_host_policy{}, count);
+                },
+                [](float* ptr) {
+                    detail::scratch_free(detail::default_host_policy{}, ptr);
+                });
+        };
+    }
+
+private:
+    template <typename Allocate, typename Free>
+    float allocate_and_free(Allocate&& allocate, Free&& free) const {
+        float sum = 0;
+        std::vector<float*> buffers(sizes_.size());
+        for (std::int64_t iteration = 0; iteration < iteration_count_; iteration++) {
+            for (std::size_t i = 0; i < sizes_.size(); i++) {
+                buffers[i] = allocate(sizes_[i]);
+                buffers[i][0] = float(i);
+            }
+            for (std::size_t i = 0; i < sizes_.size(); i++) {
+                sum += buffers[i][0];
+                free(buffers[i]);
+            }
+        }
+        return sum;
+    }
+
+    std::string get_name(const std::string& allocator_name) const {
+        return fmt::format("{}: buffer_size {}, iteration_count {}",
+                           allocator_name,
+                           sizes_[0],
+                           iteration_count_);
+    }
+
+    std::vector<std::int64_t> sizes_;
+    const std::int64_t iteration_count_ = 1000;
+};
+
+TEST_M(scratch_memory_perf_test, "scratch memory perf test", "[memory][weekly][perf]") {
+    const std::int64_t buffer_size = GENERATE(64, 4096, 262144);
+
+    this->generate(buffer_size);
+    this->run_default_malloc();
+    this->run_scratch_malloc();
+}
+
+} // namespace oneapi::dal::test
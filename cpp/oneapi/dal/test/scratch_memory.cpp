@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/detail/memory.hpp"
+
+namespace oneapi::dal::test {
+
+TEST("scratch memory is aligned", "[memory]") {
+    const std::int64_t count = GENERATE(1, 15, 1000, 10000000);
+    float* ptr = detail::scratch_malloc<float>(detail::default_host_policy{}, count);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(ptr) % 64 == 0);
+
+    ptr[0] = 1.0f;
+    ptr[count - 1] = 2.0f;
+    detail::scratch_free(detail::default_host_policy{}, ptr);
+}
+
+TEST("freed scratch memory is reused by the same thread", "[memory]") {
+    detail::scratch_scope scope;
+
+    // Both sizes fall into the same size class of the arena
+    float* first = detail::scratch_malloc<float>(detail::default_host_policy{}, 100);
+    REQUIRE(first != nullptr);
+    detail::scratch_free(detail::default_host_policy{}, first);
+
+    float* second = detail::scratch_malloc<float>(detail::default_host_policy{}, 120);
+    REQUIRE(second == first);
+    detail::scratch_free(detail::default_host_policy{}, second);
+}
+
+TEST("host_scratch_allocator allocates writable memory", "[memory]") {
+    constexpr std::int64_t count = 100;
+    const detail::host_scratch_allocator<float> alloc;
+    float* data = alloc.allocate(count);
+    REQUIRE(data != nullptr);
+    for (std::int64_t i = 0; i < count; i++) {
+        data[i] = float(i);
+    }
+    REQUIRE(data[count - 1] == float(count - 1));
+    alloc.deallocate(data, count);
+}
+
+} // namespace oneapi::dal::test
@@ -32,8 +32,9 @@ def daal_module(name, features=[], lib_tag="daal",
                 hdrs=[], srcs=[], auto=False,
                 opencl=False, **kwargs):
     if auto:
-        auto_hdrs = native.glob(["**/*.h", "**/*.i"])
-        auto_srcs = native.glob(["**/*.cpp"])
+        test_filt = ["**/test/**"]
+        auto_hdrs = native.glob(["**/*.h", "**/*.i"], exclude=test_filt)
+        auto_srcs = native.glob(["**/*.cpp"], exclude=test_filt)
         if opencl:
             auto_hdrs += native.glob(["**/*.cl"])
     else:
@@ -0,0 +1,151 @@
+/* file: async_saga_sgd_log_loss_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the asynchronous SAGA and SGD algorithms that compares
+!    the convergence against wall-clock time with the sequential algorithms
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-ASYNC_SAGA_SGD_LOG_LOSS_DENSE_BATCH"></a>
+ * \example async_saga_sgd_log_loss_dense_batch.cpp
+ */
+
+#include <chrono>
+#include <iomanip>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::algorithms::optimization_solver;
+
+string datasetFileName = "../data/batch/binary_cls_train.csv";
+
+const size_t nFeatures          = 20;
+const size_t nParameters        = nFeatures + 1;
+const size_t nIterationsSteps[] = { 10000, 40000, 160000, 640000 };
+const size_t nIndexStreams      = 8; /* Number of streams of term indices in the deterministic asynchronous mode */
+const float sgdLearningRate     = 1.0e-5f;
+const double accuracyThreshold  = 0.0;
+const float penaltyL2           = 0.001f;
+
+services::SharedPtr<logistic_loss::Batch<> > createLoss(const NumericTablePtr & data, const NumericTablePtr & dependentVariables)
+{
+    services::SharedPtr<logistic_loss::Batch<> > loss(new logistic_loss::Batch<>(data->getNumberOfRows()));
+    loss->input.set(logistic_loss::data, data);
+    loss->input.set(logistic_loss::dependentVariables, dependentVariables);
+    loss->parameter().penaltyL2     = penaltyL2;
+    loss->parameter().interceptFlag = true;
+    return loss;
+}
+
+float computeObjective(const NumericTablePtr & data, const NumericTablePtr & dependentVariables, const NumericTablePtr & argument)
+{
+    services::SharedPtr<logistic_loss::Batch<> > loss = createLoss(data, dependentVariables);
+    loss->parameter().resultsToCompute                = objective_function::value;
+    loss->input.set(logistic_loss::argument, argument);
+    checkStatus(loss->compute());
+
+    BlockDescriptor<float> block;
+    NumericTablePtr value = loss->getResult()->get(objective_function::valueIdx);
+    value->getBlockOfRows(0, 1, readOnly, block);
+    const float result = block.getBlockPtr()[0];
+    value->releaseBlockOfRows(block);
+    return result;
+}
+
+/* Runs the solver and prints the time it has taken and the objective function value at the computed minimum */
+template <typename Solver>
+void runSolver(const char * name, size_t nIterations, Solver & solver, const NumericTablePtr & data, const NumericTablePtr & dependentVariables)
+{
+    float initialPoint[nParameters] = { 0 };
+    services::Status s;
+    solver.input.set(iterative_solver::inputArgument, HomogenNumericTable<>::create(initialPoint, 1, nParameters, &s));
+    checkStatus(s);
+
+    const auto start = chrono::steady_clock::now();
+    checkStatus(solver.compute());
+    const auto end = chrono::steady_clock::now();
+
+    const double time     = chrono::duration<double, milli>(end - start).count();
+    const float objective = computeObjective(data, dependentVariables, solver.getResult()->get(iterative_solver::minimum));
+    cout << setw(24) << left << name << setw(12) << right << nIterations << setw(14) << fixed << setprecision(2) << time
+         << setw(14) << setprecision(6) << objective << endl;
+}
+
+void runSaga(const char * name, size_t nIterations, bool asynchronous, size_t nStreams, const NumericTablePtr & data,
+             const NumericTablePtr & dependentVariables)
+{
+    saga::Batch<> solver(createLoss(data, dependentVariables));
+    solver.parameter().nIterations       = nIterations;
+    solver.parameter().accuracyThreshold = accuracyThreshold;
+    solver.parameter().batchSize         = 1;
+    solver.parameter().asynchronous      = asynchronous;
+    solver.parameter().nStreams          = nStreams;
+    runSolver(name, nIterations, solver, data, dependentVariables);
+}
+
+void runSgd(const char * name, size_t nIterations, bool asynchronous, size_t nStreams, const NumericTablePtr & data,
+            const NumericTablePtr & dependentVariables)
+{
+    sgd::Batch<> solver(createLoss(data, dependentVariables));
+    services::Status s;
+    solver.parameter.learningRateSequence = HomogenNumericTable<>::create(1, 1, NumericTable::doAllocate, sgdLearningRate, &s);
+    checkStatus(s);
+    solver.parameter.nIterations       = nIterations;
+    solver.parameter.accuracyThreshold = accuracyThreshold;
+    solver.parameter.asynchronous      = asynchronous;
+    solver.parameter.nStreams          = nStreams;
+    runSolver(name, nIterations, solver, data, dependentVariables);
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for data and values for dependent variable */
+    services::Status s;
+    NumericTablePtr data = HomogenNumericTable<>::create(nFeatures, 0, NumericTable::doNotAllocate, &s);
+    checkStatus(s);
+    NumericTablePtr dependentVariables = HomogenNumericTable<>::create(1, 0, NumericTable::doNotAllocate, &s);
+    checkStatus(s);
+    NumericTablePtr mergedData = MergedNumericTable::create(data, dependentVariables, &s);
+    checkStatus(s);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock(mergedData.get());
+
+    cout << setw(24) << left << "Solver" << setw(12) << right << "Iterations" << setw(14) << "Time, ms" << setw(14) << "Objective" << endl;
+    for (size_t nIterations : nIterationsSteps)
+    {
+        runSaga("SAGA sequential", nIterations, false, 0, data, dependentVariables);
+        runSaga("SAGA asynchronous", nIterations, true, 0, data, dependentVariables);
+        runSaga("SAGA async, streams", nIterations, true, nIndexStreams, data, dependentVariables);
+        runSgd("SGD sequential", nIterations, false, 0, data, dependentVariables);
+        runSgd("SGD asynchronous", nIterations, true, 0, data, dependentVariables);
+        runSgd("SGD async, streams", nIterations, true, nIndexStreams, data, dependentVariables);
+    }
+
+    return 0;
+}